@@ -223,6 +223,15 @@ namespace App {
 		return uint64(uint32(user_id));
 	}
 	
+	MsgId idFromMessage(const MTPmessage &msg) {
+		switch (msg.type()) {
+		case mtpc_messageEmpty: return msg.c_messageEmpty().vid.v;
+		case mtpc_message: return msg.c_message().vid.v;
+		case mtpc_messageService: return msg.c_messageService().vid.v;
+		}
+		return 0;
+	}
+
 	MTPpeer peerToMTP(const PeerId &peer_id) {
 		return (peer_id & 0x100000000L) ? MTP_peerChat(MTP_int(int32(peer_id & 0xFFFFFFFFL))) : MTP_peerUser(MTP_int(int32(peer_id & 0xFFFFFFFFL)));
 	}
@@ -809,6 +818,8 @@ namespace App {
 	}
 
 	void feedWereDeleted(const QVector<MTPint> &msgsIds) {
+		Local::removeHistoryMessages(msgsIds);
+
 		bool resized = false;
 		for (QVector<MTPint>::const_iterator i = msgsIds.cbegin(), e = msgsIds.cend(); i != e; ++i) {
 			MsgsData::const_iterator j = msgsData.constFind(i->v);
@@ -818,6 +829,8 @@ namespace App {
 				if (App::main() && h->peer == App::main()->peer()) {
 					resized = true;
 				}
+			} else {
+				Local::unindexMessage(i->v);
 			}
 		}
 		if (resized) {
@@ -908,7 +921,7 @@ namespace App {
 	}
 
 	void emitPeerUpdated() {
-		if (!updatedPeers.isEmpty() && App::main()) {
+		if (!updatedPeers.isEmpty() && App::main() && !App::main()->responsesBatched()) { // batched updates are emitted when the batch ends
 			UpdatedPeers upd = updatedPeers;
 			updatedPeers.clear();
 
@@ -1563,7 +1576,7 @@ namespace App {
 	History *history(const PeerId &peer, int32 unreadCnt, int32 maxInboxRead) {
 		Histories::const_iterator i = ::histories.constFind(peer);
 		if (i == ::histories.cend()) {
-			i = App::histories().insert(peer, new History(peer));
+			i = App::histories().insert(peer, new History(App::peer(peer)));
 			i.value()->setUnreadCount(unreadCnt, false);
 			if (maxInboxRead) {
 				i.value()->inboxReadTill = maxInboxRead;
@@ -1965,8 +1978,11 @@ namespace App {
 	void checkImageCacheSize() {
 		int64 nowImageCacheSize = imageCacheSize();
 		if (nowImageCacheSize > serviceImageCacheSize + MemoryForImageCache) {
-			App::forgetMedia();
-			serviceImageCacheSize = imageCacheSize();
+			DEBUG_LOG(("App Info: image cache size %1, painted history messages size %2, forgetting images..").arg(nowImageCacheSize).arg(historyItemRastersSize()));
+			if (!forgetImages(nowImageCacheSize - serviceImageCacheSize - MemoryForImageCache / 2)) {
+				App::forgetMedia();
+				serviceImageCacheSize = imageCacheSize();
+			}
 		}
 	}
 
@@ -99,6 +99,7 @@ namespace App {
 		return peerFromUser(user_id.v);
 	}
 	MTPpeer peerToMTP(const PeerId &peer_id);
+	MsgId idFromMessage(const MTPmessage &msg);
     int32 userFromPeer(const PeerId &peer_id);
     int32 chatFromPeer(const PeerId &peer_id);
 
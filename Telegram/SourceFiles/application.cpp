@@ -48,6 +48,16 @@ namespace {
 		}
 	}
 
+	void mtpResponsesBatch(bool started) {
+		if (App::main()) {
+			if (started) {
+				App::main()->startResponsesBatch();
+			} else {
+				App::main()->finishResponsesBatch();
+			}
+		}
+	}
+
 	class EventFilterForKeys : public QObject {
 	public:
 
@@ -697,6 +707,7 @@ void Application::startApp() {
 
 	MTP::setStateChangedHandler(mtpStateChanged);
 	MTP::setSessionResetHandler(mtpSessionReset);
+	MTP::setResponsesBatchHandler(mtpResponsesBatch);
 
 	DEBUG_LOG(("Application Info: MTP started.."));
 
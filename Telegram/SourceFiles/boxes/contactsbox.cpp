@@ -150,10 +150,11 @@ void ContactsInner::loadProfilePhotos(int32 yFrom) {
 	if (_filter.isEmpty()) {
 		if (_contacts->list.count) {
 			_contacts->list.adjustCurrent(yFrom, rh);
+			DialogRow *preloadFrom = _contacts->list.current;
 			for (
-				DialogRow *preloadFrom = _contacts->list.current;
-				preloadFrom != _contacts->list.end && preloadFrom->pos * rh < yTo;
-				preloadFrom = preloadFrom->next
+				int32 pos = preloadFrom->pos();
+				preloadFrom != _contacts->list.end && pos * rh < yTo;
+				preloadFrom = preloadFrom->next, ++pos
 			) {
 				preloadFrom->history->peer->photo->load();
 			}
@@ -273,11 +274,13 @@ void ContactsInner::paintEvent(QPaintEvent *e) {
 				_contacts->list.adjustCurrent(yFrom, rh);
 
 				DialogRow *drawFrom = _contacts->list.current;
-				p.translate(0, drawFrom->pos * rh);
-				while (drawFrom != _contacts->list.end && drawFrom->pos * rh < yTo) {
+				int32 pos = drawFrom->pos();
+				p.translate(0, pos * rh);
+				while (drawFrom != _contacts->list.end && pos * rh < yTo) {
 					paintDialog(p, drawFrom->history->peer, contactData(drawFrom), (drawFrom == _sel));
 					p.translate(0, rh);
 					drawFrom = drawFrom->next;
+					++pos;
 				}
 			}
 			if (!_byUsername.isEmpty()) {
@@ -818,7 +821,8 @@ void ContactsInner::selectSkip(int32 dir) {
 			}
 		}
 		if (_sel) {
-			emit mustScrollTo(_sel->pos * rh, (_sel->pos + 1) * rh);
+			int32 pos = _sel->pos();
+			emit mustScrollTo(pos * rh, (pos + 1) * rh);
 		} else if (_byUsernameSel >= 0) {
 			emit mustScrollTo((_contacts->list.count + _byUsernameSel) * rh + st::searchedBarHeight, (_contacts->list.count + _byUsernameSel + 1) * rh + st::searchedBarHeight);
 		}
@@ -32,6 +32,8 @@ static const wchar_t *AppFile = L"Telegram";
 enum {
 	MTPShortBufferSize = 65535, // of ints, 256 kb
 	MTPPacketSizeMax = 67108864, // 64 mb
+	MTPReceiveBuffersPoolSize = 32, // received packet buffers kept for reuse, see mtpAcquireBuffer()
+	MTPReceiveBufferPooledMax = 131072, // of ints, 512 kb - larger received buffers are freed
 	MTPIdsBufferSize = 400, // received msgIds and wereAcked msgIds count stored
 	MTPCheckResendTimeout = 10000, // how much time passed from send till we resend request or check it's state, in ms
 	MTPCheckResendWaiting = 1000, // how much time to wait for some more requests, when resending request or checking it's state, in ms
@@ -54,6 +56,11 @@ enum {
 	MTPEnumDCTimeout = 4000, // 4 seconds timeout for help_getConfig to work (them move to other dc)
 
 	MTPDebugBufferSize = 1024 * 1024, // 1 mb start size
+	MTPArenaBlockSize = 64 * 1024, // 64 kb blocks for parsed response views
+
+	DebugLogRingSize = 2 * 1024 * 1024, // 2 mb of pending debug log records for each logging thread, must be a power of two
+	DebugLogWriteTimeout = 100, // debug log records are written to the files each 100 ms
+	DebugLogFileSizeLimit = 32 * 1024 * 1024, // start a new debug log file part after 32 mb
 
 	MTPPingDelayDisconnect = 60, // 1 min
 	MTPPingSendAfterAuto = 30, // send new ping starting from 30 seconds (add to existing container)
@@ -74,6 +81,7 @@ enum {
 	LocalEncryptKeySize = 256, // 2048 bit
 
 	AnimationTimerDelta = 7,
+	AnimationSuspendedTimeout = 200, // animations of hidden or minimized windows are checked 5 times a second
 
 	SaveRecentEmojisTimeout = 3000, // 3 secs
 	SaveWindowPositionTimeout = 1000, // 1 sec
@@ -105,6 +113,10 @@ enum {
 	StickerMaxSize = 2048, // 2048x2048 is a max image size for sticker
 
 	MediaViewImageSizeLimit = 100 * 1024 * 1024, // show up to 100mb jpg/png/gif docs in app
+	AnimatedGifFramesMin = 2, // decode at least 2 gif frames ahead
+	AnimatedGifFramesMax = 8, // and no more than 8 frames
+	AnimatedGifDecodeAhead = 200, // decode gif frames 200ms ahead of the playback
+	MediaViewPrefetchLimit = 64 * 1024 * 1024, // keep up to 64mb of neighbour photos decoded and scaled ahead
 	MaxZoomLevel = 7, // x8
 	ZoomToScreenLevel = 1024, // just constant
 
@@ -124,6 +136,19 @@ enum {
 	MaxHttpRedirects = 5, // when getting external data/images
 
 	WriteMapTimeout = 1000,
+	SearchIndexWriteTimeout = 10000, // messages search index is written not more than once in 10 secs
+	SearchIndexMessagesMax = 20000, // messages search index keeps 20000 newest messages
+	SearchIndexChunkSize = 500, // messages search index is written in files of 500 - 1000 messages, only the changed files are rewritten
+	LocalPackSegmentSize = 16 * 1024 * 1024, // start a new cache pack segment after 16mb appended to the current one
+	LocalPackCompactTimeout = 30000, // look for cache pack segments to compact 30 secs after the last cache write
+	LocalPackCompactWastePercent = 50, // compact a cache pack segment when half of it is overwritten or removed data
+	LocalStorageEvictTimeout = 5000, // evict least recently read cache items 5 secs after the cache went over its limit
+	LocalStorageEvictBatch = 256, // evict not more than 256 cache items at once, then let the event loop run
+	LocalStorageEvictPercent = 90, // evict until the cache size is 90% of its limit
+	LocalStorageAccessGranularity = 3600, // update cache item read time in the pack index not more than once an hour
+	DefaultStorageImagesLimit = 1024, // 1024mb of cached images
+	DefaultStorageStickersLimit = 256, // 256mb of cached stickers
+	DefaultStorageAudiosLimit = 512, // 512mb of cached voice messages
 	SaveDraftTimeout = 1000, // save draft after 1 secs of not changing text
 	SaveDraftAnywayTimeout = 5000, // or save anyway each 5 secs
 
@@ -295,13 +320,20 @@ enum {
 
 	MessagesFirstLoad = 30, // first history part size requested
 	MessagesPerPage = 50, // next history part size
+	LocalMessagesPagesMax = 10, // last 10 pages of MessagesPerPage messages of each chat are saved locally
+	HistoryLayoutAround = 2000, // history blocks 2000px around the scroll position are laid out at once on resize
+	HistoryLayoutSettleBlocks = 4, // other history blocks are laid out later, 4 blocks at a time
 
 	DownloadPartSize = 64 * 1024, // 64kb for photo
 	DocumentDownloadPartSize = 128 * 1024, // 128kb for document
 	MaxUploadPhotoSize = 32 * 1024 * 1024, // 32mb photos max
     MaxUploadDocumentSize = 1500 * 1024 * 1024, // 1500mb documents max
     UseBigFilesFrom = 10 * 1024 * 1024, // mtp big files methods used for files greater than 10mb
-	MaxFileQueries = 16, // max 16 file parts downloaded at the same time
+	MaxFileQueries = 16, // 16 file parts downloaded at the same time at start
+	MinFileQueries = 4, // then from 4
+	MaxFileQueriesAdaptive = 32, // to 32 parts at the same time, to keep twice the measured bandwidth-delay product in flight
+	DocumentDownloadPartSizeMax = 512 * 1024, // document part size grows from 128kb up to 512kb on fast links
+	DownloadStatsPeriod = 1000, // download throughput and rtt are measured each second
 
 	UploadPartSize = 32 * 1024, // 32kb for photo
     DocumentMaxPartsCount = 3000, // no more than 3000 parts
@@ -310,8 +342,12 @@ enum {
     DocumentUploadPartSize2 = 128 * 1024, // 128kb for small document ( <= 375mb )
     DocumentUploadPartSize3 = 256 * 1024, // 256kb for medium document ( <= 750mb )
     DocumentUploadPartSize4 = 512 * 1024, // 512kb for large document ( <= 1500mb )
-    MaxUploadFileParallelSize = MTPUploadSessionsCount * 512 * 1024, // max 512kb uploaded at the same time in each session
-    UploadRequestInterval = 500, // one part each half second, if not uploaded faster
+    UploadSessionWindowMin = 128 * 1024, // each upload session has from 128kb
+    UploadSessionWindowStart = 512 * 1024, // (512kb at start)
+    UploadSessionWindowMax = 2 * 1024 * 1024, // to 2mb uploading at the same time, depending on the ack latency
+    UploadAckFastLatency = 1000, // session window grows while parts are acked faster than 1 second
+    UploadAckSlowLatency = 4000, // and is halved when a part is acked slower than 4 seconds
+    UploadReadAheadSize = 8 * 1024 * 1024, // document parts are read from disk up to 8mb ahead of sending
 
 	MaxPhotosInMemory = 50, // try to clear some memory after 50 photos are created
 	NoUpdatesTimeout = 60 * 1000, // if nothing is received in 1 min we ping
@@ -319,6 +355,9 @@ enum {
 	WaitForSkippedTimeout = 1000, // 1s wait for skipped seq or pts in updates
 
 	MemoryForImageCache = 64 * 1024 * 1024, // after 64mb of unpacked images we try to clear some memory
+	ImageDecodeRequestTimeout = 1000, // drop background decoding of the images that were not painted for 1s
+	TextShapedLinesLimit = 2048, // keep shaped glyph runs of up to 2048 drawn text lines
+	HistoryItemRastersLimit = 16 * 1024 * 1024, // with -historyrasters keep up to 16mb of painted history messages for scrolling, 0 - paint them each time
 	NotifyWindowsCount = 3, // 3 desktop notifies at the same time
 	NotifySettingSaveTimeout = 1000, // wait 1 second before saving notify setting to server
 	UpdateChunk = 100 * 1024, // 100kb parts when downloading the update
@@ -365,7 +365,7 @@ void DialogsListWidget::onUpdateSelected(bool force) {
 			}
 		}
 		mouseY -= searchedOffset() - peopleOffset();
-		if (_state == SearchedState && !searchResults.isEmpty()) {
+		if (!searchResults.isEmpty()) { // found in the local index while still filtered or received from the server
 			int32 newSearchedSel = (mouseY >= 0) ? (mouseY / int32(st::dlgHeight)) : -1;
 			if (newSearchedSel < 0 || newSearchedSel >= searchResults.size()) {
 				newSearchedSel = -1;
@@ -417,14 +417,14 @@ void DialogsListWidget::createDialogAtTop(History *history, int32 unreadCount) {
 	history->updateNameText();
 
 	History::DialogLinks links = dialogs.addToEnd(history);
-	int32 movedFrom = links[0]->pos * st::dlgHeight;
+	int32 movedFrom = links[0]->pos() * st::dlgHeight;
 	dialogs.bringToTop(links);
 	history->dialogs = links;
 
 	contactsNoDialogs.del(history->peer, links[0]);
 
 	emit dialogToTopFrom(movedFrom);
-	emit App::main()->dialogsUpdated();
+	App::main()->dialogsReordered();
 
 	refresh();
 }
@@ -463,7 +463,7 @@ void DialogsListWidget::removeContact(UserData *user) {
 
 void DialogsListWidget::dlgUpdated(DialogRow *row) {
 	if (_state == DefaultState) {
-		update(0, row->pos * st::dlgHeight, width(), st::dlgHeight);
+		update(0, row->pos() * st::dlgHeight, width(), st::dlgHeight);
 	} else if (_state == FilteredState || _state == SearchedState) {
 		int32 cnt = 0;
 		for (FilteredDialogs::const_iterator i = filterResults.cbegin(), e = filterResults.cend(); i != e; ++i) {
@@ -481,11 +481,11 @@ void DialogsListWidget::dlgUpdated(History *history) {
 		DialogRow *row = 0;
 		DialogsList::RowByPeer::iterator i = dialogs.list.rowByPeer.find(history->peer->id);
 		if (i != dialogs.list.rowByPeer.cend()) {
-			update(0, i.value()->pos * st::dlgHeight, width(), st::dlgHeight);
+			update(0, i.value()->pos() * st::dlgHeight, width(), st::dlgHeight);
 		} else {
 			i = contactsNoDialogs.list.rowByPeer.end();// find(history->peer->id);
 			if (i != contactsNoDialogs.list.rowByPeer.cend()) {
-				update(0, (dialogs.list.count + i.value()->pos) * st::dlgHeight, width(), st::dlgHeight);
+				update(0, (dialogs.list.count + i.value()->pos()) * st::dlgHeight, width(), st::dlgHeight);
 			}
 		}
 	} else if (_state == FilteredState || _state == SearchedState) {
@@ -546,10 +546,10 @@ void DialogsListWidget::onParentGeometryChanged() {
 }
 
 void DialogsListWidget::onDialogToTop(const History::DialogLinks &links) {
-	int32 movedFrom = links[0]->pos * st::dlgHeight;
+	int32 movedFrom = links[0]->pos() * st::dlgHeight;
 	dialogs.bringToTop(links);
 	emit dialogToTopFrom(movedFrom);
-	emit App::main()->dialogsUpdated();
+	App::main()->dialogsReordered();
 	parentWidget()->update();
 }
 
@@ -581,6 +581,7 @@ void DialogsListWidget::onFilterUpdate(QString newFilter, bool force) {
 			newFilter = f.join(' ');
 		}
 		if (newFilter != filter || force) {
+			bool narrow = !force && _state != DefaultState && !filter.isEmpty() && newFilter.startsWith(filter); // new results are some of the current ones
 			filter = newFilter;
 			if (!_searchInPeer && filter.isEmpty()) {
 				_state = DefaultState;
@@ -593,40 +594,12 @@ void DialogsListWidget::onFilterUpdate(QString newFilter, bool force) {
 				QStringList::const_iterator fb = f.cbegin(), fe = f.cend(), fi;
 
 				_state = FilteredState;
-				filterResults.clear();
 				if (!_searchInPeer && !f.isEmpty()) {
-					DialogsList *dialogsToFilter = 0, *contactsNoDialogsToFilter = 0;
-					if (dialogs.list.count) {
-						for (fi = fb; fi != fe; ++fi) {
-							DialogsIndexed::DialogsIndex::iterator i = dialogs.index.find(fi->at(0));
-							if (i == dialogs.index.cend()) {
-								dialogsToFilter = 0;
-								break;
-							}
-							if (!dialogsToFilter || dialogsToFilter->count > i.value()->count) {
-								dialogsToFilter = i.value();
-							}
-						}
-					}
-					if (contactsNoDialogs.list.count) {
-						for (fi = fb; fi != fe; ++fi) {
-							DialogsIndexed::DialogsIndex::iterator i = contactsNoDialogs.index.find(fi->at(0));
-							if (i == contactsNoDialogs.index.cend()) {
-								contactsNoDialogsToFilter = 0;
-								break;
-							}
-							if (!contactsNoDialogsToFilter || contactsNoDialogsToFilter->count > i.value()->count) {
-								contactsNoDialogsToFilter = i.value();
-							}
-						}
-					}
-					filterResults.reserve((dialogsToFilter ? dialogsToFilter->count : 0) + (contactsNoDialogsToFilter ? contactsNoDialogsToFilter->count : 0));
-					if (dialogsToFilter && dialogsToFilter->count) {
-						for (DialogRow *i = dialogsToFilter->begin, *e = dialogsToFilter->end; i != e; i = i->next) {
-							const PeerData::Names &names(i->history->peer->names);
+					if (narrow) {
+						for (FilteredDialogs::iterator i = filterResults.begin(); i != filterResults.end();) {
+							const PeerData::Names &names((*i)->history->peer->names);
 							PeerData::Names::const_iterator nb = names.cbegin(), ne = names.cend(), ni;
 							for (fi = fb; fi != fe; ++fi) {
-								QString filterName(*fi);
 								for (ni = nb; ni != ne; ++ni) {
 									if (ni->startsWith(*fi)) {
 										break;
@@ -637,31 +610,20 @@ void DialogsListWidget::onFilterUpdate(QString newFilter, bool force) {
 								}
 							}
 							if (fi == fe) {
-								filterResults.push_back(i);
-							}
-						}
-					}
-					if (contactsNoDialogsToFilter && contactsNoDialogsToFilter->count) {
-						for (DialogRow *i = contactsNoDialogsToFilter->begin, *e = contactsNoDialogsToFilter->end; i != e; i = i->next) {
-							const PeerData::Names &names(i->history->peer->names);
-							PeerData::Names::const_iterator nb = names.cbegin(), ne = names.cend(), ni;
-							for (fi = fb; fi != fe; ++fi) {
-								QString filterName(*fi);
-								for (ni = nb; ni != ne; ++ni) {
-									if (ni->startsWith(*fi)) {
-										break;
-									}
-								}
-								if (ni == ne) {
-									break;
-								}
-							}
-							if (fi == fe) {
-								filterResults.push_back(i);
+								++i;
+							} else {
+								i = filterResults.erase(i);
 							}
 						}
+					} else {
+						filterResults.clear();
+						dialogs.filter(f, filterResults);
+						contactsNoDialogs.filter(f, filterResults);
 					}
+				} else {
+					filterResults.clear();
 				}
+				searchIndexed();
 			}
 		}
 		refresh(true);
@@ -783,8 +745,54 @@ void DialogsListWidget::addAllSavedPeers() {
 	}
 }
 
+void DialogsListWidget::searchIndexed() {
+	clearSearchResults(false);
+	searchedCount = 0;
+	if (filter.isEmpty()) return;
+
+	QVector<MsgId> ids, load;
+	Local::searchIndexed(filter, _searchInPeer ? _searchInPeer->id : 0, SearchPerPage, ids);
+	for (QVector<MsgId>::const_iterator i = ids.cbegin(), e = ids.cend(); i != e; ++i) {
+		if (!App::histItemById(*i)) load.push_back(*i);
+	}
+	Local::loadIndexedMessages(load); // not loaded messages are shown when they are read, see indexedMessagesLoaded()
+
+	searchResults.reserve(ids.size());
+	for (QVector<MsgId>::const_iterator i = ids.cbegin(), e = ids.cend(); i != e; ++i) {
+		HistoryItem *item = App::histItemById(*i);
+		if (!item) {
+			MTPMessage msg;
+			if (Local::indexedMessageLoaded(*i, msg)) {
+				item = App::histories().addToBack(msg, -1);
+			}
+		}
+		if (item) {
+			searchResults.push_back(new FakeDialogRow(item));
+		}
+	}
+	searchedCount = searchResults.size();
+}
+
+void DialogsListWidget::indexedMessagesLoaded() {
+	if (_state != FilteredState) return;
+
+	MsgId selected = (searchedSel >= 0 && searchedSel < searchResults.size()) ? searchResults.at(searchedSel)->_item->id : 0;
+	searchIndexed();
+	searchedSel = -1;
+	for (int32 i = 0, l = selected ? searchResults.size() : 0; i < l; ++i) {
+		if (searchResults.at(i)->_item->id == selected) {
+			searchedSel = i;
+			break;
+		}
+	}
+	refresh();
+	if (selByMouse) onUpdateSelected(true);
+}
+
 void DialogsListWidget::searchReceived(const QVector<MTPMessage> &messages, bool fromStart, int32 fullCount) {
+	SearchResults indexed; // found in the local index before the server answered
 	if (fromStart) {
+		qSwap(indexed, searchResults);
 		clearSearchResults(false);
 	}
 	for (QVector<MTPMessage>::const_iterator i = messages.cbegin(), e = messages.cend(); i != e; ++i) {
@@ -793,6 +801,27 @@ void DialogsListWidget::searchReceived(const QVector<MTPMessage> &messages, bool
 		_lastSearchId = item->id;
 	}
 	searchedCount = fullCount;
+	if (!indexed.isEmpty()) {
+		// older indexed messages will come with the next server parts
+		bool all = (searchResults.size() >= fullCount);
+		QMap<MsgId, FakeDialogRow*> merged;
+		for (SearchResults::const_iterator i = searchResults.cbegin(), e = searchResults.cend(); i != e; ++i) {
+			merged.insert((*i)->_item->id, *i);
+		}
+		for (SearchResults::const_iterator i = indexed.cbegin(), e = indexed.cend(); i != e; ++i) {
+			if ((all || (*i)->_item->id > _lastSearchId) && !merged.contains((*i)->_item->id)) {
+				merged.insert((*i)->_item->id, *i);
+				++searchedCount;
+			} else {
+				delete *i;
+			}
+		}
+		searchResults.clear();
+		searchResults.reserve(merged.size());
+		for (QMap<MsgId, FakeDialogRow*>::const_iterator i = merged.cend(), b = merged.cbegin(); i != b;) {
+			searchResults.push_back(*(--i));
+		}
+	}
 	if (_state == FilteredState) {
 		_state = SearchedState;
 	}
@@ -844,13 +873,13 @@ int32 DialogsListWidget::addNewContact(int32 uid, bool select) {
 			contactSel = true;
 		}
 //		if (contactsNoDialogs.list.count == 1 && !dialogs.list.count) refresh();
-		return added ? ((dialogs.list.count + added->pos) * st::dlgHeight) : -1;
+		return added ? ((dialogs.list.count + added->pos()) * st::dlgHeight) : -1;
 	}
 	if (select) {
 		sel = i.value();
 		contactSel = false;
 	}
-	return i.value()->pos * st::dlgHeight;
+	return i.value()->pos() * st::dlgHeight;
 }
 
 void DialogsListWidget::refresh(bool toTop) {
@@ -989,7 +1018,7 @@ void DialogsListWidget::selectSkip(int32 direction) {
 				contactSel = false;
 			}
 		}
-		int32 fromY = (sel->pos + (contactSel ? dialogs.list.count : 0)) * st::dlgHeight;
+		int32 fromY = (sel->pos() + (contactSel ? dialogs.list.count : 0)) * st::dlgHeight;
 		emit mustScrollTo(fromY, fromY + st::dlgHeight);
 	} else if (_state == FilteredState || _state == SearchedState) {
 		if (hashtagResults.isEmpty() && filterResults.isEmpty() && peopleResults.isEmpty() && searchResults.isEmpty()) return;
@@ -1041,11 +1070,11 @@ void DialogsListWidget::scrollToPeer(const PeerId &peer, MsgId msgId) {
 	if (_state == DefaultState) {
 		DialogsList::RowByPeer::const_iterator i = dialogs.list.rowByPeer.constFind(peer);
 		if (i != dialogs.list.rowByPeer.cend()) {
-			fromY = i.value()->pos * st::dlgHeight;
+			fromY = i.value()->pos() * st::dlgHeight;
 		} else {
 			i = contactsNoDialogs.list.rowByPeer.constFind(peer);
 			if (i != contactsNoDialogs.list.rowByPeer.cend()) {
-				fromY = (i.value()->pos + dialogs.list.count) * st::dlgHeight;
+				fromY = (i.value()->pos() + dialogs.list.count) * st::dlgHeight;
 			}
 		}
 	} else if (_state == FilteredState || _state == SearchedState) {
@@ -1106,7 +1135,7 @@ void DialogsListWidget::selectSkipPage(int32 pixels, int32 direction) {
 				contactSel = false;
 			}
 		}
-		int32 fromY = (sel->pos + (contactSel ? dialogs.list.count : 0)) * st::dlgHeight;
+		int32 fromY = (sel->pos() + (contactSel ? dialogs.list.count : 0)) * st::dlgHeight;
 		emit mustScrollTo(fromY, fromY + st::dlgHeight);
 	} else {
 		return selectSkip(direction * toSkip);
@@ -1121,7 +1150,8 @@ void DialogsListWidget::loadPeerPhotos(int32 yFrom) {
 		int32 otherStart = dialogs.list.count * st::dlgHeight;
 		if (yFrom < otherStart) {
 			dialogs.list.adjustCurrent(yFrom, st::dlgHeight);
-			for (DialogRow *row = dialogs.list.current; row != dialogs.list.end && (row->pos * st::dlgHeight) < yTo; row = row->next) {
+			DialogRow *row = dialogs.list.current;
+			for (int32 pos = row->pos(); row != dialogs.list.end && (pos * st::dlgHeight) < yTo; row = row->next, ++pos) {
 				row->history->peer->photo->load();
 			}
 			yFrom = 0;
@@ -1131,7 +1161,8 @@ void DialogsListWidget::loadPeerPhotos(int32 yFrom) {
 		yTo -= otherStart;
 		if (yTo > 0) {
 			contactsNoDialogs.list.adjustCurrent(yFrom, st::dlgHeight);
-			for (DialogRow *row = contactsNoDialogs.list.current; row != contactsNoDialogs.list.end && (row->pos * st::dlgHeight) < yTo; row = row->next) {
+			DialogRow *row = contactsNoDialogs.list.current;
+			for (int32 pos = row->pos(); row != contactsNoDialogs.list.end && (pos * st::dlgHeight) < yTo; row = row->next, ++pos) {
 				row->history->peer->photo->load();
 			}
 		}
@@ -1795,6 +1826,11 @@ void DialogsWidget::searchReceived(bool fromStart, const MTPmessages_Messages &r
 	}
 }
 
+void DialogsWidget::indexedMessagesLoaded() {
+	list.indexedMessagesLoaded();
+	onListScroll();
+}
+
 void DialogsWidget::peopleReceived(const MTPcontacts_Found &result, mtpRequestId req) {
 	QString q = _peopleQuery;
 	if (list.state() == DialogsListWidget::FilteredState || list.state() == DialogsListWidget::SearchedState) {
@@ -29,6 +29,7 @@ public:
 	void dialogsReceived(const QVector<MTPDialog> &dialogs);
 	void addAllSavedPeers();
 	void searchReceived(const QVector<MTPMessage> &messages, bool fromStart, int32 fullCount);
+	void indexedMessagesLoaded();
 	void peopleReceived(const QString &query, const QVector<MTPContactFound> &people);
 	void showMore(int32 pixels);
 
@@ -129,6 +130,7 @@ private:
 
 	void addDialog(const MTPDdialog &dialog);
 	void clearSearchResults(bool clearPeople = true);
+	void searchIndexed();
 
 	DialogsIndexed dialogs;
 	DialogsIndexed contactsNoDialogs;
@@ -178,6 +180,7 @@ public:
 	void dialogsReceived(const MTPmessages_Dialogs &dialogs);
 	void contactsReceived(const MTPcontacts_Contacts &contacts);
 	void searchReceived(bool fromStart, const MTPmessages_Messages &result, mtpRequestId req);
+	void indexedMessagesLoaded();
 	void peopleReceived(const MTPcontacts_Found &result, mtpRequestId req);
 	bool addNewContact(int32 uid, bool show = true);
 	
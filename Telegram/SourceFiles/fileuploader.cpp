@@ -18,10 +18,78 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 #include "stdafx.h"
 #include "fileuploader.h"
 
-FileUploader::FileUploader() : sentSize(0), uploading(0) {
-	memset(sentSizes, 0, sizeof(sentSizes));
-	nextTimer.setSingleShot(true);
-	connect(&nextTimer, SIGNAL(timeout()), this, SLOT(sendNext()));
+FileUploadReader::FileUploadReader(FileUploadReaderData *data, QThread *thread) : _data(data) {
+	moveToThread(thread);
+}
+
+void FileUploadReader::readParts() {
+	while (true) {
+		MsgId msgId = 0;
+		FileUploadRead read;
+		{
+			QMutexLocker lock(&_data->lock);
+			int64 readAhead = 0;
+			for (FileUploadReads::const_iterator i = _data->reads.cbegin(), e = _data->reads.cend(); i != e; ++i) {
+				readAhead += int64(i->ready.size()) * i->partSize;
+			}
+			for (FileUploadReads::const_iterator i = _data->reads.cbegin(), e = _data->reads.cend(); i != e; ++i) {
+				if (i->failed || i->readParts >= i->partsCount) continue;
+				if (!i->ready.isEmpty() && readAhead + i->partSize > UploadReadAheadSize) break;
+
+				msgId = i.key();
+				read = i.value();
+				break;
+			}
+		}
+		if (!msgId) return;
+
+		QByteArray part;
+		if (!read.file) {
+			read.file = QSharedPointer<QFile>(new QFile(read.path));
+			if (!read.file->open(QIODevice::ReadOnly)) {
+				read.failed = true;
+			}
+		}
+		if (!read.failed) {
+			part = read.file->read(read.partSize);
+			if (part.size() > read.partSize || (part.size() < read.partSize && read.readParts + 1 != read.partsCount)) {
+				read.failed = true;
+			} else if (read.needMd5) {
+				read.md5Hash.feed(part.constData(), part.size());
+			}
+		}
+
+		{
+			QMutexLocker lock(&_data->lock);
+			FileUploadReads::iterator i = _data->reads.find(msgId);
+			if (i == _data->reads.end()) continue; // upload was cancelled
+
+			if (read.failed) {
+				i->failed = true;
+				i->file.clear();
+			} else {
+				i->ready.push_back(part);
+				i->file = read.file;
+				i->md5Hash = read.md5Hash;
+				if (++i->readParts == i->partsCount) {
+					if (i->needMd5) {
+						i->md5.resize(32);
+						hashMd5Hex(i->md5Hash.result(), i->md5.data());
+					}
+					i->file.clear();
+				}
+			}
+		}
+		emit partsRead();
+	}
+}
+
+FileUploader::FileUploader() : readerThread(0), reader(0) {
+	for (int32 i = 0; i < MTPUploadSessionsCount; ++i) {
+		sentSizes[i] = 0;
+		windows[i] = UploadSessionWindowStart;
+		windowShrinked[i] = 0;
+	}
 	killSessionsTimer.setSingleShot(true);
 	connect(&killSessionsTimer, SIGNAL(timeout()), this, SLOT(killSessions()));
 }
@@ -45,41 +113,102 @@ void FileUploader::uploadMedia(MsgId msgId, const ReadyLocalMedia &media) {
 		audio->status = FileUploading;
 		audio->data = media.data;
 	}
-	queue.insert(msgId, File(media));
+	File file(media);
+	if (file.docPartsCount && media.data.isEmpty()) {
+		if (!readerThread) {
+			readerThread = new QThread();
+			reader = new FileUploadReader(&readerData, readerThread);
+			connect(this, SIGNAL(needToRead()), reader, SLOT(readParts()), Qt::QueuedConnection);
+			connect(reader, SIGNAL(partsRead()), this, SLOT(sendNext()), Qt::QueuedConnection);
+			readerThread->start();
+		}
+		{
+			QMutexLocker lock(&readerData.lock);
+			readerData.reads.insert(msgId, FileUploadRead(media.file, file.docPartSize, file.docPartsCount, file.docSize <= UseBigFilesFrom));
+		}
+		emit needToRead();
+	}
+	queue.insert(msgId, file);
 	sendNext();
 }
 
-void FileUploader::currentFailed() {
-	Queue::iterator j = queue.find(uploading);
-	if (j != queue.end()) {
-		if (j->media.type == ToPreparePhoto) {
-			emit photoFailed(j.key());
-		} else if (j->media.type == ToPrepareDocument) {
-			DocumentData *doc = App::document(j->media.id);
-			if (doc->status == FileUploading) {
-				doc->status = FileFailed;
-			}
-			emit documentFailed(j.key());
-		} else if (j->media.type == ToPrepareAudio) {
-			AudioData *audio = App::audio(j->media.id);
-			if (audio->status == FileUploading) {
-				audio->status = FileFailed;
-			}
-			emit audioFailed(j.key());
+void FileUploader::fileFailed(MsgId msgId) {
+	cancelRequests(msgId);
+	cancelRead(msgId);
+
+	Queue::iterator j = queue.find(msgId);
+	if (j == queue.end()) return;
+
+	ReadyLocalMedia media(j->media);
+	queue.erase(j);
+	if (media.type == ToPreparePhoto) {
+		emit photoFailed(msgId);
+	} else if (media.type == ToPrepareDocument) {
+		DocumentData *doc = App::document(media.id);
+		if (doc->status == FileUploading) {
+			doc->status = FileFailed;
+		}
+		emit documentFailed(msgId);
+	} else if (media.type == ToPrepareAudio) {
+		AudioData *audio = App::audio(media.id);
+		if (audio->status == FileUploading) {
+			audio->status = FileFailed;
 		}
-		queue.erase(j);
+		emit audioFailed(msgId);
 	}
+}
 
-	requestsSent.clear();
-	docRequestsSent.clear();
-	dcMap.clear();
-	uploading = 0;
-	sentSize = 0;
-	for (int i = 0; i < MTPUploadSessionsCount; ++i) {
-		sentSizes[i] = 0;
+void FileUploader::fileReady(MsgId msgId) {
+	Queue::iterator i = queue.find(msgId);
+	if (i == queue.end()) return;
+
+	File file(i.value());
+	queue.erase(i);
+
+	QByteArray md5;
+	{
+		QMutexLocker lock(&readerData.lock);
+		FileUploadReads::iterator j = readerData.reads.find(msgId);
+		if (j != readerData.reads.end()) {
+			md5 = j->md5;
+			readerData.reads.erase(j);
+		}
+	}
+	if (md5.isEmpty()) {
+		md5.resize(32);
+		hashMd5Hex(file.md5Hash.result(), md5.data());
 	}
 
-	sendNext();
+	if (file.media.type == ToPreparePhoto) {
+		emit photoReady(msgId, MTP_inputFile(MTP_long(file.media.id), MTP_int(file.partsCount), MTP_string(file.media.filename), MTP_string(file.media.jpeg_md5)));
+	} else if (file.media.type == ToPrepareDocument) {
+		MTPInputFile doc = (file.docSize > UseBigFilesFrom) ? MTP_inputFileBig(MTP_long(file.media.id), MTP_int(file.docPartsCount), MTP_string(file.media.filename)) : MTP_inputFile(MTP_long(file.media.id), MTP_int(file.docPartsCount), MTP_string(file.media.filename), MTP_string(md5));
+		if (file.partsCount) {
+			emit thumbDocumentReady(msgId, doc, MTP_inputFile(MTP_long(file.media.thumbId), MTP_int(file.partsCount), MTP_string(qsl("thumb.") + file.media.thumbExt), MTP_string(file.media.jpeg_md5)));
+		} else {
+			emit documentReady(msgId, doc);
+		}
+	} else if (file.media.type == ToPrepareAudio) {
+		MTPInputFile audio = (file.docSize > UseBigFilesFrom) ? MTP_inputFileBig(MTP_long(file.media.id), MTP_int(file.docPartsCount), MTP_string(file.media.filename)) : MTP_inputFile(MTP_long(file.media.id), MTP_int(file.docPartsCount), MTP_string(file.media.filename), MTP_string(md5));
+		emit audioReady(msgId, audio);
+	}
+}
+
+void FileUploader::cancelRequests(MsgId msgId) {
+	for (Requests::iterator i = requests.begin(); i != requests.end();) {
+		if (i->msgId == msgId) {
+			MTP::cancel(i.key());
+			sentSizes[i->dc] -= i->size;
+			i = requests.erase(i);
+		} else {
+			++i;
+		}
+	}
+}
+
+void FileUploader::cancelRead(MsgId msgId) {
+	QMutexLocker lock(&readerData.lock);
+	readerData.reads.remove(msgId);
 }
 
 void FileUploader::killSessions() {
@@ -88,9 +217,66 @@ void FileUploader::killSessions() {
 	}
 }
 
-void FileUploader::sendNext() {
-	if (sentSize >= MaxUploadFileParallelSize) return;
+bool FileUploader::hasPartsToSend(const File &file) const {
+	return !file.media.parts.isEmpty() || file.docSentParts < file.docPartsCount;
+}
+
+FileUploader::SendPartResult FileUploader::sendPart(Queue::iterator i, int32 dc) {
+	if (!i->media.parts.isEmpty()) {
+		LocalFileParts::iterator part = i->media.parts.begin();
+
+		mtpRequestId requestId = MTP::send(MTPupload_SaveFilePart(MTP_long(i->media.thumbId), MTP_int(part.key()), MTP_string(part.value())), rpcDone(&FileUploader::partLoaded), rpcFail(&FileUploader::partFailed), MTP::upl[dc]);
+		requests.insert(requestId, Request(i.key(), dc, part.value().size()));
+		sentSizes[dc] += part.value().size();
+		++i->inFlight;
+
+		i->media.parts.erase(part);
+		return PartSent;
+	}
+	if (i->docSentParts >= i->docPartsCount) {
+		return NoPartsToSend;
+	}
+
+	QByteArray toSend;
+	if (i->media.data.isEmpty()) {
+		QMutexLocker lock(&readerData.lock);
+		FileUploadReads::iterator j = readerData.reads.find(i.key());
+		if (j == readerData.reads.end() || j->failed) {
+			return PartReadFailed;
+		}
+		if (j->ready.isEmpty()) {
+			return NoPartsReadYet;
+		}
+		toSend = j->ready.front();
+		j->ready.pop_front();
+		lock.unlock();
+
+		emit needToRead();
+	} else {
+		toSend = i->media.data.mid(i->docSentParts * i->docPartSize, i->docPartSize);
+		if ((i->media.type == ToPrepareDocument || i->media.type == ToPrepareAudio) && i->docSize <= UseBigFilesFrom) {
+			i->md5Hash.feed(toSend.constData(), toSend.size());
+		}
+	}
+	if (toSend.size() > i->docPartSize || (toSend.size() < i->docPartSize && i->docSentParts + 1 != i->docPartsCount)) {
+		return PartReadFailed;
+	}
+	mtpRequestId requestId;
+	if (i->docSize > UseBigFilesFrom) {
+		requestId = MTP::send(MTPupload_SaveBigFilePart(MTP_long(i->media.id), MTP_int(i->docSentParts), MTP_int(i->docPartsCount), MTP_string(toSend)), rpcDone(&FileUploader::partLoaded), rpcFail(&FileUploader::partFailed), MTP::upl[dc]);
+	} else {
+		requestId = MTP::send(MTPupload_SaveFilePart(MTP_long(i->media.id), MTP_int(i->docSentParts), MTP_string(toSend)), rpcDone(&FileUploader::partLoaded), rpcFail(&FileUploader::partFailed), MTP::upl[dc]);
+	}
+	requests.insert(requestId, Request(i.key(), dc, i->docPartSize, true));
+	sentSizes[dc] += i->docPartSize;
+	++i->inFlight;
+	++i->docInFlight;
+
+	++i->docSentParts;
+	return PartSent;
+}
 
+void FileUploader::sendNext() {
 	bool killing = killSessionsTimer.isActive();
 	if (queue.isEmpty()) {
 		if (!killing) {
@@ -102,104 +288,48 @@ void FileUploader::sendNext() {
 	if (killing) {
 		killSessionsTimer.stop();
 	}
-	Queue::iterator i = uploading ? queue.find(uploading) : queue.begin();
-	if (!uploading) {
-		uploading = i.key();
-	} else if (i == queue.end()) {
-		i = queue.begin(); 
-		uploading = i.key();
-	}
-	int todc = 0;
-	for (int dc = 1; dc < MTPUploadSessionsCount; ++dc) {
-		if (sentSizes[dc] < sentSizes[todc]) {
-			todc = dc;
-		}
-	}
-	if (i->media.parts.isEmpty()) {
-		if (i->docSentParts >= i->docPartsCount) {
-			if (requestsSent.isEmpty() && docRequestsSent.isEmpty()) {
-				if (i->media.type == ToPreparePhoto) {
-					emit photoReady(uploading, MTP_inputFile(MTP_long(i->media.id), MTP_int(i->partsCount), MTP_string(i->media.filename), MTP_string(i->media.jpeg_md5)));
-				} else if (i->media.type == ToPrepareDocument) {
-					QByteArray docMd5(32, Qt::Uninitialized);
-					hashMd5Hex(i->md5Hash.result(), docMd5.data());
-
-					MTPInputFile doc = (i->docSize > UseBigFilesFrom) ? MTP_inputFileBig(MTP_long(i->media.id), MTP_int(i->docPartsCount), MTP_string(i->media.filename)) : MTP_inputFile(MTP_long(i->media.id), MTP_int(i->docPartsCount), MTP_string(i->media.filename), MTP_string(docMd5));
-					if (i->partsCount) {
-						emit thumbDocumentReady(uploading, doc, MTP_inputFile(MTP_long(i->media.thumbId), MTP_int(i->partsCount), MTP_string(qsl("thumb.") + i->media.thumbExt), MTP_string(i->media.jpeg_md5)));
-					} else {
-						emit documentReady(uploading, doc);
-					}
-				} else if (i->media.type == ToPrepareAudio) {
-					QByteArray audioMd5(32, Qt::Uninitialized);
-					hashMd5Hex(i->md5Hash.result(), audioMd5.data());
 
-					MTPInputFile audio = (i->docSize > UseBigFilesFrom) ? MTP_inputFileBig(MTP_long(i->media.id), MTP_int(i->docPartsCount), MTP_string(i->media.filename)) : MTP_inputFile(MTP_long(i->media.id), MTP_int(i->docPartsCount), MTP_string(i->media.filename), MTP_string(audioMd5));
-					emit audioReady(uploading, audio);
-				}
-				queue.remove(uploading);
-				uploading = 0;
-				sendNext();
+	// parts of the queued files are sent in order, several files are uploading
+	// at the same time while the sessions windows are not full
+	Queue::iterator i = queue.begin();
+	while (i != queue.end()) {
+		int32 todc = 0;
+		for (int32 dc = 1; dc < MTPUploadSessionsCount; ++dc) {
+			if (int64(windows[dc]) - sentSizes[dc] > int64(windows[todc]) - sentSizes[todc]) {
+				todc = dc;
 			}
-			return;
 		}
+		if (sentSizes[todc] >= windows[todc]) return;
 
-		QByteArray toSend;
-		if (i->media.data.isEmpty()) {
-			if (!i->docFile) {
-				i->docFile.reset(new QFile(i->media.file));
-				if (!i->docFile->open(QIODevice::ReadOnly)) {
-					currentFailed();
-					return;
-				}
-			}
-			toSend = i->docFile->read(i->docPartSize);
-			if (i->docSize <= UseBigFilesFrom) {
-				i->md5Hash.feed(toSend.constData(), toSend.size());
-			}
-		} else {
-			toSend = i->media.data.mid(i->docSentParts * i->docPartSize, i->docPartSize);
-			if ((i->media.type == ToPrepareDocument || i->media.type == ToPrepareAudio) && i->docSentParts <= UseBigFilesFrom) {
-				i->md5Hash.feed(toSend.constData(), toSend.size());
+		SendPartResult result = sendPart(i, todc);
+		if (result == PartReadFailed) {
+			fileFailed(i.key());
+			return sendNext();
+		} else if (result == NoPartsToSend) {
+			if (!i->inFlight) {
+				fileReady(i.key());
+				return sendNext();
 			}
+			++i;
+		} else if (result == NoPartsReadYet) {
+			++i;
 		}
-		if (toSend.size() > i->docPartSize || (toSend.size() < i->docPartSize && i->docSentParts + 1 != i->docPartsCount)) {
-			currentFailed();
-			return;
-		}
-		mtpRequestId requestId;
-		if (i->docSize > UseBigFilesFrom) {
-			requestId = MTP::send(MTPupload_SaveBigFilePart(MTP_long(i->media.id), MTP_int(i->docSentParts), MTP_int(i->docPartsCount), MTP_string(toSend)), rpcDone(&FileUploader::partLoaded), rpcFail(&FileUploader::partFailed), MTP::upl[todc]);
-		} else {
-			requestId = MTP::send(MTPupload_SaveFilePart(MTP_long(i->media.id), MTP_int(i->docSentParts), MTP_string(toSend)), rpcDone(&FileUploader::partLoaded), rpcFail(&FileUploader::partFailed), MTP::upl[todc]);
-		}
-		docRequestsSent.insert(requestId, i->docSentParts);
-		dcMap.insert(requestId, todc);
-		sentSize += i->docPartSize;
-		sentSizes[todc] += i->docPartSize;
-
-		i->docSentParts++;
-	} else {
-		LocalFileParts::iterator part = i->media.parts.begin();
-	
-		mtpRequestId requestId = MTP::send(MTPupload_SaveFilePart(MTP_long(i->media.thumbId), MTP_int(part.key()), MTP_string(part.value())), rpcDone(&FileUploader::partLoaded), rpcFail(&FileUploader::partFailed), MTP::upl[todc]);
-		requestsSent.insert(requestId, part.value());
-		dcMap.insert(requestId, todc);
-		sentSize += part.value().size();
-		sentSizes[todc] += part.value().size();
-
-		i->media.parts.erase(part);
 	}
-	nextTimer.start(UploadRequestInterval);
 }
 
 void FileUploader::cancel(MsgId msgId) {
 	uploaded.remove(msgId);
-	if (uploading == msgId) {
-		currentFailed();
+
+	Queue::iterator i = queue.find(msgId);
+	if (i == queue.end()) return;
+
+	if (i->inFlight || i->docSentParts || i->media.parts.size() != i->partsCount) {
+		fileFailed(msgId);
 	} else {
-		queue.remove(msgId);
+		queue.erase(i);
+		cancelRead(msgId);
 	}
+	sendNext();
 }
 
 void FileUploader::confirm(MsgId msgId) {
@@ -208,85 +338,109 @@ void FileUploader::confirm(MsgId msgId) {
 void FileUploader::clear() {
 	uploaded.clear();
 	queue.clear();
-	for (QMap<mtpRequestId, QByteArray>::const_iterator i = requestsSent.cbegin(), e = requestsSent.cend(); i != e; ++i) {
-		MTP::cancel(i.key());
+	{
+		QMutexLocker lock(&readerData.lock);
+		readerData.reads.clear();
 	}
-	requestsSent.clear();
-	for (QMap<mtpRequestId, int32>::const_iterator i = docRequestsSent.cbegin(), e = docRequestsSent.cend(); i != e; ++i) {
+	for (Requests::const_iterator i = requests.cbegin(), e = requests.cend(); i != e; ++i) {
 		MTP::cancel(i.key());
 	}
-	docRequestsSent.clear();
-	dcMap.clear();
-	sentSize = 0;
+	requests.clear();
 	for (int32 i = 0; i < MTPUploadSessionsCount; ++i) {
 		MTP::stopSession(MTP::upl[i]);
 		sentSizes[i] = 0;
+		windows[i] = UploadSessionWindowStart;
+		windowShrinked[i] = 0;
 	}
 	killSessionsTimer.stop();
 }
 
 void FileUploader::partLoaded(const MTPBool &result, mtpRequestId requestId) {
-	QMap<mtpRequestId, int32>::iterator j = docRequestsSent.end();
-	QMap<mtpRequestId, QByteArray>::iterator i = requestsSent.find(requestId);
-	if (i == requestsSent.cend()) {
-		j = docRequestsSent.find(requestId);
+	Requests::iterator i = requests.find(requestId);
+	if (i == requests.end()) return sendNext();
+
+	Request request(i.value());
+	requests.erase(i);
+	sentSizes[request.dc] -= request.size;
+
+	Queue::iterator k = queue.find(request.msgId);
+	if (k == queue.end()) return sendNext();
+
+	if (!result.v) { // failed to upload this file
+		fileFailed(request.msgId);
+		return sendNext();
 	}
-	if (i != requestsSent.cend() || j != docRequestsSent.cend()) {
-		if (!result.v) { // failed to upload current file
-			currentFailed();
-			return;
-		} else {
-			QMap<mtpRequestId, int32>::iterator dcIt = dcMap.find(requestId);
-			if (dcIt == dcMap.cend()) { // must not happen
-				currentFailed();
-				return;
-			}
-			int32 dc = dcIt.value();
-			dcMap.erase(dcIt);
-
-			Queue::const_iterator k = queue.constFind(uploading);
-			if (i != requestsSent.cend()) {
-				sentSize -= i.value().size();
-				sentSizes[dc] -= i.value().size();
-				requestsSent.erase(i);
-			} else {
-				sentSize -= k->docPartSize;
-				sentSizes[dc] -= k->docPartSize;
-				docRequestsSent.erase(j);
+
+	uint64 ms = getms(), latency = ms - request.sent;
+	if (latency < UploadAckFastLatency) {
+		windows[request.dc] = qMin(windows[request.dc] + request.size, uint32(UploadSessionWindowMax));
+	} else if (latency > UploadAckSlowLatency && request.sent > windowShrinked[request.dc]) {
+		windows[request.dc] = qMax(windows[request.dc] / 2, uint32(UploadSessionWindowMin));
+		windowShrinked[request.dc] = ms;
+	}
+
+	--k->inFlight;
+	if (request.docPart) {
+		--k->docInFlight;
+	}
+	if (k->media.type == ToPreparePhoto) {
+		emit photoProgress(k.key());
+	} else if (k->media.type == ToPrepareDocument) {
+		DocumentData *doc = App::document(k->media.id);
+		if (doc->status == FileUploading) {
+			doc->uploadOffset = (k->docSentParts - k->docInFlight) * k->docPartSize;
+			if (doc->uploadOffset > doc->size) {
+				doc->uploadOffset = doc->size;
 			}
-			if (k->media.type == ToPreparePhoto) {
-				emit photoProgress(k.key());
-			} else if (k->media.type == ToPrepareDocument) {
-				DocumentData *doc = App::document(k->media.id);
-				if (doc->status == FileUploading) {
-					doc->uploadOffset = (k->docSentParts - docRequestsSent.size()) * k->docPartSize;
-					if (doc->uploadOffset > doc->size) {
-						doc->uploadOffset = doc->size;
-					}
-				}
-				emit documentProgress(k.key());
-			} else if (k->media.type == ToPrepareAudio) {
-				AudioData *audio = App::audio(k->media.id);
-				if (audio->status == FileUploading) {
-					audio->uploadOffset = (k->docSentParts - docRequestsSent.size()) * k->docPartSize;
-					if (audio->uploadOffset > audio->size) {
-						audio->uploadOffset = audio->size;
-					}
-				}
-				emit audioProgress(k.key());
+		}
+		emit documentProgress(k.key());
+	} else if (k->media.type == ToPrepareAudio) {
+		AudioData *audio = App::audio(k->media.id);
+		if (audio->status == FileUploading) {
+			audio->uploadOffset = (k->docSentParts - k->docInFlight) * k->docPartSize;
+			if (audio->uploadOffset > audio->size) {
+				audio->uploadOffset = audio->size;
 			}
 		}
+		emit audioProgress(k.key());
 	}
 
+	k = queue.find(request.msgId); // progress handlers could cancel the upload
+	if (k != queue.end() && !k->inFlight && !hasPartsToSend(k.value())) {
+		fileReady(request.msgId);
+	}
 	sendNext();
 }
 
 bool FileUploader::partFailed(const RPCError &error, mtpRequestId requestId) {
-	if (error.type().startsWith(qsl("FLOOD_WAIT_"))) return false;
+	Requests::iterator i = requests.find(requestId);
+	if (error.type().startsWith(qsl("FLOOD_WAIT_"))) {
+		if (i != requests.end()) { // the part will be resent, don't send more to this session for now
+			windows[i->dc] = UploadSessionWindowMin;
+			windowShrinked[i->dc] = getms();
+		}
+		return false;
+	}
 
-	if (requestsSent.constFind(requestId) != requestsSent.cend() || docRequestsSent.constFind(requestId) != docRequestsSent.cend()) { // failed to upload current file
-		currentFailed();
+	if (i != requests.end()) { // failed to upload this file
+		MsgId msgId = i->msgId;
+		sentSizes[i->dc] -= i->size;
+		requests.erase(i);
+		fileFailed(msgId);
 	}
 	sendNext();
 	return true;
 }
+
+FileUploader::~FileUploader() {
+	if (readerThread) {
+		{
+			QMutexLocker lock(&readerData.lock);
+			readerData.reads.clear();
+		}
+		readerThread->quit();
+		readerThread->wait();
+		delete reader;
+		delete readerThread;
+	}
+}
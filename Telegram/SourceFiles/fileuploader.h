@@ -19,12 +19,57 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 
 #include "localimageloader.h"
 
+struct FileUploadRead { // document parts are read ahead and md5 is counted in the reader thread
+	FileUploadRead(const QString &path = QString(), int32 partSize = 0, int32 partsCount = 0, bool needMd5 = false) :
+		path(path), partSize(partSize), partsCount(partsCount), needMd5(needMd5), readParts(0), failed(false) {
+	}
+	QString path;
+	int32 partSize, partsCount;
+	bool needMd5;
+
+	int32 readParts;
+	QSharedPointer<QFile> file;
+	HashMd5 md5Hash;
+
+	QList<QByteArray> ready; // read and not sent yet
+	QByteArray md5; // hex, when all parts are read
+	bool failed;
+};
+typedef QMap<MsgId, FileUploadRead> FileUploadReads;
+
+struct FileUploadReaderData {
+	QMutex lock;
+	FileUploadReads reads;
+};
+
+class FileUploadReader : public QObject {
+	Q_OBJECT
+
+public:
+
+	FileUploadReader(FileUploadReaderData *data, QThread *thread);
+
+public slots:
+
+	void readParts();
+
+signals:
+
+	void partsRead();
+
+private:
+
+	FileUploadReaderData *_data;
+
+};
+
 class FileUploader : public QObject, public RPCSender {
 	Q_OBJECT
 
 public:
 
 	FileUploader();
+	~FileUploader();
 	void uploadMedia(MsgId msgId, const ReadyLocalMedia &image);
 
 	int32 currentOffset(MsgId msgId) const; // -1 means file not found
@@ -42,6 +87,8 @@ public slots:
 
 signals:
 
+	void needToRead();
+
 	void photoReady(MsgId msgId, const MTPInputFile &file);
 	void documentReady(MsgId msgId, const MTPInputFile &file);
 	void thumbDocumentReady(MsgId msgId, const MTPInputFile &file, const MTPInputFile &thumb);
@@ -58,7 +105,7 @@ signals:
 private:
 
 	struct File {
-		File(const ReadyLocalMedia &media) : media(media), docSentParts(0) {
+		File(const ReadyLocalMedia &media) : media(media), docSentParts(0), inFlight(0), docInFlight(0) {
 			partsCount = media.parts.size();
 			if (media.type == ToPrepareDocument || media.type == ToPrepareAudio) {
 				docSize = media.file.isEmpty() ? media.data.size() : media.filesize;
@@ -88,28 +135,52 @@ private:
 
 		HashMd5 md5Hash;
 
-		QSharedPointer<QFile> docFile;
 		int32 docSentParts;
 		int32 docSize;
 		int32 docPartSize;
 		int32 docPartsCount;
+
+		int32 inFlight, docInFlight; // parts sent and not acked yet
 	};
 	typedef QMap<MsgId, File> Queue;
 
+	struct Request {
+		Request(MsgId msgId = 0, int32 dc = 0, int32 size = 0, bool docPart = false) : msgId(msgId), dc(dc), size(size), docPart(docPart), sent(getms()) {
+		}
+		MsgId msgId;
+		int32 dc, size;
+		bool docPart;
+		uint64 sent;
+	};
+	typedef QMap<mtpRequestId, Request> Requests;
+
+	enum SendPartResult {
+		PartSent,
+		NoPartsToSend,
+		NoPartsReadYet,
+		PartReadFailed,
+	};
+	SendPartResult sendPart(Queue::iterator i, int32 dc);
+	bool hasPartsToSend(const File &file) const;
+	void fileReady(MsgId msgId);
+	void fileFailed(MsgId msgId);
+	void cancelRequests(MsgId msgId);
+	void cancelRead(MsgId msgId);
+
 	void partLoaded(const MTPBool &result, mtpRequestId requestId);
 	bool partFailed(const RPCError &err, mtpRequestId requestId);
 
-	void currentFailed();
-
-	QMap<mtpRequestId, QByteArray> requestsSent;
-	QMap<mtpRequestId, int32> docRequestsSent;
-	QMap<mtpRequestId, int32> dcMap;
-	uint32 sentSize;
+	Requests requests;
 	uint32 sentSizes[MTPUploadSessionsCount];
-	
-	MsgId uploading;
+	uint32 windows[MTPUploadSessionsCount]; // how much can be uploading in each session, adapts to ack latency
+	uint64 windowShrinked[MTPUploadSessionsCount]; // parts sent before the window was shrinked don't shrink it again
+
 	Queue queue;
 	Queue uploaded;
-	QTimer nextTimer, killSessionsTimer;
+	QTimer killSessionsTimer;
+
+	FileUploadReaderData readerData;
+	QThread *readerThread;
+	FileUploadReader *reader;
 
 };
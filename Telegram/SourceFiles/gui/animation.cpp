@@ -24,6 +24,19 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 
 namespace {
 	AnimationManager *manager = 0;
+
+	QThread *gifThread = 0;
+	AnimatedGifDecoder *gifDecoder = 0;
+
+	AnimatedGifDecoder *_gifDecoder() {
+		if (!manager) return 0;
+		if (!gifThread) {
+			gifThread = new QThread();
+			gifDecoder = new AnimatedGifDecoder(gifThread);
+			gifThread->start();
+		}
+		return gifDecoder;
+	}
 };
 
 namespace anim {
@@ -98,57 +111,258 @@ namespace anim {
 	void stopManager() {
 		delete manager;
 		manager = 0;
+
+		if (gifThread) {
+			gifThread->quit();
+			gifThread->wait();
+			delete gifDecoder;
+			delete gifThread;
+			gifDecoder = 0;
+			gifThread = 0;
+		}
 	}
 
 }
 
-bool AnimatedGif::animStep(float64 ms) {
-	int32 f = frame;
-	while (f < images.size() && ms > delays[f]) {
-		++f;
-		if (f == images.size() && images.size() < framesCount) {
-			if (reader->read(&img)) {
-				int64 d = reader->nextImageDelay(), delay = delays[f - 1];
-				if (!d) d = 1;
-				delay += d;
-				if (img.size() != QSize(w, h)) img = img.scaled(w, h, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
-				images.push_back(img);
-				frames.push_back(QPixmap());
-				delays.push_back(delay);
-				for (int32 i = 0; i < images.size(); ++i) {
-					if (!images[i].isNull() || !frames[i].isNull()) {
-						images[i] = QImage();
-						frames[i] = QPixmap();
-						break;
-					}
-				}
-			} else {
-				framesCount = images.size();
+AnimationManager::AnimationManager() : timer(this), frameBase(float64(getms())), frameDelta(AnimationTimerDelta), timerAt(0), iterating(false) {
+	QScreen *screen = QGuiApplication::primaryScreen();
+	float64 rate = screen ? screen->refreshRate() : 0.;
+	if (rate > 0) {
+		frameDelta = qMax(float64(AnimationTimerDelta), 1000. / rate);
+	}
+	timer.setSingleShot(true);
+	timer.setTimerType(Qt::PreciseTimer);
+	connect(&timer, SIGNAL(timeout()), this, SLOT(timeout()));
+}
+
+void AnimationManager::start(Animated *obj) {
+	obj->animReset();
+	if (iterating) {
+		toStart.insert(obj);
+		if (!toStop.isEmpty()) {
+			toStop.remove(obj);
+		}
+	} else {
+		objs.insert(obj);
+
+		float64 ms = float64(getms());
+		schedule(ms, ms);
+	}
+	obj->animInProcess = true;
+}
+
+void AnimationManager::step(Animated *obj) {
+	if (iterating) return;
+
+	float64 ms = float64(getms());
+	if (objs.contains(obj)) {
+		obj->animNext = ms - obj->animStarted;
+		if (!obj->animStep(ms - obj->animStarted)) {
+			objs.remove(obj);
+			if (!objs.size()) {
+				timer.stop();
 			}
+			obj->animInProcess = false;
+		} else {
+			schedule(ms, obj->animStarted + obj->animNext);
 		}
-		if (f == images.size()) {
-			if (!duration) {
-				duration = delays.isEmpty() ? 1 : delays.back();
+	}
+}
+
+void AnimationManager::stop(Animated *obj) {
+	if (iterating) {
+		toStop.insert(obj);
+		if (!toStart.isEmpty()) {
+			toStart.remove(obj);
+		}
+	} else {
+		AnimObjs::iterator i = objs.find(obj);
+		if (i != objs.cend()) {
+			objs.erase(i);
+			if (!objs.size()) {
+				timer.stop();
 			}
+		}
+	}
+	obj->animInProcess = false;
+}
 
-			f = 0;
-			for (int32 i = 0, s = delays.size() - 1; i <= s; ++i) {
-				delays[i] += duration;
+void AnimationManager::timeout() {
+	iterating = true;
+	float64 ms = float64(getms()), next = -1;
+	for (AnimObjs::iterator i = objs.begin(), e = objs.end(); i != e; ) {
+		Animated *obj = *i;
+		float64 wanted = obj->animStarted + obj->animNext;
+		if (wanted > ms + frameDelta / 2) { // nothing changes in this frame
+		} else if (suspended(obj)) {
+			wanted = ms + AnimationSuspendedTimeout;
+		} else {
+			obj->animNext = ms - obj->animStarted;
+			if (!obj->animStep(ms - obj->animStarted)) {
+				i = objs.erase(i);
+				obj->animInProcess = false;
+				continue;
 			}
-			if (images[f].isNull()) {
-				QString fname = reader->fileName();
-				delete reader;
-				reader = new QImageReader(fname);
+			wanted = obj->animStarted + obj->animNext;
+		}
+		if (next < 0 || wanted < next) {
+			next = wanted;
+		}
+		++i;
+	}
+	iterating = false;
+	if (!toStart.isEmpty()) {
+		for (AnimObjs::iterator i = toStart.begin(), e = toStart.end(); i != e; ++i) {
+			objs.insert(*i);
+		}
+		toStart.clear();
+		next = ms;
+	}
+	if (!toStop.isEmpty()) {
+		for (AnimObjs::iterator i = toStop.begin(), e = toStop.end(); i != e; ++i) {
+			objs.remove(*i);
+		}
+		toStop.clear();
+	}
+	if (objs.isEmpty()) {
+		timer.stop();
+	} else {
+		schedule(ms, (next < 0) ? ms : next);
+	}
+}
+
+bool AnimationManager::suspended(Animated *obj) const {
+	QWidget *widget = obj->animWidget();
+	if (!widget) return false;
+
+	QWidget *wnd = widget->window();
+	QWindow *handle = wnd->windowHandle(); // not created windows were never shown, their animations are stepped as usual
+	return handle && (!handle->isVisible() || wnd->isMinimized());
+}
+
+void AnimationManager::schedule(float64 ms, float64 next) {
+	float64 at = frameBase + ceil((qMax(next, ms) - frameBase) / frameDelta) * frameDelta;
+	if (at < ms + 1) at += frameDelta;
+	if (timer.isActive() && timerAt <= at) return;
+
+	timerAt = at;
+	timer.start(qMax(int32(ceil(at - ms)), 0));
+}
+
+AnimatedGifDecoder::AnimatedGifDecoder(QThread *thread) {
+	moveToThread(thread);
+}
+
+void AnimatedGifDecoder::append(const AnimatedGifDataPtr &data) {
+	QMutexLocker lock(&_lock);
+	_gifs.push_back(data);
+}
+
+void AnimatedGifDecoder::decode() {
+	while (true) {
+		AnimatedGifDataPtr next;
+		{
+			QMutexLocker lock(&_lock);
+			int32 nextAhead = 0;
+			for (QList<AnimatedGifDataPtr>::iterator i = _gifs.begin(); i != _gifs.end();) {
+				AnimatedGifData *data = i->data();
+				bool remove = false, needed = false;
+				int32 ahead = 0;
+				{
+					QMutexLocker dataLock(&data->lock);
+					if (data->stopped || data->failed) {
+						remove = true;
+					} else {
+						int32 count = data->frames.size();
+						for (AnimatedGifFrames::const_iterator j = data->frames.cbegin(), e = data->frames.cend(); j != e; ++j) {
+							ahead += j->delay;
+						}
+						needed = (count < AnimatedGifFramesMax && (count < AnimatedGifFramesMin || ahead < AnimatedGifDecodeAhead));
+					}
+				}
+				if (remove) {
+					i = _gifs.erase(i);
+					continue;
+				}
+				if (needed) {
+					if (!next || ahead < nextAhead) { // the gif that will run out of frames first
+						next = *i;
+						nextAhead = ahead;
+					}
+				}
+				++i;
 			}
 		}
-		if (images[f].isNull() && reader->read(&img)) {
-			if (img.size() != QSize(w, h)) img = img.scaled(w, h, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
-			images[f] = img;
-			frames[f] = QPixmap();
+		if (!next) break;
+
+		if (!decodeFrame(next.data())) {
+			QMutexLocker lock(&next->lock);
+			next->failed = true;
+		}
+	}
+}
+
+bool AnimatedGifDecoder::decodeFrame(AnimatedGifData *data) {
+	QImage img;
+	if (!data->reader->read(&img)) { // loop is over, start from the beginning of the cached file content
+		if (!data->buffer) {
+			QFile f(data->file);
+			if (!f.open(QIODevice::ReadOnly)) return false;
+
+			data->buffer = new QBuffer();
+			data->buffer->setData(f.readAll());
+			if (!data->buffer->open(QIODevice::ReadOnly)) return false;
+		} else {
+			data->buffer->seek(0);
+		}
+		data->reader->setDevice(data->buffer);
+		if (!data->reader->read(&img)) return false;
+	}
+	int32 delay = data->reader->nextImageDelay();
+	if (delay <= 0) delay = 1;
+
+	int32 width, height;
+	{
+		QMutexLocker lock(&data->lock);
+		width = data->width;
+		height = data->height;
+	}
+	if (img.width() != width || img.height() != height) img = img.scaled(width, height, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+
+	QMutexLocker lock(&data->lock);
+	if (data->stopped) return true;
+	data->frames.push_back(AnimatedGifFrame(img, delay));
+	return true;
+}
+
+bool AnimatedGif::animStep(float64 ms) {
+	if (isNull()) return false;
+	if (ms < _nextFrameAt) {
+		animSkip(_nextFrameAt - ms);
+		return true;
+	}
+
+	bool changed = false, failed = false;
+	{
+		QMutexLocker lock(&_data->lock);
+		while (ms >= _nextFrameAt && !_data->frames.isEmpty()) { // skip frames if we are late
+			_image = _data->frames.front().image;
+			_nextFrameAt += _data->frames.front().delay;
+			_data->frames.pop_front();
+			changed = true;
 		}
+		failed = _data->failed && _data->frames.isEmpty();
+	}
+	if (ms >= _nextFrameAt) { // decoder is late, show the next frame as soon as it is ready
+		_nextFrameAt = ms;
+	}
+	if (failed) {
+		return false;
 	}
-	if (frame != f) {
-		frame = f;
+	animSkip(_nextFrameAt - ms);
+	if (changed) {
+		_pixmap = QPixmap();
+		emit needFrames();
 		if (msg && App::main()) {
 			App::main()->msgUpdated(msg->history()->peer->id, msg);
 		} else {
@@ -158,40 +372,48 @@ bool AnimatedGif::animStep(float64 ms) {
 	return true;
 }
 
+QWidget *AnimatedGif::animWidget() {
+	if (_owner) return _owner;
+	return App::main();
+}
+
 void AnimatedGif::start(HistoryItem *row, const QString &file) {
 	stop();
 
-	reader = new QImageReader(file);
+	AnimatedGifDecoder *decoder = _gifDecoder();
+	if (!decoder) return;
+
+	QImageReader *reader = new QImageReader(file);
 	if (!reader->canRead() || !reader->supportsAnimation()) {
-		stop();
+		delete reader;
 		return;
 	}
 
 	QSize s = reader->size();
-	w = s.width();
-	h = s.height();
-	framesCount = reader->imageCount();
-	if (!w || !h || !framesCount) {
-		stop();
+	if (!s.width() || !s.height() || !reader->imageCount()) {
+		delete reader;
 		return;
 	}
+	reader->setFormat(reader->format()); // don't detect the format again on the next loops
 
-	frames.reserve(framesCount);
-	images.reserve(framesCount);
-	delays.reserve(framesCount);
-
-	int32 sizeLeft = MediaViewImageSizeLimit, delay = 0;
-	for (bool read = reader->read(&img); read; read = reader->read(&img)) {
-		sizeLeft -= w * h * 4;
-		if (img.size() != s) img = img.scaled(w, h, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
-		images.push_back(img);
-		frames.push_back(QPixmap());
-		int32 d = reader->nextImageDelay();
-		if (!d) d = 1;
-		delay += d;
-		delays.push_back(delay);
-		if (sizeLeft < 0) break;
+	QImage img; // first frame is read right away, the decoder thread reads the next ones
+	if (!reader->read(&img)) {
+		delete reader;
+		return;
 	}
+	int32 delay = reader->nextImageDelay();
+	if (delay <= 0) delay = 1;
+
+	w = _width = s.width();
+	h = _height = s.height();
+	if (img.size() != s) img = img.scaled(w, h, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+	_image = img;
+	_nextFrameAt = delay;
+
+	_data = AnimatedGifDataPtr(new AnimatedGifData(file, reader, w, h));
+	decoder->append(_data);
+	connect(this, SIGNAL(needFrames()), decoder, SLOT(decode()), Qt::QueuedConnection);
+	emit needFrames();
 
 	msg = row;
 
@@ -205,14 +427,21 @@ void AnimatedGif::start(HistoryItem *row, const QString &file) {
 void AnimatedGif::stop(bool onItemRemoved) {
 	if (isNull()) return;
 
-	delete reader;
-	reader = 0;
+	{
+		QMutexLocker lock(&_data->lock);
+		_data->stopped = true;
+		_data->frames.clear();
+	}
+	emit needFrames(); // decoder will forget the stopped gif and close its file
+	disconnect(this, SIGNAL(needFrames()), 0, 0);
+	_data.clear();
+
 	HistoryItem *row = msg;
 	msg = 0;
-	frames.clear();
-	images.clear();
-	delays.clear();
-	w = h = frame = framesCount = duration = 0;
+	_image = QImage();
+	_pixmap = QPixmap();
+	w = h = _width = _height = 0;
+	_nextFrameAt = 0;
 
 	anim::stop(this);
 	if (row && !onItemRemoved) {
@@ -224,12 +453,19 @@ void AnimatedGif::stop(bool onItemRemoved) {
 const QPixmap &AnimatedGif::current(int32 width, int32 height, bool rounded) {
 	if (!width) width = w;
 	if (!height) height = h;
-	if ((frames[frame].isNull() || frames[frame].width() != width || frames[frame].height() != height) && !images[frame].isNull()) {
-		QImage img = images[frame];
+	if (_data && (width != _width || height != _height)) { // next frames will be scaled in the decoder thread
+		_width = width;
+		_height = height;
+		QMutexLocker lock(&_data->lock);
+		_data->width = width;
+		_data->height = height;
+	}
+	if ((_pixmap.isNull() || _pixmap.width() != width || _pixmap.height() != height) && !_image.isNull()) {
+		QImage img = _image;
 		if (img.width() != width || img.height() != height) img = img.scaled(width, height, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
 		if (rounded) imageRound(img);
-		frames[frame] = QPixmap::fromImage(img, Qt::ColorOnly);
-		frames[frame].setDevicePixelRatio(cRetinaFactor());
+		_pixmap = QPixmap::fromImage(img, Qt::ColorOnly);
+		_pixmap.setDevicePixelRatio(cRetinaFactor());
 	}
-	return frames[frame];
+	return _pixmap;
 }
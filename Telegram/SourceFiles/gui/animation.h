@@ -196,13 +196,22 @@ namespace anim {
 class Animated {
 public:
 
-	Animated() : animStarted(0), animInProcess(false) {
+	Animated() : animStarted(0), animNext(0), animInProcess(false) {
 	}
 
 	virtual bool animStep(float64 ms) = 0;
 
 	void animReset() {
 		animStarted = float64(getms());
+		animNext = 0;
+	}
+
+	void animSkip(float64 ms) { // call from animStep if nothing changes in the next ms, so no steps are made till then
+		animNext += ms;
+	}
+
+	virtual QWidget *animWidget() { // animations of the widgets in hidden or minimized windows are not stepped
+		return dynamic_cast<QWidget*>(this);
 	}
 
 	virtual ~Animated() {
@@ -217,7 +226,7 @@ public:
 
 private:
 
-	float64 animStarted;
+	float64 animStarted, animNext; // animNext - time from animStarted when the next step is wanted
 	bool animInProcess;
 	friend class AnimationManager;
 
@@ -226,6 +235,9 @@ private:
 class AnimationFunc {
 public:
 	virtual bool animStep(float64 ms) = 0;
+	virtual QWidget *widget() {
+		return 0;
+	}
 	virtual ~AnimationFunc() {
 	}
 };
@@ -241,6 +253,10 @@ public:
 	bool animStep(float64 ms) {
 		return (_obj->*_method)(ms);
 	}
+
+	QWidget *widget() {
+		return dynamic_cast<QWidget*>(_obj);
+	}
 	
 private:
 	Type *_obj;
@@ -270,6 +286,9 @@ public:
 	bool animStep(float64 ms) {
 		return _func->animStep(ms);
 	}
+	QWidget *animWidget() {
+		return _func->widget();
+	}
 
 	~Animation() {
 		delete _func;
@@ -280,125 +299,102 @@ private:
 
 };
 
-class AnimationManager : public QObject {
+class AnimationManager : public QObject { // steps are aligned to the screen refresh and made only when someone needs them
 Q_OBJECT
 
 public:
 
-	AnimationManager() : timer(this), iterating(false) {
-		timer.setSingleShot(false);
-		connect(&timer, SIGNAL(timeout()), this, SLOT(timeout()));
-	}
-
-	void start(Animated *obj) {
-		obj->animReset();
-		if (iterating) {
-			toStart.insert(obj);
-			if (!toStop.isEmpty()) {
-				toStop.remove(obj);
-			}
-		} else {
-			if (!objs.size()) {
-				timer.start(AnimationTimerDelta);
-			}
-			objs.insert(obj);
-		}
-		obj->animInProcess = true;
-	}
-
-	void step(Animated *obj) {
-		if (iterating) return;
-
-		float64 ms = float64(getms());
-		AnimObjs::iterator i = objs.find(obj);
-		if (i != objs.cend()) {
-			Animated *obj = *i;
-			if (!obj->animStep(ms - obj->animStarted)) {
-				objs.erase(i);
-				if (!objs.size()) {
-					timer.stop();
-				}
-				obj->animInProcess = false;
-			}
-		}
-	}
+	AnimationManager();
 
-	void stop(Animated *obj) {
-		if (iterating) {
-			toStop.insert(obj);
-			if (!toStart.isEmpty()) {
-				toStart.insert(obj);
-			}
-		} else {
-			AnimObjs::iterator i = objs.find(obj);
-			if (i != objs.cend()) {
-				objs.erase(i);
-				if (!objs.size()) {
-					timer.stop();
-				}
-			}
-		}
-		obj->animInProcess = false;
-	}
+	void start(Animated *obj);
+	void step(Animated *obj);
+	void stop(Animated *obj);
 
 public slots:
-	void timeout() {
-		iterating = true;
-		float64 ms = float64(getms());
-		for (AnimObjs::iterator i = objs.begin(), e = objs.end(); i != e; ) {
-			Animated *obj = *i;
-			if (!obj->animStep(ms - obj->animStarted)) {
-				i = objs.erase(i);
-				obj->animInProcess = false;
-			} else {
-				++i;
-			}
-		}
-		iterating = false;
-		if (!toStart.isEmpty()) {
-			for (AnimObjs::iterator i = toStart.begin(), e = toStart.end(); i != e; ++i) {
-				objs.insert(*i);
-			}
-			toStart.clear();
-		}
-		if (!toStop.isEmpty()) {
-			for (AnimObjs::iterator i = toStop.begin(), e = toStop.end(); i != e; ++i) {
-				objs.remove(*i);
-			}
-			toStop.clear();
-		}
-		if (!objs.size()) {
-			timer.stop();
-		}
-	}
+	void timeout();
 
 private:
 
+	bool suspended(Animated *obj) const;
+	void schedule(float64 ms, float64 next); // next step at the first frame not earlier than next
+
 	typedef QSet<Animated*> AnimObjs;
 	AnimObjs objs;
 	AnimObjs toStart;
 	AnimObjs toStop;
 	QTimer timer;
+	float64 frameBase, frameDelta, timerAt;
 	bool iterating;
 
 };
 
+struct AnimatedGifFrame {
+	AnimatedGifFrame(const QImage &image = QImage(), int32 delay = 0) : image(image), delay(delay) {
+	}
+	QImage image;
+	int32 delay;
+};
+typedef QList<AnimatedGifFrame> AnimatedGifFrames;
+
+struct AnimatedGifData {
+	AnimatedGifData(const QString &file, QImageReader *reader, int32 width, int32 height) : file(file), reader(reader), buffer(0),
+	width(width), height(height), stopped(false), failed(false) {
+	}
+	~AnimatedGifData() {
+		delete reader;
+		delete buffer;
+	}
+
+	QString file;
+	QImageReader *reader; // used only in the decoder thread after start
+	QBuffer *buffer; // file content, read when the first loop is over
+
+	QMutex lock; // guards the fields below
+	int32 width, height; // frames are scaled to this size in the decoder thread
+	AnimatedGifFrames frames; // decoded upcoming frames
+	bool stopped, failed;
+};
+typedef QSharedPointer<AnimatedGifData> AnimatedGifDataPtr;
+
+class AnimatedGifDecoder : public QObject {
+	Q_OBJECT
+
+public:
+
+	AnimatedGifDecoder(QThread *thread);
+
+	void append(const AnimatedGifDataPtr &data);
+
+public slots:
+
+	void decode();
+
+private:
+
+	bool decodeFrame(AnimatedGifData *data);
+
+	QMutex _lock;
+	QList<AnimatedGifDataPtr> _gifs;
+
+};
+
 class HistoryItem;
 class AnimatedGif : public QObject, public Animated {
 	Q_OBJECT
 
 public:
 
-	AnimatedGif() : msg(0), reader(0), w(0), h(0), frame(0), framesCount(0), duration(0) {
+	AnimatedGif(QWidget *owner = 0) : msg(0), w(0), h(0), _owner(owner), _width(0), _height(0), _nextFrameAt(0) {
 	}
 
 	bool animStep(float64 ms);
+	QWidget *animWidget();
 
 	void start(HistoryItem *row, const QString &file);
 	void stop(bool onItemRemoved = false);
 
 	bool isNull() const {
-		return !reader;
+		return !_data;
 	}
 
 	~AnimatedGif() {
@@ -410,18 +406,20 @@ public:
 signals:
 
 	void updated();
+	void needFrames();
 
 public:
 
 	HistoryItem *msg;
-	QImage img;
-	QImageReader *reader;
-	int32 w, h, frame;
+	int32 w, h;
 
 private:
 
-	QVector<QPixmap> frames;
-	QVector<QImage> images;
-	QVector<int64> delays;
-	int32 framesCount, duration;
+	QWidget *_owner; // widget showing the frames, history gifs are shown in the main widget
+	AnimatedGifDataPtr _data;
+	QImage _image;
+	QPixmap _pixmap;
+	int32 _width, _height; // last requested size of the frames
+	float64 _nextFrameAt;
+
 };
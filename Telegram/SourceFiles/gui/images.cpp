@@ -21,6 +21,11 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 #include "mainwidget.h"
 #include "localstorage.h"
 
+#if defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#define IMAGES_USE_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace {
 	typedef QMap<QString, LocalImage*> LocalImages;
 	LocalImages localImages;
@@ -34,6 +39,56 @@ namespace {
 	StorageImages storageImages;
 
 	int64 globalAquiredSize = 0;
+	uint64 globalUseCounter = 0; // Image::_lastUsed is set from it in restore()
+
+	struct ImageDecodeTask {
+		ImageDecodeTask() : requested(0) {
+		}
+		ImageDecodeTask(const QByteArray &bytes, const QByteArray &format, uint64 requested) : bytes(bytes), format(format), requested(requested) {
+		}
+		QByteArray bytes, format;
+		uint64 requested; // getms() of the last paint that needed this image
+	};
+	typedef QMap<const Image*, ImageDecodeTask> ImageDecodeTasks;
+	typedef QMap<const Image*, QImage> ImageDecodeResults;
+
+	class ImageDecodeThread : public QThread {
+	public:
+
+		ImageDecodeThread(QObject *receiver) : _receiver(receiver) {
+		}
+		void run();
+
+	private:
+
+		QObject *_receiver; // onImagesDecoded() slot is invoked in it
+
+	};
+
+	QMutex imageDecodeLock; // guards the fields below
+	QWaitCondition imageDecodeCondition;
+	ImageDecodeTasks imageDecodeTasks;
+	ImageDecodeResults imageDecodeResults;
+	const Image *imageDecoding = 0;
+	bool imageDecodeStop = false;
+
+	ImageDecodeThread *imageDecodeThread = 0;
+
+	void _stopImageDecoder() {
+		if (!imageDecodeThread) return;
+		{
+			QMutexLocker lock(&imageDecodeLock);
+			imageDecodeStop = true;
+			imageDecodeCondition.wakeAll();
+		}
+		imageDecodeThread->wait();
+		delete imageDecodeThread;
+		imageDecodeThread = 0;
+
+		imageDecodeTasks.clear();
+		imageDecodeResults.clear();
+		imageDecodeStop = false;
+	}
 
 	static const uint64 BlurredCacheSkip = 0x1000000000000000LLU;
 	static const uint64 ColoredCacheSkip = 0x2000000000000000LLU;
@@ -41,6 +96,50 @@ namespace {
 	static const uint64 RoundedCacheSkip = 0x4000000000000000LLU;
 }
 
+void ImageDecodeThread::run() {
+	QMutexLocker lock(&imageDecodeLock);
+	while (!imageDecodeStop) {
+		uint64 ms = getms();
+		ImageDecodeTasks::iterator next = imageDecodeTasks.end();
+		for (ImageDecodeTasks::iterator i = imageDecodeTasks.begin(); i != imageDecodeTasks.end();) {
+			if (i->requested + ImageDecodeRequestTimeout < ms) { // not painted anymore, scrolled out of the view
+				i = imageDecodeTasks.erase(i);
+				continue;
+			}
+			if (next == imageDecodeTasks.end() || i->requested > next->requested) { // the most recently painted are the nearest to the view
+				next = i;
+			}
+			++i;
+		}
+		if (next == imageDecodeTasks.end()) {
+			imageDecodeCondition.wait(&imageDecodeLock);
+			continue;
+		}
+
+		ImageDecodeTask task = next.value();
+		imageDecoding = next.key();
+		imageDecodeTasks.erase(next);
+		lock.unlock();
+
+		QImage img;
+		{
+			QBuffer buffer(&task.bytes);
+			QImageReader reader(&buffer, task.format);
+			reader.read(&img);
+		}
+
+		lock.relock();
+		if (imageDecoding) { // the image was not destroyed while decoding
+			bool notify = imageDecodeResults.isEmpty();
+			imageDecodeResults.insert(imageDecoding, img);
+			imageDecoding = 0;
+			if (notify) {
+				QMetaObject::invokeMethod(_receiver, "onImagesDecoded", Qt::QueuedConnection);
+			}
+		}
+	}
+}
+
 bool Image::isNull() const {
 	return (this == blank());
 }
@@ -223,6 +322,174 @@ namespace {
 	static inline uint64 _blurGetColors(const uchar *p) {
 		return (uint64)p[0] + ((uint64)p[1] << 16) + ((uint64)p[2] << 32) + ((uint64)p[3] << 48);
 	}
+
+	const int32 _blurRadius = 3, _blurR1 = _blurRadius + 1; // sum of the triangle weights is _blurR1 * _blurR1 = 16
+
+#ifndef IMAGES_USE_SSE2
+	void _blurLine(const uint32 *src, uchar *dst, int32 count, int32 step) {
+		const uchar *s = reinterpret_cast<const uchar*>(src);
+		uint64 cur = _blurGetColors(s);
+		uint64 rgballsum = -_blurRadius * cur;
+		uint64 rgbsum = cur * ((_blurR1 * (_blurR1 + 1)) >> 1);
+		for (int32 i = 1; i <= _blurRadius; ++i) {
+			cur = _blurGetColors(s + i * 4);
+			rgbsum += cur * (_blurR1 - i);
+			rgballsum += cur;
+		}
+		for (int32 x = 0; x < count; ++x, dst += step) {
+			uint64 res = rgbsum >> 4;
+			dst[0] = res & 0xFF;
+			dst[1] = (res >> 16) & 0xFF;
+			dst[2] = (res >> 32) & 0xFF;
+			dst[3] = (res >> 48) & 0xFF;
+			int32 start = qMax(x - _blurR1, 0), end = qMin(x + _blurR1, count - 1);
+			rgballsum += _blurGetColors(s + start * 4) - 2 * _blurGetColors(s + x * 4) + _blurGetColors(s + end * 4);
+			rgbsum += rgballsum;
+		}
+	}
+#endif
+
+	// blurs src0 to dst0 and src1 to dst1 (if dst1 is not null), dst pixels are step bytes apart
+	void _blurLines(const uint32 *src0, const uint32 *src1, uchar *dst0, uchar *dst1, int32 count, int32 step) {
+#ifdef IMAGES_USE_SSE2
+		// 16 bit lanes: 4 channels of the src0 pixel and 4 channels of the src1 pixel
+		const __m128i zero = _mm_setzero_si128();
+#define load(i) _mm_unpacklo_epi8(_mm_unpacklo_epi32(_mm_cvtsi32_si128(int(src0[i])), _mm_cvtsi32_si128(int(src1[i]))), zero)
+		__m128i cur = load(0);
+		__m128i rgballsum = _mm_mullo_epi16(cur, _mm_set1_epi16(-_blurRadius));
+		__m128i rgbsum = _mm_mullo_epi16(cur, _mm_set1_epi16((_blurR1 * (_blurR1 + 1)) >> 1));
+		for (int32 i = 1; i <= _blurRadius; ++i) {
+			cur = load(i);
+			rgbsum = _mm_add_epi16(rgbsum, _mm_mullo_epi16(cur, _mm_set1_epi16(_blurR1 - i)));
+			rgballsum = _mm_add_epi16(rgballsum, cur);
+		}
+		for (int32 x = 0; x < count; ++x, dst0 += step) {
+			__m128i res = _mm_packus_epi16(_mm_srli_epi16(rgbsum, 4), zero);
+			uint32 res0 = uint32(_mm_cvtsi128_si32(res));
+			memcpy(dst0, &res0, 4);
+			if (dst1) {
+				uint32 res1 = uint32(_mm_cvtsi128_si32(_mm_srli_si128(res, 4)));
+				memcpy(dst1, &res1, 4);
+				dst1 += step;
+			}
+			int32 start = qMax(x - _blurR1, 0), end = qMin(x + _blurR1, count - 1);
+			rgballsum = _mm_add_epi16(rgballsum, _mm_sub_epi16(_mm_add_epi16(load(start), load(end)), _mm_slli_epi16(load(x), 1)));
+			rgbsum = _mm_add_epi16(rgbsum, rgballsum);
+		}
+#undef load
+#else
+		_blurLine(src0, dst0, count, step);
+		if (dst1) _blurLine(src1, dst1, count, step);
+#endif
+	}
+
+	const int32 _scaleWeightShift = 12; // weights of the source pixels for each result pixel sum up to 4096
+	const int32 _scaleLineShift = 5; // horizontally scaled line keeps 7 fraction bits to fit in signed 16 bit
+
+	struct ScaleContribution {
+		int32 first, count, offset; // source pixels [first, first + count) with weights [offset, offset + count)
+	};
+	typedef QVector<ScaleContribution> ScaleContributions;
+	typedef QVector<int16> ScaleWeights;
+
+	void _scaleContributions(int32 from, int32 to, ScaleContributions &contributions, ScaleWeights &weights) {
+		contributions.resize(to);
+		weights.reserve(from + to);
+		for (int32 o = 0; o < to; ++o) {
+			int64 start = int64(o) * from, end = int64(o + 1) * from; // in 1 / to of the source pixel
+			ScaleContribution &c(contributions[o]);
+			c.first = int32(start / to);
+			c.count = int32((end - 1) / to) - c.first + 1;
+			c.offset = weights.size();
+
+			int32 sum = 0, biggest = c.offset;
+			int16 biggestWeight = -1;
+			for (int32 i = c.first; i < c.first + c.count; ++i) {
+				int64 overlap = qMin(int64(i + 1) * to, end) - qMax(int64(i) * to, start);
+				int16 weight = int16((overlap << _scaleWeightShift) / from);
+				if (weight > biggestWeight) {
+					biggest = weights.size();
+					biggestWeight = weight;
+				}
+				weights.push_back(weight);
+				sum += weight;
+			}
+			weights[biggest] += (1 << _scaleWeightShift) - sum;
+		}
+	}
+
+	void _scaleLine(const uint32 *src, int16 *dst, const ScaleContributions &contributions, const int16 *weights) {
+		for (int32 o = 0, count = contributions.size(); o < count; ++o) {
+			const ScaleContribution &c(contributions.at(o));
+			const uint32 *s = src + c.first;
+			const int16 *w = weights + c.offset;
+#ifdef IMAGES_USE_SSE2
+			const __m128i zero = _mm_setzero_si128();
+			__m128i sum = zero;
+			int32 k = 0;
+			for (; k + 1 < c.count; k += 2) {
+				__m128i pix = _mm_unpacklo_epi8(_mm_unpacklo_epi32(_mm_cvtsi32_si128(int(s[k])), _mm_cvtsi32_si128(int(s[k + 1]))), zero);
+				pix = _mm_unpacklo_epi16(pix, _mm_srli_si128(pix, 8)); // b0, b1, g0, g1, r0, r1, a0, a1
+				sum = _mm_add_epi32(sum, _mm_madd_epi16(pix, _mm_set_epi16(w[k + 1], w[k], w[k + 1], w[k], w[k + 1], w[k], w[k + 1], w[k])));
+			}
+			if (k < c.count) {
+				__m128i pix = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(int(s[k])), zero), zero);
+				sum = _mm_add_epi32(sum, _mm_madd_epi16(pix, _mm_set1_epi32(w[k])));
+			}
+			sum = _mm_srai_epi32(_mm_add_epi32(sum, _mm_set1_epi32(1 << (_scaleLineShift - 1))), _scaleLineShift);
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(dst + o * 4), _mm_packs_epi32(sum, zero));
+#else
+			int32 b = 0, g = 0, r = 0, a = 0;
+			for (int32 k = 0; k < c.count; ++k) {
+				uint32 pix = s[k];
+				b += int32(pix & 0xFF) * w[k];
+				g += int32((pix >> 8) & 0xFF) * w[k];
+				r += int32((pix >> 16) & 0xFF) * w[k];
+				a += int32(pix >> 24) * w[k];
+			}
+			dst[o * 4 + 0] = int16((b + (1 << (_scaleLineShift - 1))) >> _scaleLineShift);
+			dst[o * 4 + 1] = int16((g + (1 << (_scaleLineShift - 1))) >> _scaleLineShift);
+			dst[o * 4 + 2] = int16((r + (1 << (_scaleLineShift - 1))) >> _scaleLineShift);
+			dst[o * 4 + 3] = int16((a + (1 << (_scaleLineShift - 1))) >> _scaleLineShift);
+#endif
+		}
+	}
+
+	void _scaleAccumulate(const int16 *line, int32 *sums, int32 count, int16 weight) {
+		int32 i = 0;
+#ifdef IMAGES_USE_SSE2
+		const __m128i zero = _mm_setzero_si128(), w = _mm_set1_epi32(weight);
+		for (; i + 8 <= count; i += 8) {
+			__m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(line + i));
+			__m128i *s = reinterpret_cast<__m128i*>(sums + i);
+			_mm_storeu_si128(s, _mm_add_epi32(_mm_loadu_si128(s), _mm_madd_epi16(_mm_unpacklo_epi16(values, zero), w)));
+			_mm_storeu_si128(s + 1, _mm_add_epi32(_mm_loadu_si128(s + 1), _mm_madd_epi16(_mm_unpackhi_epi16(values, zero), w)));
+		}
+#endif
+		for (; i < count; ++i) {
+			sums[i] += int32(line[i]) * weight;
+		}
+	}
+
+	void _scaleStore(const int32 *sums, uint32 *dst, int32 count) {
+		const int32 shift = _scaleWeightShift + _scaleWeightShift - _scaleLineShift;
+		int32 i = 0;
+#ifdef IMAGES_USE_SSE2
+		const __m128i zero = _mm_setzero_si128(), round = _mm_set1_epi32(1 << (shift - 1));
+		for (; i + 2 <= count; i += 2) {
+			const __m128i *s = reinterpret_cast<const __m128i*>(sums + i * 4);
+			__m128i pix0 = _mm_srai_epi32(_mm_add_epi32(_mm_loadu_si128(s), round), shift);
+			__m128i pix1 = _mm_srai_epi32(_mm_add_epi32(_mm_loadu_si128(s + 1), round), shift);
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(_mm_packs_epi32(pix0, pix1), zero));
+		}
+#endif
+		for (; i < count; ++i) {
+			const int32 *s = sums + i * 4;
+			uint32 b = qMin((s[0] + (1 << (shift - 1))) >> shift, 0xFF), g = qMin((s[1] + (1 << (shift - 1))) >> shift, 0xFF);
+			uint32 r = qMin((s[2] + (1 << (shift - 1))) >> shift, 0xFF), a = qMin((s[3] + (1 << (shift - 1))) >> shift, 0xFF);
+			dst[i] = b | (g << 8) | (r << 16) | (a << 24);
+		}
+	}
 }
 
 QImage imageBlur(QImage img) {
@@ -233,12 +500,9 @@ QImage imageBlur(QImage img) {
 
 	uchar *pix = img.bits();
 	if (pix) {
-		int w = img.width(), h = img.height(), wold = w, hold = h;
-		const int radius = 3;
-		const int r1 = radius + 1;
-		const int div = radius * 2 + 1;
-		const int stride = w * 4;
-		if (radius < 16 && div < w && div < h && stride <= w * 4) {
+		int w = img.width(), h = img.height();
+		const int div = _blurRadius * 2 + 1;
+		if (div < w && div < h) {
 			bool withalpha = img.hasAlphaChannel();
 			if (withalpha) {
 				QImage imgsmall(w, h, img.format());
@@ -247,7 +511,7 @@ QImage imageBlur(QImage img) {
 					p.setCompositionMode(QPainter::CompositionMode_Source);
 					p.setRenderHint(QPainter::SmoothPixmapTransform);
 					p.fillRect(0, 0, w, h, st::transparent->b);
-					p.drawImage(QRect(radius, radius, w - 2 * radius, h - 2 * radius), img, QRect(0, 0, w, h));
+					p.drawImage(QRect(_blurRadius, _blurRadius, w - 2 * _blurRadius, h - 2 * _blurRadius), img, QRect(0, 0, w, h));
 				}
 				QImage was = img;
 				img = imgsmall;
@@ -255,86 +519,67 @@ QImage imageBlur(QImage img) {
 				pix = img.bits();
 				if (!pix) return was;
 			}
-			uint64 *rgb = new uint64[w * h];
-
-			int x, y, i;
-
-			int yw = 0;
-			const int we = w - r1;
-			for (y = 0; y < h; y++) {
-				uint64 cur = _blurGetColors(&pix[yw]);
-				uint64 rgballsum = -radius * cur;
-				uint64 rgbsum = cur * ((r1 * (r1 + 1)) >> 1);
-
-				for (i = 1; i <= radius; i++) {
-					uint64 cur = _blurGetColors(&pix[yw + i * 4]);
-					rgbsum += cur * (r1 - i);
-					rgballsum += cur;
-				}
-
-				x = 0;
-
-#define update(start, middle, end) \
-rgb[y * w + x] = (rgbsum >> 4) & 0x00FF00FF00FF00FFLL; \
-rgballsum += _blurGetColors(&pix[yw + (start) * 4]) - 2 * _blurGetColors(&pix[yw + (middle) * 4]) + _blurGetColors(&pix[yw + (end) * 4]); \
-rgbsum += rgballsum; \
-x++;
-
-				while (x < r1) {
-					update(0, x, x + r1);
-				}
-				while (x < we) {
-					update(x - r1, x, x + r1);
-				}
-				while (x < w) {
-					update(x - r1, x, w - 1);
-				}
-
-#undef update
-
-				yw += stride;
+			const int stride = img.bytesPerLine();
+
+			// both passes are done in place, each line is copied before it is blurred
+			QVector<uint32> lines(2 * qMax(w, h));
+			uint32 *line0 = lines.data(), *line1 = line0 + qMax(w, h);
+			for (int y = 0; y < h; y += 2) {
+				uchar *dst0 = pix + y * stride, *dst1 = (y + 1 < h) ? (dst0 + stride) : 0;
+				memcpy(line0, dst0, w * 4);
+				if (dst1) memcpy(line1, dst1, w * 4);
+				_blurLines(line0, dst1 ? line1 : line0, dst0, dst1, w, 4);
 			}
-
-			const int he = h - r1;
-			for (x = 0; x < w; x++) {
-				uint64 rgballsum = -radius * rgb[x];
-				uint64 rgbsum = rgb[x] * ((r1 * (r1 + 1)) >> 1);
-				for (i = 1; i <= radius; i++) {
-					rgbsum += rgb[i * w + x] * (r1 - i);
-					rgballsum += rgb[i * w + x];
+			for (int x = 0; x < w; x += 2) {
+				uchar *dst0 = pix + x * 4, *dst1 = (x + 1 < w) ? (dst0 + 4) : 0;
+				for (int y = 0; y < h; ++y) {
+					memcpy(line0 + y, dst0 + y * stride, 4);
+					if (dst1) memcpy(line1 + y, dst1 + y * stride, 4);
 				}
+				_blurLines(line0, dst1 ? line1 : line0, dst0, dst1, h, stride);
+			}
+		}
+	}
+	return img;
+}
 
-				y = 0;
-				int yi = x * 4;
-
-#define update(start, middle, end) \
-uint64 res = rgbsum >> 4; \
-pix[yi] = res & 0xFF; \
-pix[yi + 1] = (res >> 16) & 0xFF; \
-pix[yi + 2] = (res >> 32) & 0xFF; \
-pix[yi + 3] = (res >> 48) & 0xFF; \
-rgballsum += rgb[x + (start) * w] - 2 * rgb[x + (middle) * w] + rgb[x + (end) * w]; \
-rgbsum += rgballsum; \
-y++; \
-yi += stride;
+QImage imageScaleDown(QImage img, int32 w, int32 h) {
+	int32 sw = img.width(), sh = img.height();
+	if (w <= 0 || h <= 0 || w > sw || h > sh) {
+		return img.scaled(w, h, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+	}
+	if (w == sw && h == sh) return img;
 
-				while (y < r1) {
-					update(0, y, y + r1);
-				}
-				while (y < he) {
-					update(y - r1, y, y + r1);
-				}
-				while (y < h) {
-					update(y - r1, y, h - 1);
-				}
+	QImage::Format fmt = img.format();
+	if (fmt != QImage::Format_RGB32 && fmt != QImage::Format_ARGB32_Premultiplied) {
+		img = img.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+	}
 
-#undef update
+	ScaleContributions xs, ys;
+	ScaleWeights xweights, yweights;
+	_scaleContributions(sw, w, xs, xweights);
+	_scaleContributions(sh, h, ys, yweights);
+
+	QImage result(w, h, img.format());
+	result.setDevicePixelRatio(img.devicePixelRatio());
+
+	// each source line is scaled horizontally once, it is reused if it contributes to the next result line as well
+	QVector<int16> line(w * 4);
+	QVector<int32> sums(w * 4);
+	int32 lineIndex = -1;
+	for (int32 y = 0; y < h; ++y) {
+		const ScaleContribution &c(ys.at(y));
+		sums.fill(0);
+		for (int32 j = 0; j < c.count; ++j) {
+			if (c.first + j != lineIndex) {
+				lineIndex = c.first + j;
+				_scaleLine(reinterpret_cast<const uint32*>(img.constScanLine(lineIndex)), line.data(), xs, xweights.constData());
 			}
-			
-			delete[] rgb;
+			_scaleAccumulate(line.constData(), sums.data(), w * 4, yweights.at(c.offset + j));
 		}
+		_scaleStore(sums.constData(), reinterpret_cast<uint32*>(result.scanLine(y)), w);
 	}
-	return img;
+	return result;
 }
 
 void imageRound(QImage &img) {
@@ -403,8 +648,10 @@ QPixmap Image::pixNoCache(int32 w, int32 h, bool smooth, bool blurred, bool roun
 	if (w <= 0 || !width() || !height() || (w == width() && (h <= 0 || h == height()))) {
 	} else if (h <= 0) {
 		img = img.scaledToWidth(w, smooth ? Qt::SmoothTransformation : Qt::FastTransformation);
+	} else if (smooth) {
+		img = imageScaleDown(img, w, h);
 	} else {
-		img = img.scaled(w, h, Qt::IgnoreAspectRatio, smooth ? Qt::SmoothTransformation : Qt::FastTransformation);
+		img = img.scaled(w, h, Qt::IgnoreAspectRatio, Qt::FastTransformation);
 	}
 	if (outerw > 0 && outerh > 0) {
 		outerw *= cIntRetinaFactor();
@@ -453,7 +700,7 @@ QPixmap Image::pixBlurredColoredNoCache(const style::color &add, int32 w, int32
 	if (h <= 0) {
 		img = img.scaledToWidth(w, Qt::SmoothTransformation);
 	} else {
-		img = img.scaled(w, h, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+		img = imageScaleDown(img, w, h);
 	}
 
 	return QPixmap::fromImage(imageColored(add, img), Qt::ColorOnly);
@@ -485,6 +732,7 @@ void Image::forget() const {
 }
 
 void Image::restore() const {
+	_lastUsed = ++globalUseCounter;
 	if (!forgot) return;
 	doRestore();
 	const QPixmap &p(pixData());
@@ -494,6 +742,50 @@ void Image::restore() const {
 	forgot = false;
 }
 
+bool Image::ready() const {
+	if (!forgot) return true;
+
+	if (!App::wnd()) {
+		restore();
+		return true;
+	}
+	if (!imageDecodeThread) {
+		imageDecodeThread = new ImageDecodeThread(App::wnd());
+		imageDecodeThread->start();
+	}
+
+	QMutexLocker lock(&imageDecodeLock);
+	ImageDecodeTasks::iterator i = imageDecodeTasks.find(this);
+	if (i != imageDecodeTasks.end()) {
+		i->requested = getms();
+	} else if (imageDecoding != this && !imageDecodeResults.contains(this)) {
+		imageDecodeTasks.insert(this, ImageDecodeTask(saved, format, getms()));
+		imageDecodeCondition.wakeOne();
+	}
+	return false;
+}
+
+void Image::restored(const QImage &decoded) const {
+	if (!forgot) return; // already restored synchronously
+
+	doRestore(QPixmap::fromImage(decoded, Qt::ColorOnly));
+	const QPixmap &p(pixData());
+	if (!p.isNull()) {
+		globalAquiredSize += int64(p.width()) * p.height() * 4;
+	}
+	forgot = false;
+}
+
+Image::~Image() {
+	invalidateSizeCache();
+	if (imageDecodeThread) {
+		QMutexLocker lock(&imageDecodeLock);
+		imageDecodeTasks.remove(this);
+		imageDecodeResults.remove(this);
+		if (imageDecoding == this) imageDecoding = 0;
+	}
+}
+
 void Image::invalidateSizeCache() const {
 	for (Sizes::const_iterator i = _sizesCache.cbegin(), e = _sizesCache.cend(); i != e; ++i) {
 		if (!i->isNull()) {
@@ -572,6 +864,7 @@ void clearStorageImages() {
 }
 
 void clearAllImages() {
+	_stopImageDecoder();
 	for (LocalImages::const_iterator i = localImages.cbegin(), e = localImages.cend(); i != e; ++i) {
 		delete i.value();
 	}
@@ -583,6 +876,36 @@ int64 imageCacheSize() {
 	return globalAquiredSize;
 }
 
+void imagesDecoded() {
+	ImageDecodeResults results;
+	{
+		QMutexLocker lock(&imageDecodeLock);
+		qSwap(results, imageDecodeResults);
+	}
+	for (ImageDecodeResults::const_iterator i = results.cbegin(), e = results.cend(); i != e; ++i) {
+		i.key()->restored(i.value());
+	}
+}
+
+bool forgetImages(int64 size) {
+	typedef QMultiMap<uint64, const Image*> ImagesByUsage;
+	ImagesByUsage images;
+	for (LocalImages::const_iterator i = localImages.cbegin(), e = localImages.cend(); i != e; ++i) {
+		const Image *image = i.value();
+		if (!image->forgot) images.insert(image->_lastUsed, image);
+	}
+	for (StorageImages::const_iterator i = storageImages.cbegin(), e = storageImages.cend(); i != e; ++i) {
+		const Image *image = i.value();
+		if (!image->forgot) images.insert(image->_lastUsed, image);
+	}
+
+	int64 was = globalAquiredSize;
+	for (ImagesByUsage::const_iterator i = images.cbegin(), e = images.cend(); i != e && was - globalAquiredSize < size; ++i) {
+		i.value()->forget();
+	}
+	return (was - globalAquiredSize >= size);
+}
+
 StorageImage::StorageImage(const StorageImageLocation &location, int32 size) : w(location.width), h(location.height), loader(new mtpFileLoader(location.dc, location.volume, location.local, location.secret, size)) {
 }
 
@@ -701,3 +1024,225 @@ StorageImage *getImage(const StorageImageLocation &location, const QByteArray &b
 	}
 	return i.value();
 }
+
+#ifdef _WITH_SELFTEST
+
+namespace {
+	QImage _imageBlurScalar(QImage img) { // imageBlur before the SSE2 kernels, to compare with
+		QImage::Format fmt = img.format();
+		if (fmt != QImage::Format_RGB32 && fmt != QImage::Format_ARGB32_Premultiplied) {
+			img = img.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+		}
+
+		uchar *pix = img.bits();
+		if (pix) {
+			int w = img.width(), h = img.height();
+			const int radius = 3;
+			const int r1 = radius + 1;
+			const int div = radius * 2 + 1;
+			const int stride = w * 4;
+			if (radius < 16 && div < w && div < h && stride <= w * 4) {
+				bool withalpha = img.hasAlphaChannel();
+				if (withalpha) {
+					QImage imgsmall(w, h, img.format());
+					{
+						QPainter p(&imgsmall);
+						p.setCompositionMode(QPainter::CompositionMode_Source);
+						p.setRenderHint(QPainter::SmoothPixmapTransform);
+						p.fillRect(0, 0, w, h, st::transparent->b);
+						p.drawImage(QRect(radius, radius, w - 2 * radius, h - 2 * radius), img, QRect(0, 0, w, h));
+					}
+					QImage was = img;
+					img = imgsmall;
+					imgsmall = QImage();
+					pix = img.bits();
+					if (!pix) return was;
+				}
+				uint64 *rgb = new uint64[w * h];
+
+				int x, y, i;
+
+				int yw = 0;
+				const int we = w - r1;
+				for (y = 0; y < h; y++) {
+					uint64 cur = _blurGetColors(&pix[yw]);
+					uint64 rgballsum = -radius * cur;
+					uint64 rgbsum = cur * ((r1 * (r1 + 1)) >> 1);
+
+					for (i = 1; i <= radius; i++) {
+						uint64 cur = _blurGetColors(&pix[yw + i * 4]);
+						rgbsum += cur * (r1 - i);
+						rgballsum += cur;
+					}
+
+					x = 0;
+
+#define update(start, middle, end) \
+rgb[y * w + x] = (rgbsum >> 4) & 0x00FF00FF00FF00FFLL; \
+rgballsum += _blurGetColors(&pix[yw + (start) * 4]) - 2 * _blurGetColors(&pix[yw + (middle) * 4]) + _blurGetColors(&pix[yw + (end) * 4]); \
+rgbsum += rgballsum; \
+x++;
+
+					while (x < r1) {
+						update(0, x, x + r1);
+					}
+					while (x < we) {
+						update(x - r1, x, x + r1);
+					}
+					while (x < w) {
+						update(x - r1, x, w - 1);
+					}
+
+#undef update
+
+					yw += stride;
+				}
+
+				const int he = h - r1;
+				for (x = 0; x < w; x++) {
+					uint64 rgballsum = -radius * rgb[x];
+					uint64 rgbsum = rgb[x] * ((r1 * (r1 + 1)) >> 1);
+					for (i = 1; i <= radius; i++) {
+						rgbsum += rgb[i * w + x] * (r1 - i);
+						rgballsum += rgb[i * w + x];
+					}
+
+					y = 0;
+					int yi = x * 4;
+
+#define update(start, middle, end) \
+uint64 res = rgbsum >> 4; \
+pix[yi] = res & 0xFF; \
+pix[yi + 1] = (res >> 16) & 0xFF; \
+pix[yi + 2] = (res >> 32) & 0xFF; \
+pix[yi + 3] = (res >> 48) & 0xFF; \
+rgballsum += rgb[x + (start) * w] - 2 * rgb[x + (middle) * w] + rgb[x + (end) * w]; \
+rgbsum += rgballsum; \
+y++; \
+yi += stride;
+
+					while (y < r1) {
+						update(0, y, y + r1);
+					}
+					while (y < he) {
+						update(y - r1, y, y + r1);
+					}
+					while (y < h) {
+						update(y - r1, y, h - 1);
+					}
+
+#undef update
+				}
+
+				delete[] rgb;
+			}
+		}
+		return img;
+	}
+}
+
+bool imageScaleTest() {
+	bool result = true;
+	for (int32 from = 1; from <= 300; from += 7) {
+		for (int32 to = 1; to <= from; to += 3) {
+			ScaleContributions contributions;
+			ScaleWeights weights;
+			_scaleContributions(from, to, contributions, weights);
+			for (int32 o = 0; o < to; ++o) {
+				const ScaleContribution &c(contributions.at(o));
+				int32 sum = 0;
+				for (int32 k = 0; k < c.count; ++k) {
+					if (weights.at(c.offset + k) < 0) result = false;
+					sum += weights.at(c.offset + k);
+				}
+				if (c.offset + c.count > weights.size() || c.first + c.count > from || sum != (1 << _scaleWeightShift)) {
+					LOG(("Test Error: bad scale contributions %1 -> %2 for pixel %3").arg(from).arg(to).arg(o));
+					result = false;
+				}
+			}
+		}
+	}
+
+	QImage noise(97, 61, QImage::Format_RGB32); // odd sizes for the last line and column pairs
+	for (int32 y = 0; y < noise.height(); ++y) {
+		QRgb *line = reinterpret_cast<QRgb*>(noise.scanLine(y));
+		for (int32 x = 0; x < noise.width(); ++x) {
+			line[x] = qRgb(rand() & 0xFF, rand() & 0xFF, rand() & 0xFF);
+		}
+	}
+	QImage blurred = imageBlur(noise), blurredScalar = _imageBlurScalar(noise);
+	for (int32 y = 0; y < noise.height(); ++y) {
+		if (memcmp(blurred.constScanLine(y), blurredScalar.constScanLine(y), noise.width() * 4)) {
+			LOG(("Test Error: imageBlur differs from the scalar blur in line %1").arg(y));
+			result = false;
+			break;
+		}
+	}
+
+	QImage uniform(640, 480, QImage::Format_ARGB32_Premultiplied);
+	uniform.fill(qRgba(32, 64, 128, 255));
+	QImage scaled = imageScaleDown(uniform, 90, 67);
+	if (scaled.width() != 90 || scaled.height() != 67) {
+		LOG(("Test Error: scaled image is %1x%2 instead of 90x67").arg(scaled.width()).arg(scaled.height()));
+		result = false;
+	} else {
+		for (int32 y = 0; y < 67; ++y) {
+			const QRgb *line = reinterpret_cast<const QRgb*>(scaled.constScanLine(y));
+			for (int32 x = 0; x < 90; ++x) {
+				if (qAbs(qRed(line[x]) - 32) > 1 || qAbs(qGreen(line[x]) - 64) > 1 || qAbs(qBlue(line[x]) - 128) > 1 || qAlpha(line[x]) < 254) {
+					LOG(("Test Error: uniform image scaled to %1 at %2, %3").arg(line[x], 8, 16, QChar('0')).arg(x).arg(y));
+					return false;
+				}
+			}
+		}
+	}
+	return result;
+}
+
+void imageScaleBenchmark() {
+	QImage photo(1280, 960, QImage::Format_RGB32); // like a received photo, noise with gradients
+	for (int32 y = 0; y < photo.height(); ++y) {
+		QRgb *line = reinterpret_cast<QRgb*>(photo.scanLine(y));
+		for (int32 x = 0; x < photo.width(); ++x) {
+			line[x] = qRgb((x * 255) / photo.width(), (y * 255) / photo.height(), rand() & 0xFF);
+		}
+	}
+
+	int32 sizes[] = { 90, 320 };
+	for (int32 i = 0; i < int32(sizeof(sizes) / sizeof(sizes[0])); ++i) {
+		int32 w = sizes[i], h = (photo.height() * w) / photo.width();
+		const int32 iterations = 50;
+
+		QElapsedTimer timer;
+		timer.start();
+		for (int32 j = 0; j < iterations; ++j) {
+			imageScaleDown(photo, w, h);
+		}
+		qint64 own = timer.nsecsElapsed() / iterations;
+
+		timer.restart();
+		for (int32 j = 0; j < iterations; ++j) {
+			photo.scaled(w, h, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+		}
+		qint64 qt = timer.nsecsElapsed() / iterations;
+
+		LOG(("Benchmark: scale %1x%2 to %3x%4, imageScaleDown %5 us, QImage::scaled %6 us").arg(photo.width()).arg(photo.height()).arg(w).arg(h).arg(own / 1000).arg(qt / 1000));
+
+		QImage thumb = imageScaleDown(photo, w, h);
+		timer.restart();
+		for (int32 j = 0; j < iterations; ++j) {
+			imageBlur(thumb);
+		}
+		qint64 blur = timer.nsecsElapsed() / iterations;
+
+		timer.restart();
+		for (int32 j = 0; j < iterations; ++j) {
+			_imageBlurScalar(thumb);
+		}
+		qint64 scalar = timer.nsecsElapsed() / iterations;
+
+		LOG(("Benchmark: blur %1x%2, imageBlur %3 us, previous scalar blur %4 us").arg(w).arg(h).arg(blur / 1000., 0, 'f', 1).arg(scalar / 1000., 0, 'f', 1));
+	}
+}
+
+#endif
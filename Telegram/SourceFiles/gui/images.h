@@ -20,8 +20,14 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 #include <QtGui/QPixmap>
 
 QImage imageBlur(QImage img);
+QImage imageScaleDown(QImage img, int32 w, int32 h); // smooth scale, done by area averaging if the image is not enlarged
 void imageRound(QImage &img);
 
+#ifdef _WITH_SELFTEST
+bool imageScaleTest(); // checks scale weights, a uniform image and the blur against the scalar one, see -selftest
+void imageScaleBenchmark(); // scales a photo to 90px and 320px thumbs and blurs them, see -benchmark
+#endif
+
 struct StorageImageLocation {
 	StorageImageLocation() : width(0), height(0), dc(0), volume(0), local(0), secret(0) {
 	}
@@ -49,7 +55,7 @@ inline bool operator!=(const StorageImageLocation &a, const StorageImageLocation
 class Image {
 public:
 
-	Image(QByteArray format = "PNG") : format(format), forgot(false) {
+	Image(QByteArray format = "PNG") : format(format), forgot(false), _lastUsed(0) {
 	}
 	virtual bool loaded() const {
 		return true;
@@ -81,6 +87,7 @@ public:
 	
 	void forget() const;
 	void restore() const;
+	bool ready() const; // false if forgotten, the decoding is requested in the background then
 
 	QByteArray savedFormat() const {
 		return format;
@@ -89,15 +96,14 @@ public:
 		return saved;
 	}
 
-	virtual ~Image() {
-		invalidateSizeCache();
-	}
+	virtual ~Image();
 
 protected:
 
 	virtual const QPixmap &pixData() const = 0;
 	virtual void doForget() const = 0;
 	virtual void doRestore() const = 0;
+	virtual void doRestore(const QPixmap &decoded) const = 0;
 
 	void invalidateSizeCache() const;
 
@@ -106,8 +112,13 @@ protected:
 
 private:
 
+	friend void imagesDecoded();
+	friend bool forgetImages(int64 size);
+	void restored(const QImage &decoded) const;
+
 	typedef QMap<uint64, QPixmap> Sizes;
 	mutable Sizes _sizesCache;
+	mutable uint64 _lastUsed;
 
 };
 
@@ -134,6 +145,9 @@ protected:
 		QImageReader reader(&buffer, format);
 		data = QPixmap::fromImageReader(&reader, Qt::ColorOnly);
 	}
+	void doRestore(const QPixmap &decoded) const {
+		data = decoded;
+	}
 
 private:
 
@@ -246,6 +260,9 @@ protected:
 		QImageReader reader(&buffer, format);
 		data = QPixmap::fromImageReader(&reader, Qt::ColorOnly);
 	}
+	void doRestore(const QPixmap &decoded) const {
+		data = decoded;
+	}
 
 private:
 
@@ -277,6 +294,8 @@ public:
 void clearStorageImages();
 void clearAllImages();
 int64 imageCacheSize();
+void imagesDecoded(); // applies the images decoded in the background, called by the main window
+bool forgetImages(int64 size); // forgets the least recently painted images, true if freed enough
 
 struct FileLocation {
 	FileLocation(StorageFileType type, const QString &name, const QDateTime &modified, qint32 size) : type(type), name(name), modified(modified), size(size) {
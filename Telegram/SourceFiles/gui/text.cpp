@@ -48,8 +48,43 @@ namespace {
 	inline QFixed _blockRBearing(const ITextBlock *b) {
 		return (b->type() == TextBlockText) ? static_cast<const TextBlock*>(b)->f_rbearing() : 0;
 	}
+
+	typedef QLinkedList<const Text*> ShapedTexts; // texts with shaped lines, the least recently drawn first
+	typedef QHash<const Text*, ShapedTexts::iterator> ShapedTextsMap;
+	ShapedTexts *_shapedTexts = 0; // never deleted, static Text objects could be destroyed after them
+	ShapedTextsMap *_shapedTextsMap = 0;
+	int32 _shapedLinesCount = 0;
+
+	void _shapedTextDrawn(const Text *t) { // move to back
+		if (!_shapedTexts) {
+			_shapedTexts = new ShapedTexts();
+			_shapedTextsMap = new ShapedTextsMap();
+		}
+		ShapedTextsMap::iterator i = _shapedTextsMap->find(t);
+		if (i == _shapedTextsMap->end()) {
+			_shapedTextsMap->insert(t, _shapedTexts->insert(_shapedTexts->end(), t));
+		} else if (_shapedTexts->back() != t) {
+			_shapedTexts->erase(i.value());
+			i.value() = _shapedTexts->insert(_shapedTexts->end(), t);
+		}
+	}
+
+	void _shapedTextForget(const Text *t) {
+		ShapedTextsMap::iterator i = _shapedTextsMap->find(t);
+		if (i != _shapedTextsMap->end()) {
+			_shapedTexts->erase(i.value());
+			_shapedTextsMap->erase(i);
+		}
+	}
 }
 
+struct TextShapedLine {
+	TextShapedLine(const QString &text, const QFont &font, int32 from, int32 length) : engine(text, font), from(from), length(length) {
+	}
+	QTextEngine engine; // itemized and shaped
+	int32 from, length; // QScriptLine of the engine
+};
+
 const QRegularExpression &reDomain() {
 	return _reDomain;
 }
@@ -1188,21 +1223,38 @@ public:
 
 		if (trimmedLineEnd == _lineStart && !elidedLine) return true;
 
-		if (!elidedLine) initParagraphBidi(); // if was not inited
-
 		_f = _t->_font;
-		QStackTextEngine engine(lineText, _f->f);
-		engine.option.setTextDirection(_parDirection);
-		_e = &engine;
-
-		eItemize();
 
 		QScriptLine line;
 		line.from = lineStart;
 		line.length = lineLength;
-		eShapeLine(line);
 
-		int firstItem = engine.findItem(line.from), lastItem = engine.findItem(line.from + line.length - 1);
+		bool cacheLine = !elidedLine && !overLnkInLine(lineEnd);
+		TextShapedLine *shaped = cacheLine ? findShapedLine(lineText, line) : 0;
+		QStackTextEngine stackEngine(cacheLine ? QString() : lineText, _f->f);
+		QTextEngine *engine = &stackEngine;
+		if (shaped) {
+			engine = &shaped->engine;
+			engine->fnt = _f->f;
+			engine->resetFontEngineCache();
+			_e = engine;
+		} else {
+			initParagraphBidi(); // if was not inited
+
+			if (cacheLine) {
+				shaped = new TextShapedLine(lineText, _f->f, line.from, line.length);
+				engine = &shaped->engine;
+			}
+			engine->option.setTextDirection(_parDirection);
+			_e = engine;
+
+			eItemize();
+			eShapeLine(line);
+
+			if (shaped) insertShapedLine(shaped);
+		}
+
+		int firstItem = engine->findItem(line.from), lastItem = engine->findItem(line.from + line.length - 1);
 	    int nItems = (firstItem >= 0 && lastItem >= firstItem) ? (lastItem - firstItem + 1) : 0;
 		if (!nItems) {
 			if (elidedLine) restoreAfterElided();
@@ -1212,7 +1264,7 @@ public:
 		QVarLengthArray<int> visualOrder(nItems);
 		QVarLengthArray<uchar> levels(nItems);
 		for (int i = 0; i < nItems; ++i) {
-			QScriptItem &si(engine.layoutData->items[firstItem + i]);
+			QScriptItem &si(engine->layoutData->items[firstItem + i]);
 			while (nextBlock && nextBlock->from() <= _localFrom + si.position) {
 				currentBlock = nextBlock;
 				nextBlock = (++blockIndex < _blocksSize) ? _t->_blocks[blockIndex] : 0;
@@ -1241,7 +1293,7 @@ public:
 		if (_p) _p->setPen(blockPen(currentBlock));
 		for (int i = 0; i < nItems; ++i) {
 			int item = firstItem + visualOrder[i];
-			const QScriptItem &si = engine.layoutData->items.at(item);
+			const QScriptItem &si = engine->layoutData->items.at(item);
 			bool rtl = (si.analysis.bidiLevel % 2);
 
 			while (blockIndex > _lineStartBlock + 1 && _t->_blocks[blockIndex - 1]->from() > _localFrom + si.position) {
@@ -1335,11 +1387,11 @@ public:
 				continue;
 			}
 
-			unsigned short *logClusters = engine.logClusters(&si);
-			QGlyphLayout glyphs = engine.shapedGlyphs(&si);
+			unsigned short *logClusters = engine->logClusters(&si);
+			QGlyphLayout glyphs = engine->shapedGlyphs(&si);
 
 			int itemStart = qMax(line.from, si.position), itemEnd;
-			int itemLength = engine.length(item);
+			int itemLength = engine->length(item);
 			int glyphsStart = logClusters[itemStart - si.position], glyphsEnd;
 			if (line.from + line.length < si.position + itemLength) {
 				itemEnd = line.from + line.length;
@@ -1405,8 +1457,8 @@ public:
 			} else if (_p) {
 				QTextCharFormat format;
 				QTextItemInt gf(glyphs.mid(glyphsStart, glyphsEnd - glyphsStart),
-								&_e->fnt, engine.layoutData->string.unicode() + itemStart,
-								itemEnd - itemStart, engine.fontEngine(si), format);
+								&_e->fnt, engine->layoutData->string.unicode() + itemStart,
+								itemEnd - itemStart, engine->fontEngine(si), format);
 				gf.logClusters = logClusters + itemStart - si.position;
 				gf.width = itemWidth;
 				gf.justified = false;
@@ -1462,6 +1514,55 @@ public:
 		return true;
 	}
 
+	bool overLnkInLine(int32 lineEnd) { // the hovered link is shaped with other font flags
+		if (!_overLnk) return false;
+		for (int32 i = _lineStartBlock; i < _blocksSize; ++i) {
+			ITextBlock *b = _t->_blocks[i];
+			if (b->from() >= lineEnd) break;
+			if (b->lnkIndex() && _t->_links.at(b->lnkIndex() - 1) == _overLnk) return true;
+		}
+		return false;
+	}
+
+	TextShapedLine *findShapedLine(const QString &lineText, const QScriptLine &line) {
+		if (_t->_shapedWidth != _w || _t->_shapedStyle != _textStyle) {
+			_t->clearShapedLines();
+			_t->_shapedWidth = _w;
+			_t->_shapedStyle = _textStyle;
+			return 0;
+		}
+		Text::ShapedLines::iterator i = _t->_shapedLines.find(_lineStart);
+		if (i == _t->_shapedLines.end()) return 0;
+
+		TextShapedLine *shaped = i.value();
+		if (shaped->from != line.from || shaped->length != line.length || shaped->engine.option.textDirection() != _parDirection || shaped->engine.text != lineText) {
+			delete shaped;
+			_t->_shapedLines.erase(i);
+			--_shapedLinesCount;
+			return 0;
+		}
+		_shapedTextDrawn(_t);
+		return shaped;
+	}
+
+	void insertShapedLine(TextShapedLine *shaped) {
+		Text::ShapedLines::iterator i = _t->_shapedLines.find(_lineStart);
+		if (i != _t->_shapedLines.end()) {
+			delete i.value();
+			i.value() = shaped;
+		} else {
+			_t->_shapedLines.insert(_lineStart, shaped);
+			++_shapedLinesCount;
+		}
+		_shapedTextDrawn(_t);
+
+		while (_shapedLinesCount > TextShapedLinesLimit) { // forget the lines of the least recently drawn text
+			const Text *oldest = _shapedTexts->front();
+			if (oldest == _t) break; // only the text being drawn is left
+			oldest->clearShapedLines();
+		}
+	}
+
 	void elideSaveBlock(int32 blockIndex, ITextBlock *&_endBlock, int32 elideStart, int32 elideWidth) {
 		_elideSavedIndex = blockIndex;
 		_elideSavedBlock = _t->_blocks[blockIndex];
@@ -2252,10 +2353,10 @@ const TextParseOptions _textPlainOptions = {
 	Qt::LayoutDirectionAuto, // dir
 };
 
-Text::Text(int32 minResizeWidth) : _minResizeWidth(minResizeWidth), _maxWidth(0), _minHeight(0), _startDir(Qt::LayoutDirectionAuto) {
+Text::Text(int32 minResizeWidth) : _minResizeWidth(minResizeWidth), _maxWidth(0), _minHeight(0), _startDir(Qt::LayoutDirectionAuto), _shapedWidth(0), _shapedStyle(0) {
 }
 
-Text::Text(style::font font, const QString &text, const TextParseOptions &options, int32 minResizeWidth, bool richText) : _minResizeWidth(minResizeWidth) {
+Text::Text(style::font font, const QString &text, const TextParseOptions &options, int32 minResizeWidth, bool richText) : _minResizeWidth(minResizeWidth), _shapedWidth(0), _shapedStyle(0) {
 	if (richText) {
 		setRichText(font, text, options);
 	} else {
@@ -2270,7 +2371,8 @@ _text(other._text),
 _font(other._font),
 _blocks(other._blocks.size()),
 _links(other._links),
-_startDir(other._startDir)
+_startDir(other._startDir),
+_shapedWidth(0), _shapedStyle(0)
 {
 	for (int32 i = 0, l = _blocks.size(); i < l; ++i) {
 		_blocks[i] = other._blocks.at(i)->clone();
@@ -2278,6 +2380,7 @@ _startDir(other._startDir)
 }
 
 Text &Text::operator=(const Text &other) {
+	clearShapedLines();
 	_minResizeWidth = other._minResizeWidth;
 	_maxWidth = other._maxWidth;
 	_minHeight = other._minHeight;
@@ -2554,6 +2657,7 @@ int32 Text::countHeight(int32 w) const {
 }
 
 void Text::replaceFont(style::font f) {
+	clearShapedLines();
 	_font = f;
 }
 
@@ -2669,7 +2773,19 @@ QString Text::original(uint16 selectedFrom, uint16 selectedTo, bool expandLinks)
 	return result;
 }
 
+void Text::clearShapedLines() const {
+	if (_shapedLines.isEmpty()) return;
+
+	for (ShapedLines::const_iterator i = _shapedLines.cbegin(), e = _shapedLines.cend(); i != e; ++i) {
+		delete i.value();
+	}
+	_shapedLinesCount -= _shapedLines.size();
+	_shapedLines.clear();
+	_shapedTextForget(this);
+}
+
 void Text::clean() {
+	clearShapedLines();
 	for (TextBlocks::iterator i = _blocks.begin(), e = _blocks.end(); i != e; ++i) {
 		delete *i;
 	}
@@ -4297,3 +4413,77 @@ LinkRanges textParseLinks(const QString &text, int32 flags, bool rich) { // some
 void emojiDraw(QPainter &p, EmojiPtr e, int x, int y) {
 	p.drawPixmap(QPoint(x, y), App::emojis(), QRect(e->x * ESize, e->y * ESize, ESize, ESize));
 }
+
+#ifdef _WITH_SELFTEST
+
+void textPaintBenchmark() {
+	const char *phrases[] = {
+		"Hello, how are you doing today? ",
+		"\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82, \xD0\xBA\xD0\xB0\xD0\xBA \xD0\xB4\xD0\xB5\xD0\xBB\xD0\xB0? ", // russian
+		"\xD7\xA9\xD7\x9C\xD7\x95\xD7\x9D \xD7\xA2\xD7\x95\xD7\x9C\xD7\x9D ", // hebrew
+		"see https://telegram.org for details ",
+		"the quick brown fox jumps over the lazy dog ",
+	};
+	const int32 phrasesCount = sizeof(phrases) / sizeof(phrases[0]), width = 320, iterations = 20;
+
+	QVector<Text*> texts; // like a screen of history messages, a few lines each
+	for (int32 i = 0; i < 40; ++i) {
+		QString text;
+		for (int32 j = 0, l = 2 + (i % 7); j < l; ++j) {
+			text += QString::fromUtf8(phrases[(i + j) % phrasesCount]);
+		}
+		texts.push_back(new Text(st::msgFont, text, _defaultOptions));
+	}
+	int32 height = 0, lines = 0;
+	for (int32 i = 0, l = texts.size(); i < l; ++i) {
+		int32 h = texts.at(i)->countHeight(width);
+		height += h;
+		lines += h / st::msgFont->height;
+	}
+
+	QImage canvas(width, height, QImage::Format_ARGB32_Premultiplied);
+	canvas.fill(Qt::white);
+	QPainter p(&canvas);
+
+	QElapsedTimer timer;
+	timer.start();
+	for (int32 j = 0; j < iterations; ++j) {
+		for (int32 i = 0, l = texts.size(), top = 0; i < l; top += texts.at(i)->countHeight(width), ++i) {
+			texts.at(i)->replaceFont(st::msgFont); // drops the shaped lines
+			texts.at(i)->draw(p, 0, top, width);
+		}
+	}
+	qint64 shaping = timer.nsecsElapsed() / iterations;
+
+	timer.restart();
+	for (int32 j = 0; j < iterations; ++j) {
+		for (int32 i = 0, l = texts.size(), top = 0; i < l; top += texts.at(i)->countHeight(width), ++i) {
+			texts.at(i)->draw(p, 0, top, width);
+		}
+	}
+	qint64 cached = timer.nsecsElapsed() / iterations;
+
+	LOG(("Benchmark: paint %1 texts with %2 lines, shaping each paint %3 us, with shaped lines %4 us").arg(texts.size()).arg(lines).arg(shaping / 1000).arg(cached / 1000));
+
+	QVector<Text*> more; // scrolling through a long history, more lines than TextShapedLinesLimit
+	for (int32 i = 0, l = (2 * TextShapedLinesLimit) / qMax(lines / texts.size(), 1); i < l; ++i) {
+		more.push_back(new Text(*texts.at(i % texts.size())));
+	}
+	timer.restart();
+	for (int32 i = 0, l = more.size(); i < l; ++i) {
+		more.at(i)->draw(p, 0, 0, width);
+	}
+	qint64 evicting = timer.nsecsElapsed() / more.size();
+
+	LOG(("Benchmark: paint %1 texts over the shaped lines limit, %2 us per text").arg(more.size()).arg(evicting / 1000., 0, 'f', 1));
+
+	p.end();
+	for (int32 i = 0, l = more.size(); i < l; ++i) {
+		delete more.at(i);
+	}
+	for (int32 i = 0, l = texts.size(); i < l; ++i) {
+		delete texts.at(i);
+	}
+}
+
+#endif
@@ -464,6 +464,7 @@ enum TextSelectType {
 typedef QPair<QString, QString> TextCustomTag; // open str and close str
 typedef QMap<QChar, TextCustomTag> TextCustomTagsMap;
 
+struct TextShapedLine;
 class Text {
 public:
 
@@ -548,6 +549,13 @@ private:
 
 	Qt::LayoutDirection _startDir;
 
+	// shaped glyph runs of the drawn lines by line start, for the line break width and text style below
+	typedef QMap<uint16, TextShapedLine*> ShapedLines;
+	mutable ShapedLines _shapedLines;
+	mutable QFixed _shapedWidth;
+	mutable const style::textStyle *_shapedStyle;
+	void clearShapedLines() const;
+
 	friend class TextParser;
 	friend class TextPainter;
 
@@ -587,6 +595,10 @@ QString textcmdStartColor(const style::color &color);
 QString textcmdStopColor();
 const QChar *textSkipCommand(const QChar *from, const QChar *end, bool canLink = true);
 
+#ifdef _WITH_SELFTEST
+void textPaintBenchmark(); // paints history like texts with and without shaped lines, see -benchmark
+#endif
+
 inline bool chIsSpace(QChar ch, bool rich = false) {
 	return ch.isSpace() || (ch < 32 && !(rich && ch == TextCommand)) || (ch == QChar::ParagraphSeparator) || (ch == QChar::LineSeparator) || (ch == QChar::ObjectReplacementCharacter) || (ch == QChar::SoftHyphen) || (ch == QChar::CarriageReturn) || (ch == QChar::Tabulation);
 }
@@ -294,14 +294,14 @@ void FakeDialogRow::paint(QPainter &p, int32 w, bool act, bool sel) const {
 	history->nameText.drawElided(p, rectForName.left(), rectForName.top(), rectForName.width());
 }
 
-History::History(const PeerId &peerId) : width(0), height(0)
+History::History(PeerData *peer) : width(0), height(0)
 , msgCount(0)
 , unreadCount(0)
 , inboxReadTill(0)
 , outboxReadTill(0)
 , showFrom(0)
 , unreadBar(0)
-, peer(App::peer(peerId))
+, peer(peer)
 , oldLoaded(false)
 , newLoaded(true)
 , lastMsg(0)
@@ -412,6 +412,199 @@ void History::eraseFromOverview(MediaOverviewType type, MsgId msgId) {
 	if (App::wnd()) App::wnd()->mediaOverviewUpdated(peer, type);
 }
 
+namespace {
+	uint32 _dialogRowPrioritySeed = 0x9E3779B9U;
+
+	uint32 _dialogRowPriority() { // xorshift, only needs to be cheap and well spread
+		_dialogRowPrioritySeed ^= _dialogRowPrioritySeed << 13;
+		_dialogRowPrioritySeed ^= _dialogRowPrioritySeed >> 17;
+		_dialogRowPrioritySeed ^= _dialogRowPrioritySeed << 5;
+		return _dialogRowPrioritySeed;
+	}
+
+	inline int32 _dialogRowSize(const DialogRow *row) {
+		return row ? row->size : 0;
+	}
+
+	inline void _dialogRowUpdate(DialogRow *row) {
+		row->size = _dialogRowSize(row->left) + _dialogRowSize(row->right) + 1;
+		if (row->left) row->left->parent = row;
+		if (row->right) row->right->parent = row;
+	}
+
+	DialogRow *_dialogRowsMerge(DialogRow *a, DialogRow *b) { // all of a go before all of b
+		if (!a) return b;
+		if (!b) return a;
+		if (a->priority > b->priority) {
+			a->right = _dialogRowsMerge(a->right, b);
+			_dialogRowUpdate(a);
+			return a;
+		}
+		b->left = _dialogRowsMerge(a, b->left);
+		_dialogRowUpdate(b);
+		return b;
+	}
+
+	void _dialogRowsSplit(DialogRow *root, int32 count, DialogRow *&a, DialogRow *&b) { // first count rows go to a
+		if (!root) {
+			a = b = 0;
+			return;
+		}
+		int32 leftSize = _dialogRowSize(root->left);
+		if (leftSize < count) {
+			_dialogRowsSplit(root->right, count - leftSize - 1, root->right, b);
+			_dialogRowUpdate(root);
+			a = root;
+		} else {
+			_dialogRowsSplit(root->left, count, a, root->left);
+			_dialogRowUpdate(root);
+			b = root;
+		}
+	}
+}
+
+int32 DialogRow::pos() const {
+	int32 result = _dialogRowSize(left);
+	for (const DialogRow *n = this; n->parent; n = n->parent) {
+		if (n == n->parent->right) {
+			result += _dialogRowSize(n->parent->left) + 1;
+		}
+	}
+	return result;
+}
+
+DialogRow *DialogsList::rowAt(int32 pos) const {
+	DialogRow *n = root;
+	while (n) {
+		int32 leftSize = _dialogRowSize(n->left);
+		if (pos < leftSize) {
+			n = n->left;
+		} else if (pos > leftSize) {
+			pos -= leftSize + 1;
+			n = n->right;
+		} else {
+			return n;
+		}
+	}
+	return 0;
+}
+
+void DialogsList::treeInsert(DialogRow *row, int32 pos) {
+	row->left = row->right = row->parent = 0;
+	row->size = 1;
+	row->priority = _dialogRowPriority();
+
+	DialogRow *a, *b;
+	_dialogRowsSplit(root, pos, a, b);
+	root = _dialogRowsMerge(_dialogRowsMerge(a, row), b);
+	root->parent = 0;
+}
+
+void DialogsList::treeRemove(DialogRow *row) {
+	DialogRow *parent = row->parent, *sub = _dialogRowsMerge(row->left, row->right);
+	if (sub) sub->parent = parent;
+	if (!parent) {
+		root = sub;
+	} else if (parent->left == row) {
+		parent->left = sub;
+	} else {
+		parent->right = sub;
+	}
+	for (DialogRow *n = parent; n; n = n->parent) {
+		--n->size;
+	}
+	row->left = row->right = row->parent = 0;
+	row->size = 1;
+}
+
+bool DialogsList::insertBefore(DialogRow *row, DialogRow *before) {
+	if (row == before) return false;
+
+	remove(row);
+	link(row, before);
+	return true;
+}
+
+void DialogsList::link(DialogRow *row, DialogRow *before) {
+	row->next = before; // update row
+	row->prev = before->prev;
+	row->next->prev = row; // update row->next
+	if (row->prev) { // update row->prev
+		row->prev->next = row;
+	} else {
+		begin = row;
+	}
+	treeInsert(row, before->pos());
+}
+
+DialogRow *DialogsList::adjustByName(const PeerData *peer) {
+	if (sortMode != DialogsSortByName) return 0;
+
+	RowByPeer::iterator i = rowByPeer.find(peer->id);
+	if (i == rowByPeer.cend()) return 0;
+
+	DialogRow *row = i.value();
+	if ((!row->prev || !(row->prev->history->peer->name > peer->name)) && (row->next == end || !(row->next->history->peer->name < peer->name))) {
+		return row;
+	}
+
+	remove(row);
+	int32 from = 0, till = count - 1; // binary search among the other rows, till is the end sentinel
+	while (from < till) {
+		int32 middle = (from + till) / 2;
+		if (rowAt(middle)->history->peer->name > peer->name) {
+			till = middle;
+		} else {
+			from = middle + 1;
+		}
+	}
+	link(row, rowAt(from));
+	return row;
+}
+
+DialogRow *DialogsList::addByName(History *history) {
+	if (sortMode != DialogsSortByName) return 0;
+
+	DialogRow *row = addToEnd(history);
+	const QString &peerName(history->peer->name);
+	if (!row->prev || row->prev->history->peer->name.compare(peerName, Qt::CaseInsensitive) <= 0) {
+		return row;
+	}
+
+	int32 from = 0, till = count - 1; // the new row is the last one
+	while (from < till) {
+		int32 middle = (from + till) / 2;
+		if (rowAt(middle)->history->peer->name.compare(peerName, Qt::CaseInsensitive) > 0) {
+			till = middle;
+		} else {
+			from = middle + 1;
+		}
+	}
+	insertBefore(row, rowAt(from));
+	return row;
+}
+
+void DialogsList::adjustByPos(DialogRow *row) {
+	if (sortMode != DialogsSortByDate) return;
+
+	int32 posInDialogs = row->history->posInDialogs;
+	if ((!row->prev || row->prev->history->posInDialogs <= posInDialogs) && (row->next == end || row->next->history->posInDialogs >= posInDialogs)) {
+		return;
+	}
+
+	remove(row);
+	int32 from = 0, till = count - 1; // binary search among the other rows, till is the end sentinel
+	while (from < till) {
+		int32 middle = (from + till) / 2;
+		if (rowAt(middle)->history->posInDialogs > posInDialogs) {
+			till = middle;
+		} else {
+			from = middle + 1;
+		}
+	}
+	link(row, rowAt(from));
+}
+
 bool DialogsList::del(const PeerId &peerId, DialogRow *replacedBy) {
 	RowByPeer::iterator i = rowByPeer.find(peerId);
 	if (i == rowByPeer.cend()) return false;
@@ -419,13 +612,6 @@ bool DialogsList::del(const PeerId &peerId, DialogRow *replacedBy) {
 	DialogRow *row = i.value();
 	emit App::main()->dialogRowReplaced(row, replacedBy);
 
-	if (row == current) {
-		current = row->next;
-	}
-	for (DialogRow *change = row->next; change != end; change = change->next) {
-		change->pos--;
-	}
-	end->pos--;
 	remove(row);
 	delete row;
 	--count;
@@ -435,6 +621,12 @@ bool DialogsList::del(const PeerId &peerId, DialogRow *replacedBy) {
 }
 
 void DialogsIndexed::peerNameChanged(PeerData *peer, const PeerData::Names &oldNames, const PeerData::NameFirstChars &oldChars) {
+	DialogsList::RowByPeer::const_iterator row = list.rowByPeer.constFind(peer->id);
+	if (row != list.rowByPeer.cend()) {
+		removeNames(row.value()->history, oldNames);
+		addNames(row.value()->history, peer->names);
+	}
+
 	if (sortMode == DialogsSortByName) {
 		DialogRow *mainRow = list.adjustByName(peer);
 		if (!mainRow) return;
@@ -511,9 +703,45 @@ void DialogsIndexed::clear() {
 		delete i.value();
 	}
 	index.clear();
+	byName.clear();
 	list.clear();
 }
 
+namespace {
+	bool _dialogRowPosLess(DialogRow *a, DialogRow *b) {
+		return a->pos() < b->pos();
+	}
+}
+
+void DialogsIndexed::filter(const QStringList &words, QVector<DialogRow*> &result) const {
+	if (words.isEmpty() || !list.count) return;
+
+	QSet<History*> found;
+	for (int32 i = 0, l = words.size(); i < l; ++i) {
+		QSet<History*> byWord; // peers with a name word starting with the filter word
+		for (NamesIndex::const_iterator j = byName.lowerBound(words.at(i)), e = byName.cend(); j != e && j.key().startsWith(words.at(i)); ++j) {
+			byWord.insert(j.value());
+		}
+		if (i) {
+			found.intersect(byWord);
+		} else {
+			found = byWord;
+		}
+		if (found.isEmpty()) return;
+	}
+
+	QVector<DialogRow*> rows;
+	rows.reserve(found.size());
+	for (QSet<History*>::const_iterator i = found.cbegin(), e = found.cend(); i != e; ++i) {
+		DialogsList::RowByPeer::const_iterator j = list.rowByPeer.constFind((*i)->peer->id);
+		if (j != list.rowByPeer.cend()) {
+			rows.push_back(j.value());
+		}
+	}
+	qSort(rows.begin(), rows.end(), _dialogRowPosLess);
+	result += rows;
+}
+
 void Histories::clear() {
 	App::historyClearMsgs();
 	for (Parent::const_iterator i = cbegin(), e = cend(); i != e; ++i) {
@@ -557,7 +785,7 @@ void Histories::regSendAction(History *history, UserData *user, const MTPSendMes
 }
 
 bool Histories::animStep(float64) {
-	uint64 ms = getms(true);
+	uint64 ms = getms(true), nextFrame = 0;
 	for (TypingHistories::iterator i = typing.begin(), e = typing.end(); i != e;) {
 		uint32 typingFrame = (ms - i.value()) / 150;
 		if (i.key()->updateTyping(ms, typingFrame)) {
@@ -567,12 +795,21 @@ bool Histories::animStep(float64) {
 		if (i.key()->typing.isEmpty() && i.key()->sendActions.isEmpty()) {
 			i = typing.erase(i);
 		} else {
+			uint64 frameEnd = i.value() + (typingFrame + 1) * 150;
+			if (!nextFrame || frameEnd < nextFrame) nextFrame = frameEnd;
 			++i;
 		}
 	}
+	if (nextFrame > ms) {
+		animSkip(nextFrame - ms); // typing dots change each 150 ms
+	}
 	return !typing.isEmpty();
 }
 
+QWidget *Histories::animWidget() { // typing is shown in the dialogs and the top bar
+	return App::main();
+}
+
 Histories::Parent::iterator Histories::erase(Histories::Parent::iterator i) {
 	typing.remove(i.value());
 	delete i.value();
@@ -605,7 +842,10 @@ HistoryItem *Histories::addToBack(const MTPmessage &msg, int msgState) {
 
 	iterator h = find(peer);
 	if (h == end()) {
-		h = insert(peer, new History(peer));
+		h = insert(peer, new History(App::peer(peer)));
+	}
+	if (msgState > 0) {
+		Local::addHistoryMessage(peer, msg);
 	}
 	if (msgState < 0) {
 		return h.value()->addToHistory(msg);
@@ -651,6 +891,8 @@ HistoryItem *History::createItem(HistoryBlock *block, const MTPmessage &msg, boo
 		return (returnExisting || regged) ? existing : 0;
 	}
 
+	Local::indexMessage(peer->id, msg);
+
 	switch (msg.type()) {
 	case mtpc_messageEmpty:
 		result = new HistoryServiceMsg(this, block, msg.c_messageEmpty().vid.v, date(), lang(lng_message_empty));
@@ -1466,15 +1708,24 @@ MsgId History::maxMsgId() const {
 
 int32 History::geomResize(int32 newWidth, int32 *ytransform, bool dontRecountText) {
 	if (width != newWidth || dontRecountText) {
-		int32 y = 0;
+		// if history was laid out already only the blocks around the scroll position are laid out now,
+		// others keep their old heights as an estimate and are laid out in settleLayout()
+		bool lazy = ytransform && width > 0;
+		int32 around = ytransform ? *ytransform : 0, y = 0;
 		for (iterator i = begin(), e = end(); i != e; ++i) {
 			HistoryBlock *block = *i;
 			bool updTransform = ytransform && (*ytransform >= block->y) && (*ytransform < block->y + block->height);
+			bool near = (block->y < around + HistoryLayoutAround) && (block->y + block->height > around - HistoryLayoutAround);
 			if (updTransform) *ytransform -= block->y;
 			if (block->y != y) {
 				block->y = y;
 			}
-			y += block->geomResize(newWidth, ytransform, dontRecountText);
+			if (!lazy || (dontRecountText ? (block->width > 0) : near)) {
+				y += block->geomResize(newWidth, ytransform, dontRecountText);
+			} else {
+				if (!dontRecountText) block->width = 0;
+				y += block->height;
+			}
 			if (updTransform) {
 				*ytransform += block->y;
 				ytransform = 0;
@@ -1486,6 +1737,72 @@ int32 History::geomResize(int32 newWidth, int32 *ytransform, bool dontRecountTex
 	return height;
 }
 
+int32 History::settleLayout(int32 *ytransform, int32 blocksCount) {
+	int32 l = size(), from = l - 1;
+	if (ytransform) {
+		for (int32 i = 0; i < l; ++i) {
+			if (at(i)->y + at(i)->height > *ytransform) {
+				from = i;
+				break;
+			}
+		}
+	}
+
+	// blocks nearest to the scroll position are laid out first
+	int32 dy = 0; // scroll position shift by the blocks laid out above it
+	for (int32 up = from, down = from + 1; blocksCount > 0 && (up >= 0 || down < l);) {
+		if (up >= 0) {
+			HistoryBlock *block = at(up);
+			if (block->width != width) {
+				int32 wasHeight = block->height;
+				if (ytransform && up == from) {
+					int32 inBlock = *ytransform - block->y;
+					block->geomResize(width, &inBlock, false);
+					dy += inBlock - (*ytransform - block->y);
+				} else {
+					block->geomResize(width, 0, false);
+					dy += block->height - wasHeight;
+				}
+				--blocksCount;
+			}
+			--up;
+		}
+		if (down < l && blocksCount > 0) {
+			HistoryBlock *block = at(down);
+			if (block->width != width) {
+				block->geomResize(width, 0, false);
+				--blocksCount;
+			}
+			++down;
+		}
+	}
+	if (ytransform) *ytransform += dy;
+
+	int32 y = 0;
+	for (iterator i = begin(), e = end(); i != e; ++i) {
+		(*i)->y = y;
+		y += (*i)->height;
+	}
+	height = y;
+	return height;
+}
+
+bool History::isLayoutDirty() const {
+	for (const_iterator i = cbegin(), e = cend(); i != e; ++i) {
+		if ((*i)->width != width) return true;
+	}
+	return false;
+}
+
+bool History::isLayoutDirty(int32 top, int32 bottom) const {
+	for (const_iterator i = cbegin(), e = cend(); i != e; ++i) {
+		HistoryBlock *block = *i;
+		if (block->y >= bottom) break;
+		if (block->y + block->height > top && block->width != width) return true;
+	}
+	return false;
+}
+
 void History::clear(bool leaveItems) {
 	if (unreadBar) {
 		unreadBar->destroy();
@@ -1576,6 +1893,7 @@ int32 HistoryBlock::geomResize(int32 newWidth, int32 *ytransform, bool dontRecou
 			ytransform = 0;
 		}
 	}
+	width = newWidth;
 	height = y;
 	return height;
 }
@@ -1698,6 +2016,10 @@ bool ItemAnimations::animStep(float64 ms) {
 	return !_animations.isEmpty();
 }
 
+QWidget *ItemAnimations::animWidget() {
+	return App::main();
+}
+
 uint64 ItemAnimations::animate(const HistoryItem *item, uint64 ms) {
 	if (_animations.isEmpty()) {
 		_animations.insert(item, ms);
@@ -1746,6 +2068,7 @@ void HistoryItem::markRead() {
 
 void HistoryItem::destroy() {
 	if (!out()) markRead();
+	if (id > 0) Local::unindexMessage(id);
 	bool wasAtBottom = history()->loadedAtBottom();
 	_history->removeNotification(this);
 	detach();
@@ -2075,9 +2398,9 @@ void HistoryPhoto::draw(QPainter &p, const HistoryItem *parent, bool selected, i
 		App::roundShadow(p, 0, 0, width, _height, selected ? st::msgInSelectShadow : st::msgInShadow, selected ? InSelectedShadowCorners : InShadowCorners);
 	}
 	data->full->load(false, false);
-	bool full = data->full->loaded();
+	bool full = data->full->loaded(), ready = full && data->full->ready();
 	QPixmap pix;
-	if (full) {
+	if (ready) {
 		pix = data->full->pixSingle(pixw, pixh, width, height);
 	} else {
 		pix = data->thumb->pixBlurredSingle(pixw, pixh, width, height);
@@ -3957,7 +4280,7 @@ void HistoryWebPage::draw(QPainter &p, const HistoryItem *parent, bool selected,
 		int32 pixwidth = st::webPagePhotoSize, pixheight = st::webPagePhotoSize;
 		data->photo->medium->load(false, false);
 		bool out = parent->out();
-		bool full = data->photo->medium->loaded();
+		bool full = data->photo->medium->loaded() && data->photo->medium->ready();
 		QPixmap pix;
 		if (full) {
 			pix = data->photo->medium->pixSingle(_pixw, _pixh, pixwidth, pixheight);
@@ -4022,9 +4345,9 @@ void HistoryWebPage::draw(QPainter &p, const HistoryItem *parent, bool selected,
 		int32 pixwidth = qMax(_pixw, int16(st::minPhotoSize)), pixheight = qMax(_pixh, int16(st::minPhotoSize));
 		data->photo->full->load(false, false);
 		bool out = parent->out();
-		bool full = data->photo->full->loaded();
+		bool full = data->photo->full->loaded(), ready = full && data->photo->full->ready();
 		QPixmap pix;
-		if (full) {
+		if (ready) {
 			pix = data->photo->full->pixSingle(_pixw, _pixh, pixwidth, pixheight);
 		} else {
 			pix = data->photo->thumb->pixBlurredSingle(_pixw, _pixh, pixwidth, pixheight);
@@ -6333,3 +6656,117 @@ QString HistoryUnreadBar::notificationText() const {
     return QString();
 }
 
+
+#ifdef _WITH_SELFTEST
+
+void dialogsFilterBenchmark() {
+	const char *syllables[] = { "al", "ex", "an", "dr", "ma", "ri", "na", "ko", "le", "va", "ser", "gei", "ol", "ga", "iv", "tem" };
+	const int32 syllablesCount = sizeof(syllables) / sizeof(syllables[0]), peersCount = 10000;
+
+	// synthetic peers and histories that are not registered in App
+	QVector<UserData*> users;
+	QVector<History*> histories;
+	users.reserve(peersCount);
+	histories.reserve(peersCount);
+	DialogsIndexed indexed(DialogsSortByDate);
+	for (int32 i = 0; i < peersCount; ++i) {
+		QString first, last;
+		for (int32 j = 0, l = 2 + (rand() % 2); j < l; ++j) {
+			first += QString::fromLatin1(syllables[rand() % syllablesCount]);
+			last += QString::fromLatin1(syllables[rand() % syllablesCount]);
+		}
+		UserData *user = new UserData(App::peerFromUser(0x40000000 + i));
+		user->name = user->nameOrPhone = first + ' ' + last;
+		user->fillNames();
+		users.push_back(user);
+		histories.push_back(new History(user));
+		indexed.addToEnd(histories.back());
+	}
+
+	const char *queries[] = { "a", "al", "alex", "ma", "maser", "al ko", "ser va", "zz" };
+	for (int32 i = 0; i < int32(sizeof(queries) / sizeof(queries[0])); ++i) {
+		QStringList words = QString::fromLatin1(queries[i]).split(' ', QString::SkipEmptyParts);
+		const int32 iterations = 20;
+
+		QVector<DialogRow*> found, scanned;
+		QElapsedTimer timer;
+		timer.start();
+		for (int32 j = 0; j < iterations; ++j) {
+			found.clear();
+			indexed.filter(words, found);
+		}
+		qint64 index = timer.nsecsElapsed() / iterations;
+
+		timer.restart();
+		for (int32 j = 0; j < iterations; ++j) { // every row names checked against every word
+			scanned.clear();
+			for (DialogRow *row = indexed.list.begin, *e = indexed.list.end; row != e; row = row->next) {
+				const PeerData::Names &names(row->history->peer->names);
+				QStringList::const_iterator fi = words.cbegin(), fe = words.cend();
+				for (; fi != fe; ++fi) {
+					PeerData::Names::const_iterator ni = names.cbegin(), ne = names.cend();
+					for (; ni != ne; ++ni) {
+						if (ni->startsWith(*fi)) break;
+					}
+					if (ni == ne) break;
+				}
+				if (fi == fe) scanned.push_back(row);
+			}
+		}
+		qint64 scan = timer.nsecsElapsed() / iterations;
+
+		LOG(("Benchmark: filter %1 peers by '%2', found %3 (scan found %4), DialogsIndexed::filter %5 us, linear scan %6 us").arg(peersCount).arg(queries[i]).arg(found.size()).arg(scanned.size()).arg(index / 1000).arg(scan / 1000));
+	}
+
+	indexed.clear();
+	for (int32 i = 0; i < peersCount; ++i) {
+		delete histories.at(i);
+		delete users.at(i);
+	}
+}
+
+void historyResizeBenchmark() {
+	const char *words[] = { "hello", "how", "are", "you", "telegram", "message", "history", "layout", "a", "width", "resize", "benchmark" };
+	const int32 wordsCount = sizeof(words) / sizeof(words[0]);
+	const int32 counts[] = { 1000, 10000, 50000 };
+
+	PeerId peerId = App::peerFromUser(0x40000000);
+	for (int32 c = 0; c < int32(sizeof(counts) / sizeof(counts[0])); ++c) {
+		History history(App::peer(peerId));
+		for (int32 i = 0; i < counts[c]; ++i) {
+			if (history.isEmpty() || history.back()->size() >= MessagesPerPage) {
+				history.push_back(new HistoryBlock(&history));
+			}
+			QString text;
+			for (int32 j = 0, l = 1 + (rand() % 40); j < l; ++j) {
+				if (j) text += ' ';
+				text += QString::fromLatin1(words[rand() % wordsCount]);
+			}
+			HistoryBlock *block = history.back();
+			block->push_back(new HistoryMessage(&history, block, i + 1, 0, QDateTime::currentDateTime(), App::userFromPeer(peerId), text, MTP_messageMediaEmpty()));
+		}
+		history.geomResize(st::wndMinWidth, 0);
+
+		QElapsedTimer timer;
+		timer.start();
+		history.geomResize(st::wndMinWidth + 100, 0); // lays out every block
+		qint64 full = timer.nsecsElapsed();
+
+		int32 st = history.height / 2;
+		timer.restart();
+		history.geomResize(st::wndMinWidth + 200, &st); // lays out only the blocks around the scroll position
+		qint64 around = timer.nsecsElapsed();
+
+		int32 steps = 0;
+		timer.restart();
+		while (history.isLayoutDirty()) {
+			history.settleLayout(&st, HistoryLayoutSettleBlocks);
+			++steps;
+		}
+		qint64 settle = timer.nsecsElapsed();
+
+		LOG(("Benchmark: resize history of %1 items, full layout %2 us, around the scroll position %3 us, settling the rest in %4 steps %5 us").arg(counts[c]).arg(full / 1000).arg(around / 1000).arg(steps).arg(settle / 1000));
+	}
+}
+
+#endif
@@ -43,6 +43,7 @@ struct Histories : public QHash<PeerId, History*>, public Animated {
 
 	void regSendAction(History *history, UserData *user, const MTPSendMessageAction &action);
 	bool animStep(float64 ms);
+	QWidget *animWidget();
 
 	void clear();
 	Parent::iterator erase(Parent::iterator i);
@@ -65,15 +66,21 @@ struct Histories : public QHash<PeerId, History*>, public Animated {
 struct HistoryBlock;
 
 struct DialogRow {
-	DialogRow(History *history = 0, DialogRow *prev = 0, DialogRow *next = 0, int32 pos = 0) : prev(prev), next(next), history(history), pos(pos), attached(0) {
+	DialogRow(History *history = 0, DialogRow *prev = 0, DialogRow *next = 0) : prev(prev), next(next), history(history), attached(0), left(0), right(0), parent(0), size(1), priority(0) {
 	}
 
 	void paint(QPainter &p, int32 w, bool act, bool sel) const;
 
+	int32 pos() const; // index in the owning DialogsList, O(log(count))
+
 	DialogRow *prev, *next;
 	History *history;
-	int32 pos;
 	void *attached; // for any attached data, for example View in contacts list
+
+	// implicit treap of the owning DialogsList, ordered as the prev / next chain
+	DialogRow *left, *right, *parent;
+	int32 size;
+	uint32 priority;
 };
 
 struct FakeDialogRow {
@@ -157,7 +164,7 @@ class HistoryMedia;
 class HistoryMessage;
 class HistoryUnreadBar;
 struct History : public QList<HistoryBlock*> {
-	History(const PeerId &peerId);
+	History(PeerData *peer);
 
 	typedef QList<HistoryBlock*> Parent;
 	void clear(bool leaveItems = false);
@@ -211,6 +218,9 @@ struct History : public QList<HistoryBlock*> {
 	MsgId maxMsgId() const;
 
 	int32 geomResize(int32 newWidth, int32 *ytransform = 0, bool dontRecountText = false); // return new size
+	int32 settleLayout(int32 *ytransform, int32 blocksCount); // lay out blocks skipped in geomResize, return new size
+	bool isLayoutDirty() const; // has blocks not laid out for the current width
+	bool isLayoutDirty(int32 top, int32 bottom) const;
 	int32 width, height, msgCount, unreadCount;
 	int32 inboxReadTill, outboxReadTill;
 	HistoryItem *showFrom;
@@ -321,27 +331,24 @@ enum DialogsSortMode {
 };
 
 struct DialogsList {
-	DialogsList(DialogsSortMode sortMode) : begin(&last), end(&last), sortMode(sortMode), count(0), current(&last) {
+	DialogsList(DialogsSortMode sortMode) : begin(&last), end(&last), sortMode(sortMode), count(0), current(&last), root(&last) {
 	}
 
 	void adjustCurrent(int32 y, int32 h) const {
 		int32 pos = (y > 0) ? (y / h) : 0;
-		while (current->pos > pos && current != begin) {
-			current = current->prev;
-		}
-		while (current->pos + 1 <= pos && current->next != end) {
-			current = current->next;
-		}
+		current = count ? rowAt(qMin(pos, count - 1)) : end;
 	}
 
 	void paint(QPainter &p, int32 w, int32 hFrom, int32 hTo, PeerData *act, PeerData *sel) const {
 		adjustCurrent(hFrom, st::dlgHeight);
 
 		DialogRow *drawFrom = current;
-		p.translate(0, drawFrom->pos * st::dlgHeight);
-		while (drawFrom != end && drawFrom->pos * st::dlgHeight < hTo) {
+		int32 pos = drawFrom->pos();
+		p.translate(0, pos * st::dlgHeight);
+		while (drawFrom != end && pos * st::dlgHeight < hTo) {
 			drawFrom->paint(p, w, (drawFrom->history->peer == act), (drawFrom->history->peer == sel));
 			drawFrom = drawFrom->next;
+			++pos;
 			p.translate(0, st::dlgHeight);
 		}
 	}
@@ -351,12 +358,13 @@ struct DialogsList {
 
 		int32 pos = (y > 0) ? (y / h) : 0;
 		adjustCurrent(y, h);
-		return (pos == current->pos) ? current : 0;
+		return (pos < count) ? current : 0;
 	}
 
+	DialogRow *rowAt(int32 pos) const; // O(log(count)), end for pos == count, 0 if out of range
+
 	DialogRow *addToEnd(History *history, bool updatePos = true) {
-		DialogRow *result = new DialogRow(history, end->prev, end, end->pos);
-		end->pos++;
+		DialogRow *result = new DialogRow(history, end->prev, end);
 		if (begin == end) {
 			begin = current = result;
 			if (sortMode == DialogsSortByDate && updatePos) history->posInDialogs = 0;
@@ -364,6 +372,7 @@ struct DialogsList {
 			end->prev->next = result;
 			if (sortMode == DialogsSortByDate && updatePos) history->posInDialogs = end->prev->history->posInDialogs + 1;
 		}
+		treeInsert(result, count);
 		rowByPeer.insert(history->peer->id, result);
 		++count;
 		return (end->prev = result);
@@ -376,104 +385,15 @@ struct DialogsList {
 		insertBefore(row, begin);
 	}
 
-	bool insertBefore(DialogRow *row, DialogRow *before) {
-		if (row == before) return false;
-
-		if (current == row) current = row->prev;
-
-		DialogRow *updateTill = row->prev;
-		remove(row);
-
-		// insert row
-		row->next = before; // update row
-		row->prev = before->prev;
-		row->next->prev = row; // update row->next
-		if (row->prev) { // update row->prev
-			row->prev->next = row;
-		} else {
-			begin = row;
-		}
-
-		// update y
-		for (DialogRow *n = row; n != updateTill; n = n->next) {
-			n->next->pos++;
-			row->pos--;
-		}
-		return true;
-	}
-
+	bool insertBefore(DialogRow *row, DialogRow *before);
 	bool insertAfter(DialogRow *row, DialogRow *after) {
 		if (row == after) return false;
-
-		if (current == row) current = row->next;
-
-		DialogRow *updateFrom = row->next;
-		remove(row);
-
-		// insert row
-		row->prev = after; // update row
-		row->next = after->next;
-		row->prev->next = row; // update row->prev
-		row->next->prev = row; // update row->next
-
-		// update y
-		for (DialogRow *n = updateFrom; n != row; n = n->next) {
-			n->pos--;
-			row->pos++;
-		}
-		return true;
+		return insertBefore(row, after->next);
 	}
 
-	DialogRow *adjustByName(const PeerData *peer) {
-		if (sortMode != DialogsSortByName) return 0;
-
-		RowByPeer::iterator i = rowByPeer.find(peer->id);
-		if (i == rowByPeer.cend()) return 0;
-
-		DialogRow *row = i.value(), *change = row;
-		while (change->prev && change->prev->history->peer->name > peer->name) {
-			change = change->prev;
-		}
-		if (!insertBefore(row, change)) {
-			while (change->next != end && change->next->history->peer->name < peer->name) {
-				change = change->next;
-			}
-			insertAfter(row, change);
-		}
-		return row;
-	}
-
-	DialogRow *addByName(History *history) {
-		if (sortMode != DialogsSortByName) return 0;
-
-		DialogRow *row = addToEnd(history), *change = row;
-		const QString &peerName(history->peer->name);
-		while (change->prev && change->prev->history->peer->name.compare(peerName, Qt::CaseInsensitive) > 0) {
-			change = change->prev;
-		}
-		if (!insertBefore(row, change)) {
-			while (change->next != end && change->next->history->peer->name.compare(peerName, Qt::CaseInsensitive) < 0) {
-				change = change->next;
-			}
-			insertAfter(row, change);
-		}
-		return row;
-	}
-
-	void adjustByPos(DialogRow *row) {
-		if (sortMode != DialogsSortByDate) return;
-
-		DialogRow *change = row;
-		while (change->prev && change->prev->history->posInDialogs > row->history->posInDialogs) {
-			change = change->prev;
-		}
-		if (!insertBefore(row, change)) {
-			while (change->next != end && change->next->history->posInDialogs < row->history->posInDialogs) {
-				change = change->next;
-			}
-			insertAfter(row, change);
-		}
-	}
+	DialogRow *adjustByName(const PeerData *peer);
+	DialogRow *addByName(History *history);
+	void adjustByPos(DialogRow *row);
 
 	DialogRow *addByPos(History *history) {
 		if (sortMode != DialogsSortByDate) return 0;
@@ -486,12 +406,15 @@ struct DialogsList {
 	bool del(const PeerId &peerId, DialogRow *replacedBy = 0);
 
 	void remove(DialogRow *row) {
+		if (current == row) current = (row->next != end || !row->prev) ? row->next : row->prev;
+
 		row->next->prev = row->prev; // update row->next
 		if (row->prev) { // update row->prev
 			row->prev->next = row->next;
 		} else {
 			begin = row->next;
 		}
+		treeRemove(row);
 	}
 
 	void clear() {
@@ -503,6 +426,10 @@ struct DialogsList {
 		current = begin;
 		rowByPeer.clear();
 		count = 0;
+
+		last.prev = last.left = last.right = last.parent = 0;
+		last.size = 1;
+		root = &last;
 	}
 
 	~DialogsList() {
@@ -518,6 +445,16 @@ struct DialogsList {
 	RowByPeer rowByPeer;
 
 	mutable DialogRow *current; // cache
+
+private:
+
+	void link(DialogRow *row, DialogRow *before); // row is not in the list
+
+	void treeInsert(DialogRow *row, int32 pos);
+	void treeRemove(DialogRow *row);
+
+	DialogRow *root; // treap over all rows including the end sentinel
+
 };
 
 struct DialogsIndexed {
@@ -532,6 +469,7 @@ struct DialogsIndexed {
 		}
 
 		result.insert(0, list.addToEnd(history));
+		addNames(history, history->peer->names);
 		for (PeerData::NameFirstChars::const_iterator i = history->peer->chars.cbegin(), e = history->peer->chars.cend(); i != e; ++i) {
 			DialogsIndex::iterator j = index.find(*i);
 			if (j == index.cend()) {
@@ -550,6 +488,7 @@ struct DialogsIndexed {
 		}
 
 		DialogRow *res = list.addByName(history);
+		addNames(history, history->peer->names);
 		for (PeerData::NameFirstChars::const_iterator i = history->peer->chars.cbegin(), e = history->peer->chars.cend(); i != e; ++i) {
 			DialogsIndex::iterator j = index.find(*i);
 			if (j == index.cend()) {
@@ -576,6 +515,10 @@ struct DialogsIndexed {
 	void peerNameChanged(PeerData *peer, const PeerData::Names &oldNames, const PeerData::NameFirstChars &oldChars);
 
 	void del(const PeerData *peer, DialogRow *replacedBy = 0) {
+		DialogsList::RowByPeer::const_iterator i = list.rowByPeer.constFind(peer->id);
+		if (i != list.rowByPeer.cend()) {
+			removeNames(i.value()->history, peer->names);
+		}
 		if (list.del(peer->id, replacedBy)) {
 			for (PeerData::NameFirstChars::const_iterator i = peer->chars.cbegin(), e = peer->chars.cend(); i != e; ++i) {
 				DialogsIndex::iterator j = index.find(*i);
@@ -592,14 +535,35 @@ struct DialogsIndexed {
 
 	void clear();
 
+	void filter(const QStringList &words, QVector<DialogRow*> &result) const; // appends rows with names starting with all the words in the list order
+
+	void addNames(History *history, const PeerData::Names &names) {
+		for (PeerData::Names::const_iterator i = names.cbegin(), e = names.cend(); i != e; ++i) {
+			byName.insert(*i, history);
+		}
+	}
+
+	void removeNames(History *history, const PeerData::Names &names) {
+		for (PeerData::Names::const_iterator i = names.cbegin(), e = names.cend(); i != e; ++i) {
+			byName.remove(*i, history);
+		}
+	}
+
 	DialogsSortMode sortMode;
 	DialogsList list;
 	typedef QMap<QChar, DialogsList*> DialogsIndex;
 	DialogsIndex index;
+	typedef QMultiMap<QString, History*> NamesIndex; // sorted name words for the prefix lookup
+	NamesIndex byName;
 };
 
+#ifdef _WITH_SELFTEST
+void dialogsFilterBenchmark(); // filters 10000 synthetic peers, see -benchmark
+void historyResizeBenchmark(); // resizes synthetic histories of different sizes, see -benchmark
+#endif
+
 struct HistoryBlock : public QVector<HistoryItem*> {
-	HistoryBlock(History *hist) : y(0), height(0), history(hist) {
+	HistoryBlock(History *hist) : y(0), height(0), width(hist->width), history(hist) {
 	}
 
 	typedef QVector<HistoryItem*> Parent;
@@ -612,6 +576,7 @@ struct HistoryBlock : public QVector<HistoryItem*> {
 
 	int32 geomResize(int32 newWidth, int32 *ytransform, bool dontRecountText); // return new size
 	int32 y, height;
+	int32 width; // items are laid out for this width, 0 if they keep the heights of some previous width
 	History *history;
 };
 
@@ -647,6 +612,7 @@ class ItemAnimations : public Animated {
 public:
 
 	bool animStep(float64 ms);
+	QWidget *animWidget();
 	uint64 animate(const HistoryItem *item, uint64 ms);
 	void remove(const HistoryItem *item);
 
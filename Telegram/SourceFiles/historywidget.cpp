@@ -32,6 +32,14 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 
 #include "localstorage.h"
 
+namespace {
+	int64 _historyItemRastersSize = 0;
+
+	int64 _pixmapSize(const QPixmap &pix) {
+		return int64(pix.width()) * pix.height() * 4;
+	}
+}
+
 // flick scroll taken from http://qt-project.org/doc/qt-4.8/demos-embedded-anomaly-src-flickcharm-cpp.html
 
 HistoryList::HistoryList(HistoryWidget *historyWidget, ScrollArea *scroll, History *history) : QWidget(0)
@@ -93,6 +101,106 @@ void HistoryList::updateMsg(const HistoryItem *msg) {
 	update(0, ySkip + msg->block()->y + msg->y, width(), msg->height());
 }
 
+void HistoryList::forgetItemRaster(const HistoryItem *item) {
+	ItemRasters::iterator i = _itemRasters.find(item);
+	if (i != _itemRasters.cend()) {
+		_historyItemRastersSize -= _pixmapSize(i.value().pix);
+		_itemRastersUsage.erase(i.value().used);
+		_itemRasters.erase(i);
+	}
+}
+
+void HistoryList::clearItemRasters() {
+	for (ItemRasters::const_iterator i = _itemRasters.cbegin(), e = _itemRasters.cend(); i != e; ++i) {
+		_historyItemRastersSize -= _pixmapSize(i.value().pix);
+	}
+	_itemRasters.clear();
+	_itemRastersUsage.clear();
+}
+
+bool HistoryList::itemRasterable(const HistoryItem *item) const {
+	if (!cHistoryRasters() || !HistoryItemRastersLimit) return false;
+
+	switch (item->itemType()) {
+	case HistoryItem::DateType: return true;
+	case HistoryItem::MsgType: break;
+	default: return false;
+	}
+
+	// media, reply previews and forwarded names change without msgUpdated() calls
+	if (item->id <= 0 || item->getMedia() || item->toHistoryReply() || item->toHistoryForwarded() || item->animating()) return false;
+
+	return !App::main() || !App::main()->animActiveTime(item->id);
+}
+
+void HistoryList::drawItem(QPainter &p, HistoryItem *item, uint32 selection) {
+	if (!itemRasterable(item)) {
+		forgetItemRaster(item);
+		item->draw(p, selection);
+		return;
+	}
+
+	const Image *fromPhoto = item->from()->photo.v();
+	bool fromPhotoLoaded = fromPhoto && fromPhoto->loaded();
+
+	const ITextLink *lnkOver = 0, *lnkDown = 0; // hovered and pressed links are painted with other colors
+	if (item == App::hoveredLinkItem() || item == App::pressedLinkItem()) {
+		lnkOver = textlnkOver().data();
+		lnkDown = textlnkDown().data();
+	}
+
+	ItemRasters::iterator i = _itemRasters.find(item);
+	if (i != _itemRasters.cend()) {
+		const ItemRaster &r(i.value());
+		if (r.width == hist->width && r.height == item->height() && r.id == item->id && r.selection == selection && r.unread == item->unread() && r.fromVersion == item->from()->nameVersion && r.fromPhoto == fromPhoto && r.fromPhotoLoaded == fromPhotoLoaded && r.lnkOver == lnkOver && r.lnkDown == lnkDown) {
+			if (_itemRastersUsage.back() != item) { // move to back
+				_itemRastersUsage.erase(r.used);
+				i.value().used = _itemRastersUsage.insert(_itemRastersUsage.end(), item);
+			}
+			p.drawPixmap(0, 0, r.pix);
+			return;
+		}
+		forgetItemRaster(item);
+	}
+
+	ItemRaster r;
+	r.width = hist->width;
+	r.height = item->height();
+	if (r.width <= 0 || r.height <= 0) {
+		item->draw(p, selection);
+		return;
+	}
+
+	QImage img(r.width * cIntRetinaFactor(), r.height * cIntRetinaFactor(), QImage::Format_ARGB32_Premultiplied);
+	if (cRetina()) img.setDevicePixelRatio(cRetinaFactor());
+	img.fill(Qt::transparent);
+	{
+		QPainter ip(&img);
+		item->draw(ip, selection);
+	}
+	r.pix = QPixmap::fromImage(img, Qt::ColorOnly);
+	if (cRetina()) r.pix.setDevicePixelRatio(cRetinaFactor());
+	r.id = item->id;
+	r.fromVersion = item->from()->nameVersion;
+	r.selection = selection;
+	r.unread = item->unread();
+	r.fromPhoto = fromPhoto;
+	r.fromPhotoLoaded = fromPhotoLoaded;
+	r.lnkOver = lnkOver;
+	r.lnkDown = lnkDown;
+	p.drawPixmap(0, 0, r.pix);
+
+	int64 size = _pixmapSize(r.pix);
+	if (size > HistoryItemRastersLimit / 4) return;
+
+	while (!_itemRastersUsage.isEmpty() && _historyItemRastersSize + size > HistoryItemRastersLimit) { // forget the least recently painted
+		forgetItemRaster(_itemRastersUsage.front());
+	}
+	r.used = _itemRastersUsage.insert(_itemRastersUsage.end(), item);
+	_itemRasters.insert(item, r);
+	_historyItemRastersSize += size;
+}
+
 void HistoryList::paintEvent(QPaintEvent *e) {
 	QRect r(e->rect());
 	bool trivial = (rect() == r);
@@ -119,7 +227,7 @@ void HistoryList::paintEvent(QPaintEvent *e) {
 		QPoint dogPos((width() - st::msgDogImg.pxWidth()) / 2, ((height() - st::msgDogImg.pxHeight()) * 4) / 9);
 		p.drawPixmap(dogPos, *cChatDogImage());
 	}
-	if (!_firstLoading && !hist->isEmpty()) {
+	if (!_firstLoading && !hist->isEmpty()) { // visible blocks are laid out in HistoryWidget::onListScroll() before painting
 		adjustCurrent(r.top());
 		HistoryBlock *block = (*hist)[currentBlock];
 		HistoryItem *item = (*block)[currentItem];
@@ -148,7 +256,7 @@ void HistoryList::paintEvent(QPaintEvent *e) {
 					sel = i.value();
 				}
 			}
-			item->draw(p, sel);
+			drawItem(p, item, sel);
 			p.translate(0, h);
 			++iItem;
 			if (iItem == block->size()) {
@@ -579,6 +687,8 @@ void HistoryList::onDragExec() {
 }
 
 void HistoryList::itemRemoved(HistoryItem *item) {
+	forgetItemRaster(item);
+
 	SelectedItems::iterator i = _selected.find(item);
 	if (i != _selected.cend()) {
 		_selected.erase(i);
@@ -599,6 +709,9 @@ void HistoryList::itemRemoved(HistoryItem *item) {
 }
 
 void HistoryList::itemReplaced(HistoryItem *oldItem, HistoryItem *newItem) {
+	forgetItemRaster(oldItem);
+	forgetItemRaster(newItem);
+
 	if (_dragItem == oldItem) _dragItem = newItem;
 
 	SelectedItems::iterator i = _selected.find(oldItem);
@@ -1061,6 +1174,10 @@ void HistoryList::keyPressEvent(QKeyEvent *e) {
 	}
 }
 
+int64 historyItemRastersSize() {
+	return _historyItemRastersSize;
+}
+
 int32 HistoryList::recountHeight(bool dontRecountText) {
 	int32 st = hist->lastScrollTop;
 
@@ -1102,6 +1219,13 @@ int32 HistoryList::recountHeight(bool dontRecountText) {
 	return st + (newYSkip - wasYSkip);
 }
 
+int32 HistoryList::settleLayout() {
+	int32 st = hist->lastScrollTop - ySkip;
+	hist->settleLayout(&st, HistoryLayoutSettleBlocks);
+	updateSize();
+	return st + ySkip;
+}
+
 void HistoryList::updateBotInfo(bool recount) {
 	int32 newh = 0;
 	if (botInfo && !botInfo->description.isEmpty()) {
@@ -1197,6 +1321,7 @@ void HistoryList::leaveEvent(QEvent *e) {
 }
 
 HistoryList::~HistoryList() {
+	clearItemRasters();
 	delete _menu;
 	_dragAction = NoDrag;
 }
@@ -2190,6 +2315,7 @@ HistoryWidget::HistoryWidget(QWidget *parent) : TWidget(parent)
 , _peer(0)
 , _showAtMsgId(0)
 , _preloadRequest(0), _preloadDownRequest(0)
+, _localCheckRequest(0)
 , _delayedShowAtMsgId(-1)
 , _delayedShowAtRequest(0)
 , _activeAnimMsgId(0)
@@ -2271,6 +2397,9 @@ HistoryWidget::HistoryWidget(QWidget *parent) : TWidget(parent)
 
 	_scrollTimer.setSingleShot(false);
 
+	_layoutSettleTimer.setSingleShot(true);
+	connect(&_layoutSettleTimer, SIGNAL(timeout()), this, SLOT(onLayoutSettle()));
+
 	_sendActionStopTimer.setSingleShot(true);
 
 	_animActiveTimer.setSingleShot(false);
@@ -2882,7 +3011,8 @@ void HistoryWidget::clearAllLoadRequests() {
 	if (_firstLoadRequest) MTP::cancel(_firstLoadRequest);
 	if (_preloadRequest) MTP::cancel(_preloadRequest);
 	if (_preloadDownRequest) MTP::cancel(_preloadDownRequest);
-	_preloadRequest = _preloadDownRequest = _firstLoadRequest = 0;
+	if (_localCheckRequest) MTP::cancel(_localCheckRequest);
+	_preloadRequest = _preloadDownRequest = _firstLoadRequest = _localCheckRequest = 0;
 }
 
 void HistoryWidget::updateControlsVisibility() {
@@ -3076,13 +3206,15 @@ bool HistoryWidget::messagesFailed(const RPCError &error, mtpRequestId requestId
 		App::main()->showDialogs();
 	} else if (_delayedShowAtRequest == requestId) {
 		_delayedShowAtRequest = 0;
+	} else if (_localCheckRequest == requestId) {
+		_localCheckRequest = 0;
 	}
 	return true;
 }
 
 void HistoryWidget::messagesReceived(const MTPmessages_Messages &messages, mtpRequestId requestId) {
 	if (!_history) {
-		_preloadRequest = _preloadDownRequest = _firstLoadRequest = _delayedShowAtRequest = 0;
+		_preloadRequest = _preloadDownRequest = _firstLoadRequest = _delayedShowAtRequest = _localCheckRequest = 0;
 		return;
 	}
 
@@ -3106,17 +3238,38 @@ void HistoryWidget::messagesReceived(const MTPmessages_Messages &messages, mtpRe
 	}
 	
 	if (_preloadRequest == requestId) {
+		MsgId wasMinId = _history->minMsgId();
 		addMessagesToFront(*histList);
 		_preloadRequest = 0;
+		if (_history->loadedAtBottom()) {
+			Local::prependHistoryMessages(_peer->id, *histList, wasMinId);
+		}
 		onListScroll();
 	} else if (_preloadDownRequest == requestId) {
 		addMessagesToBack(*histList);
 		_preloadDownRequest = 0;
 		onListScroll();
 		if (_history->loadedAtBottom() && App::wnd()) App::wnd()->checkHistoryActivation();
+	} else if (_localCheckRequest == requestId) {
+		_localCheckRequest = 0;
+		if (!localMessagesActual(*histList)) { // show the server messages instead of the saved ones
+			_history->clear(true);
+			_history->lastWidth = 0;
+			_firstLoadRequest = -1; // hack - don't updateListSize yet
+			addMessagesToFront(*histList);
+			_firstLoadRequest = 0;
+			if (_history->loadedAtBottom()) {
+				Local::writeHistoryMessages(_peer->id, *histList);
+			}
+			_histInited = false;
+			historyLoaded();
+		}
 	} else if (_firstLoadRequest == requestId) {
 		addMessagesToFront(*histList);
 		_firstLoadRequest = 0;
+		if (_history->loadedAtBottom()) {
+			Local::writeHistoryMessages(_peer->id, *histList);
+		}
 		if (_history->loadedAtTop()) {
 			if (_history->unreadCount > count) {
 				_history->setUnreadCount(count);
@@ -3180,6 +3333,37 @@ bool HistoryWidget::isActive() const {
 	return false;
 }
 
+bool HistoryWidget::showLocalMessages() {
+	if (!_history->isEmpty() || !_history->loadedAtBottom()) return false;
+
+	QVector<MTPMessage> saved;
+	if (!Local::readHistoryMessages(_peer->id, 0, MessagesFirstLoad, saved)) return false;
+
+	_firstLoadRequest = -1; // hack - don't updateListSize yet
+	addMessagesToFront(saved);
+	_firstLoadRequest = 0;
+	if (_history->isEmpty()) return false;
+
+	historyLoaded();
+	_localCheckRequest = MTP::send(MTPmessages_GetHistory(_peer->input, MTP_int(0), MTP_int(0), MTP_int(MessagesFirstLoad)), rpcDone(&HistoryWidget::messagesReceived), rpcFail(&HistoryWidget::messagesFailed));
+	return true;
+}
+
+bool HistoryWidget::localMessagesActual(const QVector<MTPMessage> &messages) const {
+	int32 j = 0, l = messages.size();
+	for (History::const_iterator i = _history->cend(), b = _history->cbegin(); i != b && j < l;) {
+		HistoryBlock *block = *(--i);
+		for (HistoryBlock::const_iterator k = block->cend(), bb = block->cbegin(); k != bb && j < l;) {
+			HistoryItem *item = *(--k);
+			if (item->id <= 0) continue; // date or unread bar or not sent message
+
+			if (item->id != App::idFromMessage(messages.at(j))) return false;
+			++j;
+		}
+	}
+	return (j == l);
+}
+
 void HistoryWidget::firstLoadMessages() {
 	if (!_history || _firstLoadRequest) return;
 
@@ -3199,6 +3383,8 @@ void HistoryWidget::firstLoadMessages() {
 		offset = -loadCount / 2;
 		from = _showAtMsgId;
 	}
+	if (!from && !offset && showLocalMessages()) return;
+
 	_firstLoadRequest = MTP::send(MTPmessages_GetHistory(_peer->input, MTP_int(offset), MTP_int(from), MTP_int(loadCount)), rpcDone(&HistoryWidget::messagesReceived), rpcFail(&HistoryWidget::messagesFailed));
 }
 
@@ -3206,6 +3392,14 @@ void HistoryWidget::loadMessages() {
 	if (!_history || _history->loadedAtTop() || _preloadRequest) return;
 
 	MsgId min = _history->minMsgId();
+	if (min && !_localCheckRequest) {
+		QVector<MTPMessage> saved;
+		if (Local::readHistoryMessages(_peer->id, min, MessagesPerPage, saved)) {
+			addMessagesToFront(saved);
+			return;
+		}
+	}
+
 	int32 offset = 0, loadCount = min ? MessagesPerPage : MessagesFirstLoad;
 	_preloadRequest = MTP::send(MTPmessages_GetHistory(_peer->input, MTP_int(offset), MTP_int(min), MTP_int(loadCount)), rpcDone(&HistoryWidget::messagesReceived), rpcFail(&HistoryWidget::messagesFailed));
 }
@@ -3243,6 +3437,14 @@ void HistoryWidget::onListScroll() {
 	App::checkImageCacheSize();
 	if (_firstLoadRequest || _scroll.isHidden()) return;
 
+	// scrolled to the messages that are not laid out for the current width yet, lay out all of them
+	// before painting, each onLayoutSettle() call lays out the blocks nearest to the scroll position
+	while (_histInited) {
+		int32 firstItemY = _list->height() - _history->height - st::historyPadding;
+		if (!_history->isLayoutDirty(_scroll.scrollTop() - firstItemY, _scroll.scrollTop() + _scroll.height() - firstItemY)) break;
+		onLayoutSettle();
+	}
+
 	updateToEndVisibility();
 	
 	int st = _scroll.scrollTop(), stm = _scroll.scrollTopMax(), sh = _scroll.height();
@@ -3265,6 +3467,19 @@ void HistoryWidget::onListScroll() {
 	}
 }
 
+void HistoryWidget::onLayoutSettle() {
+	if (!_history || _firstLoadRequest || !_histInited || _scroll.isHidden() || !_history->isLayoutDirty()) return;
+
+	bool wasAtBottom = _scroll.scrollTop() + 1 > _scroll.scrollTopMax();
+	_history->lastScrollTop = _scroll.scrollTop();
+	int32 newSt = _list->settleLayout();
+	_scroll.scrollToY(wasAtBottom ? History::ScrollMax : newSt);
+
+	if (_history->isLayoutDirty()) {
+		_layoutSettleTimer.start(0);
+	}
+}
+
 void HistoryWidget::onVisibleChanged() {
 	QTimer::singleShot(0, this, SLOT(onListScroll()));
 }
@@ -4440,6 +4655,7 @@ void HistoryWidget::peerMessagesUpdated() {
 
 void HistoryWidget::msgUpdated(PeerId peer, const HistoryItem *msg) {
 	if (_peer && _list && peer == _peer->id) {
+		_list->forgetItemRaster(msg);
 		_list->updateMsg(msg);
 	}
 }
@@ -4517,6 +4733,7 @@ void HistoryWidget::itemReplaced(HistoryItem *oldItem, HistoryItem *newItem) {
 }
 
 void HistoryWidget::itemResized(HistoryItem *row, bool scrollToIt) {
+	if (_list && row) _list->forgetItemRaster(row);
 	updateListSize(0, false, false, row, scrollToIt);
 }
 
@@ -4561,6 +4778,9 @@ void HistoryWidget::updateListSize(int32 addToY, bool initial, bool loadedDown,
 		_history->lastScrollTop = _scroll.scrollTop();
 	}
 	int32 newSt = _list->recountHeight(!!resizedItem);
+	if (_history->isLayoutDirty() && !_layoutSettleTimer.isActive()) {
+		_layoutSettleTimer.start(0);
+	}
 	bool washidden = _scroll.isHidden();
 	if (washidden) {
 		_scroll.show();
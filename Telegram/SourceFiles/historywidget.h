@@ -64,9 +64,11 @@ public:
 	QPoint mapMouseToItem(QPoint p, HistoryItem *item);
 
 	int32 recountHeight(bool dontRecountText);
+	int32 settleLayout();
 	void updateSize();
 
 	void updateMsg(const HistoryItem *msg);
+	void forgetItemRaster(const HistoryItem *item);
 
 	bool canCopySelected() const;
 	bool canDeleteSelected() const;
@@ -120,6 +122,24 @@ private:
 	HistoryItem *nextItem(HistoryItem *item);
 	void updateDragSelection(HistoryItem *dragSelFrom, HistoryItem *dragSelTo, bool dragSelecting, bool force = false);
 
+	bool itemRasterable(const HistoryItem *item) const;
+	void drawItem(QPainter &p, HistoryItem *item, uint32 selection);
+	void clearItemRasters();
+
+	typedef QLinkedList<const HistoryItem*> ItemRastersUsage; // the least recently painted first
+	struct ItemRaster { // painted item, used while it would be painted the same way
+		QPixmap pix;
+		int32 width, height, id, fromVersion;
+		uint32 selection;
+		bool unread, fromPhotoLoaded;
+		const Image *fromPhoto;
+		const ITextLink *lnkOver, *lnkDown;
+		ItemRastersUsage::iterator used;
+	};
+	typedef QMap<const HistoryItem*, ItemRaster> ItemRasters;
+	ItemRasters _itemRasters;
+	ItemRastersUsage _itemRastersUsage;
+
 	History *hist;
 
 	int32 ySkip;
@@ -179,6 +199,8 @@ private:
 
 };
 
+int64 historyItemRastersSize(); // memory used by painted history messages
+
 class MessageField : public FlatTextarea {
 	Q_OBJECT
 
@@ -516,6 +538,7 @@ public slots:
 	void onAudioFailed(MsgId msgId);
 
 	void onListScroll();
+	void onLayoutSettle();
 	void onHistoryToEnd();
 	void onSend(bool ctrlShiftEnter = false, MsgId replyTo = -1);
 	void onBotStart();
@@ -603,6 +626,8 @@ private:
 	void updateListSize(int32 addToY = 0, bool initial = false, bool loadedDown = false, HistoryItem *resizedItem = 0, bool scrollToIt = false);
 	void addMessagesToFront(const QVector<MTPMessage> &messages);
 	void addMessagesToBack(const QVector<MTPMessage> &messages);
+	bool showLocalMessages();
+	bool localMessagesActual(const QVector<MTPMessage> &messages) const;
 
 	void countHistoryShowFrom();
 
@@ -624,6 +649,7 @@ private:
 	MsgId _showAtMsgId;
 
 	mtpRequestId _firstLoadRequest, _preloadRequest, _preloadDownRequest;
+	mtpRequestId _localCheckRequest; // newest messages to compare with the shown locally saved ones
 
 	MsgId _delayedShowAtMsgId;
 	mtpRequestId _delayedShowAtRequest;
@@ -686,6 +712,8 @@ private:
 	QTimer _scrollTimer;
 	int32 _scrollDelta;
 
+	QTimer _layoutSettleTimer;
+
 	QTimer _animActiveTimer;
 	float64 _animActiveStart;
 
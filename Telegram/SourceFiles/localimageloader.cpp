@@ -81,7 +81,7 @@ void LocalImageLoaderPrivate::prepareImages() {
 			if (type == ToPrepareDocument) {
 				mime = mimeTypeForFile(info).name();
 			}
-			if (type != ToPrepareAuto && info.size() < MaxUploadPhotoSize) {
+			if (type != ToPrepareAuto && info.size() < MaxUploadPhotoSize && (type != ToPrepareDocument || mime.startsWith(qstr("image/")))) { // don't read other documents to memory
 				bool opaque = (mime != stickerMime);
 				img = App::readImage(file, 0, opaque, &animated);
 			}
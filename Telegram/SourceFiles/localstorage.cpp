@@ -324,20 +324,14 @@ namespace {
 		}
 	};
 
-	bool readFile(FileReadDescriptor &result, const QString &name, int options = UserPath | SafePath) {
-		if (options & UserPath) {
-			if (!_userWorking()) return false;
-		} else {
-			if (!_working()) return false;
-		}
-
+	bool readFileAt(FileReadDescriptor &result, const QString &base, const QString &name, int options) { // does not touch the globals, used in the storage thread
 		// detect order of read attempts
 		QString toTry[2];
-		toTry[0] = ((options & UserPath) ? _userBasePath : _basePath) + name + '0';
+		toTry[0] = base + name + '0';
 		if (options & SafePath) {
 			QFileInfo toTry0(toTry[0]);
 			if (toTry0.exists()) {
-				toTry[1] = ((options & UserPath) ? _userBasePath : _basePath) + name + '1';
+				toTry[1] = base + name + '1';
 				QFileInfo toTry1(toTry[1]);
 				if (toTry1.exists()) {
 					QDateTime mod0 = toTry0.lastModified(), mod1 = toTry1.lastModified();
@@ -421,6 +415,15 @@ namespace {
 		return false;
 	}
 
+	bool readFile(FileReadDescriptor &result, const QString &name, int options = UserPath | SafePath) {
+		if (options & UserPath) {
+			if (!_userWorking()) return false;
+		} else {
+			if (!_working()) return false;
+		}
+		return readFileAt(result, (options & UserPath) ? _userBasePath : _basePath, name, options);
+	}
+
 	bool decryptLocal(EncryptedDescriptor &result, const QByteArray &encrypted, const mtpAuthKey &key = _localKey) {
 		if (encrypted.size() <= 16 || (encrypted.size() & 0x0F)) {
 			LOG(("App Error: bad encrypted part size: %1").arg(encrypted.size()));
@@ -457,10 +460,7 @@ namespace {
 		return true;
 	}
 
-	bool readEncryptedFile(FileReadDescriptor &result, const QString &name, int options = UserPath | SafePath, const mtpAuthKey &key = _localKey) {
-		if (!readFile(result, name, options)) {
-			return false;
-		}
+	bool decryptFile(FileReadDescriptor &result, const mtpAuthKey &key) {
 		QByteArray encrypted;
 		result.stream >> encrypted;
 
@@ -487,6 +487,14 @@ namespace {
 		return true;
 	}
 
+	bool readEncryptedFile(FileReadDescriptor &result, const QString &name, int options = UserPath | SafePath, const mtpAuthKey &key = _localKey) {
+		return readFile(result, name, options) && decryptFile(result, key);
+	}
+
+	bool readEncryptedFileAt(FileReadDescriptor &result, const QString &base, const FileKey &fkey, int options, const mtpAuthKey &key) {
+		return readFileAt(result, base, toFilePart(fkey), options) && decryptFile(result, key);
+	}
+
 	bool readEncryptedFile(FileReadDescriptor &result, const FileKey &fkey, int options = UserPath | SafePath, const mtpAuthKey &key = _localKey) {
 		return readEncryptedFile(result, toFilePart(fkey), options, key);
 	}
@@ -507,6 +515,10 @@ namespace {
 		lskRecentHashtags    = 0x0a, // no data
 		lskStickers          = 0x0b, // no data
 		lskSavedPeers        = 0x0c, // no data
+		lskStoragePacks      = 0x0d, // no data
+		lskDownloads         = 0x0e, // no data
+		lskHistoryMessages   = 0x0f, // data: PeerId peer
+		lskSearchIndex       = 0x10, // data: search index chunks
 	};
 
 	typedef QMap<PeerId, FileKey> DraftsMap;
@@ -522,6 +534,29 @@ namespace {
 	typedef QMap<MediaKey, MediaKey> FileLocationAliases;
 	FileLocationAliases _fileLocationAliases;
 	FileKey _locationsKey = 0;
+
+	typedef QMap<MediaKey, FileDownloadState> FileDownloadStates;
+	FileDownloadStates _downloadStates;
+	FileKey _downloadsKey = 0;
+
+	struct HistoryMessagesPage {
+		HistoryMessagesPage(FileKey key = 0, MsgId minId = 0, int32 count = 0) : key(key), minId(minId), count(count) {
+		}
+		FileKey key;
+		MsgId minId;
+		int32 count;
+	};
+	typedef QList<HistoryMessagesPage> HistoryMessagesPages;
+	struct HistoryMessages {
+		HistoryMessages() : maxId(0), atBottom(false) {
+		}
+		HistoryMessagesPages pages; // from older to newer, all saved messages are contiguous
+		MsgId maxId; // last saved message
+		bool atBottom; // new messages can be appended
+		QVector<MTPMessage> pending; // new messages from older to newer, they are not written yet
+	};
+	typedef QMap<PeerId, HistoryMessages> HistoryMessagesMap;
+	HistoryMessagesMap _historyMessagesMap;
 	
 	FileKey _recentStickersKeyOld = 0, _stickersKey = 0;
 	
@@ -576,68 +611,940 @@ namespace {
 				// location + type + namelen + name + date + size
 				size += sizeof(quint64) * 2 + sizeof(quint32) + _stringSize(i.value().name) + _dateTimeSize() + sizeof(quint32);
 			}
-			//end mark
-			size += sizeof(quint64) * 2 + sizeof(quint32) + _stringSize(QString()) + _dateTimeSize() + sizeof(quint32);
-			size += sizeof(quint32); // aliases count
-			for (FileLocationAliases::const_iterator i = _fileLocationAliases.cbegin(), e = _fileLocationAliases.cend(); i != e; ++i) {
-				// alias + location
-				size += sizeof(quint64) * 2 + sizeof(quint64) * 2;
+			//end mark
+			size += sizeof(quint64) * 2 + sizeof(quint32) + _stringSize(QString()) + _dateTimeSize() + sizeof(quint32);
+			size += sizeof(quint32); // aliases count
+			for (FileLocationAliases::const_iterator i = _fileLocationAliases.cbegin(), e = _fileLocationAliases.cend(); i != e; ++i) {
+				// alias + location
+				size += sizeof(quint64) * 2 + sizeof(quint64) * 2;
+			}
+
+			EncryptedDescriptor data(size);
+			for (FileLocations::const_iterator i = _fileLocations.cbegin(); i != _fileLocations.cend(); ++i) {
+				data.stream << quint64(i.key().first) << quint64(i.key().second) << quint32(i.value().type) << i.value().name << i.value().modified << quint32(i.value().size);
+			}
+			data.stream << quint64(0) << quint64(0) << quint32(0) << QString() << QDateTime::currentDateTime() << quint32(0);
+			data.stream << quint32(_fileLocationAliases.size());
+			for (FileLocationAliases::const_iterator i = _fileLocationAliases.cbegin(), e = _fileLocationAliases.cend(); i != e; ++i) {
+				data.stream << quint64(i.key().first) << quint64(i.key().second) << quint64(i.value().first) << quint64(i.value().second);
+			}
+
+			FileWriteDescriptor file(_locationsKey);
+			file.writeEncrypted(data);
+		}
+	}
+
+	void _readLocations() {
+		FileReadDescriptor locations;
+		if (!readEncryptedFile(locations, _locationsKey)) {
+			clearKey(_locationsKey);
+			_locationsKey = 0;
+			_writeMap();
+			return;
+		}
+
+		bool endMarkFound = false;
+		while (!locations.stream.atEnd()) {
+			quint64 first, second;
+			FileLocation loc;
+			quint32 type;
+			locations.stream >> first >> second >> type >> loc.name >> loc.modified >> loc.size;
+
+			if (!first && !second && !type && loc.name.isEmpty() && !loc.size) { // end mark
+				endMarkFound = true;
+				break;
+			}
+
+			MediaKey key(first, second);
+			loc.type = StorageFileType(type);
+
+			if (loc.check()) {
+				_fileLocations.insert(key, loc);
+				_fileLocationPairs.insert(loc.name, FileLocationPair(key, loc));
+			} else {
+				_writeLocations();
+			}
+		}
+
+		if (endMarkFound) {
+			quint32 cnt;
+			locations.stream >> cnt;
+			for (quint32 i = 0; i < cnt; ++i) {
+				quint64 kfirst, ksecond, vfirst, vsecond;
+				locations.stream >> kfirst >> ksecond >> vfirst >> vsecond;
+				_fileLocationAliases.insert(MediaKey(kfirst, ksecond), MediaKey(vfirst, vsecond));
+			}
+		}
+	}
+
+	void _writeDownloads(WriteMapWhen when = WriteMapSoon) {
+		if (when != WriteMapNow) {
+			_manager->writeDownloads(when == WriteMapFast);
+			return;
+		}
+		if (!_working()) return;
+
+		_manager->writingDownloads();
+		if (_downloadStates.isEmpty()) {
+			if (_downloadsKey) {
+				clearKey(_downloadsKey);
+				_downloadsKey = 0;
+				_mapChanged = true;
+				_writeMap();
+			}
+			return;
+		}
+		if (!_downloadsKey) {
+			_downloadsKey = genKey();
+			_mapChanged = true;
+			_writeMap(WriteMapFast);
+		}
+
+		quint32 size = sizeof(quint32);
+		for (FileDownloadStates::const_iterator i = _downloadStates.cbegin(), e = _downloadStates.cend(); i != e; ++i) {
+			// location + name + size + part size + parts bitmap
+			size += sizeof(quint64) * 2 + _stringSize(i.value().name) + sizeof(qint32) * 2 + _bytearraySize(i.value().parts);
+		}
+		EncryptedDescriptor data(size);
+		data.stream << quint32(_downloadStates.size());
+		for (FileDownloadStates::const_iterator i = _downloadStates.cbegin(), e = _downloadStates.cend(); i != e; ++i) {
+			data.stream << quint64(i.key().first) << quint64(i.key().second) << i.value().name << qint32(i.value().size) << qint32(i.value().partSize) << i.value().parts;
+		}
+		FileWriteDescriptor file(_downloadsKey);
+		file.writeEncrypted(data);
+	}
+
+	void _readDownloads() {
+		FileReadDescriptor downloads;
+		if (!readEncryptedFile(downloads, _downloadsKey)) {
+			clearKey(_downloadsKey);
+			_downloadsKey = 0;
+			_mapChanged = true;
+			_writeMap();
+			return;
+		}
+
+		quint32 count = 0;
+		downloads.stream >> count;
+		for (quint32 i = 0; i < count; ++i) {
+			quint64 first, second;
+			FileDownloadState state;
+			downloads.stream >> first >> second >> state.name >> state.size >> state.partSize >> state.parts;
+			if (!_checkStreamStatus(downloads.stream)) break;
+
+			if (state.check()) {
+				_downloadStates.insert(MediaKey(first, second), state);
+			} else {
+				_writeDownloads();
+			}
+		}
+	}
+
+	struct SearchIndexMessage {
+		SearchIndexMessage(const PeerId &peer = 0, const QStringList &words = QStringList()) : peer(peer), words(words) {
+		}
+		PeerId peer;
+		QStringList words;
+	};
+	typedef QMap<MsgId, SearchIndexMessage> SearchIndexMessages; // message ids grow with time, so the oldest are first
+	SearchIndexMessages _searchIndexMessages; // messages of the read chunks and the messages indexed after start
+	typedef QMap<QString, QSet<MsgId> > SearchIndexWords; // sorted for the word prefix lookup
+	SearchIndexWords _searchIndexWords;
+
+	struct SearchIndexChunk { // messages with ids from minId till the next chunk minId, written to one file
+		SearchIndexChunk(FileKey key = 0, MsgId minId = 0, int32 count = 0) : key(key), minId(minId), count(count), read(true), changed(false) {
+		}
+		FileKey key; // 0 if the chunk was not written yet
+		MsgId minId;
+		int32 count;
+		bool read; // messages of the chunk file are in _searchIndexMessages
+		bool changed; // chunk file must be written
+	};
+	typedef QList<SearchIndexChunk> SearchIndexChunks; // sorted by minId
+	SearchIndexChunks _searchIndexChunks;
+	QSet<MsgId> _searchIndexRemoved; // removed before their chunks were read
+	QSet<PeerId> _searchIndexRemovedPeers; // chats cleared before the chunks were read
+	QSet<FileKey> _searchIndexChunksReading; // chunk files read in the storage thread
+	bool _searchIndexSearched = false; // a search waits for the chunks to be read
+
+	typedef QMap<MsgId, MTPMessage> SearchIndexLoaded;
+	SearchIndexLoaded _searchIndexLoaded; // found messages read from the saved messages of their chats
+	QSet<MsgId> _searchIndexWanted; // found messages that are not loaded yet
+	QSet<FileKey> _searchIndexReading; // saved messages pages read in the storage thread
+	QSet<MsgId> _searchIndexUnavailable; // found messages that are not in the saved messages
+
+	int32 _searchIndexChunkIndex(MsgId msgId) { // chunk for the message id, -1 if there are no chunks
+		int32 result = _searchIndexChunks.size() - 1;
+		while (result > 0 && _searchIndexChunks.at(result).minId > msgId) {
+			--result;
+		}
+		return result;
+	}
+
+	SearchIndexMessages::iterator _searchIndexChunkEnd(int32 index) {
+		return (index + 1 < _searchIndexChunks.size()) ? _searchIndexMessages.lowerBound(_searchIndexChunks.at(index + 1).minId) : _searchIndexMessages.end();
+	}
+
+	void _searchIndexInsert(MsgId msgId, const PeerId &peer, const QStringList &words) {
+		_searchIndexMessages.insert(msgId, SearchIndexMessage(peer, words));
+		for (QStringList::const_iterator i = words.cbegin(), e = words.cend(); i != e; ++i) {
+			_searchIndexWords[*i].insert(msgId);
+		}
+	}
+
+	void _searchIndexErase(SearchIndexMessages::iterator i) {
+		for (QStringList::const_iterator j = i->words.cbegin(), e = i->words.cend(); j != e; ++j) {
+			SearchIndexWords::iterator k = _searchIndexWords.find(*j);
+			if (k != _searchIndexWords.end()) {
+				k->remove(i.key());
+				if (k->isEmpty()) _searchIndexWords.erase(k);
+			}
+		}
+		_searchIndexMessages.erase(i);
+	}
+
+	void _searchIndexClear() {
+		_searchIndexMessages.clear();
+		_searchIndexWords.clear();
+		_searchIndexChunks.clear();
+		_searchIndexRemoved.clear();
+		_searchIndexRemovedPeers.clear();
+		_searchIndexChunksReading.clear();
+		_searchIndexSearched = false;
+		_searchIndexLoaded.clear();
+		_searchIndexWanted.clear();
+		_searchIndexUnavailable.clear();
+	}
+
+	void _readSearchIndexChunk(int32 index, FileReadDescriptor *data) { // data == 0 if the chunk file could not be read
+		SearchIndexChunk &chunk(_searchIndexChunks[index]);
+		chunk.read = true;
+
+		MsgId till = (index + 1 < _searchIndexChunks.size()) ? _searchIndexChunks.at(index + 1).minId : 0;
+		if (data) {
+			quint32 count = 0;
+			data->stream >> count;
+			for (quint32 i = 0; i < count; ++i) {
+				qint32 msgId;
+				quint64 peer;
+				QString words;
+				data->stream >> msgId >> peer >> words;
+				if (!_checkStreamStatus(data->stream)) {
+					chunk.changed = true;
+					break;
+				}
+
+				if (msgId < chunk.minId || (till && msgId >= till)) continue;
+				if (_searchIndexRemoved.contains(msgId) || _searchIndexRemovedPeers.contains(peer)) continue;
+				if (!_searchIndexMessages.contains(msgId)) { // messages indexed before reading are newer
+					_searchIndexInsert(msgId, peer, words.split(' ', QString::SkipEmptyParts));
+				}
+			}
+		} else {
+			LOG(("App Error: could not read search index chunk %1").arg(chunk.key));
+			chunk.changed = true;
+		}
+
+		chunk.count = 0;
+		for (SearchIndexMessages::const_iterator i = _searchIndexMessages.lowerBound(chunk.minId), e = _searchIndexChunkEnd(index); i != e; ++i) {
+			++chunk.count;
+		}
+	}
+
+	void _readSearchIndexChunk(int32 index) {
+		SearchIndexChunk &chunk(_searchIndexChunks[index]);
+		if (chunk.read) return;
+
+		FileReadDescriptor data;
+		_readSearchIndexChunk(index, (chunk.key && readEncryptedFile(data, chunk.key)) ? &data : 0);
+	}
+
+	int32 _searchIndexChunksWritten() {
+		int32 result = 0;
+		for (SearchIndexChunks::const_iterator i = _searchIndexChunks.cbegin(), e = _searchIndexChunks.cend(); i != e; ++i) {
+			if (i->key) ++result;
+		}
+		return result;
+	}
+
+	void _writeSearchIndex(WriteMapWhen when = WriteMapSoon) {
+		if (when != WriteMapNow) {
+			_manager->writeSearchIndex(when == WriteMapFast);
+			return;
+		}
+		if (!_working()) return;
+
+		_manager->writingSearchIndex();
+		bool chunksChanged = false;
+
+		int32 count = 0;
+		for (SearchIndexChunks::const_iterator i = _searchIndexChunks.cbegin(), e = _searchIndexChunks.cend(); i != e; ++i) {
+			count += i->count;
+		}
+		while (count > SearchIndexMessagesMax && _searchIndexChunks.size() > 1) { // the oldest messages leave the index
+			for (SearchIndexMessages::iterator i = _searchIndexMessages.begin(), e = _searchIndexChunkEnd(0); i != e;) {
+				SearchIndexMessages::iterator j = i;
+				++j;
+				_searchIndexErase(i);
+				i = j;
+			}
+			count -= _searchIndexChunks.front().count;
+			if (_searchIndexChunks.front().key) clearKey(_searchIndexChunks.front().key);
+			_searchIndexChunks.pop_front();
+			chunksChanged = true;
+		}
+
+		for (int32 index = 0; index < _searchIndexChunks.size();) {
+			if (!_searchIndexChunks.at(index).changed) {
+				++index;
+				continue;
+			}
+			_readSearchIndexChunk(index);
+
+			SearchIndexChunk &chunk(_searchIndexChunks[index]);
+			if (!chunk.count) {
+				if (chunk.key) clearKey(chunk.key);
+				_searchIndexChunks.removeAt(index);
+				chunksChanged = true;
+				continue;
+			}
+
+			SearchIndexMessages::const_iterator from = _searchIndexMessages.lowerBound(chunk.minId), till = _searchIndexChunkEnd(index);
+			if (chunk.count > SearchIndexChunkSize * 2) { // the second half goes to a new chunk
+				SearchIndexMessages::const_iterator middle = from;
+				for (int32 i = 0; i < chunk.count / 2; ++i) {
+					++middle;
+				}
+				SearchIndexChunk second(0, middle.key(), chunk.count - chunk.count / 2);
+				second.changed = true;
+				chunk.count /= 2;
+				till = middle;
+				_searchIndexChunks.insert(index + 1, second);
+			}
+
+			SearchIndexChunk &written(_searchIndexChunks[index]);
+			if (!written.key) written.key = genKey();
+			QStringList words;
+			words.reserve(written.count);
+			quint32 size = sizeof(quint32);
+			for (SearchIndexMessages::const_iterator i = from; i != till; ++i) {
+				words.push_back(i->words.join(' '));
+				size += sizeof(qint32) + sizeof(quint64) + _stringSize(words.back());
+			}
+			EncryptedDescriptor data(size);
+			data.stream << quint32(words.size());
+			QStringList::const_iterator j = words.cbegin();
+			for (SearchIndexMessages::const_iterator i = from; i != till; ++i, ++j) {
+				data.stream << qint32(i.key()) << quint64(i->peer) << *j;
+			}
+			FileWriteDescriptor file(written.key);
+			file.writeEncrypted(data);
+
+			written.changed = false;
+			chunksChanged = true; // keys and counts are stored in the map
+			++index;
+		}
+
+		if (chunksChanged) {
+			_mapChanged = true;
+			_writeMap();
+		}
+	}
+
+	enum StoragePackType {
+		StoragePackImages   = 0,
+		StoragePackStickers = 1,
+		StoragePackAudios   = 2,
+
+		StoragePackTypeCount
+	};
+
+	static const char tdpMagic[] = { 'T', 'D', 'P', '$' };
+	static const int32 tdpMagicLen = sizeof(tdpMagic);
+	static const int32 tdpHeaderSize = tdpMagicLen + sizeof(qint32); // magic + version
+
+	struct PackEntry {
+		PackEntry(quint32 segment = 0, quint32 offset = 0, quint32 length = 0, quint32 used = 0) : segment(segment), offset(offset), length(length), used(used) {
+		}
+		quint32 segment, offset, length;
+		quint32 used; // last read or write unixtime, for evicting least recently used items
+	};
+	inline bool operator==(const PackEntry &a, const PackEntry &b) {
+		return (a.segment == b.segment) && (a.offset == b.offset) && (a.length == b.length);
+	}
+	typedef QMap<StorageKey, PackEntry> PackIndex;
+	typedef QLinkedList<StorageKey> PackUsage; // least recently used first
+	typedef QHash<StorageKey, PackUsage::iterator> PackUsagePositions;
+	typedef QMap<quint32, qint64> PackSegmentSizes; // segment -> bytes
+	typedef QMap<quint32, int32> PackSegmentWrites; // segment -> writes queued to the storage thread
+
+	typedef QPair<Local::TaskId, mtpFileLoader*> StorageReadWaiter;
+	typedef QList<StorageReadWaiter> StorageReadWaiters;
+	typedef QMap<StorageKey, StorageReadWaiters> StorageReads;
+
+	struct StoragePack {
+		StoragePack() : current(0), last(0) {
+		}
+		PackIndex index;
+		PackUsage usage; // all the indexed locations, evicted from the front
+		PackUsagePositions usagePositions;
+		PackSegmentSizes written, wasted; // whole segment file sizes and not indexed bytes in them
+		PackSegmentWrites writing;
+		StorageReads reading;
+		quint32 current, last; // segment for appending and the last created segment
+	};
+	StoragePack _packs[StoragePackTypeCount];
+	FileKey _packIndexKey = 0;
+	Local::TaskId _storageTaskId = 0;
+
+	enum StorageTaskType {
+		StorageTaskWrite,
+		StorageTaskReadPack,
+		StorageTaskReadFile,
+		StorageTaskReadMessages,
+		StorageTaskReadIndex,
+		StorageTaskRemove,
+	};
+
+	struct StorageTask { // disk, hash and crypto work done in the storage thread
+		StorageTask(StorageTaskType kind = StorageTaskRemove, StoragePackType type = StoragePackImages, const StorageKey &location = StorageKey()) : kind(kind), type(type), location(location), file(0), peer(0), result(false) {
+		}
+		StorageTaskType kind;
+		StoragePackType type;
+		StorageKey location;
+		PackEntry entry;
+		FileKey file; // old separate file for StorageTaskReadFile, saved messages page for StorageTaskReadMessages or search index chunk for StorageTaskReadIndex
+		PeerId peer; // chat of the saved messages page
+		QString path; // pack segment or a file to remove
+		QString base; // user data folder for the file reading tasks, set when queued
+		QByteArray data; // plain data to write or decrypted data that was read
+		mtpAuthKey key;
+		bool result;
+	};
+	typedef QList<StorageTask> StorageTasks;
+
+	void _storageQueue(StorageTask &task);
+
+	StorageMap &_packLegacyMap(StoragePackType type) {
+		switch (type) {
+		case StoragePackStickers: return _stickerImagesMap;
+		case StoragePackAudios: return _audiosMap;
+		}
+		return _imagesMap;
+	}
+
+	int32 &_packStorageSize(StoragePackType type) {
+		switch (type) {
+		case StoragePackStickers: return _storageStickersSize;
+		case StoragePackAudios: return _storageAudiosSize;
+		}
+		return _storageImagesSize;
+	}
+
+	QString _packBasePath() {
+		return _userBasePath + qsl("pack/");
+	}
+
+	QString _packSegmentName(StoragePackType type, quint32 segment) {
+		static const char prefix[StoragePackTypeCount] = { 'i', 's', 'a' };
+		return QString(QChar(prefix[type])) + QString("%1").arg(segment, 8, 16, QChar('0')).toUpper();
+	}
+
+	QString _packSegmentPath(StoragePackType type, quint32 segment) {
+		return _packBasePath() + _packSegmentName(type, segment);
+	}
+
+	quint32 _packRecordLength(int32 plainSize) {
+		// part of sha1 + plain data padded to 16 bytes, see FileWriteDescriptor::prepareEncrypted
+		quint32 fullSize = plainSize;
+		if (fullSize & 0x0F) fullSize += 0x10 - (fullSize & 0x0F);
+		return 0x10 + fullSize;
+	}
+
+	PackEntry _packAllocate(StoragePackType type, quint32 length) {
+		StoragePack &pack(_packs[type]);
+		qint64 written = pack.current ? pack.written.value(pack.current, 0) : 0;
+		if (!pack.current || (written > tdpHeaderSize && written + length > LocalPackSegmentSize)) {
+			pack.current = ++pack.last;
+			written = 0;
+		}
+		written = qMax(written, qint64(tdpHeaderSize));
+
+		PackEntry result(pack.current, quint32(written), length, myunixtime());
+		pack.written[pack.current] = written + length;
+		if (!pack.wasted.contains(pack.current)) pack.wasted.insert(pack.current, 0);
+		++pack.writing[pack.current];
+		return result;
+	}
+
+	void _packWaste(StoragePackType type, const PackEntry &entry) {
+		StoragePack &pack(_packs[type]);
+		pack.wasted[entry.segment] += entry.length;
+		_packStorageSize(type) -= entry.length;
+	}
+
+	void _packUsed(StoragePack &pack, const StorageKey &location) { // moves the location to the back of the usage list
+		PackUsagePositions::iterator i = pack.usagePositions.find(location);
+		if (i != pack.usagePositions.end()) {
+			if (i.value() + 1 == pack.usage.end()) return;
+			pack.usage.erase(i.value());
+			i.value() = pack.usage.insert(pack.usage.end(), location);
+		} else {
+			pack.usagePositions.insert(location, pack.usage.insert(pack.usage.end(), location));
+		}
+	}
+
+	void _packForget(StoragePack &pack, const StorageKey &location) {
+		PackUsagePositions::iterator i = pack.usagePositions.find(location);
+		if (i != pack.usagePositions.end()) {
+			pack.usage.erase(i.value());
+			pack.usagePositions.erase(i);
+		}
+	}
+
+	void _packClear() {
+		for (int32 i = 0; i < StoragePackTypeCount; ++i) {
+			StoragePack &pack(_packs[i]);
+			pack.index.clear();
+			pack.usage.clear();
+			pack.usagePositions.clear();
+			pack.written.clear();
+			pack.wasted.clear();
+			pack.writing.clear();
+			pack.current = 0; // keep pack.last, so the new segments never get the old names
+		}
+		_packIndexKey = 0;
+	}
+
+	void _writePackIndex(WriteMapWhen when = WriteMapSoon) {
+		if (when != WriteMapNow) {
+			_manager->writePackIndex(when == WriteMapFast);
+			return;
+		}
+		if (!_working()) return;
+
+		_manager->writingPackIndex();
+		quint32 count = 0;
+		for (int32 i = 0; i < StoragePackTypeCount; ++i) {
+			count += _packs[i].index.size();
+		}
+		if (!count) {
+			if (_packIndexKey) {
+				clearKey(_packIndexKey);
+				_packIndexKey = 0;
+				_mapChanged = true;
+				_writeMap();
+			}
+			return;
+		}
+		if (!_packIndexKey) {
+			_packIndexKey = genKey();
+			_mapChanged = true;
+			_writeMap(WriteMapFast);
+		}
+
+		// (type + current + count) per pack, location + segment + offset + length + used per entry
+		quint32 size = StoragePackTypeCount * sizeof(quint32) * 3 + count * (sizeof(quint64) * 2 + sizeof(quint32) * 4);
+		EncryptedDescriptor data(size);
+		for (int32 i = 0; i < StoragePackTypeCount; ++i) {
+			const StoragePack &pack(_packs[i]);
+			data.stream << quint32(i) << quint32(pack.current) << quint32(pack.index.size());
+			for (PackIndex::const_iterator j = pack.index.cbegin(), e = pack.index.cend(); j != e; ++j) {
+				data.stream << quint64(j.key().first) << quint64(j.key().second) << quint32(j.value().segment) << quint32(j.value().offset) << quint32(j.value().length) << quint32(j.value().used);
+			}
+		}
+		FileWriteDescriptor file(_packIndexKey);
+		file.writeEncrypted(data);
+	}
+
+	qint64 _storageLimit(StoragePackType type) {
+		int32 mb = 0;
+		switch (type) {
+		case StoragePackImages: mb = cStorageImagesLimit(); break;
+		case StoragePackStickers: mb = cStorageStickersLimit(); break;
+		case StoragePackAudios: mb = cStorageAudiosLimit(); break;
+		}
+		return qint64(mb) * 1024 * 1024;
+	}
+
+	bool _storageOverLimit() {
+		for (int32 i = 0; i < StoragePackTypeCount; ++i) {
+			qint64 limit = _storageLimit(StoragePackType(i));
+			if (limit > 0 && _packStorageSize(StoragePackType(i)) > limit) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void _readPackIndex() {
+		FileReadDescriptor index;
+		if (_packIndexKey && !readEncryptedFile(index, _packIndexKey)) {
+			clearKey(_packIndexKey);
+			_packIndexKey = 0;
+			_mapChanged = true;
+			_writeMap();
+		}
+		if (_packIndexKey) {
+			while (!index.stream.atEnd()) {
+				quint32 type, current, count;
+				index.stream >> type >> current >> count;
+				if (!_checkStreamStatus(index.stream) || type >= StoragePackTypeCount) break;
+
+				StoragePack &pack(_packs[type]);
+				pack.current = current;
+				for (quint32 i = 0; i < count; ++i) {
+					quint64 first, second;
+					quint32 segment, offset, length, used;
+					index.stream >> first >> second >> segment >> offset >> length >> used;
+					pack.index.insert(StorageKey(first, second), PackEntry(segment, offset, length, used));
+				}
+				if (!_checkStreamStatus(index.stream)) {
+					pack.index.clear();
+					break;
+				}
+			}
+		}
+
+		// one directory listing instead of a stat per cache item
+		QStringList segments = QDir(_packBasePath()).entryList(QDir::Files);
+		bool changed = false;
+		for (int32 i = 0; i < StoragePackTypeCount; ++i) {
+			StoragePackType type = StoragePackType(i);
+			StoragePack &pack(_packs[i]);
+			QString empty = _packSegmentName(type, 0);
+			for (QStringList::const_iterator j = segments.cbegin(), e = segments.cend(); j != e; ++j) {
+				if (j->size() != empty.size() || j->at(0) != empty.at(0)) continue;
+
+				bool ok = false;
+				quint32 segment = j->mid(1).toUInt(&ok, 16);
+				if (!ok || !segment) continue;
+
+				pack.written.insert(segment, QFileInfo(_packBasePath() + *j).size());
+				pack.wasted.insert(segment, 0);
+				if (segment > pack.last) pack.last = segment;
+			}
+
+			PackSegmentSizes live;
+			for (PackIndex::iterator j = pack.index.begin(); j != pack.index.end();) {
+				qint64 written = pack.written.value(j.value().segment, 0);
+				if (j.value().offset < quint32(tdpHeaderSize) || qint64(j.value().offset) + j.value().length > written) {
+					j = pack.index.erase(j);
+					changed = true;
+				} else {
+					live[j.value().segment] += j.value().length;
+					_packStorageSize(type) += j.value().length;
+					++j;
+				}
+			}
+			for (PackSegmentSizes::iterator j = pack.written.begin(); j != pack.written.end();) {
+				qint64 used = live.value(j.key(), 0);
+				if (!used && j.key() != pack.current) { // nothing indexed there, possibly an interrupted compaction
+					QFile::remove(_packSegmentPath(type, j.key()));
+					pack.wasted.remove(j.key());
+					j = pack.written.erase(j);
+				} else {
+					pack.wasted[j.key()] = qMax(j.value() - tdpHeaderSize - used, qint64(0));
+					++j;
+				}
+			}
+
+			typedef QMultiMap<quint32, StorageKey> ByUsage; // sorted once, then kept in order by _packUsed()
+			ByUsage byUsage;
+			for (PackIndex::const_iterator j = pack.index.cbegin(), e = pack.index.cend(); j != e; ++j) {
+				byUsage.insert(j.value().used, j.key());
+			}
+			for (ByUsage::const_iterator j = byUsage.cbegin(), e = byUsage.cend(); j != e; ++j) {
+				_packUsed(pack, j.value());
+			}
+		}
+		if (changed) _writePackIndex();
+		if (_packIndexKey) _manager->compactPacks();
+		if (_storageOverLimit()) _manager->evictStorage();
+	}
+
+	bool _storageHas(StoragePackType type, const StorageKey &location) {
+		return _packs[type].index.contains(location) || _packLegacyMap(type).contains(location);
+	}
+
+	int32 _storageCount(StoragePackType type) {
+		return _packs[type].index.size() + _packLegacyMap(type).size();
+	}
+
+	void _storageWrite(StoragePackType type, const StorageKey &location, const QByteArray &plain) {
+		StoragePack &pack(_packs[type]);
+		StorageTask task(StorageTaskWrite, type, location);
+		task.entry = _packAllocate(type, _packRecordLength(plain.size()));
+		task.path = _packSegmentPath(type, task.entry.segment);
+		task.data = plain;
+		_storageQueue(task);
+
+		PackIndex::iterator i = pack.index.find(location);
+		if (i != pack.index.end()) {
+			_packWaste(type, i.value());
+			i.value() = task.entry;
+		} else {
+			pack.index.insert(location, task.entry);
+		}
+		_packUsed(pack, location);
+		_packStorageSize(type) += task.entry.length;
+
+		StorageMap &legacy(_packLegacyMap(type));
+		StorageMap::iterator j = legacy.find(location);
+		if (j != legacy.end()) {
+			clearKey(j.value().first, UserPath);
+			_packStorageSize(type) -= j.value().second;
+			legacy.erase(j);
+			_mapChanged = true;
+			_writeMap();
+		}
+
+		_writePackIndex();
+		_manager->compactPacks();
+		if (_storageOverLimit()) {
+			_manager->evictStorage();
+		}
+	}
+
+	void _storageWrite(StoragePackType type, const StorageKey &location, EncryptedDescriptor &data) {
+		data.finish();
+		_storageWrite(type, location, data.data);
+	}
+
+	void _prepareRead(EncryptedDescriptor &result, const QByteArray &decrypted) {
+		result.data = decrypted;
+		result.buffer.setBuffer(&result.data);
+		result.buffer.open(QIODevice::ReadOnly);
+		result.buffer.seek(sizeof(uint32)); // skip len
+		result.stream.setDevice(&result.buffer);
+		result.stream.setVersion(QDataStream::Qt_5_1);
+	}
+
+	void _prepareRead(FileReadDescriptor &result, const QByteArray &decrypted) {
+		result.version = AppVersion;
+		result.data = decrypted;
+		result.buffer.setBuffer(&result.data);
+		result.buffer.open(QIODevice::ReadOnly);
+		result.buffer.seek(sizeof(uint32)); // skip len
+		result.stream.setDevice(&result.buffer);
+		result.stream.setVersion(QDataStream::Qt_5_1);
+	}
+
+	Local::TaskId _storageStartRead(StoragePackType type, const StorageKey &location, mtpFileLoader *loader) {
+		if (!_working()) return 0;
+
+		StoragePack &pack(_packs[type]);
+		StorageReads::iterator i = pack.reading.find(location);
+		if (i == pack.reading.end()) { // concurrent reads of the same item wait for one task
+			StorageTask task;
+			PackIndex::const_iterator j = pack.index.constFind(location);
+			if (j != pack.index.cend()) {
+				task = StorageTask(StorageTaskReadPack, type, location);
+				task.entry = j.value();
+				task.path = _packSegmentPath(type, j.value().segment);
+			} else {
+				StorageMap &legacy(_packLegacyMap(type));
+				StorageMap::const_iterator k = legacy.constFind(location);
+				if (k == legacy.cend()) {
+					return 0;
+				}
+				task = StorageTask(StorageTaskReadFile, type, location);
+				task.file = k.value().first;
+			}
+			_storageQueue(task);
+			i = pack.reading.insert(location, StorageReadWaiters());
+		}
+		Local::TaskId result = ++_storageTaskId;
+		i.value().push_back(StorageReadWaiter(result, loader));
+		return result;
+	}
+
+	void _storageDeliver(StoragePackType type, const StorageKey &location, const QByteArray &decrypted) {
+		StoragePack &pack(_packs[type]);
+		StorageReads::iterator i = pack.reading.find(location);
+		if (i == pack.reading.end()) return;
+
+		StorageReadWaiters waiters = i.value();
+		pack.reading.erase(i);
+		if (waiters.isEmpty()) return;
+
+		StorageImageSaved result;
+		if (!decrypted.isEmpty()) {
+			EncryptedDescriptor data;
+			_prepareRead(data, decrypted);
+
+			quint64 locFirst, locSecond;
+			data.stream >> locFirst >> locSecond;
+			if (locFirst == location.first && locSecond == location.second) {
+				if (type == StoragePackImages) {
+					QByteArray imageData;
+					quint32 imageType;
+					data.stream >> imageType >> imageData;
+					result = StorageImageSaved(StorageFileType(imageType), imageData);
+				} else {
+					QByteArray bytes;
+					data.stream >> bytes;
+					if (!bytes.isEmpty()) result = StorageImageSaved(StorageFilePartial, bytes);
+				}
+			}
+		}
+		for (StorageReadWaiters::const_iterator j = waiters.cbegin(), e = waiters.cend(); j != e; ++j) {
+			j->second->localLoaded(result);
+		}
+	}
+
+}
+
+namespace Local {
+	void _searchIndexChunkRead(const FileKey &key, const QByteArray &decrypted);
+	void _searchIndexPageRead(const PeerId &peer, const FileKey &key, const QByteArray &decrypted);
+}
+
+namespace {
+
+	void _storageProcessed(StorageTask &task) {
+		if (task.kind == StorageTaskReadIndex) {
+			Local::_searchIndexChunkRead(task.file, task.result ? task.data : QByteArray());
+			return;
+		} else if (task.kind == StorageTaskReadMessages) {
+			Local::_searchIndexPageRead(task.peer, task.file, task.result ? task.data : QByteArray());
+			return;
+		}
+
+		StoragePack &pack(_packs[task.type]);
+		PackIndex::iterator i = pack.index.find(task.location);
+		bool indexed = (i != pack.index.end()) && (i.value() == task.entry);
+		switch (task.kind) {
+		case StorageTaskWrite: {
+			PackSegmentWrites::iterator j = pack.writing.find(task.entry.segment);
+			if (j != pack.writing.end() && --j.value() <= 0) {
+				pack.writing.erase(j);
+			}
+			if (!task.result) {
+				LOG(("App Error: could not write %1 bytes at %2 to cache pack segment '%3'").arg(task.entry.length).arg(task.entry.offset).arg(task.path));
+				if (indexed) {
+					_packWaste(task.type, i.value());
+					_packForget(pack, task.location);
+					pack.index.erase(i);
+					_writePackIndex();
+				}
+				if (pack.current == task.entry.segment) {
+					pack.current = 0; // try a new segment next time
+				}
 			}
-
-			EncryptedDescriptor data(size);
-			for (FileLocations::const_iterator i = _fileLocations.cbegin(); i != _fileLocations.cend(); ++i) {
-				data.stream << quint64(i.key().first) << quint64(i.key().second) << quint32(i.value().type) << i.value().name << i.value().modified << quint32(i.value().size);
+		} return;
+
+		case StorageTaskReadPack: {
+			if (task.result) {
+				quint32 now = myunixtime();
+				if (indexed) _packUsed(pack, task.location);
+				if (indexed && now > i.value().used + LocalStorageAccessGranularity) {
+					i.value().used = now;
+					_writePackIndex();
+				}
+			} else if (i != pack.index.end() && !indexed) { // moved by compaction while reading
+				task.entry = i.value();
+				task.path = _packSegmentPath(task.type, task.entry.segment);
+				_storageQueue(task);
+				return;
+			} else if (indexed) {
+				LOG(("App Error: could not read %1 bytes at %2 from cache pack segment '%3'").arg(task.entry.length).arg(task.entry.offset).arg(task.path));
+				_packWaste(task.type, i.value());
+				_packForget(pack, task.location);
+				pack.index.erase(i);
+				_writePackIndex();
 			}
-			data.stream << quint64(0) << quint64(0) << quint32(0) << QString() << QDateTime::currentDateTime() << quint32(0);
-			data.stream << quint32(_fileLocationAliases.size());
-			for (FileLocationAliases::const_iterator i = _fileLocationAliases.cbegin(), e = _fileLocationAliases.cend(); i != e; ++i) {
-				data.stream << quint64(i.key().first) << quint64(i.key().second) << quint64(i.value().first) << quint64(i.value().second);
+		} break;
+
+		case StorageTaskReadFile: {
+			StorageMap &legacy(_packLegacyMap(task.type));
+			StorageMap::iterator j = legacy.find(task.location);
+			if (j != legacy.end() && j.value().first == task.file) {
+				if (!task.result) {
+					clearKey(j.value().first, UserPath);
+					_packStorageSize(task.type) -= j.value().second;
+					legacy.erase(j);
+					_mapChanged = true;
+					_writeMap();
+				} else if (i == pack.index.end()) {
+					// move the old separate file to the pack, next time it will be an index hit
+					_storageWrite(task.type, task.location, task.data);
+				}
 			}
+		} break;
 
-			FileWriteDescriptor file(_locationsKey);
-			file.writeEncrypted(data);
+		default: return;
 		}
+		_storageDeliver(task.type, task.location, task.result ? task.data : QByteArray());
 	}
 
-	void _readLocations() {
-		FileReadDescriptor locations;
-		if (!readEncryptedFile(locations, _locationsKey)) {
-			clearKey(_locationsKey);
-			_locationsKey = 0;
-			_writeMap();
-			return;
-		}
+	bool _storageEvict() { // returns true if more items should be evicted
+		bool more = false, indexChanged = false;
+		for (int32 i = 0; i < StoragePackTypeCount; ++i) {
+			StoragePackType type = StoragePackType(i);
+			qint64 limit = _storageLimit(type);
+			int32 &size(_packStorageSize(type));
+			if (limit <= 0 || size <= limit) continue;
+
+			qint64 target = limit * LocalStorageEvictPercent / 100;
+			int32 left = LocalStorageEvictBatch;
+
+			// old separate files were not read since they were moved to the pack
+			StorageMap &legacy(_packLegacyMap(type));
+			for (StorageMap::iterator j = legacy.begin(); j != legacy.end() && left > 0 && size > target; --left) {
+				clearKey(j.value().first, UserPath);
+				size -= j.value().second;
+				j = legacy.erase(j);
+				_mapChanged = true;
+			}
 
-		bool endMarkFound = false;
-		while (!locations.stream.atEnd()) {
-			quint64 first, second;
-			FileLocation loc;
-			quint32 type;
-			locations.stream >> first >> second >> type >> loc.name >> loc.modified >> loc.size;
+			StoragePack &pack(_packs[i]);
+			for (; !pack.usage.isEmpty() && left > 0 && size > target; --left) {
+				StorageKey location = pack.usage.front();
+				_packForget(pack, location);
 
-			if (!first && !second && !type && loc.name.isEmpty() && !loc.size) { // end mark
-				endMarkFound = true;
-				break;
+				PackIndex::iterator j = pack.index.find(location);
+				if (j != pack.index.end()) {
+					_packWaste(type, j.value());
+					pack.index.erase(j);
+					indexChanged = true;
+				}
 			}
+			if (size > target) more = true;
+		}
+		if (_mapChanged) _writeMap();
+		if (indexChanged) {
+			_writePackIndex();
+			_manager->compactPacks();
+		}
+		return more;
+	}
 
-			MediaKey key(first, second);
-			loc.type = StorageFileType(type);
-
-			if (loc.check()) {
-				_fileLocations.insert(key, loc);
-				_fileLocationPairs.insert(loc.name, FileLocationPair(key, loc));
-			} else {
-				_writeLocations();
+	void _storageClearPacks(QStringList &segments) {
+		for (int32 i = 0; i < StoragePackTypeCount; ++i) {
+			StoragePackType type = StoragePackType(i);
+			const StoragePack &pack(_packs[i]);
+			for (PackSegmentSizes::const_iterator j = pack.written.cbegin(), e = pack.written.cend(); j != e; ++j) {
+				segments.push_back(_packSegmentPath(type, j.key()));
 			}
 		}
+		if (_packIndexKey) {
+			clearKey(_packIndexKey);
+			_mapChanged = true;
+		}
+		_packClear();
+	}
 
-		if (endMarkFound) {
-			quint32 cnt;
-			locations.stream >> cnt;
-			for (quint32 i = 0; i < cnt; ++i) {
-				quint64 kfirst, ksecond, vfirst, vsecond;
-				locations.stream >> kfirst >> ksecond >> vfirst >> vsecond;
-				_fileLocationAliases.insert(MediaKey(kfirst, ksecond), MediaKey(vfirst, vsecond));
+	void _storageCancel(Local::TaskId id) {
+		for (int32 i = 0; i < StoragePackTypeCount; ++i) {
+			StorageReads &reading(_packs[i].reading);
+			for (StorageReads::iterator j = reading.begin(), e = reading.end(); j != e; ++j) {
+				for (StorageReadWaiters::iterator k = j.value().begin(), ke = j.value().end(); k != ke; ++k) {
+					if (k->first == id) {
+						j.value().erase(k); // the task result will be ignored if nobody waits for it
+						return;
+					}
+				}
 			}
 		}
 	}
@@ -1048,6 +1955,16 @@ namespace {
 			cSetSongVolume(snap(v / 1e6, 0., 1.));
 		} break;
 
+		case dbiStorageLimits: {
+			qint32 images, stickers, audios;
+			stream >> images >> stickers >> audios;
+			if (!_checkStreamStatus(stream)) return false;
+
+			cSetStorageImagesLimit(qMax(images, 0));
+			cSetStorageStickersLimit(qMax(stickers, 0));
+			cSetStorageAudiosLimit(qMax(audios, 0));
+		} break;
+
 		default:
 			LOG(("App Error: unknown blockId in _readSetting: %1").arg(blockId));
 			return false;
@@ -1275,6 +2192,7 @@ namespace {
 		size += sizeof(quint32) + sizeof(qint32) + cEmojiVariants().size() * (sizeof(uint32) + sizeof(uint64));
 		size += sizeof(quint32) + sizeof(qint32) + (cRecentStickersPreload().isEmpty() ? cGetRecentStickers().size() : cRecentStickersPreload().size()) * (sizeof(uint64) + sizeof(ushort));
 		size += sizeof(quint32) + _stringSize(cDialogLastPath());
+		size += sizeof(quint32) + 3 * sizeof(qint32);
 
 		EncryptedDescriptor data(size);
 		data.stream << quint32(dbiSendKey) << qint32(cCtrlEnter() ? dbiskCtrlEnter : dbiskEnter);
@@ -1291,6 +2209,7 @@ namespace {
 		data.stream << quint32(dbiEmojiTab) << qint32(cEmojiTab());
 		data.stream << quint32(dbiDialogLastPath) << cDialogLastPath();
 		data.stream << quint32(dbiSongVolume) << qint32(qRound(cSongVolume() * 1e6));
+		data.stream << quint32(dbiStorageLimits) << qint32(cStorageImagesLimit()) << qint32(cStorageStickersLimit()) << qint32(cStorageAudiosLimit());
 
 		{
 			RecentEmojisPreload v(cRecentEmojisPreload());
@@ -1434,9 +2353,11 @@ namespace {
 
 		DraftsMap draftsMap, draftsPositionsMap;
 		DraftsNotReadMap draftsNotReadMap;
+		HistoryMessagesMap historyMessagesMap;
 		StorageMap imagesMap, stickerImagesMap, audiosMap;
 		qint64 storageImagesSize = 0, storageStickersSize = 0, storageAudiosSize = 0;
-		quint64 locationsKey = 0, recentStickersKeyOld = 0, stickersKey = 0, backgroundKey = 0, userSettingsKey = 0, recentHashtagsKey = 0, savedPeersKey = 0;
+		quint64 locationsKey = 0, recentStickersKeyOld = 0, stickersKey = 0, backgroundKey = 0, userSettingsKey = 0, recentHashtagsKey = 0, savedPeersKey = 0, storagePacksKey = 0, downloadsKey = 0;
+		SearchIndexChunks searchIndexChunks;
 		while (!map.stream.atEnd()) {
 			quint32 keyType;
 			map.stream >> keyType;
@@ -1462,6 +2383,27 @@ namespace {
 					draftsPositionsMap.insert(p, key);
 				}
 			} break;
+			case lskHistoryMessages: {
+				quint32 count = 0;
+				map.stream >> count;
+				for (quint32 i = 0; i < count; ++i) {
+					quint64 p;
+					qint32 maxId, atBottom;
+					quint32 pagesCount = 0;
+					map.stream >> p >> maxId >> atBottom >> pagesCount;
+
+					HistoryMessages messages;
+					messages.maxId = maxId;
+					messages.atBottom = (atBottom == 1);
+					for (quint32 j = 0; j < pagesCount; ++j) {
+						FileKey key;
+						qint32 minId, pageCount;
+						map.stream >> key >> minId >> pageCount;
+						messages.pages.push_back(HistoryMessagesPage(key, minId, pageCount));
+					}
+					historyMessagesMap.insert(p, messages);
+				}
+			} break;
 			case lskImages: {
 				quint32 count = 0;
 				map.stream >> count;
@@ -1519,6 +2461,24 @@ namespace {
 			case lskSavedPeers: {
 				map.stream >> savedPeersKey;
 			} break;
+			case lskStoragePacks: {
+				map.stream >> storagePacksKey;
+			} break;
+			case lskDownloads: {
+				map.stream >> downloadsKey;
+			} break;
+			case lskSearchIndex: {
+				quint32 count = 0;
+				map.stream >> count;
+				for (quint32 i = 0; i < count; ++i) {
+					FileKey key;
+					qint32 minId, chunkCount;
+					map.stream >> key >> minId >> chunkCount;
+					SearchIndexChunk chunk(key, minId, chunkCount);
+					chunk.read = false; // read when it is needed
+					searchIndexChunks.push_back(chunk);
+				}
+			} break;
 			default:
 				LOG(("App Error: unknown key type in encrypted map: %1").arg(keyType));
 				return Local::ReadMapFailed;
@@ -1531,6 +2491,7 @@ namespace {
 		_draftsMap = draftsMap;
 		_draftsPositionsMap = draftsPositionsMap;
 		_draftsNotReadMap = draftsNotReadMap;
+		_historyMessagesMap = historyMessagesMap;
 
 		_imagesMap = imagesMap;
 		_storageImagesSize = storageImagesSize;
@@ -1546,6 +2507,10 @@ namespace {
 		_backgroundKey = backgroundKey;
 		_userSettingsKey = userSettingsKey;
 		_recentHashtagsKey = recentHashtagsKey;
+		_packIndexKey = storagePacksKey;
+		_downloadsKey = downloadsKey;
+		_searchIndexClear();
+		_searchIndexChunks = searchIndexChunks;
 		_oldMapVersion = mapData.version;
 		if (_oldMapVersion < AppVersion) {
 			_mapChanged = true;
@@ -1557,6 +2522,10 @@ namespace {
 		if (_locationsKey) {
 			_readLocations();
 		}
+		if (_downloadsKey) {
+			_readDownloads();
+		}
+		_readPackIndex();
 
 		_readUserSettings();
 		_readMtpData();
@@ -1601,6 +2570,12 @@ namespace {
 		uint32 mapSize = 0;
 		if (!_draftsMap.isEmpty()) mapSize += sizeof(quint32) * 2 + _draftsMap.size() * sizeof(quint64) * 2;
 		if (!_draftsPositionsMap.isEmpty()) mapSize += sizeof(quint32) * 2 + _draftsPositionsMap.size() * sizeof(quint64) * 2;
+		if (!_historyMessagesMap.isEmpty()) {
+			mapSize += sizeof(quint32) * 2;
+			for (HistoryMessagesMap::const_iterator i = _historyMessagesMap.cbegin(), e = _historyMessagesMap.cend(); i != e; ++i) {
+				mapSize += sizeof(quint64) + sizeof(qint32) * 2 + sizeof(quint32) + i.value().pages.size() * (sizeof(quint64) + sizeof(qint32) * 2);
+			}
+		}
 		if (!_imagesMap.isEmpty()) mapSize += sizeof(quint32) * 2 + _imagesMap.size() * (sizeof(quint64) * 3 + sizeof(qint32));
 		if (!_stickerImagesMap.isEmpty()) mapSize += sizeof(quint32) * 2 + _stickerImagesMap.size() * (sizeof(quint64) * 3 + sizeof(qint32));
 		if (!_audiosMap.isEmpty()) mapSize += sizeof(quint32) * 2 + _audiosMap.size() * (sizeof(quint64) * 3 + sizeof(qint32));
@@ -1611,6 +2586,10 @@ namespace {
 		if (_backgroundKey) mapSize += sizeof(quint32) + sizeof(quint64);
 		if (_userSettingsKey) mapSize += sizeof(quint32) + sizeof(quint64);
 		if (_recentHashtagsKey) mapSize += sizeof(quint32) + sizeof(quint64);
+		if (_packIndexKey) mapSize += sizeof(quint32) + sizeof(quint64);
+		if (_downloadsKey) mapSize += sizeof(quint32) + sizeof(quint64);
+		int32 searchIndexChunks = _searchIndexChunksWritten();
+		if (searchIndexChunks) mapSize += sizeof(quint32) * 2 + searchIndexChunks * (sizeof(quint64) + sizeof(qint32) * 2);
 		EncryptedDescriptor mapData(mapSize);
 		if (!_draftsMap.isEmpty()) {
 			mapData.stream << quint32(lskDraft) << quint32(_draftsMap.size());
@@ -1624,6 +2603,16 @@ namespace {
 				mapData.stream << quint64(i.value()) << quint64(i.key());
 			}
 		}
+		if (!_historyMessagesMap.isEmpty()) {
+			mapData.stream << quint32(lskHistoryMessages) << quint32(_historyMessagesMap.size());
+			for (HistoryMessagesMap::const_iterator i = _historyMessagesMap.cbegin(), e = _historyMessagesMap.cend(); i != e; ++i) {
+				const HistoryMessages &messages(i.value());
+				mapData.stream << quint64(i.key()) << qint32(messages.maxId) << qint32(messages.atBottom ? 1 : 0) << quint32(messages.pages.size());
+				for (HistoryMessagesPages::const_iterator j = messages.pages.cbegin(), en = messages.pages.cend(); j != en; ++j) {
+					mapData.stream << quint64(j->key) << qint32(j->minId) << qint32(j->count);
+				}
+			}
+		}
 		if (!_imagesMap.isEmpty()) {
 			mapData.stream << quint32(lskImages) << quint32(_imagesMap.size());
 			for (StorageMap::const_iterator i = _imagesMap.cbegin(), e = _imagesMap.cend(); i != e; ++i) {
@@ -1663,6 +2652,18 @@ namespace {
 		if (_recentHashtagsKey) {
 			mapData.stream << quint32(lskRecentHashtags) << quint64(_recentHashtagsKey);
 		}
+		if (_packIndexKey) {
+			mapData.stream << quint32(lskStoragePacks) << quint64(_packIndexKey);
+		}
+		if (_downloadsKey) {
+			mapData.stream << quint32(lskDownloads) << quint64(_downloadsKey);
+		}
+		if (searchIndexChunks) {
+			mapData.stream << quint32(lskSearchIndex) << quint32(searchIndexChunks);
+			for (SearchIndexChunks::const_iterator i = _searchIndexChunks.cbegin(), e = _searchIndexChunks.cend(); i != e; ++i) {
+				if (i->key) mapData.stream << quint64(i->key) << qint32(i->minId) << qint32(i->count);
+			}
+		}
 		map.writeEncrypted(mapData);
 
 		_mapChanged = false;
@@ -1670,13 +2671,193 @@ namespace {
 
 }
 
+namespace Local {
+	void _writeHistoryMessages(WriteMapWhen when);
+}
+
 namespace _local_inner {
 
-	Manager::Manager() {
+	struct StorageWorkerData {
+		QMutex lock;
+		StorageTasks queue, done;
+		QFile segment; // last written pack segment, kept open while there are tasks
+	};
+
+	StorageWorker::StorageWorker(StorageWorkerData *data, QThread *thread) : QObject(0), _data(data) {
+		moveToThread(thread);
+	}
+
+	StorageWorkerData *StorageWorker::data() const {
+		return _data;
+	}
+
+	void StorageWorker::process() {
+		while (true) {
+			StorageTask task;
+			{
+				QMutexLocker lock(&_data->lock);
+				if (_data->queue.isEmpty()) break;
+				task = _data->queue.front();
+				_data->queue.pop_front();
+			}
+
+			switch (task.kind) {
+			case StorageTaskWrite: {
+				EncryptedDescriptor plain;
+				plain.data = task.data;
+				QByteArray encrypted = FileWriteDescriptor::prepareEncrypted(plain, task.key);
+				task.data = QByteArray();
+
+				QFile &f(_data->segment);
+				if (f.fileName() != task.path) {
+					if (f.isOpen()) f.close();
+					f.setFileName(task.path);
+				}
+				if (!f.isOpen() && !f.open(QIODevice::ReadWrite)) {
+					QDir().mkpath(QFileInfo(task.path).absolutePath());
+					f.open(QIODevice::ReadWrite);
+				}
+				if (f.isOpen() && encrypted.size() == int32(task.entry.length)) {
+					if (f.size() < tdpHeaderSize) {
+						qint32 version = AppVersion;
+						f.seek(0);
+						f.write(tdpMagic, tdpMagicLen);
+						f.write((const char*)&version, sizeof(version));
+					}
+					task.result = f.seek(task.entry.offset) && (f.write(encrypted) == encrypted.size()) && f.flush();
+				}
+			} break;
+
+			case StorageTaskReadPack: {
+				QFile f(task.path);
+				if (f.open(QIODevice::ReadOnly) && f.seek(task.entry.offset)) {
+					QByteArray encrypted = f.read(task.entry.length);
+					EncryptedDescriptor result;
+					if (encrypted.size() == int32(task.entry.length) && decryptLocal(result, encrypted, task.key)) {
+						task.data = result.data;
+						task.result = true;
+					}
+				}
+			} break;
+
+			case StorageTaskReadFile: {
+				FileReadDescriptor result;
+				if (readEncryptedFileAt(result, task.base, task.file, UserPath, task.key)) {
+					task.data = result.data;
+					task.result = true;
+				}
+			} break;
+
+			case StorageTaskReadMessages:
+			case StorageTaskReadIndex: {
+				FileReadDescriptor result;
+				if (readEncryptedFileAt(result, task.base, task.file, UserPath | SafePath, task.key)) {
+					task.data = result.data;
+					task.result = true;
+				}
+			} break;
+
+			case StorageTaskRemove: {
+				if (_data->segment.fileName() == task.path && _data->segment.isOpen()) {
+					_data->segment.close();
+				}
+				task.result = QFile::remove(task.path);
+			} break;
+			}
+
+			{
+				QMutexLocker lock(&_data->lock);
+				_data->done.push_back(task);
+			}
+			emit processed();
+		}
+		if (_data->segment.isOpen()) {
+			_data->segment.close();
+		}
+	}
+
+	StorageWorker::~StorageWorker() {
+		delete _data;
+	}
+
+	struct PackCompactorData {
+		PackCompactorData() : type(StoragePackImages), from(0), to(0), written(0), result(false) {
+		}
+		StoragePackType type;
+		quint32 from, to;
+		QString fromPath, toPath;
+		QList<QPair<StorageKey, PackEntry> > entries; // sorted by offset in the source segment
+		QList<quint32> offsets; // new offsets of the entries in the target segment
+		qint64 written;
+		bool result;
+	};
+
+	bool _packEntryOffsetLess(const QPair<StorageKey, PackEntry> &a, const QPair<StorageKey, PackEntry> &b) {
+		return a.second.offset < b.second.offset;
+	}
+
+	PackCompactor::PackCompactor(PackCompactorData *data, QThread *thread) : QObject(0), _data(data) {
+		moveToThread(thread);
+		connect(thread, SIGNAL(started()), this, SLOT(onStart()));
+	}
+
+	PackCompactorData *PackCompactor::data() const {
+		return _data;
+	}
+
+	void PackCompactor::onStart() {
+		PackCompactorData &d(*_data);
+		QFile from(d.fromPath), to(d.toPath);
+		if (from.open(QIODevice::ReadOnly) && to.open(QIODevice::WriteOnly)) {
+			to.write(tdpMagic, tdpMagicLen);
+			qint32 version = AppVersion;
+			to.write((const char*)&version, sizeof(version));
+
+			// records are self-contained encrypted blobs, so they are copied as is
+			d.result = true;
+			for (int32 i = 0, l = d.entries.size(); i < l; ++i) {
+				const PackEntry &entry(d.entries.at(i).second);
+				QByteArray bytes;
+				if (from.seek(entry.offset)) bytes = from.read(entry.length);
+				d.offsets.push_back(quint32(to.pos()));
+				if (bytes.size() != int32(entry.length) || to.write(bytes) != bytes.size()) {
+					d.result = false;
+					break;
+				}
+			}
+			if (d.result) d.result = to.flush();
+			d.written = to.size();
+			to.close();
+			if (!d.result) QFile::remove(d.toPath);
+		}
+		emit compacted();
+	}
+
+	PackCompactor::~PackCompactor() {
+		delete _data;
+	}
+
+	Manager::Manager() : _compactThread(0), _compactor(0), _storageThread(new QThread()), _storageWorker(new StorageWorker(new StorageWorkerData(), _storageThread)) {
 		_mapWriteTimer.setSingleShot(true);
 		connect(&_mapWriteTimer, SIGNAL(timeout()), this, SLOT(mapWriteTimeout()));
 		_locationsWriteTimer.setSingleShot(true);
 		connect(&_locationsWriteTimer, SIGNAL(timeout()), this, SLOT(locationsWriteTimeout()));
+		_downloadsWriteTimer.setSingleShot(true);
+		connect(&_downloadsWriteTimer, SIGNAL(timeout()), this, SLOT(downloadsWriteTimeout()));
+		_searchIndexWriteTimer.setSingleShot(true);
+		connect(&_searchIndexWriteTimer, SIGNAL(timeout()), this, SLOT(searchIndexWriteTimeout()));
+		_historyMessagesWriteTimer.setSingleShot(true);
+		connect(&_historyMessagesWriteTimer, SIGNAL(timeout()), this, SLOT(historyMessagesWriteTimeout()));
+		_packIndexWriteTimer.setSingleShot(true);
+		connect(&_packIndexWriteTimer, SIGNAL(timeout()), this, SLOT(packIndexWriteTimeout()));
+		_packCompactTimer.setSingleShot(true);
+		connect(&_packCompactTimer, SIGNAL(timeout()), this, SLOT(packCompactTimeout()));
+		_evictTimer.setSingleShot(true);
+		connect(&_evictTimer, SIGNAL(timeout()), this, SLOT(evictTimeout()));
+
+		connect(this, SIGNAL(storageNeedsProcessing()), _storageWorker, SLOT(process()));
+		connect(_storageWorker, SIGNAL(processed()), this, SLOT(onStorageProcessed()));
+		_storageThread->start();
 	}
 
 	void Manager::writeMap(bool fast) {
@@ -1703,21 +2884,290 @@ namespace _local_inner {
 		_locationsWriteTimer.stop();
 	}
 
+	void Manager::writeDownloads(bool fast) {
+		if (!_downloadsWriteTimer.isActive() || fast) {
+			_downloadsWriteTimer.start(fast ? 1 : WriteMapTimeout);
+		} else if (_downloadsWriteTimer.remainingTime() <= 0) {
+			downloadsWriteTimeout();
+		}
+	}
+
+	void Manager::writingDownloads() {
+		_downloadsWriteTimer.stop();
+	}
+
+	void Manager::writeSearchIndex(bool fast) {
+		if (!_searchIndexWriteTimer.isActive() || fast) {
+			_searchIndexWriteTimer.start(fast ? 1 : SearchIndexWriteTimeout);
+		} else if (_searchIndexWriteTimer.remainingTime() <= 0) {
+			searchIndexWriteTimeout();
+		}
+	}
+
+	void Manager::writingSearchIndex() {
+		_searchIndexWriteTimer.stop();
+	}
+
+	void Manager::writeHistoryMessages(bool fast) {
+		if (!_historyMessagesWriteTimer.isActive() || fast) {
+			_historyMessagesWriteTimer.start(fast ? 1 : WriteMapTimeout);
+		} else if (_historyMessagesWriteTimer.remainingTime() <= 0) {
+			historyMessagesWriteTimeout();
+		}
+	}
+
+	void Manager::writingHistoryMessages() {
+		_historyMessagesWriteTimer.stop();
+	}
+
+	void Manager::writePackIndex(bool fast) {
+		if (!_packIndexWriteTimer.isActive() || fast) {
+			_packIndexWriteTimer.start(fast ? 1 : WriteMapTimeout);
+		} else if (_packIndexWriteTimer.remainingTime() <= 0) {
+			packIndexWriteTimeout();
+		}
+	}
+
+	void Manager::writingPackIndex() {
+		_packIndexWriteTimer.stop();
+	}
+
+	void Manager::compactPacks() {
+		if (!_compactor) {
+			_packCompactTimer.start(LocalPackCompactTimeout);
+		}
+	}
+
+	void Manager::evictStorage() {
+		if (!_evictTimer.isActive()) {
+			_evictTimer.start(LocalStorageEvictTimeout);
+		}
+	}
+
+	StorageWorkerData *Manager::storageData() const {
+		return _storageWorker ? _storageWorker->data() : 0;
+	}
+
+	void Manager::processStorage() {
+		emit storageNeedsProcessing();
+	}
+
+	void Manager::onStorageProcessed() {
+		StorageWorkerData *data = storageData();
+		if (!data) return;
+
+		StorageTasks done;
+		{
+			QMutexLocker lock(&data->lock);
+			qSwap(done, data->done);
+		}
+		for (StorageTasks::iterator i = done.begin(), e = done.end(); i != e; ++i) {
+			_storageProcessed(*i);
+		}
+	}
+
+	void Manager::evictTimeout() {
+		if (_userWorking() && _storageEvict()) {
+			_evictTimer.start(0); // next batch after processing the pending events
+		}
+	}
+
 	void Manager::mapWriteTimeout() {
 		_writeMap(WriteMapNow);
 	}
 
-	void Manager::locationsWriteTimeout() {
-		_writeLocations(WriteMapNow);
-	}
+	void Manager::locationsWriteTimeout() {
+		_writeLocations(WriteMapNow);
+	}
+
+	void Manager::downloadsWriteTimeout() {
+		_writeDownloads(WriteMapNow);
+	}
+
+	void Manager::searchIndexWriteTimeout() {
+		_writeSearchIndex(WriteMapNow);
+	}
+
+	void Manager::historyMessagesWriteTimeout() {
+		Local::_writeHistoryMessages(WriteMapNow);
+	}
+
+	void Manager::packIndexWriteTimeout() {
+		_writePackIndex(WriteMapNow);
+	}
+
+	void Manager::packCompactTimeout() {
+		if (_compactor || !_userWorking()) return;
+
+		PackCompactorData *data = 0;
+		for (int32 i = 0; i < StoragePackTypeCount && !data; ++i) {
+			StoragePackType type = StoragePackType(i);
+			StoragePack &pack(_packs[i]);
+
+			QList<quint32> empty;
+			for (PackSegmentSizes::const_iterator j = pack.written.cbegin(), e = pack.written.cend(); j != e; ++j) {
+				if (j.key() == pack.current || pack.writing.contains(j.key())) continue;
+
+				qint64 size = j.value() - tdpHeaderSize, wasted = pack.wasted.value(j.key(), 0);
+				if (wasted >= size) {
+					empty.push_back(j.key());
+				} else if (!data && wasted * 100 >= size * LocalPackCompactWastePercent) {
+					data = new PackCompactorData();
+					data->type = type;
+					data->from = j.key();
+				}
+			}
+			for (QList<quint32>::const_iterator j = empty.cbegin(), e = empty.cend(); j != e; ++j) {
+				StorageTask task;
+				task.path = _packSegmentPath(type, *j);
+				_storageQueue(task);
+				pack.written.remove(*j);
+				pack.wasted.remove(*j);
+			}
+			if (data) {
+				for (PackIndex::const_iterator j = pack.index.cbegin(), e = pack.index.cend(); j != e; ++j) {
+					if (j.value().segment == data->from) {
+						data->entries.push_back(qMakePair(j.key(), j.value()));
+					}
+				}
+				qSort(data->entries.begin(), data->entries.end(), _packEntryOffsetLess);
+				data->to = ++pack.last;
+				data->fromPath = _packSegmentPath(type, data->from);
+				data->toPath = _packSegmentPath(type, data->to);
+			}
+		}
+		if (!data) return;
+
+		_compactThread = new QThread();
+		_compactor = new PackCompactor(data, _compactThread);
+		connect(_compactor, SIGNAL(compacted()), this, SLOT(onPackCompacted()));
+		_compactThread->start();
+	}
+
+	void Manager::onPackCompacted() {
+		if (!_compactor) return;
+
+		stopCompactor(); // compactor data is not touched by the thread anymore
+		PackCompactorData *data = _compactor->data();
+		StoragePack &pack(_packs[data->type]);
+		if (data->result && pack.written.contains(data->from)) {
+			qint64 wasted = 0;
+			for (int32 i = 0, l = data->entries.size(); i < l; ++i) {
+				const QPair<StorageKey, PackEntry> &moved(data->entries.at(i));
+				PackIndex::iterator j = pack.index.find(moved.first);
+				if (j != pack.index.end() && j.value() == moved.second) {
+					j.value().segment = data->to;
+					j.value().offset = data->offsets.at(i);
+				} else {
+					wasted += moved.second.length; // was overwritten or removed while compacting
+				}
+			}
+			pack.written.insert(data->to, data->written);
+			pack.wasted.insert(data->to, wasted);
+			pack.written.remove(data->from);
+			pack.wasted.remove(data->from);
+
+			// the index must point to the new segment before the old one is gone,
+			// the removing is queued after the reads that still use the old segment
+			_writePackIndex(WriteMapNow);
+			StorageTask task;
+			task.path = data->fromPath;
+			_storageQueue(task);
+		} else if (data->result) {
+			QFile::remove(data->toPath);
+		}
+		bool more = data->result;
+
+		delete _compactor;
+		_compactor = 0;
+
+		if (more) compactPacks();
+	}
+
+	void Manager::stopCompactor() {
+		if (!_compactThread) return;
+
+		_compactThread->quit();
+		_compactThread->wait();
+		delete _compactThread;
+		_compactThread = 0;
+	}
+
+	void Manager::stopStorage() {
+		if (!_storageThread) return;
+
+		for (int32 i = 0; i < StoragePackTypeCount; ++i) {
+			_packs[i].reading.clear(); // no loaders are notified while quitting
+		}
+		_storageThread->quit();
+		_storageThread->wait();
+
+		// the thread could quit before processing everything, do the rest here
+		_storageWorker->process();
+		onStorageProcessed();
+
+		delete _storageWorker;
+		_storageWorker = 0;
+		delete _storageThread;
+		_storageThread = 0;
+	}
+
+	void Manager::finish() {
+		if (_compactor) {
+			onPackCompacted();
+		}
+		stopStorage();
+		if (_packIndexWriteTimer.isActive()) {
+			packIndexWriteTimeout();
+		}
+		if (_locationsWriteTimer.isActive()) {
+			locationsWriteTimeout();
+		}
+		if (_downloadsWriteTimer.isActive()) {
+			downloadsWriteTimeout();
+		}
+		if (_searchIndexWriteTimer.isActive()) {
+			searchIndexWriteTimeout();
+		}
+		if (_historyMessagesWriteTimer.isActive()) {
+			historyMessagesWriteTimeout();
+		}
+		if (_mapWriteTimer.isActive()) {
+			mapWriteTimeout();
+		}
+	}
+
+}
+
+namespace {
+
+	void _storageQueue(StorageTask &task) {
+		_local_inner::StorageWorkerData *data = _manager ? _manager->storageData() : 0;
+		if (!data) return;
+
+		task.key = _localKey; // the storage thread does not read the globals, they change in Local::reset()
+		task.base = _userBasePath;
+		{
+			QMutexLocker lock(&data->lock);
+			data->queue.push_back(task);
+		}
+		_manager->processStorage();
+	}
+
+	bool _readSearchIndex() { // starts reading the chunks in the storage thread, returns true if all of them are read
+		bool result = true;
+		for (SearchIndexChunks::const_iterator i = _searchIndexChunks.cbegin(), e = _searchIndexChunks.cend(); i != e; ++i) {
+			if (i->read) continue;
 
-	void Manager::finish() {
-		if (_mapWriteTimer.isActive()) {
-			mapWriteTimeout();
-		}
-		if (_locationsWriteTimer.isActive()) {
-			locationsWriteTimeout();
+			result = false;
+			if (_searchIndexChunksReading.contains(i->key)) continue;
+
+			_searchIndexChunksReading.insert(i->key);
+			StorageTask task(StorageTaskReadIndex);
+			task.file = i->key;
+			_storageQueue(task);
 		}
+		return result;
 	}
 
 }
@@ -1908,11 +3358,16 @@ namespace Local {
 		_passKeySalt.clear(); // reset passcode, local key
 		_draftsMap.clear();
 		_draftsPositionsMap.clear();
+		_historyMessagesMap.clear();
 		_imagesMap.clear();
 		_draftsNotReadMap.clear();
 		_stickerImagesMap.clear();
 		_audiosMap.clear();
-		_locationsKey = _recentStickersKeyOld = _stickersKey = _backgroundKey = _userSettingsKey = _recentHashtagsKey = _savedPeersKey = 0;
+		_packClear();
+		_storageImagesSize = _storageStickersSize = _storageAudiosSize = 0;
+		_downloadStates.clear();
+		_searchIndexClear();
+		_locationsKey = _recentStickersKeyOld = _stickersKey = _backgroundKey = _userSettingsKey = _recentHashtagsKey = _savedPeersKey = _downloadsKey = 0;
 		_mapChanged = true;
 		_writeMap(WriteMapNow);
 
@@ -2105,33 +3560,34 @@ namespace Local {
 		return FileLocation();
 	}
 
-	qint32 _storageImageSize(qint32 rawlen) {
-		// fulllen + storagekey + type + len + data
-		qint32 result = sizeof(uint32) + sizeof(quint64) * 2 + sizeof(quint32) + sizeof(quint32) + rawlen;
-		if (result & 0x0F) result += 0x10 - (result & 0x0F);
-		result += tdfMagicLen + sizeof(qint32) + sizeof(quint32) + 0x10 + 0x10; // magic + version + len of encrypted + part of sha1 + md5
-		return result;
+	void writeDownloadState(const MediaKey &location, const FileDownloadState &state) {
+		if (state.name.isEmpty()) return;
+
+		_downloadStates.insert(location, state);
+		_writeDownloads();
 	}
 
-	qint32 _storageStickerSize(qint32 rawlen) {
-		// fulllen + storagekey + len + data
-		qint32 result = sizeof(uint32) + sizeof(quint64) * 2 + sizeof(quint32) + rawlen;
-		if (result & 0x0F) result += 0x10 - (result & 0x0F);
-		result += tdfMagicLen + sizeof(qint32) + sizeof(quint32) + 0x10 + 0x10; // magic + version + len of encrypted + part of sha1 + md5
-		return result;
+	FileDownloadState readDownloadState(const MediaKey &location) {
+		FileDownloadStates::iterator i = _downloadStates.find(location);
+		if (i == _downloadStates.end()) return FileDownloadState();
+
+		if (!i.value().check()) {
+			_downloadStates.erase(i);
+			_writeDownloads();
+			return FileDownloadState();
+		}
+		return i.value();
 	}
 
-	qint32 _storageAudioSize(qint32 rawlen) {
-		// fulllen + storagekey + len + data
-		qint32 result = sizeof(uint32) + sizeof(quint64) * 2 + sizeof(quint32) + rawlen;
-		if (result & 0x0F) result += 0x10 - (result & 0x0F);
-		result += tdfMagicLen + sizeof(qint32) + sizeof(quint32) + 0x10 + 0x10; // magic + version + len of encrypted + part of sha1 + md5
-		return result;
+	void removeDownloadState(const MediaKey &location) {
+		if (_downloadStates.remove(location)) {
+			_writeDownloads(WriteMapFast);
+		}
 	}
 
 	void writeImage(const StorageKey &location, const ImagePtr &image) {
 		if (image->isNull() || !image->loaded()) return;
-		if (_imagesMap.constFind(location) != _imagesMap.cend()) return;
+		if (_storageHas(StoragePackImages, location)) return;
 
 		QByteArray fmt = image->savedFormat();
 		StorageFileType format = StorageFileUnknown;
@@ -2150,51 +3606,19 @@ namespace Local {
 
 	void writeImage(const StorageKey &location, const StorageImageSaved &image, bool overwrite) {
 		if (!_working()) return;
+		if (!overwrite && _storageHas(StoragePackImages, location)) return;
 
-		qint32 size = _storageImageSize(image.data.size());
-		StorageMap::const_iterator i = _imagesMap.constFind(location);
-		if (i == _imagesMap.cend()) {
-			i = _imagesMap.insert(location, FileDesc(genKey(UserPath), size));
-			_storageImagesSize += size;
-			_mapChanged = true;
-			_writeMap();
-		} else if (!overwrite) {
-			return;
-		}
 		EncryptedDescriptor data(sizeof(quint64) * 2 + sizeof(quint32) + sizeof(quint32) + image.data.size());
 		data.stream << quint64(location.first) << quint64(location.second) << quint32(image.type) << image.data;
-		FileWriteDescriptor file(i.value().first, UserPath);
-		file.writeEncrypted(data);
-		if (i.value().second != size) {
-			_storageImagesSize += size;
-			_storageImagesSize -= i.value().second;
-			_imagesMap[location].second = size;
-		}
+		_storageWrite(StoragePackImages, location, data);
 	}
 
-	StorageImageSaved readImage(const StorageKey &location) {
-		StorageMap::iterator j = _imagesMap.find(location);
-		if (j == _imagesMap.cend()) {
-			return StorageImageSaved();
-		}
-		FileReadDescriptor draft;
-		if (!readEncryptedFile(draft, j.value().first, UserPath)) {
-			clearKey(j.value().first, UserPath);
-			_storageImagesSize -= j.value().second;
-			_imagesMap.erase(j);
-			return StorageImageSaved();
-		}
-
-		QByteArray imageData;
-		quint64 locFirst, locSecond;
-		quint32 imageType;
-		draft.stream >> locFirst >> locSecond >> imageType >> imageData;
-
-		return (locFirst == location.first && locSecond == location.second) ? StorageImageSaved(StorageFileType(imageType), imageData) : StorageImageSaved();
+	TaskId startImageLoad(const StorageKey &location, mtpFileLoader *loader) {
+		return _storageStartRead(StoragePackImages, location, loader);
 	}
 
 	int32 hasImages() {
-		return _imagesMap.size();
+		return _storageCount(StoragePackImages);
 	}
 
 	qint64 storageImagesSize() {
@@ -2203,50 +3627,19 @@ namespace Local {
 
 	void writeStickerImage(const StorageKey &location, const QByteArray &sticker, bool overwrite) {
 		if (!_working()) return;
+		if (!overwrite && _storageHas(StoragePackStickers, location)) return;
 
-		qint32 size = _storageStickerSize(sticker.size());
-		StorageMap::const_iterator i = _stickerImagesMap.constFind(location);
-		if (i == _stickerImagesMap.cend()) {
-			i = _stickerImagesMap.insert(location, FileDesc(genKey(UserPath), size));
-			_storageStickersSize += size;
-			_mapChanged = true;
-			_writeMap();
-		} else if (!overwrite) {
-			return;
-		}
 		EncryptedDescriptor data(sizeof(quint64) * 2 + sizeof(quint32) + sizeof(quint32) + sticker.size());
 		data.stream << quint64(location.first) << quint64(location.second) << sticker;
-		FileWriteDescriptor file(i.value().first, UserPath);
-		file.writeEncrypted(data);
-		if (i.value().second != size) {
-			_storageStickersSize += size;
-			_storageStickersSize -= i.value().second;
-			_stickerImagesMap[location].second = size;
-		}
+		_storageWrite(StoragePackStickers, location, data);
 	}
 
-	QByteArray readStickerImage(const StorageKey &location) {
-		StorageMap::iterator j = _stickerImagesMap.find(location);
-		if (j == _stickerImagesMap.cend()) {
-			return QByteArray();
-		}
-		FileReadDescriptor draft;
-		if (!readEncryptedFile(draft, j.value().first, UserPath)) {
-			clearKey(j.value().first, UserPath);
-			_storageStickersSize -= j.value().second;
-			_stickerImagesMap.erase(j);
-			return QByteArray();
-		}
-
-		QByteArray stickerData;
-		quint64 locFirst, locSecond;
-		draft.stream >> locFirst >> locSecond >> stickerData;
-
-		return (locFirst == location.first && locSecond == location.second) ? stickerData : QByteArray();
+	TaskId startStickerImageLoad(const StorageKey &location, mtpFileLoader *loader) {
+		return _storageStartRead(StoragePackStickers, location, loader);
 	}
 
 	int32 hasStickers() {
-		return _stickerImagesMap.size();
+		return _storageCount(StoragePackStickers);
 	}
 
 	qint64 storageStickersSize() {
@@ -2255,56 +3648,29 @@ namespace Local {
 
 	void writeAudio(const StorageKey &location, const QByteArray &audio, bool overwrite) {
 		if (!_working()) return;
+		if (!overwrite && _storageHas(StoragePackAudios, location)) return;
 
-		qint32 size = _storageAudioSize(audio.size());
-		StorageMap::const_iterator i = _audiosMap.constFind(location);
-		if (i == _audiosMap.cend()) {
-			i = _audiosMap.insert(location, FileDesc(genKey(UserPath), size));
-			_storageAudiosSize += size;
-			_mapChanged = true;
-			_writeMap();
-		} else if (!overwrite) {
-			return;
-		}
 		EncryptedDescriptor data(sizeof(quint64) * 2 + sizeof(quint32) + sizeof(quint32) + audio.size());
 		data.stream << quint64(location.first) << quint64(location.second) << audio;
-		FileWriteDescriptor file(i.value().first, UserPath);
-		file.writeEncrypted(data);
-		if (i.value().second != size) {
-			_storageAudiosSize += size;
-			_storageAudiosSize -= i.value().second;
-			_audiosMap[location].second = size;
-		}
+		_storageWrite(StoragePackAudios, location, data);
 	}
 
-	QByteArray readAudio(const StorageKey &location) {
-		StorageMap::iterator j = _audiosMap.find(location);
-		if (j == _audiosMap.cend()) {
-			return QByteArray();
-		}
-		FileReadDescriptor draft;
-		if (!readEncryptedFile(draft, j.value().first, UserPath)) {
-			clearKey(j.value().first, UserPath);
-			_storageAudiosSize -= j.value().second;
-			_audiosMap.erase(j);
-			return QByteArray();
-		}
-
-		QByteArray audioData;
-		quint64 locFirst, locSecond;
-		draft.stream >> locFirst >> locSecond >> audioData;
-
-		return (locFirst == location.first && locSecond == location.second) ? audioData : QByteArray();
+	TaskId startAudioLoad(const StorageKey &location, mtpFileLoader *loader) {
+		return _storageStartRead(StoragePackAudios, location, loader);
 	}
 
 	int32 hasAudios() {
-		return _audiosMap.size();
+		return _storageCount(StoragePackAudios);
 	}
 
 	qint64 storageAudiosSize() {
 		return _storageAudiosSize;
 	}
 
+	void cancelTask(TaskId id) {
+		_storageCancel(id);
+	}
+
 	void _writeStorageImageLocation(QDataStream &stream, const StorageImageLocation &loc) {
 		stream << qint32(loc.width) << qint32(loc.height);
 		stream << qint32(loc.dc) << quint64(loc.volume) << qint32(loc.local) << quint64(loc.secret);
@@ -2761,7 +4127,7 @@ namespace Local {
 		}
 	}
 
-	PeerData *_readPeer(FileReadDescriptor &from) {
+	PeerData *_readPeer(FileReadDescriptor &from, bool loadedToo = true) { // if !loadedToo the data is read but not applied to already loaded peers
 		PeerData *result = 0;
 		quint64 peerId = 0, photoId = 0;
 		from.stream >> peerId >> photoId;
@@ -2769,6 +4135,7 @@ namespace Local {
 		StorageImageLocation photoLoc(_readStorageImageLocation(from));
 
 		result = App::peer(peerId);
+		bool apply = loadedToo || !result->loaded;
 		result->loaded = true;
 		if (result->chat) {
 			ChatData *chat = result->asChat();
@@ -2776,6 +4143,7 @@ namespace Local {
 			QString name, invitationUrl;
 			qint32 count, date, version, admin, forbidden, left;
 			from.stream >> name >> count >> date >> version >> admin >> forbidden >> left >> invitationUrl;
+			if (!apply) return result;
 
 			chat->updateName(name, QString(), QString());
 			chat->count = count;
@@ -2796,6 +4164,7 @@ namespace Local {
 			quint64 access;
 			qint32 onlineTill, contact, botInfoVersion;
 			from.stream >> first >> last >> phone >> username >> access >> onlineTill >> contact >> botInfoVersion;
+			if (!apply) return result;
 
 			bool showPhone = !isServiceUser(user->id) && (App::userFromPeer(user->id) != MTP::authedId()) && (contact <= 0);
 			QString pname = (showPhone && !phone.isEmpty()) ? App::formatPhone(phone) : QString();
@@ -2825,6 +4194,527 @@ namespace Local {
 		return result;
 	}
 
+	void _historyMessagesPeers(const QVector<MTPMessage> &messages, QList<PeerData*> &result) {
+		QSet<PeerData*> added;
+		for (QVector<MTPMessage>::const_iterator i = messages.cbegin(), e = messages.cend(); i != e; ++i) {
+			PeerData *peers[3] = { 0, 0, 0 };
+			switch (i->type()) {
+			case mtpc_message: {
+				const MTPDmessage &d(i->c_message());
+				peers[0] = App::peerLoaded(App::peerFromUser(d.vfrom_id));
+				peers[1] = App::peerLoaded(App::peerFromMTP(d.vto_id));
+				if (d.has_fwd_from_id()) peers[2] = App::peerLoaded(App::peerFromUser(d.vfwd_from_id));
+			} break;
+			case mtpc_messageService: {
+				const MTPDmessageService &d(i->c_messageService());
+				peers[0] = App::peerLoaded(App::peerFromUser(d.vfrom_id));
+				peers[1] = App::peerLoaded(App::peerFromMTP(d.vto_id));
+			} break;
+			}
+			for (int32 j = 0; j < 3; ++j) {
+				if (peers[j] && !added.contains(peers[j])) {
+					added.insert(peers[j]);
+					result.push_back(peers[j]);
+				}
+			}
+		}
+	}
+
+	// page: peer id + serialized vector of messages from older to newer + peers of the messages
+	void _writeHistoryMessagesPage(const FileKey &key, const PeerId &peer, const QVector<MTPMessage> &messages) {
+		mtpBuffer buffer;
+		MTP_vector<MTPMessage>(messages).write(buffer);
+		QByteArray serialized(reinterpret_cast<const char*>(buffer.constData()), buffer.size() * sizeof(mtpPrime));
+
+		QList<PeerData*> peers;
+		_historyMessagesPeers(messages, peers);
+
+		quint32 size = sizeof(quint64) + sizeof(quint32) + serialized.size() + sizeof(quint32);
+		for (QList<PeerData*>::const_iterator i = peers.cbegin(), e = peers.cend(); i != e; ++i) {
+			size += _peerSize(*i);
+		}
+
+		EncryptedDescriptor data(size);
+		data.stream << quint64(peer) << serialized << quint32(peers.size());
+		for (QList<PeerData*>::const_iterator i = peers.cbegin(), e = peers.cend(); i != e; ++i) {
+			_writePeer(data.stream, *i);
+		}
+
+		FileWriteDescriptor file(key);
+		file.writeEncrypted(data);
+	}
+
+	bool _readHistoryMessagesPage(FileReadDescriptor &page, const PeerId &peer, QVector<MTPMessage> &result) {
+		quint64 pagePeer = 0;
+		QByteArray serialized;
+		quint32 peersCount = 0;
+		page.stream >> pagePeer >> serialized >> peersCount;
+		if (!_checkStreamStatus(page.stream) || pagePeer != peer || (serialized.size() % sizeof(mtpPrime))) return false;
+
+		for (quint32 i = 0; i < peersCount; ++i) {
+			_readPeer(page, false);
+			if (!_checkStreamStatus(page.stream)) return false;
+		}
+
+		const mtpPrime *from = reinterpret_cast<const mtpPrime*>(serialized.constData()), *end = from + serialized.size() / sizeof(mtpPrime);
+		MTPVector<MTPMessage> messages;
+		try {
+			messages.read(from, end);
+		} catch (Exception &e) {
+			LOG(("App Error: could not read saved messages page, error: %1").arg(e.what()));
+			return false;
+		}
+		result = messages.c_vector().v;
+		return true;
+	}
+
+	bool _readHistoryMessagesPage(const FileKey &key, const PeerId &peer, QVector<MTPMessage> &result) {
+		FileReadDescriptor page;
+		return readEncryptedFile(page, key) && _readHistoryMessagesPage(page, peer, result);
+	}
+
+	void _clearHistoryMessages(HistoryMessages &messages) {
+		for (HistoryMessagesPages::const_iterator i = messages.pages.cbegin(), e = messages.pages.cend(); i != e; ++i) {
+			clearKey(i->key);
+		}
+		messages.pages.clear();
+		messages.pending.clear();
+		messages.maxId = 0;
+		messages.atBottom = false;
+	}
+
+	void _writeHistoryMessages(const PeerId &peer, HistoryMessages &messages) {
+		if (messages.pending.isEmpty() || !_working()) return;
+
+		QVector<MTPMessage> last;
+		if (!messages.pages.isEmpty() && messages.pages.back().count < MessagesPerPage) {
+			if (!_readHistoryMessagesPage(messages.pages.back().key, peer, last)) {
+				_clearHistoryMessages(messages);
+				_mapChanged = true;
+				_writeMap();
+				return;
+			}
+		}
+		for (int32 i = 0, l = messages.pending.size(); i < l;) {
+			if (messages.pages.isEmpty() || messages.pages.back().count >= MessagesPerPage) {
+				messages.pages.push_back(HistoryMessagesPage(genKey(), App::idFromMessage(messages.pending.at(i)), 0));
+				last.clear();
+			}
+			int32 add = qMin(MessagesPerPage - messages.pages.back().count, l - i);
+			last += messages.pending.mid(i, add);
+			messages.pages.back().count += add;
+			i += add;
+
+			_writeHistoryMessagesPage(messages.pages.back().key, peer, last);
+		}
+		messages.maxId = App::idFromMessage(messages.pending.back());
+		messages.pending.clear();
+
+		while (messages.pages.size() > LocalMessagesPagesMax) {
+			clearKey(messages.pages.front().key);
+			messages.pages.pop_front();
+		}
+		_mapChanged = true;
+		_writeMap();
+	}
+
+	void _writeHistoryMessages(WriteMapWhen when) {
+		if (when != WriteMapNow) {
+			_manager->writeHistoryMessages(when == WriteMapFast);
+			return;
+		}
+		if (!_working()) return;
+
+		_manager->writingHistoryMessages();
+		for (HistoryMessagesMap::iterator i = _historyMessagesMap.begin(), e = _historyMessagesMap.end(); i != e; ++i) {
+			_writeHistoryMessages(i.key(), i.value());
+		}
+	}
+
+	void writeHistoryMessages(const PeerId &peer, const QVector<MTPMessage> &slice) {
+		if (!_working()) return;
+
+		HistoryMessages &messages(_historyMessagesMap[peer]);
+		_clearHistoryMessages(messages);
+		_searchIndexUnavailable.clear(); // found messages could be saved now
+		messages.atBottom = true;
+		messages.pending.reserve(slice.size());
+		for (int32 i = slice.size(); i > 0;) {
+			const MTPMessage &msg(slice.at(--i));
+			MsgId id = App::idFromMessage(msg);
+			if (id > 0 && (messages.pending.isEmpty() || id > App::idFromMessage(messages.pending.back()))) {
+				messages.pending.push_back(msg);
+			}
+		}
+		if (messages.pending.isEmpty()) {
+			_historyMessagesMap.remove(peer);
+		}
+		_mapChanged = true;
+		_writeMap();
+		_writeHistoryMessages(WriteMapFast);
+	}
+
+	void prependHistoryMessages(const PeerId &peer, const QVector<MTPMessage> &slice, MsgId before) {
+		if (!_working() || slice.isEmpty()) return;
+
+		HistoryMessagesMap::iterator i = _historyMessagesMap.find(peer);
+		if (i == _historyMessagesMap.cend() || i->pages.isEmpty() || i->pages.front().minId != before) return;
+
+		// slice is newer first, so the newest of the older messages are saved if there is no place for all of them
+		int32 from = 0, till = slice.size();
+		while (from < till && i->pages.size() < LocalMessagesPagesMax) {
+			int32 count = qMin(int32(MessagesPerPage), till - from);
+			QVector<MTPMessage> page;
+			page.reserve(count);
+			for (int32 j = from + count; j > from;) {
+				const MTPMessage &msg(slice.at(--j));
+				MsgId id = App::idFromMessage(msg);
+				if (id > 0 && id < i->pages.front().minId && (page.isEmpty() || id > App::idFromMessage(page.back()))) {
+					page.push_back(msg);
+				}
+			}
+			from += count;
+			if (page.isEmpty()) continue;
+
+			HistoryMessagesPage saved(genKey(), App::idFromMessage(page.front()), page.size());
+			_writeHistoryMessagesPage(saved.key, peer, page);
+			i->pages.push_front(saved);
+			_mapChanged = true;
+			_searchIndexUnavailable.clear(); // found messages could be saved now
+		}
+		_writeMap();
+	}
+
+	void addHistoryMessage(const PeerId &peer, const MTPMessage &msg) {
+		HistoryMessagesMap::iterator i = _historyMessagesMap.find(peer);
+		if (i == _historyMessagesMap.cend() || !i->atBottom) return;
+
+		MsgId id = App::idFromMessage(msg), maxId = i->pending.isEmpty() ? i->maxId : App::idFromMessage(i->pending.back());
+		if (id <= maxId) return;
+
+		i->pending.push_back(msg);
+		_writeHistoryMessages(WriteMapSoon);
+	}
+
+	void markHistoryMessagesGap(const PeerId &peer) {
+		HistoryMessagesMap::iterator i = _historyMessagesMap.find(peer);
+		if (i == _historyMessagesMap.cend() || !i->atBottom) return;
+
+		_writeHistoryMessages(peer, i.value());
+		i->atBottom = false;
+		_mapChanged = true;
+		_writeMap();
+	}
+
+	bool readHistoryMessages(const PeerId &peer, MsgId before, int32 count, QVector<MTPMessage> &result) {
+		result.clear();
+
+		HistoryMessagesMap::iterator i = _historyMessagesMap.find(peer);
+		if (i == _historyMessagesMap.cend()) return false;
+
+		_writeHistoryMessages(peer, i.value());
+		if (i->pages.isEmpty() || (before && (before <= i->pages.front().minId || before > i->maxId))) return false;
+
+		for (int32 p = i->pages.size(); p > 0 && result.size() < count;) {
+			const HistoryMessagesPage &page(i->pages.at(--p));
+			if (before && page.minId >= before) continue;
+
+			QVector<MTPMessage> messages;
+			if (!_readHistoryMessagesPage(page.key, peer, messages)) {
+				clearHistoryMessages(peer);
+				result.clear();
+				return false;
+			}
+			for (int32 j = messages.size(); j > 0 && result.size() < count;) {
+				const MTPMessage &msg(messages.at(--j));
+				if (!before || App::idFromMessage(msg) < before) {
+					result.push_back(msg);
+				}
+			}
+		}
+		return !result.isEmpty();
+	}
+
+	void removeHistoryMessages(const QVector<MTPint> &ids) {
+		if (_historyMessagesMap.isEmpty()) return;
+
+		// message ids are not unique for a chat, so all the chats with a removed message id in the saved range are cleared
+		QList<PeerId> peers;
+		for (HistoryMessagesMap::const_iterator i = _historyMessagesMap.cbegin(), e = _historyMessagesMap.cend(); i != e; ++i) {
+			if (i->pages.isEmpty() && i->pending.isEmpty()) continue;
+
+			MsgId minId = i->pages.isEmpty() ? App::idFromMessage(i->pending.front()) : i->pages.front().minId;
+			MsgId maxId = i->pending.isEmpty() ? i->maxId : App::idFromMessage(i->pending.back());
+			for (QVector<MTPint>::const_iterator j = ids.cbegin(), en = ids.cend(); j != en; ++j) {
+				if (j->v >= minId && j->v <= maxId) {
+					peers.push_back(i.key());
+					break;
+				}
+			}
+		}
+		for (QList<PeerId>::const_iterator i = peers.cbegin(), e = peers.cend(); i != e; ++i) {
+			clearHistoryMessages(*i);
+		}
+	}
+
+	void clearHistoryMessages(const PeerId &peer) {
+		HistoryMessagesMap::iterator i = _historyMessagesMap.find(peer);
+		if (i == _historyMessagesMap.cend()) return;
+
+		_clearHistoryMessages(i.value());
+		_historyMessagesMap.erase(i);
+		_mapChanged = true;
+		_writeMap();
+	}
+
+	void indexMessage(const PeerId &peer, const MTPmessage &msg) {
+		if (msg.type() != mtpc_message || !_working()) return;
+
+		const MTPDmessage &m(msg.c_message());
+		QString text = qs(m.vmessage);
+		switch (m.vmedia.type()) {
+		case mtpc_messageMediaPhoto: text += ' ' + qs(m.vmedia.c_messageMediaPhoto().vcaption); break;
+		case mtpc_messageMediaVideo: text += ' ' + qs(m.vmedia.c_messageMediaVideo().vcaption); break;
+		}
+		QStringList words = textSearchKey(text).split(cWordSplit(), QString::SkipEmptyParts);
+		if (words.isEmpty()) return;
+		words.removeDuplicates();
+
+		// the chunk files are not read here, a newer message overrides the one read later
+		MsgId msgId = m.vid.v;
+		SearchIndexMessages::iterator i = _searchIndexMessages.find(msgId);
+		bool added = (i == _searchIndexMessages.end());
+		if (!added) {
+			if (i->peer == peer && i->words == words) return;
+			_searchIndexErase(i);
+		}
+		_searchIndexInsert(msgId, peer, words);
+
+		if (_searchIndexChunks.isEmpty()) {
+			_searchIndexChunks.push_back(SearchIndexChunk(0, msgId));
+		} else if (msgId < _searchIndexChunks.front().minId) {
+			_searchIndexChunks.front().minId = msgId;
+		}
+		SearchIndexChunk &chunk(_searchIndexChunks[_searchIndexChunkIndex(msgId)]);
+		if (added) ++chunk.count;
+		chunk.changed = true;
+		_writeSearchIndex();
+	}
+
+	void unindexMessage(MsgId msgId) {
+		if (!_working() || _searchIndexChunks.isEmpty()) return;
+
+		SearchIndexChunk &chunk(_searchIndexChunks[_searchIndexChunkIndex(msgId)]);
+		SearchIndexMessages::iterator i = _searchIndexMessages.find(msgId);
+		if (i != _searchIndexMessages.end()) {
+			_searchIndexErase(i);
+			--chunk.count;
+		} else if (chunk.read) {
+			return;
+		} else {
+			_searchIndexRemoved.insert(msgId);
+		}
+		chunk.changed = true;
+		_writeSearchIndex();
+	}
+
+	void unindexHistory(const PeerId &peer) {
+		if (!_working()) return;
+
+		bool changed = false;
+		for (int32 index = 0, l = _searchIndexChunks.size(); index < l; ++index) {
+			SearchIndexChunk &chunk(_searchIndexChunks[index]);
+			for (SearchIndexMessages::iterator i = _searchIndexMessages.lowerBound(chunk.minId), e = _searchIndexChunkEnd(index); i != e;) {
+				if (i->peer == peer) {
+					SearchIndexMessages::iterator j = i;
+					++j;
+					_searchIndexErase(i);
+					i = j;
+					--chunk.count;
+					chunk.changed = changed = true;
+				} else {
+					++i;
+				}
+			}
+			if (!chunk.read) {
+				_searchIndexRemovedPeers.insert(peer);
+				chunk.changed = changed = true;
+			}
+		}
+		if (changed) {
+			_writeSearchIndex(WriteMapFast);
+		}
+	}
+
+	void searchIndexed(const QString &query, const PeerId &inPeer, int32 limit, QVector<MsgId> &result) {
+		result.clear();
+
+		QStringList words = textSearchKey(query).split(cWordSplit(), QString::SkipEmptyParts);
+		if (words.isEmpty() || !_working()) return;
+
+		if (!_readSearchIndex()) { // the query is answered when the index is read, see _searchIndexChunkRead()
+			_searchIndexSearched = true;
+			return;
+		}
+
+		QSet<MsgId> found;
+		for (int32 i = 0, l = words.size(); i < l; ++i) {
+			QSet<MsgId> byWord; // messages with a word starting with the query word
+			for (SearchIndexWords::const_iterator j = _searchIndexWords.lowerBound(words.at(i)), e = _searchIndexWords.cend(); j != e && j.key().startsWith(words.at(i)); ++j) {
+				byWord.unite(j.value());
+			}
+			if (i) {
+				found.intersect(byWord);
+			} else {
+				found = byWord;
+			}
+			if (found.isEmpty()) return;
+		}
+
+		QList<MsgId> ids = found.toList();
+		qSort(ids.begin(), ids.end(), qGreater<MsgId>());
+		for (QList<MsgId>::const_iterator i = ids.cbegin(), e = ids.cend(); i != e && result.size() < limit; ++i) {
+			if (!inPeer || _searchIndexMessages.value(*i).peer == inPeer) {
+				result.push_back(*i);
+			}
+		}
+	}
+
+	void loadIndexedMessages(const QVector<MsgId> &ids) {
+		_searchIndexWanted.clear();
+		for (QVector<MsgId>::const_iterator i = ids.cbegin(), e = ids.cend(); i != e; ++i) {
+			_searchIndexWanted.insert(*i);
+		}
+		for (SearchIndexLoaded::iterator i = _searchIndexLoaded.begin(); i != _searchIndexLoaded.end();) {
+			if (_searchIndexWanted.contains(i.key())) {
+				++i;
+			} else {
+				i = _searchIndexLoaded.erase(i);
+			}
+		}
+		if (!_working()) return;
+
+		for (QVector<MsgId>::const_iterator i = ids.cbegin(), e = ids.cend(); i != e; ++i) {
+			if (_searchIndexLoaded.contains(*i) || _searchIndexUnavailable.contains(*i)) continue;
+
+			SearchIndexMessages::const_iterator j = _searchIndexMessages.constFind(*i);
+			if (j == _searchIndexMessages.cend()) continue;
+
+			HistoryMessagesMap::const_iterator k = _historyMessagesMap.constFind(j->peer);
+			if (k == _historyMessagesMap.cend()) {
+				_searchIndexUnavailable.insert(*i);
+				continue;
+			}
+			if (!k->pending.isEmpty() && *i >= App::idFromMessage(k->pending.front())) { // not written yet
+				for (QVector<MTPMessage>::const_iterator m = k->pending.cbegin(), en = k->pending.cend(); m != en; ++m) {
+					if (App::idFromMessage(*m) == *i) {
+						_searchIndexLoaded.insert(*i, *m);
+						break;
+					}
+				}
+				if (!_searchIndexLoaded.contains(*i)) {
+					_searchIndexUnavailable.insert(*i);
+				}
+				continue;
+			}
+
+			int32 p = k->pages.size();
+			while (p > 0 && k->pages.at(p - 1).minId > *i) {
+				--p;
+			}
+			if (!p || *i > k->maxId) {
+				_searchIndexUnavailable.insert(*i);
+				continue;
+			}
+
+			const HistoryMessagesPage &page(k->pages.at(p - 1));
+			if (_searchIndexReading.contains(page.key)) continue;
+
+			_searchIndexReading.insert(page.key);
+			StorageTask task(StorageTaskReadMessages);
+			task.file = page.key;
+			task.peer = j->peer;
+			_storageQueue(task);
+		}
+	}
+
+	bool indexedMessageLoaded(MsgId msgId, MTPMessage &result) {
+		SearchIndexLoaded::iterator i = _searchIndexLoaded.find(msgId);
+		if (i == _searchIndexLoaded.end()) return false;
+
+		result = i.value();
+		_searchIndexLoaded.erase(i);
+		return true;
+	}
+
+	void _searchIndexChunkRead(const FileKey &key, const QByteArray &decrypted) {
+		_searchIndexChunksReading.remove(key);
+
+		// the chunk could be removed or read for writing while it was read
+		int32 index = 0, l = _searchIndexChunks.size();
+		while (index < l && _searchIndexChunks.at(index).key != key) {
+			++index;
+		}
+		if (index < l && !_searchIndexChunks.at(index).read) {
+			if (decrypted.isEmpty()) {
+				_readSearchIndexChunk(index, 0);
+			} else {
+				FileReadDescriptor data;
+				_prepareRead(data, decrypted);
+				_readSearchIndexChunk(index, &data);
+			}
+		}
+
+		if (_searchIndexSearched && _searchIndexChunksReading.isEmpty()) {
+			_searchIndexSearched = false;
+			if (App::main()) App::main()->indexedMessagesLoaded();
+		}
+	}
+
+	void _searchIndexPageRead(const PeerId &peer, const FileKey &key, const QByteArray &decrypted) {
+		_searchIndexReading.remove(key);
+
+		// the page could be removed while it was read
+		HistoryMessagesMap::const_iterator i = _historyMessagesMap.constFind(peer);
+		if (i == _historyMessagesMap.cend()) return;
+
+		int32 p = 0, l = i->pages.size();
+		while (p < l && i->pages.at(p).key != key) {
+			++p;
+		}
+		if (p == l) return;
+
+		QVector<MTPMessage> messages;
+		if (!decrypted.isEmpty()) {
+			FileReadDescriptor page;
+			_prepareRead(page, decrypted);
+			if (!_readHistoryMessagesPage(page, peer, messages)) {
+				messages.clear();
+			}
+		}
+
+		bool loaded = false;
+		for (QVector<MTPMessage>::const_iterator j = messages.cbegin(), e = messages.cend(); j != e; ++j) {
+			MsgId msgId = App::idFromMessage(*j);
+			if (_searchIndexWanted.contains(msgId) && !_searchIndexLoaded.contains(msgId)) {
+				_searchIndexLoaded.insert(msgId, *j);
+				loaded = true;
+			}
+		}
+
+		// wanted messages from the page range that were not found are not read again
+		MsgId from = i->pages.at(p).minId, till = (p + 1 < l) ? i->pages.at(p + 1).minId : (i->maxId + 1);
+		for (QSet<MsgId>::const_iterator j = _searchIndexWanted.cbegin(), e = _searchIndexWanted.cend(); j != e; ++j) {
+			if (*j >= from && *j < till && !_searchIndexLoaded.contains(*j) && _searchIndexMessages.value(*j).peer == peer) {
+				_searchIndexUnavailable.insert(*j);
+			}
+		}
+
+		if (loaded && App::main()) {
+			App::main()->indexedMessagesLoaded();
+		}
+	}
+
 	void writeSavedPeers() {
 		if (!_working()) return;
 
@@ -2920,6 +4810,7 @@ namespace Local {
 	struct ClearManagerData {
 		QThread *thread;
 		StorageMap images, stickers, audios;
+		QStringList packs;
 		QMutex mutex;
 		QList<int> tasks;
 		bool working;
@@ -2952,6 +4843,11 @@ namespace Local {
 				_storageAudiosSize = 0;
 				_mapChanged = true;
 			}
+			if (_packIndexKey) {
+				_mapChanged = true;
+			}
+			_packClear();
+			_storageImagesSize = _storageStickersSize = _storageAudiosSize = 0;
 			if (!_draftsMap.isEmpty()) {
 				_draftsMap.clear();
 				_mapChanged = true;
@@ -2960,10 +4856,23 @@ namespace Local {
 				_draftsPositionsMap.clear();
 				_mapChanged = true;
 			}
+			if (!_historyMessagesMap.isEmpty()) {
+				_historyMessagesMap.clear();
+				_mapChanged = true;
+			}
 			if (_locationsKey) {
 				_locationsKey = 0;
 				_mapChanged = true;
 			}
+			_downloadStates.clear();
+			if (_downloadsKey) {
+				_downloadsKey = 0;
+				_mapChanged = true;
+			}
+			if (!_searchIndexChunks.isEmpty()) {
+				_mapChanged = true;
+			}
+			_searchIndexClear();
 			if (_recentStickersKeyOld) {
 				_recentStickersKeyOld = 0;
 				_mapChanged = true;
@@ -3031,6 +4940,8 @@ namespace Local {
 					_storageAudiosSize = 0;
 					_mapChanged = true;
 				}
+				_storageClearPacks(data->packs);
+				_storageImagesSize = _storageStickersSize = _storageAudiosSize = 0;
 				_writeMap();
 			}
 			for (int32 i = 0, l = data->tasks.size(); i < l; ++i) {
@@ -3067,6 +4978,7 @@ namespace Local {
 			int task = 0;
 			bool result = false;
 			StorageMap images, stickers, audios;
+			QStringList packs;
 			{
 				QMutexLocker lock(&data->mutex);
 				if (data->tasks.isEmpty()) {
@@ -3077,6 +4989,7 @@ namespace Local {
 				images = data->images;
 				stickers = data->stickers;
 				audios = data->audios;
+				packs = data->packs;
 			}
 			switch (task) {
 			case ClearManagerAll: {
@@ -3108,6 +5021,9 @@ namespace Local {
 				for (StorageMap::const_iterator i = audios.cbegin(), e = audios.cend(); i != e; ++i) {
 					clearKey(i.value().first, UserPath);
 				}
+				for (QStringList::const_iterator i = packs.cbegin(), e = packs.cend(); i != e; ++i) {
+					QFile::remove(*i);
+				}
 				result = true;
 			break;
 			}
@@ -21,6 +21,54 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 
 namespace _local_inner {
 
+	struct StorageWorkerData;
+	class StorageWorker : public QObject {
+		Q_OBJECT
+
+	public:
+
+		StorageWorker(StorageWorkerData *data, QThread *thread);
+		StorageWorkerData *data() const;
+		~StorageWorker();
+
+	public slots:
+
+		void process();
+
+	signals:
+
+		void processed();
+
+	private:
+
+		StorageWorkerData *_data;
+
+	};
+
+	struct PackCompactorData;
+	class PackCompactor : public QObject {
+		Q_OBJECT
+
+	public:
+
+		PackCompactor(PackCompactorData *data, QThread *thread);
+		PackCompactorData *data() const;
+		~PackCompactor();
+
+	public slots:
+
+		void onStart();
+
+	signals:
+
+		void compacted();
+
+	private:
+
+		PackCompactorData *_data;
+
+	};
+
 	class Manager : public QObject {
 	Q_OBJECT
 
@@ -32,17 +80,56 @@ namespace _local_inner {
 		void writingMap();
 		void writeLocations(bool fast);
 		void writingLocations();
+		void writeDownloads(bool fast);
+		void writingDownloads();
+		void writeSearchIndex(bool fast);
+		void writingSearchIndex();
+		void writeHistoryMessages(bool fast);
+		void writingHistoryMessages();
+		void writePackIndex(bool fast);
+		void writingPackIndex();
+		void compactPacks();
+		void evictStorage();
+		StorageWorkerData *storageData() const;
+		void processStorage();
 		void finish();
 
+	signals:
+
+		void storageNeedsProcessing();
+
 	public slots:
 
 		void mapWriteTimeout();
 		void locationsWriteTimeout();
+		void downloadsWriteTimeout();
+		void searchIndexWriteTimeout();
+		void historyMessagesWriteTimeout();
+		void packIndexWriteTimeout();
+		void packCompactTimeout();
+		void onPackCompacted();
+		void evictTimeout();
+		void onStorageProcessed();
 
 	private:
 
+		void stopCompactor();
+		void stopStorage();
+
 		QTimer _mapWriteTimer;
 		QTimer _locationsWriteTimer;
+		QTimer _downloadsWriteTimer;
+		QTimer _searchIndexWriteTimer;
+		QTimer _historyMessagesWriteTimer;
+		QTimer _packIndexWriteTimer;
+		QTimer _packCompactTimer;
+		QTimer _evictTimer;
+
+		QThread *_compactThread;
+		PackCompactor *_compactor;
+
+		QThread *_storageThread;
+		StorageWorker *_storageWorker;
 
 	};
 
@@ -100,6 +187,8 @@ namespace Local {
 	ReadMapState readMap(const QByteArray &pass);
 	int32 oldMapVersion();
 
+	typedef quint64 TaskId;
+
 	struct MessageDraft {
 		MessageDraft(MsgId replyTo = 0, QString text = QString(), bool previewCancelled = false) : replyTo(replyTo), text(text), previewCancelled(previewCancelled) {
 		}
@@ -116,19 +205,27 @@ namespace Local {
 	void writeFileLocation(MediaKey location, const FileLocation &local);
 	FileLocation readFileLocation(MediaKey location, bool check = true);
 
+	void writeDownloadState(const MediaKey &location, const FileDownloadState &state); // written to disk with a delay
+	FileDownloadState readDownloadState(const MediaKey &location); // empty name if there is no valid state
+	void removeDownloadState(const MediaKey &location);
+
+	// cached media is read in the storage thread, loader->localLoaded() is called when it is done
+	// zero task id is returned if there is nothing in the cache for that location
+	TaskId startImageLoad(const StorageKey &location, mtpFileLoader *loader);
+	TaskId startStickerImageLoad(const StorageKey &location, mtpFileLoader *loader);
+	TaskId startAudioLoad(const StorageKey &location, mtpFileLoader *loader);
+	void cancelTask(TaskId id);
+
 	void writeImage(const StorageKey &location, const ImagePtr &img);
 	void writeImage(const StorageKey &location, const StorageImageSaved &jpeg, bool overwrite = true);
-	StorageImageSaved readImage(const StorageKey &location);
 	int32 hasImages();
 	qint64 storageImagesSize();
 
 	void writeStickerImage(const StorageKey &location, const QByteArray &data, bool overwrite = true);
-	QByteArray readStickerImage(const StorageKey &location);
 	int32 hasStickers();
 	qint64 storageStickersSize();
 
 	void writeAudio(const StorageKey &location, const QByteArray &data, bool overwrite = true);
-	QByteArray readAudio(const StorageKey &location);
 	int32 hasAudios();
 	qint64 storageAudiosSize();
 
@@ -141,6 +238,23 @@ namespace Local {
 	void writeRecentHashtags();
 	void readRecentHashtags();
 
+	// last messages of the chats are saved in pages of MessagesPerPage messages to be shown before the server answers
+	void writeHistoryMessages(const PeerId &peer, const QVector<MTPMessage> &slice); // newest messages of the chat, newer first, replace the saved ones
+	void prependHistoryMessages(const PeerId &peer, const QVector<MTPMessage> &slice, MsgId before); // older messages loaded before the 'before' message, newer first
+	void addHistoryMessage(const PeerId &peer, const MTPMessage &msg); // new message, saved only if all the messages till the bottom are saved
+	void markHistoryMessagesGap(const PeerId &peer); // a message was not saved, so new messages are not saved till the next writeHistoryMessages()
+	bool readHistoryMessages(const PeerId &peer, MsgId before, int32 count, QVector<MTPMessage> &result); // newer first, before == 0 for the newest
+	void removeHistoryMessages(const QVector<MTPint> &ids);
+	void clearHistoryMessages(const PeerId &peer);
+
+	// words of the message texts are indexed for the local messages search, the index is written to disk with a delay
+	void indexMessage(const PeerId &peer, const MTPmessage &msg);
+	void unindexMessage(MsgId msgId);
+	void unindexHistory(const PeerId &peer);
+	void searchIndexed(const QString &query, const PeerId &inPeer, int32 limit, QVector<MsgId> &result); // newer first, inPeer == 0 for all chats, empty while the index is read in the storage thread, App::main() is notified
+	void loadIndexedMessages(const QVector<MsgId> &ids); // found messages are read from the saved messages of their chats in the storage thread, App::main() is notified
+	bool indexedMessageLoaded(MsgId msgId, MTPMessage &result); // takes a found message if it was read
+
 	void addSavedPeer(PeerData *peer, const QDateTime &position);
 	void removeSavedPeer(PeerData *peer);
 	void readSavedPeers();
@@ -20,9 +20,8 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 #include "pspecific.h"
 
 namespace {
-	QFile debugLog, tcpLog, mtpLog, mainLog;
-	QTextStream *debugLogStream = 0, *tcpLogStream = 0, *mtpLogStream = 0, *mainLogStream = 0;
-	int32 part = -1;
+	QFile mainLog;
+	QTextStream *mainLogStream = 0;
 	QChar zero('0');
 
 	QMutex debugLogMutex, mainLogMutex;
@@ -34,81 +33,374 @@ namespace {
 		}
 	};
 
-	QString debugLogEntryStart() {
-		static uint32 logEntry = 0;
-
-		QDateTime tm(QDateTime::currentDateTime());
-
-		QThread *thread = QThread::currentThread();
-		MTPThread *mtpThread = qobject_cast<MTPThread*>(thread);
-		uint32 threadId = mtpThread ? mtpThread->getThreadId() : 0;
-		
-		return QString("[%1 %2-%3]").arg(tm.toString("hh:mm:ss.zzz")).arg(QString("%1").arg(threadId, 2, 10, zero)).arg(++logEntry, 7, 10, zero);
+	struct DebugLogFile {
+		DebugLogFile(const char *name) : name(name), stream(0), index(0) {
+		}
+		const char *name;
+		QFile file;
+		QTextStream *stream;
+		int32 index; // size based part inside the current time based part
+	};
+	DebugLogFile debugLog("log"), tcpLog("tcp"), mtpLog("mtp");
+	int32 part = -1, dayIndex = 0;
+	QString partPostfix;
+
+	void _logsOpen(DebugLogFile &f) {
+		if (f.stream) {
+			delete f.stream;
+			f.stream = 0;
+			f.file.close();
+		}
+		QIODevice::OpenMode mode;
+		while (true) {
+			f.file.setFileName(cWorkingDir() + qsl("DebugLogs/") + QLatin1String(f.name) + partPostfix + (f.index ? QString("_%1").arg(f.index) : QString()) + qsl(".txt"));
+			mode = QIODevice::WriteOnly | QIODevice::Text;
+			if (f.file.exists()) {
+				if (f.file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+					if (QString::fromUtf8(f.file.readLine()).toInt() == dayIndex) {
+						mode |= QIODevice::Append;
+					}
+					f.file.close();
+				}
+				if ((mode & QIODevice::Append) && f.file.size() >= DebugLogFileSizeLimit) { // this part is full already
+					++f.index;
+					continue;
+				}
+			}
+			break;
+		}
+		if (!f.file.open(mode)) {
+			QDir dir(QDir::current());
+			dir.mkdir(cWorkingDir() + qsl("DebugLogs"));
+			f.file.open(mode);
+		}
+		if (f.file.isOpen()) {
+			f.stream = new QTextStream();
+			f.stream->setDevice(&f.file);
+			f.stream->setCodec("UTF-8");
+			(*f.stream) << ((mode & QIODevice::Append) ? qsl("----------------------------------------------------------------\nNEW LOGGING INSTANCE STARTED!!!\n----------------------------------------------------------------\n") : qsl("%1\n").arg(dayIndex));
+			f.stream->flush();
+		}
 	}
-}
 
-void debugLogWrite(const char *file, int32 line, const QString &v) {
-	if (!cDebug() || !debugLogStream) return;
+	void _logsFlush(DebugLogFile &f) {
+		if (!f.stream) return;
 
-	const char *last = strstr(file, "/"), *found = 0;
-	while (last) {
-		found = last;
-		last = strstr(last + 1, "/");
+		f.stream->flush();
+		if (f.file.size() >= DebugLogFileSizeLimit) {
+			++f.index;
+			_logsOpen(f);
+		}
 	}
-	last = strstr(file, "\\");
-	while (last) {
-		found = last;
-		last = strstr(last + 1, "\\");
+
+	void _logsClose(DebugLogFile &f) {
+		if (f.stream) {
+			delete f.stream;
+			f.stream = 0;
+			f.file.close();
+		}
 	}
-	if (found) {
-		file = found + 1;
+
+	void _logsCheckPart() { // open new files each 15 minutes
+		time_t t = time(NULL);
+		struct tm tm;
+		mylocaltime(&tm, &t);
+
+		static const int switchEach = 15; // minutes
+		int32 newPart = (tm.tm_min + tm.tm_hour * 60) / switchEach;
+		if (newPart == part) return;
+
+		part = newPart;
+		dayIndex = (tm.tm_year + 1900) * 10000 + (tm.tm_mon + 1) * 100 + tm.tm_mday;
+		partPostfix = QString("_%4_%5").arg((part * switchEach) / 60, 2, 10, zero).arg((part * switchEach) % 60, 2, 10, zero);
+
+		debugLog.index = tcpLog.index = mtpLog.index = 0;
+		_logsOpen(debugLog);
+		_logsOpen(tcpLog);
+		_logsOpen(mtpLog);
 	}
 
-	{
-		QMutexLocker lock(&debugLogMutex);
-		if (!cDebug() || !debugLogStream) return;
+	enum DebugLogRecordType {
+		DebugLogRecordText,
+		TcpLogRecordText,
+		MtpLogRecordText,
+		MtpLogRecordData,
+	};
+
+	struct DebugLogRecord { // followed by size bytes of utf-16 text or mtp primes
+		uint32 full; // record with its data size, aligned by 8 bytes
+		uint32 type, entry, size;
+		int32 dc, line;
+		const char *file; // source file for DEBUG_LOG or prefix for MTP_LOG_DATA, always a literal
+		qint64 time;
+	};
+	QAtomicInt debugLogEntry;
+
+	class DebugLogRing { // written only by its thread, read only by the log writer thread
+	public:
+		DebugLogRing(uint32 threadId) : threadId(threadId), _data(new char[DebugLogRingSize]), _head(0), _tail(0), _dropped(0), _finished(0) {
+		}
 
-		logsInitDebug(); // maybe need to reopen new file
+		bool push(const DebugLogRecord &record, const void *data) { // returns true if the writer should be woken up
+			uint32 head = uint32(_head.load()), tail = uint32(_tail.loadAcquire());
+			if (head - tail + record.full > uint32(DebugLogRingSize)) {
+				_dropped.ref();
+				return true;
+			}
+			copyIn(head, &record, sizeof(DebugLogRecord));
+			copyIn(head + sizeof(DebugLogRecord), data, record.size);
+			_head.storeRelease(int(head + record.full));
+			return (head - tail + record.full > uint32(DebugLogRingSize / 2));
+		}
 
-		QString msg(QString("%1 %2 (%3 : %4)\n").arg(debugLogEntryStart()).arg(v).arg(file).arg(line));
-		(*debugLogStream) << msg;
-		debugLogStream->flush();
+		bool peek(DebugLogRecord &record) const {
+			uint32 tail = uint32(_tail.load());
+			if (uint32(_head.loadAcquire()) == tail) return false;
+
+			copyOut(tail, &record, sizeof(DebugLogRecord));
+			return true;
+		}
+
+		void take(const DebugLogRecord &record, QByteArray &data) {
+			uint32 tail = uint32(_tail.load());
+			data.resize(record.size);
+			copyOut(tail + sizeof(DebugLogRecord), data.data(), record.size);
+			_tail.storeRelease(int(tail + record.full));
+		}
+
+		int32 takeDropped() {
+			return _dropped.fetchAndStoreRelaxed(0);
+		}
+
+		void finish() {
+			_finished.storeRelease(1);
+		}
+
+		bool finished() const {
+			return _finished.loadAcquire() != 0;
+		}
+
+		~DebugLogRing() {
+			delete[] _data;
+		}
+
+		const uint32 threadId;
+
+	private:
+
+		void copyIn(uint32 pos, const void *from, uint32 size) {
+			uint32 offset = pos & (DebugLogRingSize - 1), first = qMin(size, uint32(DebugLogRingSize) - offset);
+			memcpy(_data + offset, from, first);
+			if (first < size) memcpy(_data, static_cast<const char*>(from) + first, size - first);
+		}
+
+		void copyOut(uint32 pos, void *to, uint32 size) const {
+			uint32 offset = pos & (DebugLogRingSize - 1), first = qMin(size, uint32(DebugLogRingSize) - offset);
+			memcpy(to, _data + offset, first);
+			if (first < size) memcpy(static_cast<char*>(to) + first, _data, size - first);
+		}
+
+		char *_data;
+		QAtomicInt _head, _tail, _dropped, _finished;
+
+	};
+
+	struct DebugLogRingHolder { // rings are deleted by the writer after their threads are finished
+		DebugLogRingHolder() : ring(0) {
+		}
+		~DebugLogRingHolder() {
+			if (ring) ring->finish();
+		}
+		DebugLogRing *ring;
+	};
+	QThreadStorage<DebugLogRingHolder> debugLogRingHolders;
+
+	QMutex debugLogRingsMutex;
+	QList<DebugLogRing*> debugLogRings;
+
+	DebugLogRing *debugLogRing() {
+		DebugLogRingHolder &holder(debugLogRingHolders.localData());
+		if (!holder.ring) {
+			QThread *thread = QThread::currentThread();
+			MTPThread *mtpThread = qobject_cast<MTPThread*>(thread);
+			holder.ring = new DebugLogRing(mtpThread ? mtpThread->getThreadId() : 0);
+
+			QMutexLocker lock(&debugLogRingsMutex);
+			debugLogRings.push_back(holder.ring);
+		}
+		return holder.ring;
+	}
+
+	const char *_logFileName(const char *file) {
+		const char *last = strstr(file, "/"), *found = 0;
+		while (last) {
+			found = last;
+			last = strstr(last + 1, "/");
+		}
+		last = strstr(file, "\\");
+		while (last) {
+			found = last;
+			last = strstr(last + 1, "\\");
+		}
+		return found ? (found + 1) : file;
+	}
+
+	void _logWriteRecord(const DebugLogRecord &record, const QByteArray &data, uint32 threadId) { // under debugLogMutex
+		QString start(QString("[%1 %2-%3]").arg(QDateTime::fromMSecsSinceEpoch(record.time).toString("hh:mm:ss.zzz")).arg(threadId, 2, 10, zero).arg(record.entry, 7, 10, zero));
+		switch (record.type) {
+		case DebugLogRecordText: if (debugLog.stream) {
+			QString msg(QString("%1 %2 (%3 : %4)\n").arg(start).arg(QString(reinterpret_cast<const QChar*>(data.constData()), data.size() / sizeof(QChar))).arg(_logFileName(record.file)).arg(record.line));
+			(*debugLog.stream) << msg;
 #ifdef Q_OS_WIN
-//		OutputDebugString(reinterpret_cast<const wchar_t *>(msg.utf16()));
+//			OutputDebugString(reinterpret_cast<const wchar_t *>(msg.utf16()));
 #elif defined Q_OS_MAC
-        objc_outputDebugString(msg);
+			objc_outputDebugString(msg);
 #elif defined Q_OS_LINUX && defined _DEBUG
-//        std::cout << msg.toUtf8().constData();
+//			std::cout << msg.toUtf8().constData();
 #endif
+		} break;
+
+		case TcpLogRecordText: if (tcpLog.stream) {
+			(*tcpLog.stream) << QString("%1 %2\n").arg(start).arg(QString(reinterpret_cast<const QChar*>(data.constData()), data.size() / sizeof(QChar)));
+		} break;
+
+		case MtpLogRecordText: if (mtpLog.stream) {
+			(*mtpLog.stream) << QString("%1 (dc:%2) %3\n").arg(start).arg(record.dc).arg(QString(reinterpret_cast<const QChar*>(data.constData()), data.size() / sizeof(QChar)));
+		} break;
+
+		case MtpLogRecordData: if (mtpLog.stream) {
+			const mtpPrime *from = reinterpret_cast<const mtpPrime*>(data.constData()), *end = from + (data.size() / sizeof(mtpPrime));
+			(*mtpLog.stream) << QString("%1 (dc:%2) %3%4\n").arg(start).arg(record.dc).arg(QLatin1String(record.file)).arg(mtpTextSerialize(from, end));
+		} break;
+		}
 	}
-}
 
-void tcpLogWrite(const QString &v) {
-	if (!cDebug() || !tcpLogStream) return;
+	void _logWriteRecords() { // under debugLogMutex, in the writer thread
+		_logsCheckPart();
 
-	{
-		QMutexLocker lock(&debugLogMutex);
-		if (!cDebug() || !tcpLogStream) return;
+		QList<DebugLogRing*> rings;
+		{
+			QMutexLocker lock(&debugLogRingsMutex);
+			rings = debugLogRings;
+		}
+
+		for (int32 i = 0, l = rings.size(); i < l; ++i) {
+			if (int32 dropped = rings.at(i)->takeDropped()) {
+				if (debugLog.stream) (*debugLog.stream) << QString("[%1 log records of thread %2 dropped, the writer did not keep up]\n").arg(dropped).arg(rings.at(i)->threadId, 2, 10, zero);
+			}
+		}
+
+		// records of all threads are written in the order they were logged in
+		DebugLogRecord record, next;
+		QByteArray data;
+		while (true) {
+			DebugLogRing *from = 0;
+			for (int32 i = 0, l = rings.size(); i < l; ++i) {
+				if (rings.at(i)->peek(record) && (!from || int32(record.entry - next.entry) < 0)) {
+					from = rings.at(i);
+					next = record;
+				}
+			}
+			if (!from) break;
+
+			from->take(next, data);
+			_logWriteRecord(next, data, from->threadId);
+		}
+
+		_logsFlush(debugLog);
+		_logsFlush(tcpLog);
+		_logsFlush(mtpLog);
+
+		QMutexLocker lock(&debugLogRingsMutex);
+		for (QList<DebugLogRing*>::iterator i = debugLogRings.begin(); i != debugLogRings.end();) {
+			if ((*i)->finished() && !(*i)->peek(record)) {
+				delete *i;
+				i = debugLogRings.erase(i);
+			} else {
+				++i;
+			}
+		}
+	}
+
+	QMutex debugLogWriterMutex;
+	QWaitCondition debugLogWriterCondition;
+	bool debugLogWriterStopping = false;
+
+	class DebugLogWriter : public QThread {
+	protected:
 
-		logsInitDebug(); // maybe need to reopen new file
+		void run() {
+			while (true) {
+				bool stopping = false;
+				{
+					QMutexLocker lock(&debugLogWriterMutex);
+					if (!debugLogWriterStopping) {
+						debugLogWriterCondition.wait(&debugLogWriterMutex, DebugLogWriteTimeout);
+					}
+					stopping = debugLogWriterStopping;
+				}
+				{
+					QMutexLocker lock(&debugLogMutex);
+					_logWriteRecords();
+				}
+				if (stopping) return;
+			}
+		}
+
+	};
+	DebugLogWriter *debugLogWriter = 0;
+
+	void _logPush(uint32 type, int32 dc, const char *file, int32 line, const void *data, uint32 size) {
+		DebugLogRing *ring = debugLogRing();
+
+		DebugLogRecord record;
+		record.full = uint32((sizeof(DebugLogRecord) + size + 7) & ~7U);
+		record.type = type;
+		record.entry = uint32(debugLogEntry.fetchAndAddRelaxed(1) + 1);
+		record.size = size;
+		record.dc = dc;
+		record.line = line;
+		record.file = file;
+		record.time = QDateTime::currentMSecsSinceEpoch();
 
-		(*tcpLogStream) << QString("%1 %2\n").arg(debugLogEntryStart()).arg(v);
-		tcpLogStream->flush();
+		if (record.full > uint32(DebugLogRingSize / 2)) { // too big for the ring, write it right away
+			if (QThread::currentThread() == debugLogWriter) return;
+
+			QMutexLocker lock(&debugLogMutex);
+			if (!debugLogWriter) return;
+
+			_logWriteRecord(record, QByteArray::fromRawData(static_cast<const char*>(data), size), ring->threadId);
+			return;
+		}
+
+		if (ring->push(record, data)) {
+			debugLogWriterCondition.wakeOne();
+		}
 	}
 }
 
+void debugLogWrite(const char *file, int32 line, const QString &v) {
+	if (!cDebug() || !debugLogWriter) return;
+
+	_logPush(DebugLogRecordText, 0, file, line, v.constData(), v.size() * sizeof(QChar));
+}
+
+void tcpLogWrite(const QString &v) {
+	if (!cDebug() || !debugLogWriter) return;
+
+	_logPush(TcpLogRecordText, 0, 0, 0, v.constData(), v.size() * sizeof(QChar));
+}
+
 void mtpLogWrite(int32 dc, const QString &v) {
-	if (!cDebug() || !mtpLogStream) return;
+	if (!cDebug() || !debugLogWriter) return;
 
-	{
-		QMutexLocker lock(&debugLogMutex);
-		if (!cDebug() || !mtpLogStream) return;
+	_logPush(MtpLogRecordText, dc, 0, 0, v.constData(), v.size() * sizeof(QChar));
+}
 
-		logsInitDebug(); // maybe need to reopen new file
+void mtpLogWriteData(int32 dc, const char *prefix, const int32 *from, const int32 *end) {
+	if (!cDebug() || !debugLogWriter) return;
 
-		(*mtpLogStream) << QString("%1 (dc:%2) %3\n").arg(debugLogEntryStart()).arg(dc).arg(v);
-		mtpLogStream->flush();
-	}
+	_logPush(MtpLogRecordData, dc, prefix, 0, from, uint32((end - from) * sizeof(int32)));
 }
 
 void logWrite(const QString &v) {
@@ -240,109 +532,34 @@ void logsInit() {
 }
 
 void logsInitDebug() {
-	time_t t = time(NULL);
-	struct tm tm;
-	mylocaltime(&tm, &t);
-
-	static const int switchEach = 15; // minutes
-	int32 newPart = (tm.tm_min + tm.tm_hour * 60) / switchEach;
-	if (newPart == part) return;
-
-	part = newPart;
+	QMutexLocker lock(&debugLogMutex);
+	_logsCheckPart();
 
-	int32 dayIndex = (tm.tm_year + 1900) * 10000 + (tm.tm_mon + 1) * 100 + tm.tm_mday;
-	QString logPostfix = QString("_%4_%5").arg((part * switchEach) / 60, 2, 10, zero).arg((part * switchEach) % 60, 2, 10, zero);
-
-	if (debugLogStream) {
-		delete debugLogStream;
-		debugLogStream = 0;
-		debugLog.close();
-	}
-	debugLog.setFileName(cWorkingDir() + qsl("DebugLogs/log") + logPostfix + qsl(".txt"));
-	QIODevice::OpenMode debugLogMode = QIODevice::WriteOnly | QIODevice::Text;
-	if (debugLog.exists()) {
-		if (debugLog.open(QIODevice::ReadOnly | QIODevice::Text)) {
-			if (QString::fromUtf8(debugLog.readLine()).toInt() == dayIndex) {
-				debugLogMode |= QIODevice::Append;
-			}
-			debugLog.close();
-		}
-	}
-	if (!debugLog.open(debugLogMode)) {
-		QDir dir(QDir::current());
-		dir.mkdir(cWorkingDir() + qsl("DebugLogs"));
-		debugLog.open(debugLogMode);
-	}
-	if (debugLog.isOpen()) {
-		debugLogStream = new QTextStream();
-		debugLogStream->setDevice(&debugLog);
-		debugLogStream->setCodec("UTF-8");
-		(*debugLogStream) << ((debugLogMode & QIODevice::Append) ? qsl("----------------------------------------------------------------\nNEW LOGGING INSTANCE STARTED!!!\n----------------------------------------------------------------\n") : qsl("%1\n").arg(dayIndex));
-		debugLogStream->flush();
-	}
-	if (tcpLogStream) {
-		delete tcpLogStream;
-		tcpLogStream = 0;
-		tcpLog.close();
-	}
-	tcpLog.setFileName(cWorkingDir() + qsl("DebugLogs/tcp") + logPostfix + qsl(".txt"));
-	QIODevice::OpenMode tcpLogMode = QIODevice::WriteOnly | QIODevice::Text;
-	if (tcpLog.exists()) {
-		if (tcpLog.open(QIODevice::ReadOnly | QIODevice::Text)) {
-			if (QString::fromUtf8(tcpLog.readLine()).toInt() == dayIndex) {
-				tcpLogMode |= QIODevice::Append;
-			}
-			tcpLog.close();
-		}
-	}
-	if (tcpLog.open(tcpLogMode)) {
-		tcpLogStream = new QTextStream();
-		tcpLogStream->setDevice(&tcpLog);
-		tcpLogStream->setCodec("UTF-8");
-		(*tcpLogStream) << ((tcpLogMode & QIODevice::Append) ? qsl("----------------------------------------------------------------\nNEW LOGGING INSTANCE STARTED!!!\n----------------------------------------------------------------\n") : qsl("%1\n").arg(dayIndex));
-		tcpLogStream->flush();
-	}
-	if (mtpLogStream) {
-		delete mtpLogStream;
-		mtpLogStream = 0;
-		mtpLog.close();
-	}
-	mtpLog.setFileName(cWorkingDir() + qsl("DebugLogs/mtp") + logPostfix + qsl(".txt"));
-	QIODevice::OpenMode mtpLogMode = QIODevice::WriteOnly | QIODevice::Text;
-	if (mtpLog.exists()) {
-		if (mtpLog.open(QIODevice::ReadOnly | QIODevice::Text)) {
-			if (QString::fromUtf8(mtpLog.readLine()).toInt() == dayIndex) {
-				mtpLogMode |= QIODevice::Append;
-			}
-			mtpLog.close();
-		}
-	}
-	if (mtpLog.open(mtpLogMode)) {
-		mtpLogStream = new QTextStream();
-		mtpLogStream->setDevice(&mtpLog);
-		mtpLogStream->setCodec("UTF-8");
-		(*mtpLogStream) << ((mtpLogMode & QIODevice::Append) ? qsl("----------------------------------------------------------------\nNEW LOGGING INSTANCE STARTED!!!\n----------------------------------------------------------------\n") : qsl("%1\n").arg(dayIndex));
-		mtpLogStream->flush();
+	if (!debugLogWriter) {
+		debugLogWriterStopping = false;
+		debugLogWriter = new DebugLogWriter();
+		debugLogWriter->start();
 	}
 }
 
 void logsClose() {
-	if (cDebug()) {
-		if (debugLogStream) {
-			delete debugLogStream;
-			debugLogStream = 0;
-			debugLog.close();
-		}
-		if (tcpLogStream) {
-			delete tcpLogStream;
-			tcpLogStream = 0;
-			tcpLog.close();
-		}
-		if (mtpLogStream) {
-			delete mtpLogStream;
-			mtpLogStream = 0;
-			mtpLog.close();
+	if (debugLogWriter) { // write all pending records
+		{
+			QMutexLocker lock(&debugLogWriterMutex);
+			debugLogWriterStopping = true;
+			debugLogWriterCondition.wakeOne();
 		}
+		debugLogWriter->wait();
+
+		QMutexLocker lock(&debugLogMutex);
+		delete debugLogWriter;
+		debugLogWriter = 0;
+	}
+	{
+		QMutexLocker lock(&debugLogMutex);
+		_logsClose(debugLog);
+		_logsClose(tcpLog);
+		_logsClose(mtpLog);
 	}
 	if (mainLogStream) {
 		delete mainLogStream;
@@ -60,10 +60,15 @@ void mtpLogWrite(int32 dc, const QString &v);
 #define MTP_LOG(dc, msg) { if (cDebug()) mtpLogWrite(dc, QString msg); }
 //usage MTP_LOG(dc, ("log: %1 %2").arg(1).arg(2))
 
+void mtpLogWriteData(int32 dc, const char *prefix, const int32 *from, const int32 *end);
+#define MTP_LOG_DATA(dc, prefix, from, end) { if (cDebug()) mtpLogWriteData(dc, prefix, from, end); }
+//usage MTP_LOG_DATA(dc, "Send: ", from, end) - mtp data is copied and serialized to text by the log writer thread
+
 #else
 #define DEBUG_LOG(msg) (void(0))
 #define TCP_LOG(msg) (void(0))
 #define MTP_LOG(dc, msg) (void(0))
+#define MTP_LOG_DATA(dc, prefix, from, end) (void(0))
 #endif
 
 inline const char *logBool(bool v) {
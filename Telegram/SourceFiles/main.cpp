@@ -21,6 +21,32 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 
 #include "localstorage.h"
 
+#ifdef _WITH_SELFTEST
+namespace {
+	int _runTests(int argc, char *argv[], bool benchmark) { // -selftest checks the optimized code paths, -benchmark measures them
+		QApplication app(argc, argv);
+		style::startManager();
+
+		int result = 0;
+		if (benchmark) {
+			imageScaleBenchmark();
+			dialogsFilterBenchmark();
+			historyResizeBenchmark();
+			textPaintBenchmark();
+			aesIgeBenchmark();
+		} else {
+			if (!imageScaleTest()) result = 1;
+			if (!mtpReadFuzzTest()) result = 1;
+			if (!aesIgeTest()) result = 1;
+			LOG(("Test Info: %1").arg(result ? "FAILED" : "passed"));
+		}
+
+		style::stopManager();
+		return result;
+	}
+}
+#endif
+
 int main(int argc, char *argv[]) {
 #ifdef _NEED_WIN_GENERATE_DUMP
 	_oldWndExceptionFilter = SetUnhandledExceptionFilter(_exceptionFilter);
@@ -37,6 +63,15 @@ int main(int argc, char *argv[]) {
 		}
 	}
 	logsInit();
+#ifdef _WITH_SELFTEST
+	for (int32 i = 0; i < argc; ++i) {
+		if (string("-selftest") == argv[i] || string("-benchmark") == argv[i]) {
+			int result = _runTests(argc, argv, string("-benchmark") == argv[i]);
+			logsClose();
+			return result;
+		}
+	}
+#endif
 
 	Local::readSettings();
 	if (cFromAutoStart() && !cAutoStart()) {
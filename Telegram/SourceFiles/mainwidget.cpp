@@ -351,7 +351,7 @@ MainWidget *TopBarWidget::main() {
 }
 
 MainWidget::MainWidget(Window *window) : QWidget(window),
-_started(0), failedObjId(0), _toForwardNameVersion(0), _dialogsWidth(st::dlgMinWidth),
+_started(0), failedObjId(0), _toForwardNameVersion(0), _responsesBatch(0), _batchedDialogsUpdated(false), _dialogsWidth(st::dlgMinWidth),
 dialogs(this), history(this), profile(0), overview(0), _player(this), _topBar(this),
 _forwardConfirm(0), _hider(0), _peerInStack(0), _msgIdInStack(0),
 _playerHeight(0), _contentScrollAddToY(0), _mediaType(this), _mediaTypeMask(0),
@@ -739,6 +739,8 @@ bool MainWidget::leaveChatFailed(PeerData *peer, const RPCError &error) {
 		}
 		dialogs.removePeer(peer);
 		App::history(peer->id)->clear();
+		Local::clearHistoryMessages(peer->id);
+		Local::unindexHistory(peer->id);
 		MTP::send(MTPmessages_DeleteHistory(peer->input, MTP_int(0)), rpcDone(&MainWidget::deleteHistoryPart, peer));
 		return true;
 	}
@@ -752,6 +754,8 @@ void MainWidget::deleteHistoryAfterLeave(PeerData *peer, const MTPUpdates &updat
 	}
 	dialogs.removePeer(peer);
 	App::history(peer->id)->clear();
+	Local::clearHistoryMessages(peer->id);
+	Local::unindexHistory(peer->id);
 	MTP::send(MTPmessages_DeleteHistory(peer->input, MTP_int(0)), rpcDone(&MainWidget::deleteHistoryPart, peer));
 }
 
@@ -781,6 +785,8 @@ void MainWidget::deleteConversation(PeerData *peer) {
 	History *h = App::history(peer->id);
 	h->clear();
 	h->newLoaded = h->oldLoaded = true;
+	Local::clearHistoryMessages(peer->id);
+	Local::unindexHistory(peer->id);
 	showDialogs();
 	MTP::send(MTPmessages_DeleteHistory(peer->input, MTP_int(0)), rpcDone(&MainWidget::deleteHistoryPart, peer));
 }
@@ -792,6 +798,8 @@ void MainWidget::clearHistory(PeerData *peer) {
 	}
 	h->clear();
 	h->newLoaded = h->oldLoaded = true;
+	Local::clearHistoryMessages(peer->id);
+	Local::unindexHistory(peer->id);
 	showPeerHistory(peer->id, ShowAtUnreadMsgId);
 	MTP::send(MTPmessages_DeleteHistory(peer->input, MTP_int(0)), rpcDone(&MainWidget::deleteHistoryPart, peer));
 }
@@ -1079,6 +1087,10 @@ void MainWidget::searchMessages(const QString &query) {
 	if (!cWideMode()) showDialogs();
 }
 
+void MainWidget::indexedMessagesLoaded() {
+	dialogs.indexedMessagesLoaded();
+}
+
 void MainWidget::preloadOverviews(PeerData *peer) {
 	History *h = App::history(peer->id);
 	bool sending[OverviewCount] = { false };
@@ -1188,6 +1200,7 @@ void MainWidget::changingMsgId(HistoryItem *row, MsgId newId) {
 }
 
 void MainWidget::itemRemoved(HistoryItem *item) {
+	_batchedMsgUpdates.remove(item);
 	api()->itemRemoved(item);
 	dialogs.itemRemoved(item);
 	if (history.peer() == item->history()->peer) {
@@ -2267,11 +2280,46 @@ void MainWidget::sentUpdatesReceived(const MTPUpdates &result) {
 
 void MainWidget::msgUpdated(PeerId peer, const HistoryItem *msg) {
 	if (!msg) return;
+	if (_responsesBatch) {
+		_batchedMsgUpdates.insert(msg, peer);
+		return;
+	}
 	history.msgUpdated(peer, msg);
 	if (!msg->history()->dialogs.isEmpty()) dialogs.dlgUpdated(msg->history()->dialogs[0]);
 	if (overview) overview->msgUpdated(peer, msg);
 }
 
+void MainWidget::dialogsReordered() {
+	if (_responsesBatch) {
+		_batchedDialogsUpdated = true;
+	} else {
+		emit dialogsUpdated();
+	}
+}
+
+void MainWidget::startResponsesBatch() {
+	++_responsesBatch;
+}
+
+void MainWidget::finishResponsesBatch() {
+	if (_responsesBatch > 0 && --_responsesBatch > 0) return;
+
+	BatchedMsgUpdates msgs;
+	qSwap(msgs, _batchedMsgUpdates);
+	for (BatchedMsgUpdates::const_iterator i = msgs.cbegin(), e = msgs.cend(); i != e; ++i) {
+		msgUpdated(i.value(), i.key());
+	}
+	if (_batchedDialogsUpdated) {
+		_batchedDialogsUpdated = false;
+		emit dialogsUpdated();
+	}
+	App::emitPeerUpdated();
+}
+
+bool MainWidget::responsesBatched() const {
+	return _responsesBatch > 0;
+}
+
 void MainWidget::historyToDown(History *hist) {
 	history.historyToDown(hist);
 }
@@ -2611,6 +2659,7 @@ void MainWidget::gotState(const MTPupdates_State &state) {
 	updSetState(d.vpts.v, d.vdate.v, d.vqts.v, d.vseq.v);
 
 	MTP::setGlobalDoneHandler(rpcDone(&MainWidget::updateReceived));
+	MTP::setGlobalFailHandler(rpcFail(&MainWidget::updateFailed));
 	_lastUpdateTime = getms(true);
 	noUpdatesTimer.start(NoUpdatesTimeout);
 	updInited = true;
@@ -2630,6 +2679,7 @@ void MainWidget::gotDifference(const MTPupdates_Difference &diff) {
 		updSetState(updGoodPts, d.vdate.v, updQts, d.vseq.v);
 
 		MTP::setGlobalDoneHandler(rpcDone(&MainWidget::updateReceived));
+		MTP::setGlobalFailHandler(rpcFail(&MainWidget::updateFailed));
 		_lastUpdateTime = getms(true);
 		noUpdatesTimer.start(NoUpdatesTimeout);
 
@@ -3270,29 +3320,45 @@ void MainWidget::checkIdleFinish() {
 	}
 }
 
-void MainWidget::updateReceived(const mtpPrime *from, const mtpPrime *end) {
-	if (end <= from || !MTP::authedId()) return;
+bool MainWidget::updateReceived(const mtpPrime *from, const mtpPrime *end) {
+	if (end <= from || !MTP::authedId()) return true;
 
 	App::wnd()->checkAutoLock();
 
-	if (mtpTypeId(*from) == mtpc_new_session_created) {
-		MTPNewSession newSession(from, end);
+	mtpTypeId type = mtpTypeId(*from);
+	if (type == mtpc_new_session_created) {
 		updSeq = 0;
 		MTP_LOG(0, ("getDifference { after new_session_created }%1").arg(cTestMode() ? " TESTMODE" : ""));
-		return getDifference();
-	} else {
-		try {
-			MTPUpdates updates(from, end);
+		getDifference();
+		return true;
+	}
 
-			_lastUpdateTime = getms(true);
-			noUpdatesTimer.start(NoUpdatesTimeout);
+	switch (type) {
+	case mtpc_updatesTooLong:
+	case mtpc_updateShortMessage:
+	case mtpc_updateShortChatMessage:
+	case mtpc_updateShort:
+	case mtpc_updatesCombined:
+	case mtpc_updates: {
+		MTPUpdates updates;
+		if (updates.tryRead(from, end) != mtpReadDone) return false; // see updateFailed()
 
-			handleUpdates(updates);
-			App::emitPeerUpdated();
-		} catch (mtpErrorUnexpected &e) { // just some other type
-		}
+		_lastUpdateTime = getms(true);
+		noUpdatesTimer.start(NoUpdatesTimeout);
+
+		handleUpdates(updates);
+		App::emitPeerUpdated();
+	} break;
+	default: break; // just some other type
 	}
 	update();
+	return true;
+}
+
+bool MainWidget::updateFailed(const RPCError &e) { // updates were received, but could not be parsed, so the state is lost
+	MTP_LOG(0, ("getDifference { after updates parse failed: %1 }%2").arg(e.description()).arg(cTestMode() ? " TESTMODE" : ""));
+	getDifference();
+	return true;
 }
 
 void MainWidget::handleUpdates(const MTPUpdates &updates) {
@@ -3409,6 +3475,7 @@ void MainWidget::feedUpdate(const MTPUpdate &update) {
 			if (msgRow) {
 				App::historyUnregItem(msgRow);
 				History *h = msgRow->history();
+				Local::markHistoryMessagesGap(h->peer->id); // sent message is not saved
 				for (int32 i = 0; i < OverviewCount; ++i) {
 					History::MediaOverviewIds::iterator j = h->_overviewIds[i].find(msgRow->id);
 					if (j != h->_overviewIds[i].cend()) {
@@ -225,6 +225,7 @@ public:
 	void sentDataReceived(uint64 randomId, const MTPmessages_SentMessage &data);
 	void sentUpdatesReceived(const MTPUpdates &updates);
 	void msgUpdated(PeerId peer, const HistoryItem *msg);
+	void dialogsReordered();
 	void historyToDown(History *hist);
 	void dialogsToUp();
 	void newUnreadMsg(History *history, HistoryItem *item);
@@ -320,6 +321,7 @@ public:
 	void insertBotCommand(const QString &cmd);
 
 	void searchMessages(const QString &query);
+	void indexedMessagesLoaded();
 	void preloadOverviews(PeerData *peer);
 	void mediaOverviewUpdated(PeerData *peer, MediaOverviewType type);
 	void changingMsgId(HistoryItem *row, MsgId newId);
@@ -443,6 +445,10 @@ public slots:
 
 	void onStickersInstalled(uint64 setId);
 
+	void startResponsesBatch();
+	void finishResponsesBatch();
+	bool responsesBatched() const;
+
 private:
 
     void partWasRead(PeerData *peer, const MTPmessages_AffectedHistory &result);
@@ -461,6 +467,11 @@ private:
 	Text _toForwardFrom, _toForwardText;
 	int32 _toForwardNameVersion;
 
+	int32 _responsesBatch; // nesting of received responses dispatch, ui updates wait for it to end
+	typedef QMap<const HistoryItem*, PeerId> BatchedMsgUpdates;
+	BatchedMsgUpdates _batchedMsgUpdates;
+	bool _batchedDialogsUpdated;
+
 	QMap<WebPageId, bool> _webPagesUpdated;
 	QTimer _webPageUpdater;
 
@@ -476,7 +487,8 @@ private:
 	void feedMessageIds(const MTPVector<MTPUpdate> &updates);
 	void feedUpdate(const MTPUpdate &update);
 
-	void updateReceived(const mtpPrime *from, const mtpPrime *end);
+	bool updateReceived(const mtpPrime *from, const mtpPrime *end); // false if the updates could not be parsed
+	bool updateFailed(const RPCError &e);
 	void handleUpdates(const MTPUpdates &updates);
 	bool updateFail(const RPCError &e);
 
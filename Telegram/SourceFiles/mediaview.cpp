@@ -53,11 +53,68 @@ namespace {
 	};
 }
 
+MediaViewDecoder::MediaViewDecoder(QThread *thread) {
+	moveToThread(thread);
+}
+
+void MediaViewDecoder::append(const MediaViewPrefetchTask &task) {
+	QMutexLocker lock(&_lock);
+	for (QList<MediaViewPrefetchTask>::iterator i = _tasks.begin(); i != _tasks.end(); ++i) {
+		if (i->id == task.id) {
+			*i = task;
+			return;
+		}
+	}
+	_tasks.push_back(task);
+}
+
+void MediaViewDecoder::cancel(const PhotoId &id) {
+	QMutexLocker lock(&_lock);
+	for (QList<MediaViewPrefetchTask>::iterator i = _tasks.begin(); i != _tasks.end(); ++i) {
+		if (i->id == id) {
+			_tasks.erase(i);
+			return;
+		}
+	}
+}
+
+QList<MediaViewPrefetchTask> MediaViewDecoder::takeDecoded() {
+	QMutexLocker lock(&_lock);
+	QList<MediaViewPrefetchTask> result;
+	qSwap(result, _decoded);
+	return result;
+}
+
+void MediaViewDecoder::decode() {
+	while (true) {
+		MediaViewPrefetchTask task;
+		{
+			QMutexLocker lock(&_lock);
+			if (_tasks.isEmpty()) break;
+			task = _tasks.takeFirst(); // tasks are appended from the nearest photo to the farthest
+		}
+
+		QImage img = App::readImage(task.bytes, &task.format, false);
+		if (!img.isNull() && (img.width() != task.width || img.height() != task.height)) {
+			img = imageScaleDown(img, task.width, task.height);
+		}
+		task.bytes = QByteArray();
+		task.image = img;
+
+		QMutexLocker lock(&_lock);
+		_decoded.push_back(task);
+		if (_decoded.size() == 1) {
+			emit decoded();
+		}
+	}
+}
+
 MediaView::MediaView() : TWidget(App::wnd()),
 _photo(0), _doc(0), _overview(OverviewCount),
 _leftNavVisible(false), _rightNavVisible(false), _saveVisible(false), _headerHasLink(false), _animStarted(getms()),
 _width(0), _x(0), _y(0), _w(0), _h(0), _xStart(0), _yStart(0),
-_zoom(0), _zoomToScreen(0), _pressed(false), _dragging(0), _full(-1),
+_zoom(0), _zoomToScreen(0), _pressed(false), _dragging(0), _currentGif(this), _full(-1),
+_prefetchThread(new QThread()), _prefetchDecoder(new MediaViewDecoder(_prefetchThread)),
 _docNameWidth(0), _docSizeWidth(0),
 _docThumbx(0), _docThumby(0), _docThumbw(0),
 _docRadialFirst(0), _docRadialStart(0), _docRadialLast(0), _docRadialOpacity(1), a_docRadialStart(0, 1),
@@ -126,6 +183,11 @@ _saveMsgStarted(0), _saveMsgOpacity(0)
 	connect(&_docDownload, SIGNAL(clicked()), this, SLOT(onDownload()));
 	connect(&_docSaveAs, SIGNAL(clicked()), this, SLOT(onSaveAs()));
 	connect(&_docCancel, SIGNAL(clicked()), this, SLOT(onSaveCancel()));
+
+	connect(this, SIGNAL(needPrefetch()), _prefetchDecoder, SLOT(decode()), Qt::QueuedConnection);
+	connect(_prefetchDecoder, SIGNAL(decoded()), this, SLOT(onPrefetchDecoded()), Qt::QueuedConnection);
+	connect(App::wnd(), SIGNAL(imageLoaded()), this, SLOT(onImageLoaded()));
+	_prefetchThread->start();
 }
 
 void MediaView::moveToScreen() {
@@ -400,6 +462,11 @@ bool MediaView::animStep(float64 msp) {
 }
 
 MediaView::~MediaView() {
+	_prefetchThread->quit();
+	_prefetchThread->wait();
+	delete _prefetchDecoder;
+	delete _prefetchThread;
+
 	delete _menu;
 }
 
@@ -759,19 +826,10 @@ void MediaView::displayPhoto(PhotoData *photo, HistoryItem *item) {
 	_current = QPixmap();
 	_currentGif.stop();
 	_down = OverNone;
-	_w = convertScale(photo->full->width());
-	_h = convertScale(photo->full->height());
 	if (isHidden()) {
 		moveToScreen();
 	}
-	if (_w > width()) {
-		_h = qRound(_h * width() / float64(_w));
-		_w = width();
-	}
-	if (_h > height()) {
-		_w = qRound(_w * height() / float64(_h));
-		_h = height();
-	}
+	photoFitSize(photo, _w, _h);
 	_x = (width() - _w) / 2;
 	_y = (height() - _h) / 2;
 	_width = _w;
@@ -997,7 +1055,12 @@ void MediaView::paintEvent(QPaintEvent *e) {
 	// photo
 	if (_photo) {
 		int32 w = _width * cIntRetinaFactor();
-		if (_full <= 0 && _photo->full->loaded()) {
+		PrefetchedPhotos::const_iterator prefetched = (_full <= 0) ? _prefetched.constFind(_photo->id) : _prefetched.cend();
+		if (prefetched != _prefetched.cend() && prefetched->width() == w) {
+			_current = prefetched.value();
+			if (cRetina()) _current.setDevicePixelRatio(cRetinaFactor());
+			_full = 1;
+		} else if (_full <= 0 && _photo->full->loaded()) {
 			int32 h = int((_photo->full->height() * (qreal(w) / qreal(_photo->full->width()))) + 0.9999);
 			_current = _photo->full->pixNoCache(w, h, true);
 			if (cRetina()) _current.setDevicePixelRatio(cRetinaFactor());
@@ -1413,7 +1476,11 @@ void MediaView::moveToNext(int32 delta) {
 }
 
 void MediaView::preloadData(int32 delta) {
-	if (_index < 0 || (!_user && _overview == OverviewCount)) return;
+	_prefetchPhotos.clear();
+	if (_index < 0 || (!_user && _overview == OverviewCount)) {
+		prefetchPhotos();
+		return;
+	}
 
 	int32 from = _index + (delta ? delta : -1), to = _index + (delta ? delta * MediaOverviewPreloadCount : 1), forget = _index - delta * 2;
 	if (from > to) qSwap(from, to);
@@ -1423,7 +1490,7 @@ void MediaView::preloadData(int32 delta) {
 				if (HistoryItem *item = App::histItemById(_history->_overview[_overview][i])) {
 					if (HistoryMedia *media = item->getMedia()) {
 						switch (media->type()) {
-						case MediaTypePhoto: static_cast<HistoryPhoto*>(media)->photo()->full->load(); break;
+						case MediaTypePhoto: static_cast<HistoryPhoto*>(media)->photo()->full->load(); _prefetchPhotos.push_back(static_cast<HistoryPhoto*>(media)->photo()); break;
 						case MediaTypeDocument: static_cast<HistoryDocument*>(media)->document()->thumb->load(); break;
 						case MediaTypeSticker: static_cast<HistorySticker*>(media)->document()->sticker()->img->load(); break;
 						}
@@ -1451,12 +1518,102 @@ void MediaView::preloadData(int32 delta) {
 		for (int32 i = from; i <= to; ++i) {
 			if (i >= 0 && i < _user->photos.size() && i != _index) {
 				_user->photos[i]->full->load();
+				_prefetchPhotos.push_back(_user->photos[i]);
 			}
 		}
 		if (forget >= 0 && forget < _user->photos.size() && forget != _index) {
 			_user->photos[forget]->forget();
 		}
 	}
+	if (delta < 0) { // photos were collected from the farthest to the nearest
+		for (int32 i = 0, l = _prefetchPhotos.size(); i < l / 2; ++i) {
+			_prefetchPhotos.swap(i, l - i - 1);
+		}
+	}
+	prefetchPhotos();
+}
+
+void MediaView::photoFitSize(PhotoData *photo, int32 &w, int32 &h) const {
+	w = convertScale(photo->full->width());
+	h = convertScale(photo->full->height());
+	if (w > width()) {
+		h = qRound(h * width() / float64(w));
+		w = width();
+	}
+	if (h > height()) {
+		w = qRound(w * height() / float64(h));
+		h = height();
+	}
+}
+
+void MediaView::prefetchPhotos() {
+	int64 size = 0;
+	PrefetchedPhotos prefetched;
+	PrefetchingPhotos prefetching;
+	if (_photo) { // the shown photo keeps its prefetched pixmap while it is on the screen
+		PrefetchedPhotos::const_iterator i = _prefetched.constFind(_photo->id);
+		if (i != _prefetched.cend()) {
+			prefetched.insert(i.key(), i.value());
+			size += int64(i->width()) * i->height() * 4;
+		}
+	}
+	for (int32 i = 0, l = _prefetchPhotos.size(); i < l; ++i) {
+		PhotoData *photo = _prefetchPhotos.at(i);
+		if (photo == _photo || prefetched.contains(photo->id) || prefetching.contains(photo->id)) continue;
+		if (!photo->full->loaded() || photo->full->savedData().isEmpty()) continue;
+
+		int32 w, h;
+		photoFitSize(photo, w, h);
+		w *= cIntRetinaFactor();
+		if (w <= 0 || !photo->full->width()) continue;
+		h = int((photo->full->height() * (qreal(w) / qreal(photo->full->width()))) + 0.9999);
+
+		size += int64(w) * h * 4;
+		if (size > MediaViewPrefetchLimit) break;
+
+		PrefetchedPhotos::const_iterator j = _prefetched.constFind(photo->id);
+		if (j != _prefetched.cend() && j->width() == w) {
+			prefetched.insert(j.key(), j.value());
+		} else {
+			PrefetchingPhotos::const_iterator k = _prefetching.constFind(photo->id);
+			if (k == _prefetching.cend() || k.value() != w) {
+				_prefetchDecoder->append(MediaViewPrefetchTask(photo->id, photo->full->savedData(), photo->full->savedFormat(), w, h));
+			}
+			prefetching.insert(photo->id, w);
+		}
+	}
+	for (PrefetchingPhotos::const_iterator i = _prefetching.cbegin(), e = _prefetching.cend(); i != e; ++i) {
+		PrefetchingPhotos::const_iterator j = prefetching.constFind(i.key());
+		if (j == prefetching.cend() || j.value() != i.value()) {
+			_prefetchDecoder->cancel(i.key());
+		}
+	}
+	_prefetched = prefetched;
+	_prefetching = prefetching;
+	if (!_prefetching.isEmpty()) {
+		emit needPrefetch();
+	}
+}
+
+void MediaView::onImageLoaded() {
+	if (isHidden() || _prefetchPhotos.isEmpty()) return;
+	prefetchPhotos();
+}
+
+void MediaView::onPrefetchDecoded() {
+	QList<MediaViewPrefetchTask> decoded(_prefetchDecoder->takeDecoded());
+	for (QList<MediaViewPrefetchTask>::const_iterator i = decoded.cbegin(), e = decoded.cend(); i != e; ++i) {
+		PrefetchingPhotos::iterator j = _prefetching.find(i->id);
+		if (j == _prefetching.end() || j.value() != i->width) continue; // not needed anymore
+
+		_prefetching.erase(j);
+		if (!i->image.isNull()) {
+			_prefetched.insert(i->id, QPixmap::fromImage(i->image, Qt::ColorOnly));
+			if (_photo && _photo->id == i->id && _full <= 0) {
+				update(_x, _y, _w, _h);
+			}
+		}
+	}
 }
 
 void MediaView::mousePressEvent(QMouseEvent *e) {
@@ -1792,6 +1949,10 @@ void MediaView::hide() {
 	_controlsState = ControlsShown;
 	a_cOpacity = anim::fvalue(1, 1);
 	QWidget::hide();
+
+	_prefetchPhotos.clear();
+	prefetchPhotos(); // cancel the pending decoding
+	_prefetched.clear();
 }
 
 void MediaView::onMenuDestroy(QObject *obj) {
@@ -19,6 +19,43 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 
 #include "dropdown.h"
 
+struct MediaViewPrefetchTask {
+	MediaViewPrefetchTask() : id(0), width(0), height(0) {
+	}
+	MediaViewPrefetchTask(const PhotoId &id, const QByteArray &bytes, const QByteArray &format, int32 width, int32 height) : id(id), bytes(bytes), format(format), width(width), height(height) {
+	}
+	PhotoId id;
+	QByteArray bytes, format;
+	int32 width, height; // the photo is scaled to this size in the decoder thread
+	QImage image;
+};
+
+class MediaViewDecoder : public QObject {
+	Q_OBJECT
+
+public:
+
+	MediaViewDecoder(QThread *thread);
+
+	void append(const MediaViewPrefetchTask &task);
+	void cancel(const PhotoId &id);
+	QList<MediaViewPrefetchTask> takeDecoded();
+
+signals:
+
+	void decoded();
+
+public slots:
+
+	void decode();
+
+private:
+
+	QMutex _lock;
+	QList<MediaViewPrefetchTask> _tasks, _decoded;
+
+};
+
 class MediaView : public TWidget, public RPCSender, public Animated {
 	Q_OBJECT
 
@@ -97,6 +134,13 @@ public slots:
 	void updateImage();
 	void onGifUpdated();
 
+	void onImageLoaded();
+	void onPrefetchDecoded();
+
+signals:
+
+	void needPrefetch();
+
 private:
 
 	void displayPhoto(PhotoData *photo, HistoryItem *item);
@@ -111,6 +155,9 @@ private:
 	void updateHeader();
 	void snapXY();
 
+	void photoFitSize(PhotoData *photo, int32 &w, int32 &h) const;
+	void prefetchPhotos();
+
 	QBrush _transparentBrush;
 
 	PhotoData *_photo;
@@ -139,6 +186,14 @@ private:
 	AnimatedGif _currentGif;
 	int32 _full; // -1 - thumb, 0 - medium, 1 - full
 
+	QThread *_prefetchThread;
+	MediaViewDecoder *_prefetchDecoder;
+	QList<PhotoData*> _prefetchPhotos; // neighbours of the current photo, nearest first
+	typedef QMap<PhotoId, QPixmap> PrefetchedPhotos;
+	PrefetchedPhotos _prefetched; // decoded and scaled to the screen size
+	typedef QMap<PhotoId, int32> PrefetchingPhotos;
+	PrefetchingPhotos _prefetching; // sent to the decoder, value is the requested width
+
 	style::sprite _docIcon;
 	style::color _docIconColor;
 	QString _docName, _docSize, _docExt;
@@ -225,12 +225,17 @@ with open('scheme.tl') as f:
       funcsText += '\tmtpTypeId type() const {\n\t\treturn mtpc_' + name + ';\n\t}\n'; # type id
 
       funcsText += '\tvoid read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_' + name + ') {\n'; # read method
+      funcsText += '\t\tmtpReadResult result = tryRead(from, end, cons);\n';
+      funcsText += '\t\tif (result != mtpReadDone) mtpReadFailed(result, cons, "MTP' + name + '");\n';
+      funcsText += '\t}\n';
+      funcsText += '\tmtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_' + name + ') {\n'; # non-throwing read method
       for k in prmsList:
         v = prms[k];
         if (k in conditionsList):
-          funcsText += '\t\tif (has_' + k + '()) { v' + k + '.read(from, end); } else { v' + k + ' = MTP' + v + '(); }\n';
+          funcsText += '\t\tif (has_' + k + '()) { if (mtpReadResult result = v' + k + '.tryRead(from, end)) return result; } else { v' + k + ' = MTP' + v + '(); }\n';
         else:
-          funcsText += '\t\tv' + k + '.read(from, end);\n';
+          funcsText += '\t\tif (mtpReadResult result = v' + k + '.tryRead(from, end)) return result;\n';
+      funcsText += '\t\treturn mtpReadDone;\n';
       funcsText += '\t}\n';
 
       funcsText += '\tvoid write(mtpBuffer &to) const {\n'; # write method
@@ -457,11 +462,11 @@ for restype in typesList:
           readText += '\t\t';
           writeText += '\t\t';
         if (paramName in conditionsList):
-          readText += '\tif (v.has_' + paramName + '()) { v.v' + paramName + '.read(from, end); } else { v.v' + paramName + ' = MTP' + paramType + '(); }\n';
+          readText += '\tif (v.has_' + paramName + '()) { if (mtpReadResult result = v.v' + paramName + '.tryRead(from, end)) return result; } else { v.v' + paramName + ' = MTP' + paramType + '(); }\n';
           writeText += '\tif (v.has_' + paramName + '()) v.v' + paramName + '.write(to);\n';
           sizeList.append('(v.has_' + paramName + '() ? v.v' + paramName + '.innerLength() : 0)');
         else:
-          readText += '\tv.v' + paramName + '.read(from, end);\n';
+          readText += '\tif (mtpReadResult result = v.v' + paramName + '.tryRead(from, end)) return result;\n';
           writeText += '\tv.v' + paramName + '.write(to);\n';
           sizeList.append('v.v' + paramName + '.innerLength()');
 
@@ -601,18 +606,28 @@ for restype in typesList:
     typesText += ' = mtpc_' + name;
   typesText += ');\n';
   inlineMethods += 'inline void MTP' + restype + '::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {\n';
+  inlineMethods += '\tmtpReadResult result = tryRead(from, end, cons);\n';
+  inlineMethods += '\tif (result != mtpReadDone) mtpReadFailed(result, cons, "MTP' + restype + '");\n';
+  inlineMethods += '}\n';
+
+  typesText += '\tmtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons'; # non-throwing read method
+  if (not withType):
+    typesText += ' = mtpc_' + name;
+  typesText += ');\n';
+  inlineMethods += 'inline mtpReadResult MTP' + restype + '::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {\n';
   if (withData):
     if (withType):
       inlineMethods += '\tif (cons != _type) setData(0);\n';
     else:
-      inlineMethods += '\tif (cons != mtpc_' + v[0][0] + ') throw mtpErrorUnexpected(cons, "MTP' + restype + '");\n';
+      inlineMethods += '\tif (cons != mtpc_' + v[0][0] + ') return mtpReadUnexpected;\n';
   if (withType):
     inlineMethods += '\tswitch (cons) {\n'
     inlineMethods += reader;
-    inlineMethods += '\t\tdefault: throw mtpErrorUnexpected(cons, "MTP' + restype + '");\n';
+    inlineMethods += '\t\tdefault: return mtpReadUnexpected;\n';
     inlineMethods += '\t}\n';
   else:
     inlineMethods += reader;
+  inlineMethods += '\treturn mtpReadDone;\n';
   inlineMethods += '}\n';
 
   typesText += '\tvoid write(mtpBuffer &to) const;\n'; # write method
@@ -655,6 +670,139 @@ for restype in typesList:
   inlineMethods += creatorsText;
   typesText += 'typedef MTPBoxed<MTP' + restype + '> MTP' + resType + ';\n'; # boxed type definition
 
+# read-only views parsed into a per-response arena
+def viewType(ptype):
+  vtypeget = re.match(r'^([Vv]ector)<MTP([A-Za-z0-9_]+)>$', ptype);
+  if (vtypeget):
+    return 'MTP' + vtypeget.group(1) + 'View<' + viewType(vtypeget.group(2)) + ' >';
+  if (ptype in ['int', 'long', 'int128', 'int256', 'double', 'bool', 'Int', 'Long', 'Int128', 'Int256', 'Double', 'Bool']):
+    return 'MTP' + ptype;
+  return 'MTP' + ptype + 'View';
+
+viewForwards = '';
+viewTypesText = '';
+viewDataTexts = '';
+viewInlineMethods = '';
+for restype in typesList:
+  v = typesDict[restype];
+  resType = TypesDict[restype];
+  withType = (len(v) > 1);
+  withData = 0;
+  getters = '';
+  reader = '';
+
+  viewForwards += 'class MTP' + restype + 'View;\n';
+  for data in v:
+    name = data[0];
+    prmsList = data[2];
+    prms = data[3];
+    hasFlags = data[4];
+    conditionsList = data[5];
+    conditions = data[6];
+
+    readText = '';
+    if (len(prms)):
+      withData = 1;
+      viewForwards += 'class MTPD' + name + 'View;\n';
+
+      getters += '\tconst MTPD' + name + 'View &c_' + name + '() const {\n'; # const getter
+      getters += '\t\tif (!_data) throw mtpErrorUninitialized();\n';
+      if (withType):
+        getters += '\t\tif (_type != mtpc_' + name + ') throw mtpErrorWrongTypeId(_type, mtpc_' + name + ');\n';
+      getters += '\t\treturn *(const MTPD' + name + 'View*)_data;\n';
+      getters += '\t}\n';
+
+      dataText = '\nclass MTPD' + name + 'View {\n'; # data view class
+      dataText += 'public:\n';
+      for paramName in prmsList:
+        dataText += '\t' + viewType(prms[paramName]) + ' v' + paramName + ';\n';
+        if (withType):
+          readText += '\t\t';
+        if (paramName in conditionsList):
+          readText += '\tif (v->has_' + paramName + '()) if (mtpReadResult result = mtpTryReadView(v->v' + paramName + ', from, end, arena)) return result;\n';
+        else:
+          readText += '\tif (mtpReadResult result = mtpTryReadView(v->v' + paramName + ', from, end, arena)) return result;\n';
+      if (len(conditions)):
+        dataText += '\n';
+        dataText += '\tenum {\n';
+        for paramName in conditionsList:
+          dataText += '\t\tflag_' + paramName + ' = (1 << ' + conditions[paramName] + '),\n';
+        dataText += '\t};\n';
+        dataText += '\n';
+        for paramName in conditionsList:
+          dataText += '\tbool has_' + paramName + '() const { return v' + hasFlags + '.v & flag_' + paramName + '; }\n';
+      dataText += '};\n';
+      viewDataTexts += dataText;
+
+    if (withType):
+      reader += '\t\tcase mtpc_' + name + ': _type = cons; ';
+      if (len(prms)):
+        reader += '{\n';
+        reader += '\t\t\tMTPD' + name + 'View *v = arena.alloc<MTPD' + name + 'View>(1);\n';
+        reader += '\t\t\t_data = v;\n';
+        reader += readText;
+        reader += '\t\t} break;\n';
+      else:
+        reader += '_data = 0; break;\n';
+    elif (len(prms)):
+      reader += '\tMTPD' + name + 'View *v = arena.alloc<MTPD' + name + 'View>(1);\n';
+      reader += '\t_data = v;\n';
+      reader += readText;
+
+  viewTypesText += '\nclass MTP' + restype + 'View {\n'; # type view class
+  viewTypesText += 'public:\n';
+  inits = [];
+  if (withData):
+    inits.append('_data(0)');
+  if (withType):
+    inits.append('_type(0)');
+  viewTypesText += '\tMTP' + restype + 'View()';
+  if (inits):
+    viewTypesText += ' : ' + ', '.join(inits);
+  viewTypesText += ' {\n\t}\n';
+  if (withData):
+    viewTypesText += '\n' + getters;
+
+  viewTypesText += '\n\tmtpTypeId type() const {\n';
+  if (withType):
+    viewTypesText += '\t\tif (!_type) throw mtpErrorUninitialized();\n';
+    viewTypesText += '\t\treturn _type;\n';
+  else:
+    viewTypesText += '\t\treturn mtpc_' + v[0][0] + ';\n';
+  viewTypesText += '\t}\n';
+
+  viewTypesText += '\tvoid read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons'; # read method
+  if (not withType):
+    viewTypesText += ' = mtpc_' + v[0][0];
+  viewTypesText += ') {\n';
+  viewTypesText += '\t\tmtpReadResult result = tryRead(from, end, arena, cons);\n';
+  viewTypesText += '\t\tif (result != mtpReadDone) mtpReadFailed(result, cons, "MTP' + restype + 'View");\n';
+  viewTypesText += '\t}\n';
+  viewTypesText += '\tmtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons'; # tryRead method
+  if (not withType):
+    viewTypesText += ' = mtpc_' + v[0][0];
+  viewTypesText += ');\n';
+  viewInlineMethods += '\ninline mtpReadResult MTP' + restype + 'View::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {\n';
+  if (withType):
+    viewInlineMethods += '\tswitch (cons) {\n';
+    viewInlineMethods += reader;
+    viewInlineMethods += '\t\tdefault: return mtpReadUnexpected;\n';
+    viewInlineMethods += '\t}\n';
+  else:
+    viewInlineMethods += '\tif (cons != mtpc_' + v[0][0] + ') return mtpReadUnexpected;\n';
+    viewInlineMethods += reader;
+  viewInlineMethods += '\treturn mtpReadDone;\n';
+  viewInlineMethods += '}\n';
+
+  if (withData or withType):
+    viewTypesText += '\nprivate:\n';
+  if (withData):
+    viewTypesText += '\tconst void *_data;\n';
+  if (withType):
+    viewTypesText += '\tmtpTypeId _type;\n';
+  viewTypesText += '};\n';
+  viewTypesText += 'typedef MTPBoxedView<MTP' + restype + 'View> MTP' + resType + 'View;\n'; # boxed view definition
+
 textSerializeFull = '\nvoid mtpTextSerializeType(MTPStringLogger &to, const mtpPrime *&from, const mtpPrime *end, mtpPrime cons, uint32 level, mtpPrime vcons) {\n';
 textSerializeFull += '\tQVector<mtpTypeId> types, vtypes;\n';
 textSerializeFull += '\tQVector<int32> stages, flags;\n';
@@ -745,6 +893,10 @@ out.write('\n// Type classes definitions\n' + typesText);
 out.write('\n// Type constructors with data\n' + dataTexts);
 out.write('\n// RPC methods\n' + funcsText);
 out.write('\n// Inline methods definition\n' + inlineMethods);
+out.write('\n// Read-only view forward declarations\n' + viewForwards);
+out.write('\n// Read-only view classes definitions\n' + viewTypesText);
+out.write('\n// Read-only views of constructors with data\n' + viewDataTexts);
+out.write('\n// Read-only view inline methods definition\n' + viewInlineMethods);
 out.write('\n// Human-readable text serialization\n#if (defined _DEBUG || defined _WITH_DEBUG)\n\nvoid mtpTextSerializeType(MTPStringLogger &to, const mtpPrime *&from, const mtpPrime *end, mtpPrime cons, uint32 level, mtpPrime vcons);\n\n#endif\n');
 
 outCpp = open('mtpScheme.cpp', 'w');
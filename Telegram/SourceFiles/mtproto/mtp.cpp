@@ -39,6 +39,7 @@ namespace {
 	
 	typedef QMap<mtpRequestId, RPCResponseHandler> ParserMap;
 	ParserMap parserMap;
+	ParserMap dispatchingParserMap; // parsers taken by takeCallbacks() for a received batch
 	QMutex parserMapLock;
 
 	typedef QMap<mtpRequestId, mtpRequest> RequestMap;
@@ -65,6 +66,7 @@ namespace {
 	RPCResponseHandler globalHandler;
 	MTPStateChangedHandler stateChangedHandler = 0;
 	MTPSessionResetHandler sessionResetHandler = 0;
+	MTPResponsesBatchHandler responsesBatchHandler = 0;
 	_mtp_internal::RequestResender *resender = 0;
 
 	void importDone(const MTPauth_Authorization &result, mtpRequestId req) {
@@ -448,6 +450,11 @@ namespace _mtp_internal {
 				found = true;
 
 				parserMap.erase(i);
+			} else if ((i = dispatchingParserMap.find(requestId)) != dispatchingParserMap.end()) {
+				h = i.value();
+				found = true;
+
+				dispatchingParserMap.erase(i);
 			}
 		}
 		if (errorCode && found) {
@@ -483,7 +490,7 @@ namespace _mtp_internal {
 			for (RPCCallbackClears::iterator i = toClear.begin(), e = toClear.end(); i != e; ++i) {
 				if (cDebug()) {
 					QMutexLocker locker(&parserMapLock);
-					if (parserMap.find(i->requestId) != parserMap.end()) {
+					if (parserMap.find(i->requestId) != parserMap.end() || dispatchingParserMap.find(i->requestId) != dispatchingParserMap.end()) {
 						DEBUG_LOG(("RPC Info: clearing delayed callback %1, error code %2").arg(i->requestId).arg(i->errorCode));
 					}
 				}
@@ -494,32 +501,57 @@ namespace _mtp_internal {
 		}
 	}
 
+	void takeCallbacks(const mtpResponseMap &responses) {
+		QMutexLocker locker(&parserMapLock);
+		for (mtpResponseMap::const_iterator i = responses.cbegin(), e = responses.cend(); i != e; ++i) {
+			if (i.key() <= 0) continue;
+
+			ParserMap::iterator j = parserMap.find(i.key());
+			if (j != parserMap.cend()) {
+				dispatchingParserMap.insert(j.key(), j.value());
+				parserMap.erase(j);
+			}
+		}
+	}
+
 	void execCallback(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) {
 		RPCResponseHandler h;
 		{
 			QMutexLocker locker(&parserMapLock);
-			ParserMap::iterator i = parserMap.find(requestId);
-			if (i != parserMap.cend()) {
+			ParserMap::iterator i = dispatchingParserMap.find(requestId);
+			if (i != dispatchingParserMap.cend()) {
+				h = i.value();
+				dispatchingParserMap.erase(i);
+			} else if ((i = parserMap.find(requestId)) != parserMap.cend()) {
 				h = i.value();
 				parserMap.erase(i);
-
+			}
+			if (h.onDone || h.onFail) {
 				DEBUG_LOG(("RPC Info: found parser for request %1, trying to parse response..").arg(requestId));
 			}
 		}
 		if (h.onDone || h.onFail) {
-			try {
-				if (from >= end) throw mtpErrorInsufficient();
-
-				if (*from == mtpc_rpc_error) {
-					RPCError err(MTPRpcError(from, end));
-					DEBUG_LOG(("RPC Info: error received, code %1, type %2, description: %3").arg(err.code()).arg(err.type()).arg(err.description()));
-					if (!rpcErrorOccured(requestId, h, err)) {
-						QMutexLocker locker(&parserMapLock);
-						parserMap.insert(requestId, h);
-						return;
+			try { // parsing does not throw, only the callbacks may
+				bool parsed = (from < end);
+				if (parsed && *from == mtpc_rpc_error) {
+					MTPRpcError error;
+					parsed = (error.tryRead(from, end) == mtpReadDone);
+					if (parsed) {
+						RPCError err(error);
+						DEBUG_LOG(("RPC Info: error received, code %1, type %2, description: %3").arg(err.code()).arg(err.type()).arg(err.description()));
+						if (!rpcErrorOccured(requestId, h, err)) {
+							QMutexLocker locker(&parserMapLock);
+							parserMap.insert(requestId, h);
+							return;
+						}
 					}
-				} else {
-					if (h.onDone) (*h.onDone)(requestId, from, end);
+				} else if (parsed && h.onDone) {
+					parsed = (*h.onDone)(requestId, from, end);
+				}
+				if (!parsed && !rpcErrorOccured(requestId, h, rpcClientError("RESPONSE_PARSE_FAILED", QString("could not parse response for request %1").arg(requestId)))) {
+					QMutexLocker locker(&parserMapLock);
+					parserMap.insert(requestId, h);
+					return;
 				}
 			} catch (Exception &e) {
 				if (!rpcErrorOccured(requestId, h, rpcClientError("RESPONSE_PARSE_FAILED", QString("exception text: ") + e.what()))) {
@@ -536,12 +568,15 @@ namespace _mtp_internal {
 
 	bool hasCallbacks(mtpRequestId requestId) {
 		QMutexLocker locker(&parserMapLock);
-		ParserMap::iterator i = parserMap.find(requestId);
-		return (i != parserMap.cend());
+		return (parserMap.constFind(requestId) != parserMap.cend()) || (dispatchingParserMap.constFind(requestId) != dispatchingParserMap.cend());
 	}
 
 	void globalCallback(const mtpPrime *from, const mtpPrime *end) {
-		if (globalHandler.onDone) (*globalHandler.onDone)(0, from, end); // some updates were received
+		if (!globalHandler.onDone) return;
+		if (!(*globalHandler.onDone)(0, from, end)) { // some updates were received, but could not be parsed
+			LOG(("RPC Error: could not parse updates with type 0x%1 of %2 bytes").arg((end > from) ? mtpTypeId(*from) : 0, 0, 16).arg(int32((end - from) * sizeof(mtpPrime))));
+			if (globalHandler.onFail) (*globalHandler.onFail)(0, rpcClientError("UPDATES_PARSE_FAILED", QString("could not parse updates with type 0x%1").arg((end > from) ? mtpTypeId(*from) : 0, 0, 16)));
+		}
 	}
 
 	void onStateChange(int32 dcWithShift, int32 state) {
@@ -552,6 +587,10 @@ namespace _mtp_internal {
 		if (sessionResetHandler) sessionResetHandler(dcWithShift);
 	}
 
+	void onResponsesBatch(bool started) {
+		if (responsesBatchHandler) responsesBatchHandler(started);
+	}
+
 	bool rpcErrorOccured(mtpRequestId requestId, const RPCFailHandlerPtr &onFail, const RPCError &err) { // return true if need to clean request data
 		if (err.type().startsWith(qsl("FLOOD_WAIT_"))) {
 			if (onFail && (*onFail)(requestId, err)) return true;
@@ -822,6 +861,10 @@ namespace MTP {
 		sessionResetHandler = handler;
 	}
 
+	void setResponsesBatchHandler(MTPResponsesBatchHandler handler) {
+		responsesBatchHandler = handler;
+	}
+
 	void clearGlobalHandlers() {
 		setGlobalDoneHandler(RPCDoneHandlerPtr());
 		setGlobalFailHandler(RPCFailHandlerPtr());
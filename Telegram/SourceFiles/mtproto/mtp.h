@@ -34,11 +34,13 @@ namespace _mtp_internal {
 	void clearCallbacks(mtpRequestId requestId, int32 errorCode = RPCError::NoError); // 0 - do not toggle onError callback
 	void clearCallbacksDelayed(const RPCCallbackClears &requestIds);
 	void performDelayedClear();
+	void takeCallbacks(const mtpResponseMap &responses); // take parsers for a whole received batch at once
 	void execCallback(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end);
 	bool hasCallbacks(mtpRequestId requestId);
 	void globalCallback(const mtpPrime *from, const mtpPrime *end);
 	void onStateChange(int32 dcWithShift, int32 state);
 	void onSessionReset(int32 dcWithShift);
+	void onResponsesBatch(bool started);
 	bool rpcErrorOccured(mtpRequestId requestId, const RPCFailHandlerPtr &onFail, const RPCError &err); // return true if need to clean request data
 	inline bool rpcErrorOccured(mtpRequestId requestId, const RPCResponseHandler &handler, const RPCError &err) {
 		return rpcErrorOccured(requestId, handler.onFail, err);
@@ -126,6 +128,7 @@ namespace MTP {
 	void setGlobalFailHandler(RPCFailHandlerPtr handler);
 	void setStateChangedHandler(MTPStateChangedHandler handler);
 	void setSessionResetHandler(MTPSessionResetHandler handler);
+	void setResponsesBatchHandler(MTPResponsesBatchHandler handler);
 	void clearGlobalHandlers();
 
 	void updateDcOptions(const QVector<MTPDcOption> &options);
@@ -110,13 +110,7 @@ typedef QSharedPointer<mtpAuthKey> mtpAuthKeyPtr;
 typedef QVector<mtpAuthKeyPtr> mtpKeysMap;
 
 inline void aesEncrypt(const void *src, void *dst, uint32 len, void *key, void *iv) {
-	uchar aes_key[32], aes_iv[32];
-	memcpy(aes_key, key, 32);
-	memcpy(aes_iv, iv, 32);
-	
-	AES_KEY aes;
-	AES_set_encrypt_key(aes_key, 256, &aes);
-	AES_ige_encrypt((const uchar*)src, (uchar*)dst, len, &aes, aes_iv, AES_ENCRYPT);
+	aesIgeEncrypt(src, dst, len, key, iv);
 }
 
 inline void aesEncrypt(const void *src, void *dst, uint32 len, const mtpAuthKeyPtr &authKey, const MTPint128 &msgKey) {
@@ -134,13 +128,7 @@ inline void aesEncryptLocal(const void *src, void *dst, uint32 len, const mtpAut
 }
 
 inline void aesDecrypt(const void *src, void *dst, uint32 len, void *key, void *iv) {
-	uchar aes_key[32], aes_iv[32];
-	memcpy(aes_key, key, 32);
-	memcpy(aes_iv, iv, 32);
-	
-	AES_KEY aes;
-	AES_set_decrypt_key(aes_key, 256, &aes);
-	AES_ige_encrypt((const uchar*)src, (uchar*)dst, len, &aes, aes_iv, AES_DECRYPT);
+	aesIgeDecrypt(src, dst, len, key, iv);
 }
 
 inline void aesDecrypt(const void *src, void *dst, uint32 len, const mtpAuthKeyPtr &authKey, const MTPint128 &msgKey) {
@@ -334,6 +334,63 @@ QString MTProtoConnection::transport() const {
 	return data->transport();
 }
 
+namespace {
+	QMutex _buffersPoolLock;
+	QList<mtpBuffer> _buffersPool;
+	QAtomicInt _buffersAllocated, _buffersReused, _buffersReleased, _buffersDropped;
+}
+
+mtpBuffer mtpAcquireBuffer(uint32 size) {
+	mtpBuffer result;
+	{
+		QMutexLocker lock(&_buffersPoolLock);
+		for (int32 i = _buffersPool.size(); i > 0;) {
+			if (uint32(_buffersPool.at(--i).capacity()) >= size) {
+				result.swap(_buffersPool[i]);
+				_buffersPool.removeAt(i);
+				break;
+			}
+		}
+	}
+	if (result.capacity()) {
+		_buffersReused.ref();
+	} else {
+		result.reserve(size); // reserved capacity is kept when the buffer is resized down
+		_buffersAllocated.ref();
+	}
+	result.resize(size);
+	return result;
+}
+
+void mtpReleaseBuffer(mtpBuffer &buffer) {
+	if (buffer.isDetached() && buffer.capacity() > 0 && buffer.capacity() <= MTPReceiveBufferPooledMax) {
+		QMutexLocker lock(&_buffersPoolLock);
+		if (_buffersPool.size() < MTPReceiveBuffersPoolSize) {
+			_buffersPool.push_back(mtpBuffer());
+			_buffersPool.back().swap(buffer);
+			_buffersReleased.ref();
+			return;
+		}
+	}
+	if (buffer.capacity() > 0) {
+		_buffersDropped.ref();
+	}
+	buffer = mtpBuffer();
+}
+
+mtpBuffersStats mtpGetBuffersStats() {
+	mtpBuffersStats result;
+	result.allocated = _buffersAllocated.load();
+	result.reused = _buffersReused.load();
+	result.released = _buffersReleased.load();
+	result.dropped = _buffersDropped.load();
+	{
+		QMutexLocker lock(&_buffersPoolLock);
+		result.pooled = _buffersPool.size();
+	}
+	return result;
+}
+
 namespace {
 	mtpBuffer _handleHttpResponse(QNetworkReply *reply) {
 		QByteArray response = reply->readAll();
@@ -346,7 +403,7 @@ namespace {
 			return mtpBuffer(1, -500);
 		}
 
-		mtpBuffer data(response.size() >> 2);
+		mtpBuffer data(mtpAcquireBuffer(response.size() >> 2));
 		memcpy(data.data(), response.constData(), response.size());
 
 		return data;
@@ -427,7 +484,7 @@ namespace {
 			return mtpBuffer(1, packet[2]);
 		}
 
-		mtpBuffer data(size - 3);
+		mtpBuffer data(mtpAcquireBuffer(size - 3)); // packet is in the socket read buffer, copy only the payload
 		memcpy(data.data(), packet + 2, (size - 3) * sizeof(mtpPrime));
 
 		return data;
@@ -492,29 +549,37 @@ namespace {
 		return buffer;
 	}
 
-	MTPResPQ _readPQFakeReply(const mtpBuffer &buffer) {
+	int32 _handleReadFailed(mtpReadResult result, mtpTypeId cons) { // handleOneReceived() result for a message that could not be parsed
+		LOG(("Message Error: could not parse message with constructor %1, %2").arg(cons).arg((result == mtpReadInsufficient) ? "insufficient data" : "unexpected type id"));
+		return -1;
+	}
+
+	bool _readPQFakeReply(const mtpBuffer &buffer, MTPResPQ &response) {
 		const mtpPrime *answer(buffer.constData());
 		uint32 len = buffer.size();
 		if (len < 5) {
 			LOG(("Fake PQ Error: bad request answer, len = %1").arg(len * sizeof(mtpPrime)));
 			DEBUG_LOG(("Fake PQ Error: answer bytes %1").arg(mb(answer, len * sizeof(mtpPrime)).str()));
-			throw Exception("bad pq reply");
+			return false;
 		}
 		if (answer[0] != 0 || answer[1] != 0 || (((uint32)answer[2]) & 0x03) != 1/* || (unixtime() - answer[3] > 300) || (answer[3] - unixtime() > 60)*/) { // didnt sync time yet
 			LOG(("Fake PQ Error: bad request answer start (%1 %2 %3)").arg(answer[0]).arg(answer[1]).arg(answer[2]));
 			DEBUG_LOG(("Fake PQ Error: answer bytes %1").arg(mb(answer, len * sizeof(mtpPrime)).str()));
-			throw Exception("bad pq reply");
+			return false;
 		}
 		uint32 answerLen = (uint32)answer[4];
 		if (answerLen != (len - 5) * sizeof(mtpPrime)) {
 			LOG(("Fake PQ Error: bad request answer %1 <> %2").arg(answerLen).arg((len - 5) * sizeof(mtpPrime)));
 			DEBUG_LOG(("Fake PQ Error: answer bytes %1").arg(mb(answer, len * sizeof(mtpPrime)).str()));
-			throw Exception("bad pq reply");
+			return false;
 		}
 		const mtpPrime *from(answer + 5), *end(from + len - 5);
-		MTPResPQ response;
-		response.read(from, end);
-		return response;
+		if (response.tryRead(from, end) != mtpReadDone) {
+			LOG(("Fake PQ Error: could not parse request answer"));
+			DEBUG_LOG(("Fake PQ Error: answer bytes %1").arg(mb(answer, len * sizeof(mtpPrime)).str()));
+			return false;
+		}
+		return true;
 	}
 
 }
@@ -786,8 +851,8 @@ void MTPautoConnection::requestFinished(QNetworkReply *reply) {
 				receivedQueue.push_back(data);
 				emit receivedData();
 			} else if (status == WaitingBoth || status == WaitingHttp) {
-				try {
-					MTPResPQ res_pq = _readPQFakeReply(data);
+				MTPResPQ res_pq;
+				if (_readPQFakeReply(data, res_pq)) {
 					const MTPDresPQ &res_pq_data(res_pq.c_resPQ());
 					if (res_pq_data.vnonce == httpNonce) {
 						if (status == WaitingBoth) {
@@ -800,8 +865,8 @@ void MTPautoConnection::requestFinished(QNetworkReply *reply) {
 							emit connected();
 						}
 					}
-				} catch (Exception &e) {
-					DEBUG_LOG(("Connection Error: exception in parsing HTTP fake pq-responce, %1").arg(e.what()));
+				} else {
+					DEBUG_LOG(("Connection Error: bad HTTP fake pq-responce"));
 					if (status == WaitingBoth) {
 						status = WaitingTcp;
 					} else {
@@ -852,16 +917,16 @@ void MTPautoConnection::socketPacket(mtpPrime *packet, uint32 size) {
 		emit receivedData();
 	} else if (status == WaitingBoth || status == WaitingTcp || status == HttpReady) {
 		tcpTimeoutTimer.stop();
-		try {
-			MTPResPQ res_pq = _readPQFakeReply(data);
+		MTPResPQ res_pq;
+		if (_readPQFakeReply(data, res_pq)) {
 			const MTPDresPQ &res_pq_data(res_pq.c_resPQ());
 			if (res_pq_data.vnonce == tcpNonce) {
 				DEBUG_LOG(("Connection Info: TCP/%1-transport chosen by pq-response").arg((_flags & MTPDdcOption_flag_ipv6) ? "IPv6" : "IPv4"));
 				status = UsingTcp;
 				emit connected();
 			}
-		} catch (Exception &e) {
-			DEBUG_LOG(("Connection Error: exception in parsing TCP fake pq-responce, %1").arg(e.what()));
+		} else {
+			DEBUG_LOG(("Connection Error: bad TCP fake pq-responce"));
 			if (status == WaitingBoth) {
 				status = WaitingHttp;
 				sock.disconnectFromHost();
@@ -1020,16 +1085,16 @@ void MTPtcpConnection::socketPacket(mtpPrime *packet, uint32 size) {
 		emit receivedData();
 	} else if (status == WaitingTcp) {
 		tcpTimeoutTimer.stop();
-		try {
-			MTPResPQ res_pq = _readPQFakeReply(data);
+		MTPResPQ res_pq;
+		if (_readPQFakeReply(data, res_pq)) {
 			const MTPDresPQ &res_pq_data(res_pq.c_resPQ());
 			if (res_pq_data.vnonce == tcpNonce) {
 				DEBUG_LOG(("Connection Info: TCP/%1-transport chosen by pq-response").arg((_flags & MTPDdcOption_flag_ipv6) ? "IPv6" : "IPv4"));
 				status = UsingTcp;
 				emit connected();
 			}
-		} catch (Exception &e) {
-			DEBUG_LOG(("Connection Error: exception in parsing TCP fake pq-responce, %1").arg(e.what()));
+		} else {
+			DEBUG_LOG(("Connection Error: bad TCP fake pq-responce"));
 			emit error();
 		}
 	}
@@ -1129,16 +1194,16 @@ void MTPhttpConnection::requestFinished(QNetworkReply *reply) {
 				receivedQueue.push_back(data);
 				emit receivedData();
 			} else {
-				try {
-					MTPResPQ res_pq = _readPQFakeReply(data);
+				MTPResPQ res_pq;
+				if (_readPQFakeReply(data, res_pq)) {
 					const MTPDresPQ &res_pq_data(res_pq.c_resPQ());
 					if (res_pq_data.vnonce == httpNonce) {
 						DEBUG_LOG(("Connection Info: HTTP/%1-transport connected by pq-response").arg((_flags & MTPDdcOption_flag_ipv6) ? "IPv6" : "IPv4"));
 						status = UsingHttp;
 						emit connected();
 					}
-				} catch (Exception &e) {
-					DEBUG_LOG(("Connection Error: exception in parsing HTTP fake pq-responce, %1").arg(e.what()));
+				} else {
+					DEBUG_LOG(("Connection Error: bad HTTP fake pq-responce"));
 					emit error();
 				}
 			}
@@ -1954,6 +2019,10 @@ void MTProtoConnectionPrivate::restart(bool maybeBadKey) {
 	if (!sessionData) return;
 
 	DEBUG_LOG(("MTP Info: restarting MTProtoConnection, maybe bad key = %1").arg(logBool(maybeBadKey)));
+	if (cDebug()) {
+		mtpBuffersStats stats(mtpGetBuffersStats());
+		DEBUG_LOG(("MTP Info: receive buffers allocated %1, reused %2, released %3, dropped %4, pooled %5").arg(stats.allocated).arg(stats.reused).arg(stats.released).arg(stats.dropped).arg(stats.pooled));
+	}
 
 	_waitForReceivedTimer.stop();
 	_waitForConnectedTimer.stop();
@@ -2136,9 +2205,10 @@ void MTProtoConnectionPrivate::handleReceived() {
 	}
 
 	while (_conn->received().size()) {
-		const mtpBuffer &encryptedBuf(_conn->received().front());
+		mtpBuffer encryptedBuf; // decrypted in place and returned to the pool after handling
+		encryptedBuf.swap(_conn->received().front());
 		uint32 len = encryptedBuf.size();
-		const mtpPrime *encrypted(encryptedBuf.data());
+		mtpPrime *encrypted(encryptedBuf.data());
 		if (len < 18) { // 2 auth_key_id, 4 msg_key, 2 salt, 2 session, 2 msg_id, 1 seq_no, 1 length, (1 data + 3 padding) min
 			LOG(("TCP Error: bad message received, len %1").arg(len * sizeof(mtpPrime)));
 			TCP_LOG(("TCP Error: bad message %1").arg(mb(encrypted, len * sizeof(mtpPrime)).str()));
@@ -2154,20 +2224,20 @@ void MTProtoConnectionPrivate::handleReceived() {
 			return restart();
 		}
 
-		QByteArray dataBuffer((len - 6) * sizeof(mtpPrime), Qt::Uninitialized);
-		mtpPrime *data((mtpPrime*)dataBuffer.data()), *msg = data + 8;
+		uint32 dataSize = (len - 6) * sizeof(mtpPrime);
+		mtpPrime *data(encrypted + 6), *msg = data + 8;
 		const mtpPrime *from(msg), *end;
 		MTPint128 msgKey(*(MTPint128*)(encrypted + 2));
-		
-		aesDecrypt(encrypted + 6, data, dataBuffer.size(), key, msgKey);
+
+		aesDecrypt(data, data, dataSize, key, msgKey); // ige decryption can be done in place
 
 		uint64 serverSalt = *(uint64*)&data[0], session = *(uint64*)&data[2], msgId = *(uint64*)&data[4];
 		uint32 seqNo = *(uint32*)&data[6], msgLen = *(uint32*)&data[7];
 		bool needAck = (seqNo & 0x01);
 
-		if (uint32(dataBuffer.size()) < msgLen + 8 * sizeof(mtpPrime) || (msgLen & 0x03)) {
-			LOG(("TCP Error: bad msg_len received %1, data size: %2").arg(msgLen).arg(dataBuffer.size()));
-			TCP_LOG(("TCP Error: bad message %1").arg(mb(encrypted, len * sizeof(mtpPrime)).str()));
+		if (dataSize < msgLen + 8 * sizeof(mtpPrime) || (msgLen & 0x03)) {
+			LOG(("TCP Error: bad msg_len received %1, data size: %2").arg(msgLen).arg(dataSize));
+			TCP_LOG(("TCP Error: bad decrypted message %1").arg(mb(encrypted, len * sizeof(mtpPrime)).str()));
 			_conn->received().pop_front();
 
 			lockFinished.unlock();
@@ -2176,7 +2246,7 @@ void MTProtoConnectionPrivate::handleReceived() {
 		uchar sha1Buffer[20];
 		if (memcmp(&msgKey, hashSha1(data, msgLen + 8 * sizeof(mtpPrime), sha1Buffer) + 1, sizeof(msgKey))) {
 			LOG(("TCP Error: bad SHA1 hash after aesDecrypt in message"));
-			TCP_LOG(("TCP Error: bad message %1").arg(mb(encrypted, len * sizeof(mtpPrime)).str()));
+			TCP_LOG(("TCP Error: bad decrypted message %1").arg(mb(encrypted, len * sizeof(mtpPrime)).str()));
 			_conn->received().pop_front();
 
 			lockFinished.unlock();
@@ -2234,8 +2304,7 @@ void MTProtoConnectionPrivate::handleReceived() {
 
 		int32 res = 1; // if no need to handle, then succeed
 		end = data + 8 + (msgLen >> 2);
-		const mtpPrime *sfrom(data + 4);
-		MTP_LOG(dc, ("Recv: ") + mtpTextSerialize(sfrom, end));
+		MTP_LOG_DATA(dc, "Recv: ", data + 4, end);
 
 		bool needToHandle = false;
 		{
@@ -2246,6 +2315,7 @@ void MTProtoConnectionPrivate::handleReceived() {
 		if (needToHandle) {
 			res = handleOneReceived(from, end, msgId, serverTime, serverSalt, badTime);
 		}
+		mtpReleaseBuffer(encryptedBuf);
 		{
 			QWriteLocker lock(sessionData->receivedIdsMutex());
 			mtpMsgIdsMap &receivedIds(sessionData->receivedIdsSet());
@@ -2300,9 +2370,9 @@ void MTProtoConnectionPrivate::handleReceived() {
 }
 
 int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mtpPrime *end, uint64 msgId, int32 serverTime, uint64 serverSalt, bool badTime) {
-	mtpTypeId cons = *from;
-	try {
+	if (from >= end) return _handleReadFailed(mtpReadInsufficient, 0);
 
+	mtpTypeId cons = *from;
 	switch (cons) {
 
 	case mtpc_gzip_packed: {
@@ -2315,24 +2385,26 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 	}
 
 	case mtpc_msg_container: {
-		if (++from >= end) throw mtpErrorInsufficient();
+		if (++from >= end) return _handleReadFailed(mtpReadInsufficient, cons);
 
 		const mtpPrime *otherEnd;
 		uint32 msgsCount = (uint32)*(from++);
 		DEBUG_LOG(("Message Info: container received, count: %1").arg(msgsCount));
 		for (uint32 i = 0; i < msgsCount; ++i) {
-			if (from + 4 >= end) throw mtpErrorInsufficient();
+			if (from + 4 >= end) return _handleReadFailed(mtpReadInsufficient, cons);
 			otherEnd = from + 4;
 
-			MTPlong inMsgId(from, otherEnd);
+			MTPlong inMsgId;
+			inMsgId.tryRead(from, otherEnd); // msg_id, seq_no and bytes fit in the four primes checked above
 			bool isReply = ((inMsgId.v & 0x03) == 1);
 			if (!isReply && ((inMsgId.v & 0x03) != 3)) {
 				LOG(("Message Error: bad msg_id %1 in contained message received").arg(inMsgId.v));
 				return -1;
 			}
 
-			MTPint inSeqNo(from, otherEnd);
-			MTPint bytes(from, otherEnd);
+			MTPint inSeqNo, bytes;
+			inSeqNo.tryRead(from, otherEnd);
+			bytes.tryRead(from, otherEnd);
 			if ((bytes.v & 0x03) || bytes.v < 4) {
 				LOG(("Message Error: bad length %1 of contained message received").arg(bytes.v));
 				return -1;
@@ -2344,7 +2416,7 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 			DEBUG_LOG(("Message Info: message from container, msg_id: %1, needAck: %2").arg(inMsgId.v).arg(logBool(needAck)));
 
 			otherEnd = from + (bytes.v >> 2);
-			if (otherEnd > end) throw mtpErrorInsufficient();
+			if (otherEnd > end) return _handleReadFailed(mtpReadInsufficient, cons);
 
 			bool needToHandle = false;
 			{
@@ -2366,7 +2438,8 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 	} return 1;
 
 	case mtpc_msgs_ack: {
-		MTPMsgsAck msg(from, end);
+		MTPMsgsAck msg;
+		if (mtpReadResult result = msg.tryRead(from, end)) return _handleReadFailed(result, cons);
 		const QVector<MTPlong> &ids(msg.c_msgs_ack().vmsg_ids.c_vector().v);
 		uint32 idsCount = ids.size();
 
@@ -2384,7 +2457,8 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 	} return 1;
 
 	case mtpc_bad_msg_notification: {
-		MTPBadMsgNotification msg(from, end);
+		MTPBadMsgNotification msg;
+		if (mtpReadResult result = msg.tryRead(from, end)) return _handleReadFailed(result, cons);
 		const MTPDbad_msg_notification &data(msg.c_bad_msg_notification());
 		LOG(("Message Info: bad message notification received (error_code %3) for msg_id = %1, seq_no = %2").arg(data.vbad_msg_id.v).arg(data.vbad_msg_seqno.v).arg(data.verror_code.v));
 
@@ -2460,7 +2534,8 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 	} return 1;
 
 	case mtpc_bad_server_salt: {
-		MTPBadMsgNotification msg(from, end);
+		MTPBadMsgNotification msg;
+		if (mtpReadResult result = msg.tryRead(from, end)) return _handleReadFailed(result, cons);
 		const MTPDbad_server_salt &data(msg.c_bad_server_salt());
 		DEBUG_LOG(("Message Info: bad server salt received (error_code %4) for msg_id = %1, seq_no = %2, new salt: %3").arg(data.vbad_msg_id.v).arg(data.vbad_msg_seqno.v).arg(data.vnew_server_salt.v).arg(data.verror_code.v));
 
@@ -2494,7 +2569,8 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 			DEBUG_LOG(("Message Info: skipping with bad time.."));
 			return 0;
 		}
-		MTPMsgsStateReq msg(from, end);
+		MTPMsgsStateReq msg;
+		if (mtpReadResult result = msg.tryRead(from, end)) return _handleReadFailed(result, cons);
 		const QVector<MTPlong> ids(msg.c_msgs_state_req().vmsg_ids.c_vector().v);
 		uint32 idsCount = ids.size();
 		DEBUG_LOG(("Message Info: msgs_state_req received, ids: %1").arg(logVectorLong(ids)));
@@ -2541,7 +2617,8 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 	} return 1;
 
 	case mtpc_msgs_state_info: {
-		MTPMsgsStateInfo msg(from, end);
+		MTPMsgsStateInfo msg;
+		if (mtpReadResult result = msg.tryRead(from, end)) return _handleReadFailed(result, cons);
 		const MTPDmsgs_state_info &data(msg.c_msgs_state_info());
 		
 		uint64 reqMsgId = data.vreq_msg_id.v;
@@ -2574,18 +2651,21 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 			LOG(("Message Error: bad request %1 found in requestMap, size: %2").arg(reqMsgId).arg(requestBuffer->size()));
 			return -1;
 		}
-		try {
-			const mtpPrime *rFrom = requestBuffer->constData() + 8, *rEnd = requestBuffer->constData() + requestBuffer->size();
-			if (mtpTypeId(*rFrom) == mtpc_msgs_state_req) {
-				MTPMsgsStateReq request(rFrom, rEnd);
-				handleMsgsStates(request.c_msgs_state_req().vmsg_ids.c_vector().v, states, toAck);
-			} else {
-				MTPMsgResendReq request(rFrom, rEnd);
-				handleMsgsStates(request.c_msg_resend_req().vmsg_ids.c_vector().v, states, toAck);
+		const mtpPrime *rFrom = requestBuffer->constData() + 8, *rEnd = requestBuffer->constData() + requestBuffer->size();
+		if (mtpTypeId(*rFrom) == mtpc_msgs_state_req) {
+			MTPMsgsStateReq request;
+			if (request.tryRead(rFrom, rEnd) != mtpReadDone) {
+				LOG(("Message Error: could not parse sent msgs_state_req"));
+				return -1;
 			}
-		} catch(Exception &e) {
-			LOG(("Message Error: could not parse sent msgs_state_req"));
-			throw;
+			handleMsgsStates(request.c_msgs_state_req().vmsg_ids.c_vector().v, states, toAck);
+		} else {
+			MTPMsgResendReq request;
+			if (request.tryRead(rFrom, rEnd) != mtpReadDone) {
+				LOG(("Message Error: could not parse sent msg_resend_req"));
+				return -1;
+			}
+			handleMsgsStates(request.c_msg_resend_req().vmsg_ids.c_vector().v, states, toAck);
 		}
 
 		requestsAcked(toAck);
@@ -2597,7 +2677,8 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 			return 0;
 		}
 
-		MTPMsgsAllInfo msg(from, end);
+		MTPMsgsAllInfo msg;
+		if (mtpReadResult result = msg.tryRead(from, end)) return _handleReadFailed(result, cons);
 		const MTPDmsgs_all_info &data(msg.c_msgs_all_info());
 		const QVector<MTPlong> ids(data.vmsg_ids.c_vector().v);
 		const string &states(data.vinfo.c_string().v);
@@ -2611,7 +2692,8 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 	} return 1;
 
 	case mtpc_msg_detailed_info: {
-		MTPMsgDetailedInfo msg(from, end);
+		MTPMsgDetailedInfo msg;
+		if (mtpReadResult result = msg.tryRead(from, end)) return _handleReadFailed(result, cons);
 		const MTPDmsg_detailed_info &data(msg.c_msg_detailed_info());
 
 		DEBUG_LOG(("Message Info: msg detailed info, sent msgId %1, answerId %2, status %3, bytes %4").arg(data.vmsg_id.v).arg(data.vanswer_msg_id.v).arg(data.vstatus.v).arg(data.vbytes.v));
@@ -2647,7 +2729,8 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 			DEBUG_LOG(("Message Info: skipping msg_new_detailed_info with bad time.."));
 			return 0;
 		}
-		MTPMsgDetailedInfo msg(from, end);
+		MTPMsgDetailedInfo msg;
+		if (mtpReadResult result = msg.tryRead(from, end)) return _handleReadFailed(result, cons);
 		const MTPDmsg_new_detailed_info &data(msg.c_msg_new_detailed_info());
 
 		DEBUG_LOG(("Message Info: msg new detailed info, answerId %2, status %3, bytes %4").arg(data.vanswer_msg_id.v).arg(data.vstatus.v).arg(data.vbytes.v));
@@ -2668,7 +2751,8 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 	} return 1;
 	
 	case mtpc_msg_resend_req: {
-		MTPMsgResendReq msg(from, end);
+		MTPMsgResendReq msg;
+		if (mtpReadResult result = msg.tryRead(from, end)) return _handleReadFailed(result, cons);
 		const QVector<MTPlong> &ids(msg.c_msg_resend_req().vmsg_ids.c_vector().v);
 
 		uint32 idsCount = ids.size();
@@ -2683,10 +2767,11 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 	} return 1;
 
 	case mtpc_rpc_result: {
-		if (from + 3 > end) throw mtpErrorInsufficient();
+		if (from + 3 > end) return _handleReadFailed(mtpReadInsufficient, cons);
 		mtpResponse response;
 
-		MTPlong reqMsgId(++from, end);
+		MTPlong reqMsgId;
+		reqMsgId.tryRead(++from, end); // fits in the three primes checked above
 		mtpTypeId typeId = from[0];
 
 		DEBUG_LOG(("RPC Info: response received for %1, queueing..").arg(reqMsgId.v));
@@ -2710,7 +2795,7 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 			}
 			typeId = response[0];
 		} else {
-			response.resize(end - from);
+			response = mtpAcquireBuffer(end - from);
 			memcpy(response.data(), from, (end - from) * sizeof(mtpPrime));
 		}
 		if (!sessionData->layerWasInited()) {
@@ -2731,7 +2816,8 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 		if (badTime) return 0;
 
 		const mtpPrime *start = from;
-		MTPNewSession msg(from, end);
+		MTPNewSession msg;
+		if (mtpReadResult result = msg.tryRead(from, end)) return _handleReadFailed(result, cons);
 		const MTPDnew_session_created &data(msg.c_new_session_created());
 		DEBUG_LOG(("Message Info: new server session created, unique_id %1, first_msg_id %2, server_salt %3").arg(data.vunique_id.v).arg(data.vfirst_msg_id.v).arg(data.vserver_salt.v));
 		sessionData->setSalt(data.vserver_salt.v);
@@ -2749,7 +2835,7 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 		}
 		resendMany(toResend, 10, true);
 
-		mtpBuffer update(from - start);
+		mtpBuffer update(mtpAcquireBuffer(from - start));
 		if (from > start) memcpy(update.data(), start, (from - start) * sizeof(mtpPrime));
 		
 		QWriteLocker locker(sessionData->haveReceivedMutex());
@@ -2761,14 +2847,16 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 	case mtpc_ping: {
 		if (badTime) return 0;
 
-		MTPPing msg(from, end);
+		MTPPing msg;
+		if (mtpReadResult result = msg.tryRead(from, end)) return _handleReadFailed(result, cons);
 		DEBUG_LOG(("Message Info: ping received, ping_id: %1, sending pong..").arg(msg.vping_id.v));
 
 		emit sendPongAsync(msgId, msg.vping_id.v);
 	} return 1;
 
 	case mtpc_pong: {
-		MTPPong msg(from, end);
+		MTPPong msg;
+		if (mtpReadResult result = msg.tryRead(from, end)) return _handleReadFailed(result, cons);
 		const MTPDpong &data(msg.c_pong());
 		DEBUG_LOG(("Message Info: pong received, msg_id: %1, ping_id: %2").arg(data.vmsg_id.v).arg(data.vping_id.v));
 		
@@ -2795,16 +2883,12 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 
 	}
 
-	} catch (Exception &e) {
-		return -1;
-	}
-
 	if (badTime) {
 		DEBUG_LOG(("Message Error: bad time in updates cons, must create new session"));
 		return -2;
 	}
 
-	mtpBuffer update(end - from);
+	mtpBuffer update(mtpAcquireBuffer(end - from));
 	if (end > from) memcpy(update.data(), from, (end - from) * sizeof(mtpPrime));
 		
 	QWriteLocker locker(sessionData->haveReceivedMutex());
@@ -2820,11 +2904,15 @@ int32 MTProtoConnectionPrivate::handleOneReceived(const mtpPrime *from, const mt
 }
 
 mtpBuffer MTProtoConnectionPrivate::ungzip(const mtpPrime *from, const mtpPrime *end) const {
-	MTPstring packed(from, end); // read packed string as serialized mtp string type
-	uint32 packedLen = packed.c_string().v.size(), unpackedChunk = packedLen, unpackedLen = 0;
-
 	mtpBuffer result; // * 4 because of mtpPrime type
 	result.resize(0);
+
+	MTPstring packed; // read packed string as serialized mtp string type
+	if (packed.tryRead(from, end) != mtpReadDone) {
+		LOG(("RPC Error: could not read gzip packed data"));
+		return result;
+	}
+	uint32 packedLen = packed.c_string().v.size(), unpackedChunk = packedLen, unpackedLen = 0;
 	z_stream stream;
 	stream.zalloc = 0;
 	stream.zfree = 0;
@@ -3669,35 +3757,35 @@ template <typename TResponse>
 bool MTProtoConnectionPrivate::readResponseNotSecure(TResponse &response) {
 	onReceivedSome();
 
-	try {
-		if (_conn->received().isEmpty()) {
-			LOG(("AuthKey Error: trying to read response from empty received list"));
-			return false;
-		}
-		mtpBuffer buffer(_conn->received().front());
-		_conn->received().pop_front();
+	if (_conn->received().isEmpty()) {
+		LOG(("AuthKey Error: trying to read response from empty received list"));
+		return false;
+	}
+	mtpBuffer buffer(_conn->received().front());
+	_conn->received().pop_front();
 
-		const mtpPrime *answer(buffer.constData());
-		uint32 len = buffer.size();
-		if (len < 5) {
-			LOG(("AuthKey Error: bad request answer, len = %1").arg(len * sizeof(mtpPrime)));
-			DEBUG_LOG(("AuthKey Error: answer bytes %1").arg(mb(answer, len * sizeof(mtpPrime)).str()));
-			return false;
-		}
-		if (answer[0] != 0 || answer[1] != 0 || (((uint32)answer[2]) & 0x03) != 1/* || (unixtime() - answer[3] > 300) || (answer[3] - unixtime() > 60)*/) { // didnt sync time yet
-			LOG(("AuthKey Error: bad request answer start (%1 %2 %3)").arg(answer[0]).arg(answer[1]).arg(answer[2]));
-			DEBUG_LOG(("AuthKey Error: answer bytes %1").arg(mb(answer, len * sizeof(mtpPrime)).str()));
-			return false;
-		}
-		uint32 answerLen = (uint32)answer[4];
-		if (answerLen != (len - 5) * sizeof(mtpPrime)) {
-			LOG(("AuthKey Error: bad request answer %1 <> %2").arg(answerLen).arg((len - 5) * sizeof(mtpPrime)));
-			DEBUG_LOG(("AuthKey Error: answer bytes %1").arg(mb(answer, len * sizeof(mtpPrime)).str()));
-			return false;
-		}
-		const mtpPrime *from(answer + 5), *end(from + len - 5);
-		response.read(from, end);
-	} catch (Exception &e) {
+	const mtpPrime *answer(buffer.constData());
+	uint32 len = buffer.size();
+	if (len < 5) {
+		LOG(("AuthKey Error: bad request answer, len = %1").arg(len * sizeof(mtpPrime)));
+		DEBUG_LOG(("AuthKey Error: answer bytes %1").arg(mb(answer, len * sizeof(mtpPrime)).str()));
+		return false;
+	}
+	if (answer[0] != 0 || answer[1] != 0 || (((uint32)answer[2]) & 0x03) != 1/* || (unixtime() - answer[3] > 300) || (answer[3] - unixtime() > 60)*/) { // didnt sync time yet
+		LOG(("AuthKey Error: bad request answer start (%1 %2 %3)").arg(answer[0]).arg(answer[1]).arg(answer[2]));
+		DEBUG_LOG(("AuthKey Error: answer bytes %1").arg(mb(answer, len * sizeof(mtpPrime)).str()));
+		return false;
+	}
+	uint32 answerLen = (uint32)answer[4];
+	if (answerLen != (len - 5) * sizeof(mtpPrime)) {
+		LOG(("AuthKey Error: bad request answer %1 <> %2").arg(answerLen).arg((len - 5) * sizeof(mtpPrime)));
+		DEBUG_LOG(("AuthKey Error: answer bytes %1").arg(mb(answer, len * sizeof(mtpPrime)).str()));
+		return false;
+	}
+	const mtpPrime *from(answer + 5), *end(from + len - 5);
+	if (response.tryRead(from, end) != mtpReadDone) {
+		LOG(("AuthKey Error: could not parse request answer"));
+		DEBUG_LOG(("AuthKey Error: answer bytes %1").arg(mb(answer, len * sizeof(mtpPrime)).str()));
 		return false;
 	}
 	return true;
@@ -3735,7 +3823,7 @@ bool MTProtoConnectionPrivate::sendRequest(mtpRequest &request, bool needAnyResp
 	memcpy(request->data() + 2, &session, 2 * sizeof(mtpPrime));
 
 	const mtpPrime *from = request->constData() + 4;
-	MTP_LOG(dc, ("Send: ") + mtpTextSerialize(from, from + messageSize));
+	MTP_LOG_DATA(dc, "Send: ", from, from + messageSize);
 
 	uchar encryptedSHA[20];
 	MTPint128 &msgKey(*(MTPint128*)(encryptedSHA + 4));
@@ -83,6 +83,13 @@ inline bool mtpRequestData::needAckByType(mtpTypeId type) {
 	return true;
 }
 
+struct mtpBuffersStats { // received packet buffers pool counters
+	int32 allocated, reused, released, dropped, pooled;
+};
+mtpBuffer mtpAcquireBuffer(uint32 size); // buffer of size ints for a received packet, reuses a released buffer if possible
+void mtpReleaseBuffer(mtpBuffer &buffer); // buffer is returned to the pool if it is not shared, cleared anyway
+mtpBuffersStats mtpGetBuffersStats();
+
 class MTProtoConnectionPrivate;
 class MTPSessionData;
 
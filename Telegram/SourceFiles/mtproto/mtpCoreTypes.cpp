@@ -18,6 +18,46 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 #include "stdafx.h"
 #include "mtpCoreTypes.h"
 
+void mtpArena::grow(uint32 size) {
+	uint32 blockSize = qMax(size, uint32(MTPArenaBlockSize));
+	_current = new char[blockSize];
+	_left = blockSize;
+	_blocks.push_back(_current);
+}
+
+void mtpArena::clear() {
+	for (QVector<char*>::const_iterator i = _blocks.cbegin(), e = _blocks.cend(); i != e; ++i) {
+		delete[] *i;
+	}
+	_blocks.clear();
+	_current = 0;
+	_left = _allocations = _size = 0;
+}
+
+namespace {
+	struct ViewParseStats {
+		ViewParseStats() : count(0), ns(0), allocations(0), blocks(0) {
+		}
+		uint32 count;
+		uint64 ns, allocations, blocks;
+	};
+	typedef QMap<mtpTypeId, ViewParseStats> ViewParseStatsMap;
+	ViewParseStatsMap viewParseStats;
+	QMutex viewParseStatsLock;
+}
+
+void mtpViewParsed(mtpTypeId type, qint64 ns, const mtpArena &arena) {
+	if (!cDebug()) return;
+
+	QMutexLocker lock(&viewParseStatsLock);
+	ViewParseStats &stats(viewParseStats[type]);
+	++stats.count;
+	stats.ns += ns;
+	stats.allocations += arena.allocations();
+	stats.blocks += arena.blocks();
+	DEBUG_LOG(("MTP View: parsed 0x%1 in %2ms, %3 views in %4 arena blocks (%5 bytes), total %6 responses in %7ms with %8 views in %9 blocks").arg(type, 0, 16).arg(ns / 1000000., 0, 'f', 3).arg(arena.allocations()).arg(arena.blocks()).arg(arena.size()).arg(stats.count).arg(stats.ns / 1000000., 0, 'f', 3).arg(stats.allocations).arg(stats.blocks));
+}
+
 #if defined _DEBUG || defined _WITH_DEBUG
 
 QString mtpWrapNumber(float64 number) {
@@ -167,3 +207,153 @@ void mtpTextSerializeCore(MTPStringLogger &to, const mtpPrime *&from, const mtpP
 }
 
 #endif
+
+#ifdef _WITH_SELFTEST
+
+namespace {
+	struct ReadFuzzResult {
+		ReadFuzzResult() : result(mtpReadDone), viewResult(mtpReadDone), read(0), viewRead(0) {
+		}
+		bool operator==(const ReadFuzzResult &other) const {
+			return (result == other.result) && (viewResult == other.viewResult) && (read == other.read) && (viewRead == other.viewRead) && (written == other.written);
+		}
+		mtpReadResult result, viewResult;
+		int32 read, viewRead; // primes read by the refcounted type and the view
+		mtpBuffer written; // the refcounted value written back if it was read
+	};
+
+	template <typename TType, typename TView>
+	bool _readFuzzRead(const mtpBuffer &buffer, mtpPrime guard, ReadFuzzResult &result, QString &error) { // false if tryRead() threw or moved outside of the buffer
+		// the buffer is followed by the guard primes, a parser that reads them gives different results for different guards
+		const int32 guardSize = 64;
+		mtpBuffer guarded(buffer);
+		guarded.resize(buffer.size() + guardSize);
+		for (int32 i = buffer.size(), l = guarded.size(); i < l; ++i) {
+			guarded[i] = guard;
+		}
+
+		const mtpPrime *start = guarded.constData(), *end = start + buffer.size();
+		try {
+			TType value;
+			const mtpPrime *from = start;
+			result.result = value.tryRead(from, end);
+			if (from < start || from > end) {
+				error = qsl("was read past the end");
+				return false;
+			}
+			result.read = from - start;
+			result.written.clear();
+			if (result.result == mtpReadDone) value.write(result.written);
+
+			mtpArena arena;
+			TView view;
+			from = start;
+			result.viewResult = view.tryRead(from, end, arena);
+			if (from < start || from > end) {
+				error = qsl("view was read past the end");
+				return false;
+			}
+			result.viewRead = from - start;
+		} catch (Exception &e) {
+			error = qsl("tryRead() has thrown: %1").arg(e.what());
+			return false;
+		}
+		return true;
+	}
+
+	template <typename TType, typename TView>
+	bool _readFuzzCheck(const mtpBuffer &buffer, ReadFuzzResult &result, QString &error) { // reads with two different guards, the results must be the same
+		ReadFuzzResult other;
+		if (!_readFuzzRead<TType, TView>(buffer, 0, result, error) || !_readFuzzRead<TType, TView>(buffer, mtpc_vector, other, error)) return false;
+		if (!(result == other)) {
+			error = qsl("depends on the data after the end");
+			return false;
+		}
+		return true;
+	}
+
+	template <typename TType, typename TView>
+	bool _readFuzzTest(const TType &sample, const char *name) {
+		mtpBuffer buffer;
+		sample.write(buffer);
+
+		ReadFuzzResult read;
+		QString error;
+		if (!_readFuzzCheck<TType, TView>(buffer, read, error)) {
+			LOG(("Test Error: complete %1 %2").arg(name).arg(error));
+			return false;
+		}
+		if (read.result != mtpReadDone || read.viewResult != mtpReadDone || read.read != buffer.size() || read.viewRead != buffer.size() || read.written != buffer) {
+			LOG(("Test Error: could not read a complete %1").arg(name));
+			return false;
+		}
+
+		for (int32 size = 0, l = buffer.size(); size < l; ++size) { // every truncated buffer must be reported as insufficient
+			if (!_readFuzzCheck<TType, TView>(buffer.mid(0, size), read, error)) {
+				LOG(("Test Error: %1 truncated to %2 of %3 primes %4").arg(name).arg(size).arg(l).arg(error));
+				return false;
+			}
+			if (read.result != mtpReadInsufficient || read.viewResult != mtpReadInsufficient) {
+				LOG(("Test Error: %1 truncated to %2 of %3 primes was read with results %4 and %5").arg(name).arg(size).arg(l).arg(read.result).arg(read.viewResult));
+				return false;
+			}
+		}
+
+		mtpBuffer corrupted(buffer);
+		corrupted[0] = 0; // no type has zero id
+		if (!_readFuzzCheck<TType, TView>(corrupted, read, error)) {
+			LOG(("Test Error: %1 with a wrong type id %2").arg(name).arg(error));
+			return false;
+		}
+		if (read.result != mtpReadUnexpected || read.viewResult != mtpReadUnexpected) {
+			LOG(("Test Error: %1 with a wrong type id was read with results %2 and %3").arg(name).arg(read.result).arg(read.viewResult));
+			return false;
+		}
+
+		const int32 iterations = 2000;
+		for (int32 i = 0; i < iterations; ++i) { // mutated buffers may be read or not, but never past the end
+			mtpBuffer mutated(buffer);
+			for (int32 j = 0, changes = 1 + (qrand() % 4); j < changes; ++j) {
+				mtpPrime &prime(mutated[qrand() % mutated.size()]);
+				switch (qrand() % 3) {
+				case 0: prime ^= (1 << (qrand() % 32)); break;
+				case 1: prime = qrand(); break;
+				case 2: prime = -1 - (qrand() % 4); break; // huge lengths and counts
+				}
+			}
+			if (qrand() % 2) mutated.resize(qrand() % (mutated.size() + 1));
+
+			if (!_readFuzzCheck<TType, TView>(mutated, read, error)) {
+				LOG(("Test Error: mutated %1 %2, iteration %3").arg(name).arg(error).arg(i));
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+bool mtpReadFuzzTest() {
+	qsrand(0x5EED); // fixed seed, so the failures are reproducible
+
+	MTPFileLocation location(MTP_fileLocation(MTP_int(2), MTP_long(0x123456789LL), MTP_int(77), MTP_long(-5)));
+	MTPUser user(MTP_user(MTP_int(0x7F | (1 << 14)), MTP_int(101), MTP_long(0xABCDEFLL), MTP_string("First"), MTP_string("Last name that is longer than a few primes"), MTP_string("username"), MTP_string("79001234567"), MTP_userProfilePhoto(MTP_long(5), location, location), MTP_userStatusOnline(MTP_int(1400000000)), MTP_int(3)));
+	MTPChat chat(MTP_chat(MTP_int(202), MTP_string("Chat title"), MTP_chatPhoto(location, location), MTP_int(5), MTP_int(1400000000), MTP_bool(false), MTP_int(1)));
+	MTPDialog dialog(MTP_dialog(MTP_peerUser(MTP_int(101)), MTP_int(10), MTP_int(9), MTP_int(1), MTP_peerNotifySettings(MTP_int(0), MTP_string("default"), MTP_bool(true), MTP_int(0))));
+
+	MTPVector<MTPUser> users(MTP_vector<MTPUser>(2, user));
+	MTPVector<MTPChat> chats(MTP_vector<MTPChat>(1, chat));
+	MTPVector<MTPMessage> messages(MTP_vector<MTPMessage>(2, MTP_messageEmpty(MTP_int(10))));
+	MTPVector<MTPEncryptedMessage> encrypted(MTP_vector<MTPEncryptedMessage>(1, MTP_encryptedMessageService(MTP_long(1), MTP_int(3), MTP_int(1400000000), MTP_string("encrypted bytes"))));
+	MTPVector<MTPUpdate> updates(MTP_vector<MTPUpdate>(1, MTP_updateUserTyping(MTP_int(101), MTP_sendMessageTypingAction())));
+
+	bool result = true;
+	result = _readFuzzTest<MTPmessages_Dialogs, MTPmessages_DialogsView>(MTP_messages_dialogsSlice(MTP_int(100), MTP_vector<MTPDialog>(3, dialog), messages, chats, users), "messages.dialogsSlice") && result;
+	result = _readFuzzTest<MTPupdates_Difference, MTPupdates_DifferenceView>(MTP_updates_differenceSlice(messages, encrypted, updates, chats, users, MTP_updates_state(MTP_int(1), MTP_int(2), MTP_int(3), MTP_int(4), MTP_int(5))), "updates.differenceSlice") && result;
+	result = _readFuzzTest<MTPMsgsAck, MTPMsgsAckView>(MTP_msgs_ack(MTP_vector<MTPlong>(4, MTP_long(0x5555000000000001LL))), "msgs_ack") && result;
+	result = _readFuzzTest<MTPMsgDetailedInfo, MTPMsgDetailedInfoView>(MTP_msg_detailed_info(MTP_long(1), MTP_long(2), MTP_int(16), MTP_int(0)), "msg_detailed_info") && result;
+	result = _readFuzzTest<MTPNewSession, MTPNewSessionView>(MTP_new_session_created(MTP_long(1), MTP_long(2), MTP_long(3)), "new_session_created") && result;
+	result = _readFuzzTest<MTPBadMsgNotification, MTPBadMsgNotificationView>(MTP_bad_server_salt(MTP_long(1), MTP_int(2), MTP_int(48), MTP_long(3)), "bad_server_salt") && result;
+	return result;
+}
+
+#endif
@@ -240,6 +240,17 @@ public:
 	}
 };
 
+enum mtpReadResult { // result of the non-throwing tryRead() methods
+	mtpReadDone = 0,
+	mtpReadInsufficient, // truncated input
+	mtpReadUnexpected, // unexpected type id in input
+};
+
+inline void mtpReadFailed(mtpReadResult result, mtpTypeId cons, const char *type) { // throwing read() wrappers report tryRead() failures here
+	if (result == mtpReadInsufficient) throw mtpErrorInsufficient();
+	throw mtpErrorUnexpected(cons, type);
+}
+
 class mtpData {
 public:
 	mtpData() : cnt(1) {
@@ -398,6 +409,11 @@ public:
 		cons = (mtpTypeId)*(from++);
 		bareT::read(from, end, cons);
 	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = 0) {
+		if (from + 1 > end) return mtpReadInsufficient;
+		cons = (mtpTypeId)*(from++);
+		return bareT::tryRead(from, end, cons);
+	}
 	void write(mtpBuffer &to) const {
         to.push_back(bareT::type());
 		bareT::write(to);
@@ -425,9 +441,14 @@ public:
 		return mtpc_int;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_int) {
-		if (from + 1 > end) throw mtpErrorInsufficient();
-		if (cons != mtpc_int) throw mtpErrorUnexpected(cons, "MTPint");
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPint");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_int) {
+		if (from + 1 > end) return mtpReadInsufficient;
+		if (cons != mtpc_int) return mtpReadUnexpected;
 		v = (int32)*(from++);
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		to.push_back((mtpPrime)v);
@@ -468,10 +489,15 @@ public:
 		return mtpc_long;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_long) {
-		if (from + 2 > end) throw mtpErrorInsufficient();
-		if (cons != mtpc_long) throw mtpErrorUnexpected(cons, "MTPlong");
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPlong");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_long) {
+		if (from + 2 > end) return mtpReadInsufficient;
+		if (cons != mtpc_long) return mtpReadUnexpected;
 		v = (uint64)(((uint32*)from)[0]) | ((uint64)(((uint32*)from)[1]) << 32);
 		from += 2;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		to.push_back((mtpPrime)(v & 0xFFFFFFFFL));
@@ -514,11 +540,16 @@ public:
 		return mtpc_int128;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_int128) {
-		if (from + 4 > end) throw mtpErrorInsufficient();
-		if (cons != mtpc_int128) throw mtpErrorUnexpected(cons, "MTPint128");
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPint128");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_int128) {
+		if (from + 4 > end) return mtpReadInsufficient;
+		if (cons != mtpc_int128) return mtpReadUnexpected;
 		l = (uint64)(((uint32*)from)[0]) | ((uint64)(((uint32*)from)[1]) << 32);
 		h = (uint64)(((uint32*)from)[2]) | ((uint64)(((uint32*)from)[3]) << 32);
 		from += 4;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		to.push_back((mtpPrime)(l & 0xFFFFFFFFL));
@@ -563,9 +594,14 @@ public:
 		return mtpc_int256;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_int256) {
-		if (cons != mtpc_int256) throw mtpErrorUnexpected(cons, "MTPint256");
-		l.read(from, end);
-		h.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPint256");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_int256) {
+		if (cons != mtpc_int256) return mtpReadUnexpected;
+		if (mtpReadResult result = l.tryRead(from, end)) return result;
+		if (mtpReadResult result = h.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		l.write(to);
@@ -607,10 +643,15 @@ public:
 		return mtpc_double;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_double) {
-		if (from + 2 > end) throw mtpErrorInsufficient();
-		if (cons != mtpc_double) throw mtpErrorUnexpected(cons, "MTPdouble");
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPdouble");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_double) {
+		if (from + 2 > end) return mtpReadInsufficient;
+		if (cons != mtpc_double) return mtpReadUnexpected;
 		*(uint64*)(&v) = (uint64)(((uint32*)from)[0]) | ((uint64)(((uint32*)from)[1]) << 32);
 		from += 2;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		uint64 iv = *(uint64*)(&v);
@@ -685,8 +726,12 @@ public:
 		return mtpc_string;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_string) {
-		if (from + 1 > end) throw mtpErrorInsufficient();
-		if (cons != mtpc_string) throw mtpErrorUnexpected(cons, "MTPstring");
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPstring");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_string) {
+		if (from + 1 > end) return mtpReadInsufficient;
+		if (cons != mtpc_string) return mtpReadUnexpected;
 
 		uint32 l;
 		const uchar *buf = (const uchar*)from;
@@ -699,12 +744,13 @@ public:
 			++buf;
 			from += ((l + 1) >> 2) + (((l + 1) & 0x03) ? 1 : 0);
 		}
-		if (from > end) throw mtpErrorInsufficient();
+		if (from > end) return mtpReadInsufficient;
 		
 		if (!data) setData(new MTPDstring());
 		MTPDstring &v(_string());
 		v.v.resize(l);
 		memcpy(&v.v[0], buf, l);
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		uint32 l = c_string().v.length(), s = l + ((l < 254) ? 1 : 4), was = to.size();
@@ -785,12 +831,17 @@ public:
 	mtpTypeId type() const {
 		return v ? mtpc_boolTrue : mtpc_boolFalse;
 	}
-	void read(const mtpPrime *& /*from*/, const mtpPrime * /*end*/, mtpTypeId cons) {
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPbool");
+	}
+	mtpReadResult tryRead(const mtpPrime *& /*from*/, const mtpPrime * /*end*/, mtpTypeId cons) {
 		switch (cons) {
 			case mtpc_boolFalse: v = false; break;
 			case mtpc_boolTrue: v = true; break;
-			default: throw mtpErrorUnexpected(cons, "MTPbool");
+			default: return mtpReadUnexpected;
 		}
+		return mtpReadDone;
 	}
 	void write(mtpBuffer & /*to*/) const {
 	}
@@ -878,17 +929,25 @@ public:
 		return mtpc_vector;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_vector) {
-		if (from + 1 > end) throw mtpErrorInsufficient();
-		if (cons != mtpc_vector) throw mtpErrorUnexpected(cons, "MTPvector");
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPvector");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_vector) {
+		if (from + 1 > end) return mtpReadInsufficient;
+		if (cons != mtpc_vector) return mtpReadUnexpected;
 		uint32 count = (uint32)*(from++);
+		if (count > uint32(end - from)) return mtpReadInsufficient; // each element takes at least one prime
 
 		if (!data) setData(new MTPDvector<T>());
 		MTPDvector<T> &v(_vector());
 		v.v.resize(0);
 		v.v.reserve(count);
 		for (uint32 i = 0; i < count; ++i) {
-			v.v.push_back(T(from, end));
+			T item;
+			if (mtpReadResult result = item.tryRead(from, end)) return result;
+			v.v.push_back(item);
 		}
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		to.push_back(c_vector().v.size());
@@ -942,6 +1001,231 @@ inline bool operator!=(const MTPvector<T> &a, const MTPvector<T> &b) {
 	return a.c_vector().v != b.c_vector().v;
 }
 
+// Read-only views of parsed responses, generated for each type as MTP*View
+// All the view data lives in one mtpArena per response and strings point right
+// into the response buffer, so both must outlive the views that were read from them
+
+class mtpArena {
+public:
+	mtpArena() : _current(0), _left(0), _allocations(0), _size(0) {
+	}
+
+	void *alloc(uint32 size) {
+		size = (size + 7) & ~7U;
+		if (size > _left) grow(size);
+
+		char *result = _current;
+		_current += size;
+		_left -= size;
+		_size += size;
+		++_allocations;
+		return result;
+	}
+
+	template <typename T>
+	T *alloc(uint32 count) { // views hold no resources, so their destructors are never called
+		T *result = (T*)alloc(count * sizeof(T));
+		for (uint32 i = 0; i < count; ++i) {
+			new (result + i) T();
+		}
+		return result;
+	}
+
+	uint32 allocations() const {
+		return _allocations;
+	}
+	uint32 blocks() const {
+		return _blocks.size();
+	}
+	uint32 size() const {
+		return _size;
+	}
+
+	void clear();
+	~mtpArena() {
+		clear();
+	}
+
+private:
+	void grow(uint32 size);
+
+	QVector<char*> _blocks;
+	char *_current;
+	uint32 _left, _allocations, _size;
+
+	mtpArena(const mtpArena &);
+	mtpArena &operator=(const mtpArena &);
+};
+
+template <typename bareT>
+class MTPBoxedView : public bareT {
+public:
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = 0) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPBoxedView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = 0) {
+		if (from + 1 > end) return mtpReadInsufficient;
+		cons = (mtpTypeId)*(from++);
+		return bareT::tryRead(from, end, arena, cons);
+	}
+};
+
+// plain values are read as is, everything else needs the arena
+template <typename T>
+inline mtpReadResult mtpTryReadView(T &v, const mtpPrime *&from, const mtpPrime *end, mtpArena &arena) {
+	return v.tryRead(from, end, arena);
+}
+template <typename T>
+inline mtpReadResult mtpTryReadView(MTPBoxed<T> &v, const mtpPrime *&from, const mtpPrime *end, mtpArena &/*arena*/) {
+	return v.tryRead(from, end);
+}
+inline mtpReadResult mtpTryReadView(MTPint &v, const mtpPrime *&from, const mtpPrime *end, mtpArena &/*arena*/) {
+	return v.tryRead(from, end);
+}
+inline mtpReadResult mtpTryReadView(MTPlong &v, const mtpPrime *&from, const mtpPrime *end, mtpArena &/*arena*/) {
+	return v.tryRead(from, end);
+}
+inline mtpReadResult mtpTryReadView(MTPint128 &v, const mtpPrime *&from, const mtpPrime *end, mtpArena &/*arena*/) {
+	return v.tryRead(from, end);
+}
+inline mtpReadResult mtpTryReadView(MTPint256 &v, const mtpPrime *&from, const mtpPrime *end, mtpArena &/*arena*/) {
+	return v.tryRead(from, end);
+}
+inline mtpReadResult mtpTryReadView(MTPdouble &v, const mtpPrime *&from, const mtpPrime *end, mtpArena &/*arena*/) {
+	return v.tryRead(from, end);
+}
+
+class MTPstringView {
+public:
+	MTPstringView() : _data(0), _size(0) {
+	}
+
+	const char *data() const {
+		return _data;
+	}
+	uint32 size() const {
+		return _size;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_string;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_string) {
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPstringView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_string) {
+		if (from + 1 > end) return mtpReadInsufficient;
+		if (cons != mtpc_string) return mtpReadUnexpected;
+
+		const uchar *buf = (const uchar*)from;
+		if (buf[0] == 254) {
+			_size = (uint32)buf[1] + ((uint32)buf[2] << 8) + ((uint32)buf[3] << 16);
+			buf += 4;
+			from += ((_size + 4) >> 2) + (((_size + 4) & 0x03) ? 1 : 0);
+		} else {
+			_size = (uint32)buf[0];
+			++buf;
+			from += ((_size + 1) >> 2) + (((_size + 1) & 0x03) ? 1 : 0);
+		}
+		if (from > end) return mtpReadInsufficient;
+
+		_data = (const char*)buf;
+		return mtpReadDone;
+	}
+
+private:
+	const char *_data;
+	uint32 _size;
+};
+inline mtpReadResult mtpTryReadView(MTPstringView &v, const mtpPrime *&from, const mtpPrime *end, mtpArena &/*arena*/) {
+	return v.tryRead(from, end);
+}
+typedef MTPBoxed<MTPstringView> MTPStringView;
+
+typedef MTPstringView MTPbytesView;
+typedef MTPStringView MTPBytesView;
+
+inline QString qs(const MTPstringView &v) {
+	return QString::fromUtf8(v.data(), v.size());
+}
+
+inline QByteArray qba(const MTPstringView &v) {
+	return QByteArray(v.data(), v.size());
+}
+
+template <typename T>
+class MTPvectorView {
+public:
+	MTPvectorView() : _data(0), _count(0) {
+	}
+
+	typedef const T *const_iterator;
+	const_iterator cbegin() const {
+		return _data;
+	}
+	const_iterator cend() const {
+		return _data + _count;
+	}
+	const T &at(uint32 index) const {
+		return _data[index];
+	}
+	const T &operator[](uint32 index) const {
+		return _data[index];
+	}
+	uint32 size() const {
+		return _count;
+	}
+	bool isEmpty() const {
+		return !_count;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_vector;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_vector) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPvectorView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_vector) {
+		if (from + 1 > end) return mtpReadInsufficient;
+		if (cons != mtpc_vector) return mtpReadUnexpected;
+		uint32 count = (uint32)*(from++);
+		if (count > uint32(end - from)) return mtpReadInsufficient; // each element takes at least one prime
+
+		T *data = arena.alloc<T>(count);
+		for (uint32 i = 0; i < count; ++i) {
+			if (mtpReadResult result = mtpTryReadView(data[i], from, end, arena)) return result;
+		}
+		_data = data;
+		_count = count;
+		return mtpReadDone;
+	}
+
+private:
+	const T *_data;
+	uint32 _count;
+};
+template <typename T>
+class MTPVectorView : public MTPBoxedView<MTPvectorView<T> > {
+};
+
+void mtpViewParsed(mtpTypeId type, qint64 ns, const mtpArena &arena); // logs per response type statistics
+
+template <typename TView> // TView is a boxed view type, for example MTPmessages_DialogsView
+bool mtpParseView(TView &view, mtpArena &arena, const mtpPrime *from, const mtpPrime *end) { // returns false on a malformed response
+	QElapsedTimer timer;
+	timer.start();
+	if (view.tryRead(from, end, arena) != mtpReadDone) return false;
+	mtpViewParsed(view.type(), timer.nsecsElapsed(), arena);
+	return true;
+}
+
+#ifdef _WITH_SELFTEST
+bool mtpReadFuzzTest(); // reads truncated, corrupted and mutated responses with tryRead, see -selftest
+#endif
+
 // Human-readable text serialization
 #if (defined _DEBUG || defined _WITH_DEBUG)
 
@@ -33,19 +33,57 @@ namespace {
 	QMap<int32, DataRequested> _dataRequested;
 }
 struct mtpFileLoaderQueue {
-	mtpFileLoaderQueue() : queries(0), start(0), end(0) {
+	mtpFileLoaderQueue() : queries(0), limit(MaxFileQueries), partSize(DocumentDownloadPartSize), start(0), end(0),
+	periodStart(0), periodReceived(0), periodRtt(0), throughput(0), rtt(0) {
 	}
-	int32 queries;
+	int32 queries, limit; // in flight and allowed in flight
+	int32 partSize; // for documents
 	mtpFileLoader *start, *end;
+
+	uint64 periodStart;
+	int64 periodReceived;
+	int32 periodRtt; // min rtt in the current period
+	float64 throughput; // bytes per ms
+	int32 rtt;
 };
 
 namespace {
 	typedef QMap<int32, mtpFileLoaderQueue> LoaderQueues;
 	LoaderQueues queues;
+
+	void _queuePartLoaded(mtpFileLoaderQueue *queue, int32 bytes, int32 rtt) {
+		uint64 ms = getms();
+		if (!queue->periodStart) {
+			queue->periodStart = ms;
+		}
+		queue->periodReceived += bytes;
+		if (!queue->periodRtt || rtt < queue->periodRtt) {
+			queue->periodRtt = qMax(rtt, 1);
+		}
+
+		int32 elapsed = int32(ms - queue->periodStart);
+		if (elapsed < DownloadStatsPeriod) return;
+
+		float64 rate = float64(queue->periodReceived) / elapsed;
+		queue->throughput = (queue->throughput > 0) ? ((queue->throughput * 3 + rate) / 4) : rate;
+		queue->rtt = queue->periodRtt; // min rtt is taken so that the queued requests don't inflate the window
+		queue->periodStart = ms;
+		queue->periodReceived = 0;
+		queue->periodRtt = 0;
+
+		float64 window = 2 * queue->throughput * queue->rtt;
+		int32 partSize = DocumentDownloadPartSize;
+		while (partSize < DocumentDownloadPartSizeMax && window > float64(partSize) * MaxFileQueries) {
+			partSize *= 2;
+		}
+		queue->partSize = partSize;
+		queue->limit = qMax(qMin(int32(window / partSize) + 1, int32(MaxFileQueriesAdaptive)), int32(MinFileQueries));
+		DEBUG_LOG(("Download Info: throughput %1 kb/s, rtt %2 ms, part size %3 kb, %4 parts in flight").arg(int32(queue->throughput * 1000 / 1024)).arg(queue->rtt).arg(queue->partSize / 1024).arg(queue->limit));
+	}
 }
 
 mtpFileLoader::mtpFileLoader(int32 dc, const uint64 &volume, int32 local, const uint64 &secret, int32 size) : prev(0), next(0),
-priority(0), inQueue(false), complete(false), triedLocal(false), skippedBytes(0), nextRequestOffset(0), lastComplete(false),
+priority(0), inQueue(false), complete(false), triedLocal(false), localTaskId(0), startedAt(0), received(0), skippedBytes(0), nextRequestOffset(0), lastComplete(false),
 dc(dc), locationType(0), volume(volume), local(local), secret(secret),
 id(0), access(0), fileIsOpen(false), size(size), type(mtpc_storage_fileUnknown) {
 	LoaderQueues::iterator i = queues.find(dc);
@@ -56,7 +94,7 @@ id(0), access(0), fileIsOpen(false), size(size), type(mtpc_storage_fileUnknown)
 }
 
 mtpFileLoader::mtpFileLoader(int32 dc, const uint64 &id, const uint64 &access, mtpTypeId locType, const QString &to, int32 size) : prev(0), next(0),
-priority(0), inQueue(false), complete(false), triedLocal(false), skippedBytes(0), nextRequestOffset(0), lastComplete(false),
+priority(0), inQueue(false), complete(false), triedLocal(false), localTaskId(0), startedAt(0), received(0), skippedBytes(0), nextRequestOffset(0), lastComplete(false),
 dc(dc), locationType(locType), volume(0), local(0), secret(0),
 id(id), access(access), file(to), fname(to), fileIsOpen(false), duplicateInData(false), size(size), type(mtpc_storage_fileUnknown) {
 	LoaderQueues::iterator i = queues.find(MTP::dld[0] + dc);
@@ -67,7 +105,7 @@ id(id), access(access), file(to), fname(to), fileIsOpen(false), duplicateInData(
 }
 
 mtpFileLoader::mtpFileLoader(int32 dc, const uint64 &id, const uint64 &access, mtpTypeId locType, const QString &to, int32 size, bool todata) : prev(0), next(0),
-priority(0), inQueue(false), complete(false), triedLocal(false), skippedBytes(0), nextRequestOffset(0), lastComplete(false),
+priority(0), inQueue(false), complete(false), triedLocal(false), localTaskId(0), startedAt(0), received(0), skippedBytes(0), nextRequestOffset(0), lastComplete(false),
 dc(dc), locationType(locType), volume(0), local(0), secret(0),
 id(id), access(access), file(to), fname(to), fileIsOpen(false), duplicateInData(todata), size(size), type(mtpc_storage_fileUnknown) {
 	LoaderQueues::iterator i = queues.find(MTP::dld[0] + dc);
@@ -117,11 +155,21 @@ uint64 mtpFileLoader::objId() const {
 	return id;
 }
 
+int64 mtpFileLoader::receivedBytes() const {
+	return received;
+}
+
+float64 mtpFileLoader::throughput() const {
+	if (!startedAt) return 0;
+	uint64 ms = getms();
+	return (ms > startedAt) ? (float64(received) * 1000 / (ms - startedAt)) : 0;
+}
+
 void mtpFileLoader::loadNext() {
-	if (queue->queries >= MaxFileQueries) return;
+	if (queue->queries >= queue->limit) return;
 	for (mtpFileLoader *i = queue->start; i;) {
 		if (i->loadPart()) {
-			if (queue->queries >= MaxFileQueries) return;
+			if (queue->queries >= queue->limit) return;
 		} else {
 			i = i->next;
 		}
@@ -138,6 +186,10 @@ void mtpFileLoader::finishFail() {
 		fileIsOpen = false;
 		file.remove();
 	}
+	if (downloadState.partSize) {
+		Local::removeDownloadState(mediaKey(mtpToLocationType(locationType), dc, id));
+		downloadState = FileDownloadState();
+	}
 	data = QByteArray();
 	emit failed(this, started);
 	file.setFileName(fname = QString());
@@ -145,10 +197,13 @@ void mtpFileLoader::finishFail() {
 }
 
 bool mtpFileLoader::loadPart() {
-	if (complete || lastComplete || (!requests.isEmpty() && !size)) return false;
+	if (complete || lastComplete || localTaskId || (!requests.isEmpty() && !size)) return false;
 	if (size && nextRequestOffset >= size) return false;
 
-	int32 limit = DocumentDownloadPartSize;
+	int32 limit = queue->partSize;
+	while (limit > DocumentDownloadPartSize && (nextRequestOffset % limit)) { // offset must be divisible by the part size
+		limit /= 2;
+	}
 	MTPInputFileLocation loc;
 	switch (locationType) {
 	case 0: loc = MTP_inputFileLocation(MTP_long(volume), MTP_int(local), MTP_long(secret)); limit = DownloadPartSize; break;
@@ -175,10 +230,16 @@ bool mtpFileLoader::loadPart() {
 
 	mtpRequestId reqId = MTP::send(MTPupload_GetFile(MTPupload_getFile(loc, MTP_int(offset), MTP_int(limit))), rpcDone(&mtpFileLoader::partLoaded, offset), rpcFail(&mtpFileLoader::partFailed), MTP::dld[dcIndex] + dc, 50);
 
+	if (!queue->queries) { // the period counts only the time with requests in flight, not the idle time before
+		queue->periodStart = getms();
+		queue->periodReceived = 0;
+		queue->periodRtt = 0;
+	}
 	++queue->queries;
 	dr.v[dcIndex] += limit;
-	requests.insert(reqId, dcIndex);
+	requests.insert(reqId, Request(dcIndex, limit));
 	nextRequestOffset += limit;
+	if (!startedAt) startedAt = getms();
 
 	return true;
 }
@@ -188,15 +249,16 @@ void mtpFileLoader::partLoaded(int32 offset, const MTPupload_File &result, mtpRe
 	Requests::iterator i = requests.find(req);
 	if (i == requests.cend()) return loadNext();
 
-	int32 limit = locationType ? DocumentDownloadPartSize : DownloadPartSize;
-	int32 dcIndex = i.value();
-	_dataRequested[dc].v[dcIndex] -= limit;
+	Request request(i.value());
+	_dataRequested[dc].v[request.dcIndex] -= request.limit;
 
 	--queue->queries;
 	requests.erase(i);
 
 	const MTPDupload_file &d(result.c_upload_file());
 	const string &bytes(d.vbytes.c_string().v);
+	received += bytes.size();
+	_queuePartLoaded(queue, bytes.size(), int32(getms() - request.sent));
 	if (bytes.size()) {
 		if (fileIsOpen) {
 			int64 fsize = file.size();
@@ -209,6 +271,12 @@ void mtpFileLoader::partLoaded(int32 offset, const MTPupload_File &result, mtpRe
 			if (file.write(bytes.data(), bytes.size()) != qint64(bytes.size())) {
 				return finishFail();
 			}
+			if (downloadState.partSize && !(offset % downloadState.partSize)) {
+				for (int32 part = offset; part < offset + int32(bytes.size()); part += downloadState.partSize) {
+					downloadState.setPart(part / downloadState.partSize);
+				}
+				Local::writeDownloadState(mediaKey(mtpToLocationType(locationType), dc, id), downloadState);
+			}
 		} else {
 			data.reserve(offset + bytes.size());
 			if (offset > data.size()) {
@@ -241,11 +309,16 @@ void mtpFileLoader::partLoaded(int32 offset, const MTPupload_File &result, mtpRe
 		}
 		type = d.vtype.type();
 		complete = true;
+		if (locationType) DEBUG_LOG(("Download Info: loaded %1 bytes, %2 kb/s").arg(received).arg(int32(throughput() / 1024)));
 		if (fileIsOpen) {
 			file.close();
 			fileIsOpen = false;
 			psPostprocessFile(QFileInfo(file).absoluteFilePath());
 		}
+		if (downloadState.partSize) {
+			Local::removeDownloadState(mediaKey(mtpToLocationType(locationType), dc, id));
+			downloadState = FileDownloadState();
+		}
 		removeFromQueue();
 
 		emit App::wnd()->imageLoaded();
@@ -303,16 +376,72 @@ void mtpFileLoader::pause() {
 	removeFromQueue();
 }
 
+void mtpFileLoader::localLoaded(const StorageImageSaved &result) {
+	localTaskId = 0;
+	if (result.type == StorageFileUnknown || result.data.isEmpty() || complete) {
+		if (inQueue && queue->queries < queue->limit) loadPart();
+		return;
+	}
+
+	data = result.data;
+	type = mtpFromStorageType(result.type);
+	if (!fname.isEmpty() && duplicateInData) {
+		if (!fileIsOpen) fileIsOpen = file.open(QIODevice::WriteOnly);
+		if (!fileIsOpen) {
+			return finishFail();
+		}
+		if (file.write(data) != qint64(data.size())) {
+			return finishFail();
+		}
+	}
+	complete = true;
+	if (fileIsOpen) {
+		file.close();
+		fileIsOpen = false;
+		psPostprocessFile(QFileInfo(file).absoluteFilePath());
+	}
+	removeFromQueue();
+	emit App::wnd()->imageLoaded();
+	emit progress(this);
+	loadNext();
+}
+
+void mtpFileLoader::resumeDownload() {
+	if (!locationType || size <= 0 || nextRequestOffset || !requests.isEmpty()) return;
+
+	MediaKey key(mediaKey(mtpToLocationType(locationType), dc, id));
+	FileDownloadState state(Local::readDownloadState(key));
+
+	// partial file is continued only if we download to it again, a file saved with another name starts from scratch
+	bool sameFile = !state.name.isEmpty() && (state.name == fname);
+	int32 offset = state.contiguousSize();
+	if (sameFile && state.size == size && state.partSize == DocumentDownloadPartSize && offset > 0 && offset < size) {
+		QFile partial(state.name);
+		if (partial.open(QIODevice::ReadWrite) && partial.resize(offset)) {
+			partial.close();
+
+			file.setFileName(fname);
+			fileIsOpen = file.open(QIODevice::ReadWrite);
+			if (fileIsOpen) {
+				DEBUG_LOG(("Download Info: resuming %1 from offset %2 of %3").arg(fname).arg(offset).arg(size));
+				downloadState = FileDownloadState(fname, size, DocumentDownloadPartSize);
+				for (int32 i = 0, l = offset / DocumentDownloadPartSize; i < l; ++i) {
+					downloadState.setPart(i);
+				}
+				nextRequestOffset = offset;
+				return;
+			}
+		}
+	}
+	downloadState = FileDownloadState(fname, size, DocumentDownloadPartSize);
+}
+
 void mtpFileLoader::start(bool loadFirst, bool prior) {
 	if (complete) return;
-	if (!triedLocal) {
+	if (!triedLocal) { // the loader is queued as usual, but does not request parts while the cache is read
 		if (!locationType) {
 			triedLocal = true;
-			StorageImageSaved cached = Local::readImage(storageKey(dc, volume, local));
-			if (cached.type != StorageFileUnknown) {
-				data = cached.data;
-				type = mtpFromStorageType(cached.type);
-			}
+			localTaskId = Local::startImageLoad(storageKey(dc, volume, local), this);
 		} else if (locationType) {
 			if (!fname.isEmpty()) {
 				triedLocal = true;
@@ -320,41 +449,22 @@ void mtpFileLoader::start(bool loadFirst, bool prior) {
 			if (duplicateInData) {
 				if (locationType == mtpc_inputDocumentFileLocation) {
 					triedLocal = true;
-					data = Local::readStickerImage(mediaKey(mtpToLocationType(locationType), dc, id));
-					if (!data.isEmpty()) type = mtpc_storage_filePartial;
+					localTaskId = Local::startStickerImageLoad(mediaKey(mtpToLocationType(locationType), dc, id), this);
 				} else if (locationType == mtpc_inputAudioFileLocation) {
 					triedLocal = true;
-					data = Local::readAudio(mediaKey(mtpToLocationType(locationType), dc, id));
-					if (!data.isEmpty()) type = mtpc_storage_filePartial;
-				}
-			}
-		}
-		if (triedLocal && !data.isEmpty()) {
-			if (!fname.isEmpty() && duplicateInData) {
-				if (!fileIsOpen) fileIsOpen = file.open(QIODevice::WriteOnly);
-				if (!fileIsOpen) {
-					return finishFail();
-				}
-				if (file.write(data) != qint64(data.size())) {
-					return finishFail();
+					localTaskId = Local::startAudioLoad(mediaKey(mtpToLocationType(locationType), dc, id), this);
 				}
 			}
-			complete = true;
-			if (fileIsOpen) {
-				file.close();
-				fileIsOpen = false;
-				psPostprocessFile(QFileInfo(file).absoluteFilePath());
-			}
-			emit App::wnd()->imageLoaded();
-			emit progress(this);
-			return loadNext();
 		}
 	}
 
 	if (!fname.isEmpty() && !duplicateInData && !fileIsOpen) {
-		fileIsOpen = file.open(QIODevice::WriteOnly);
+		resumeDownload();
 		if (!fileIsOpen) {
-			return finishFail();
+			fileIsOpen = file.open(QIODevice::WriteOnly);
+			if (!fileIsOpen) {
+				return finishFail();
+			}
 		}
 	}
 
@@ -447,6 +557,10 @@ void mtpFileLoader::start(bool loadFirst, bool prior) {
 }
 
 void mtpFileLoader::cancel() {
+	if (localTaskId) {
+		Local::cancelTask(localTaskId);
+		localTaskId = 0;
+	}
 	cancelRequests();
 	type = mtpc_storage_fileUnknown;
 	complete = true;
@@ -457,6 +571,10 @@ void mtpFileLoader::cancel() {
 	}
 	data = QByteArray();
 	file.setFileName(QString());
+	if (downloadState.partSize) {
+		Local::removeDownloadState(mediaKey(mtpToLocationType(locationType), dc, id));
+		downloadState = FileDownloadState();
+	}
 	emit progress(this);
 	loadNext();
 }
@@ -464,12 +582,10 @@ void mtpFileLoader::cancel() {
 void mtpFileLoader::cancelRequests() {
 	if (requests.isEmpty()) return;
 
-	int32 limit = locationType ? DocumentDownloadPartSize : DownloadPartSize;
 	DataRequested &dr(_dataRequested[dc]);
 	for (Requests::const_iterator i = requests.cbegin(), e = requests.cend(); i != e; ++i) {
 		MTP::cancel(i.key());
-		int32 dcIndex = i.value();
-		dr.v[dcIndex] -= limit;
+		dr.v[i.value().dcIndex] -= i.value().limit;
 	}
 	queue->queries -= requests.size();
 	requests.clear();
@@ -484,11 +600,14 @@ bool mtpFileLoader::loading() const {
 }
 
 void mtpFileLoader::started(bool loadFirst, bool prior) {
-	if ((queue->queries >= MaxFileQueries && (!loadFirst || !prior)) || complete) return;
+	if ((queue->queries >= queue->limit && (!loadFirst || !prior)) || complete || localTaskId) return;
 	loadPart();
 }
 
 mtpFileLoader::~mtpFileLoader() {
+	if (localTaskId) {
+		Local::cancelTask(localTaskId);
+	}
 	removeFromQueue();
 	cancelRequests();
 }
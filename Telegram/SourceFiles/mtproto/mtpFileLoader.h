@@ -21,7 +21,40 @@ namespace MTP {
 	void clearLoaderPriorities();
 }
 
+struct FileDownloadState { // partially downloaded file, parts are set in the bitmap when written
+	FileDownloadState(const QString &name, qint32 size, qint32 partSize) : name(name), size(size), partSize(partSize) {
+		parts.fill(0, partsCount() / 8 + 1);
+	}
+	FileDownloadState() : size(0), partSize(0) {
+	}
+	int32 partsCount() const {
+		return partSize ? ((size / partSize) + ((size % partSize) ? 1 : 0)) : 0;
+	}
+	bool hasPart(int32 index) const {
+		return (index >= 0 && (index >> 3) < parts.size()) ? ((parts.at(index >> 3) & (1 << (index & 0x07))) != 0) : false;
+	}
+	void setPart(int32 index) {
+		if (index >= 0 && (index >> 3) < parts.size()) {
+			parts[index >> 3] = char(parts.at(index >> 3) | (1 << (index & 0x07)));
+		}
+	}
+	qint32 contiguousSize() const { // size of the downloaded part from the file start without gaps
+		int32 index = 0, count = partsCount();
+		while (index < count && hasPart(index)) ++index;
+		return qMin(index * partSize, size);
+	}
+	bool check() const {
+		if (name.isEmpty() || size <= 0 || partSize <= 0 || parts.size() != partsCount() / 8 + 1) return false;
+		QFileInfo f(name);
+		return f.exists() && f.size() >= contiguousSize() && f.size() <= size;
+	}
+	QString name;
+	qint32 size, partSize;
+	QByteArray parts;
+};
+
 struct mtpFileLoaderQueue;
+struct StorageImageSaved;
 class mtpFileLoader : public QObject, public RPCSender {
 	Q_OBJECT
 
@@ -47,6 +80,11 @@ public:
 
 	uint64 objId() const;
 
+	int64 receivedBytes() const;
+	float64 throughput() const; // bytes per second since the first part was requested
+
+	void localLoaded(const StorageImageSaved &result);
+
 	~mtpFileLoader();
 
 	mtpFileLoader *prev, *next;
@@ -61,11 +99,20 @@ private:
 
 	mtpFileLoaderQueue *queue;
 	bool inQueue, complete, triedLocal;
+	quint64 localTaskId;
 	
 	void cancelRequests();
 
-	typedef QMap<mtpRequestId, int32> Requests;
+	struct Request {
+		Request(int32 dcIndex = 0, int32 limit = 0) : dcIndex(dcIndex), limit(limit), sent(getms()) {
+		}
+		int32 dcIndex, limit;
+		uint64 sent;
+	};
+	typedef QMap<mtpRequestId, Request> Requests;
 	Requests requests;
+	uint64 startedAt;
+	int64 received;
 	int32 skippedBytes;
 	int32 nextRequestOffset;
 	bool lastComplete;
@@ -75,6 +122,7 @@ private:
 
 	void loadNext();
 	void finishFail();
+	void resumeDownload();
 	bool loadPart();
 	void partLoaded(int32 offset, const MTPupload_File &result, mtpRequestId req);
 	bool partFailed(const RPCError &error);
@@ -94,6 +142,7 @@ private:
 	bool duplicateInData;
 
 	QByteArray data;
+	FileDownloadState downloadState; // parts written to the file, saved so that the download can be resumed
 
 	int32 size;
 	mtpTypeId type;
@@ -67,7 +67,7 @@ inline bool mtpIsFlood(const RPCError &error) {
 
 class RPCAbstractDoneHandler { // abstract done
 public:
-	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const = 0;
+	virtual bool operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const = 0; // false if the response could not be parsed
 	virtual ~RPCAbstractDoneHandler() {
 	}
 };
@@ -101,8 +101,9 @@ class RPCDoneHandlerBare : public RPCAbstractDoneHandler { // done(from, end)
 public:
     RPCDoneHandlerBare(CallbackType onDone) : _onDone(onDone) {
 	}
-	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
+	virtual bool operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
 		(*_onDone)(from, end);
+		return true;
 	}
 
 private:
@@ -117,8 +118,9 @@ class RPCDoneHandlerBareReq : public RPCAbstractDoneHandler { // done(from, end,
 public:
     RPCDoneHandlerBareReq(CallbackType onDone) : _onDone(onDone) {
 	}
-	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
+	virtual bool operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
 		(*_onDone)(from, end, requestId);
+		return true;
 	}
 
 private:
@@ -133,8 +135,11 @@ class RPCDoneHandlerPlain : public RPCAbstractDoneHandler { // done(result)
 public:
     RPCDoneHandlerPlain(CallbackType onDone) : _onDone(onDone) {
 	}
-	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
-		(*_onDone)(TResponse(from, end));
+	virtual bool operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
+		TResponse response;
+		if (response.tryRead(from, end) != mtpReadDone) return false;
+		(*_onDone)(response);
+		return true;
 	}
 
 private:
@@ -149,8 +154,11 @@ class RPCDoneHandlerReq : public RPCAbstractDoneHandler { // done(result, req_id
 public:
     RPCDoneHandlerReq(CallbackType onDone) : _onDone(onDone) {
 	}
-	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
-		(*_onDone)(TResponse(from, end), requestId);
+	virtual bool operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
+		TResponse response;
+		if (response.tryRead(from, end) != mtpReadDone) return false;
+		(*_onDone)(response, requestId);
+		return true;
 	}
 
 private:
@@ -165,8 +173,9 @@ class RPCDoneHandlerNo : public RPCAbstractDoneHandler { // done()
 public:
     RPCDoneHandlerNo(CallbackType onDone) : _onDone(onDone) {
 	}
-	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
+	virtual bool operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
 		(*_onDone)();
+		return true;
 	}
 
 private:
@@ -181,8 +190,9 @@ class RPCDoneHandlerNoReq : public RPCAbstractDoneHandler { // done(req_id)
 public:
     RPCDoneHandlerNoReq(CallbackType onDone) : _onDone(onDone) {
 	}
-	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
+	virtual bool operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
 		(*_onDone)(requestId);
+		return true;
 	}
 
 private:
@@ -338,8 +348,25 @@ class RPCDoneHandlerBareOwned : public RPCOwnedDoneHandler { // done(from, end)
 public:
     RPCDoneHandlerBareOwned(TReceiver *receiver, CallbackType onDone) : RPCOwnedDoneHandler(receiver), _onDone(onDone) {
 	}
-	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
+	virtual bool operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
 		if (_owner) (static_cast<TReceiver*>(_owner)->*_onDone)(from, end);
+		return true;
+	}
+
+private:
+	CallbackType _onDone;
+
+};
+
+template <typename TReceiver>
+class RPCDoneHandlerBareOwned<bool, TReceiver> : public RPCOwnedDoneHandler { // bool done(from, end), false if the data could not be parsed
+	typedef bool (TReceiver::*CallbackType)(const mtpPrime *, const mtpPrime *);
+
+public:
+    RPCDoneHandlerBareOwned(TReceiver *receiver, CallbackType onDone) : RPCOwnedDoneHandler(receiver), _onDone(onDone) {
+	}
+	virtual bool operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
+		return _owner ? (static_cast<TReceiver*>(_owner)->*_onDone)(from, end) : true;
 	}
 
 private:
@@ -354,8 +381,9 @@ class RPCDoneHandlerBareOwnedReq : public RPCOwnedDoneHandler { // done(from, en
 public:
     RPCDoneHandlerBareOwnedReq(TReceiver *receiver, CallbackType onDone) : RPCOwnedDoneHandler(receiver), _onDone(onDone) {
 	}
-	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
+	virtual bool operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
 		if (_owner) (static_cast<TReceiver*>(_owner)->*_onDone)(from, end, requestId);
+		return true;
 	}
 
 private:
@@ -370,8 +398,13 @@ class RPCDoneHandlerOwned : public RPCOwnedDoneHandler { // done(result)
 public:
     RPCDoneHandlerOwned(TReceiver *receiver, CallbackType onDone) : RPCOwnedDoneHandler(receiver), _onDone(onDone) {
 	}
-	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
-		if (_owner) (static_cast<TReceiver*>(_owner)->*_onDone)(TResponse(from, end));
+	virtual bool operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
+		if (!_owner) return true;
+
+		TResponse response;
+		if (response.tryRead(from, end) != mtpReadDone) return false;
+		(static_cast<TReceiver*>(_owner)->*_onDone)(response);
+		return true;
 	}
 
 private:
@@ -386,8 +419,13 @@ class RPCDoneHandlerOwnedReq : public RPCOwnedDoneHandler { // done(result, req_
 public:
     RPCDoneHandlerOwnedReq(TReceiver *receiver, CallbackType onDone) : RPCOwnedDoneHandler(receiver), _onDone(onDone) {
 	}
-	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
-		if (_owner) (static_cast<TReceiver*>(_owner)->*_onDone)(TResponse(from, end), requestId);
+	virtual bool operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
+		if (!_owner) return true;
+
+		TResponse response;
+		if (response.tryRead(from, end) != mtpReadDone) return false;
+		(static_cast<TReceiver*>(_owner)->*_onDone)(response, requestId);
+		return true;
 	}
 
 private:
@@ -402,8 +440,9 @@ class RPCDoneHandlerOwnedNo : public RPCOwnedDoneHandler { // done()
 public:
     RPCDoneHandlerOwnedNo(TReceiver *receiver, CallbackType onDone) : RPCOwnedDoneHandler(receiver), _onDone(onDone) {
 	}
-	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
+	virtual bool operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
 		if (_owner) (static_cast<TReceiver*>(_owner)->*_onDone)();
+		return true;
 	}
 
 private:
@@ -418,8 +457,31 @@ class RPCDoneHandlerOwnedNoReq : public RPCOwnedDoneHandler { // done(req_id)
 public:
     RPCDoneHandlerOwnedNoReq(TReceiver *receiver, CallbackType onDone) : RPCOwnedDoneHandler(receiver), _onDone(onDone) {
 	}
-	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
+	virtual bool operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
 		if (_owner) (static_cast<TReceiver*>(_owner)->*_onDone)(requestId);
+		return true;
+	}
+
+private:
+	CallbackType _onDone;
+
+};
+
+template <typename TReturn, typename TReceiver, typename TView>
+class RPCDoneHandlerViewOwned : public RPCOwnedDoneHandler { // done(view), the view is valid only inside the callback
+	typedef TReturn (TReceiver::*CallbackType)(const TView &);
+
+public:
+    RPCDoneHandlerViewOwned(TReceiver *receiver, CallbackType onDone) : RPCOwnedDoneHandler(receiver), _onDone(onDone) {
+	}
+	virtual bool operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
+		if (!_owner) return true;
+
+		mtpArena arena;
+		TView view;
+		if (!mtpParseView(view, arena, from, end)) return false;
+		(static_cast<TReceiver*>(_owner)->*_onDone)(view);
+		return true;
 	}
 
 private:
@@ -434,8 +496,9 @@ class RPCBindedDoneHandlerBareOwned : public RPCOwnedDoneHandler { // done(b, fr
 public:
     RPCBindedDoneHandlerBareOwned(T b, TReceiver *receiver, CallbackType onDone) : RPCOwnedDoneHandler(receiver), _b(b), _onDone(onDone) {
 	}
-	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
+	virtual bool operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
 		if (_owner) (static_cast<TReceiver*>(_owner)->*_onDone)(_b, from, end);
+		return true;
 	}
 
 private:
@@ -451,8 +514,9 @@ class RPCBindedDoneHandlerBareOwnedReq : public RPCOwnedDoneHandler { // done(b,
 public:
     RPCBindedDoneHandlerBareOwnedReq(T b, TReceiver *receiver, CallbackType onDone) : RPCOwnedDoneHandler(receiver), _b(b), _onDone(onDone) {
 	}
-	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
+	virtual bool operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
 		if (_owner) (static_cast<TReceiver*>(_owner)->*_onDone)(_b, from, end, requestId);
+		return true;
 	}
 
 private:
@@ -468,8 +532,13 @@ class RPCBindedDoneHandlerOwned : public RPCOwnedDoneHandler { // done(b, result
 public:
     RPCBindedDoneHandlerOwned(T b, TReceiver *receiver, CallbackType onDone) : RPCOwnedDoneHandler(receiver), _onDone(onDone), _b(b) {
 	}
-	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
-		if (_owner) (static_cast<TReceiver*>(_owner)->*_onDone)(_b, TResponse(from, end));
+	virtual bool operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
+		if (!_owner) return true;
+
+		TResponse response;
+		if (response.tryRead(from, end) != mtpReadDone) return false;
+		(static_cast<TReceiver*>(_owner)->*_onDone)(_b, response);
+		return true;
 	}
 
 private:
@@ -485,8 +554,13 @@ class RPCBindedDoneHandlerOwnedReq : public RPCOwnedDoneHandler { // done(b, res
 public:
     RPCBindedDoneHandlerOwnedReq(T b, TReceiver *receiver, CallbackType onDone) : RPCOwnedDoneHandler(receiver), _onDone(onDone), _b(b) {
 	}
-	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
-		if (_owner) (static_cast<TReceiver*>(_owner)->*_onDone)(_b, TResponse(from, end), requestId);
+	virtual bool operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
+		if (!_owner) return true;
+
+		TResponse response;
+		if (response.tryRead(from, end) != mtpReadDone) return false;
+		(static_cast<TReceiver*>(_owner)->*_onDone)(_b, response, requestId);
+		return true;
 	}
 
 private:
@@ -502,8 +576,9 @@ class RPCBindedDoneHandlerOwnedNo : public RPCOwnedDoneHandler { // done(b)
 public:
     RPCBindedDoneHandlerOwnedNo(T b, TReceiver *receiver, CallbackType onDone) : RPCOwnedDoneHandler(receiver), _b(b), _onDone(onDone) {
 	}
-	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
+	virtual bool operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
 		if (_owner) (static_cast<TReceiver*>(_owner)->*_onDone)(_b);
+		return true;
 	}
 
 private:
@@ -519,8 +594,9 @@ class RPCBindedDoneHandlerOwnedNoReq : public RPCOwnedDoneHandler { // done(b, r
 public:
     RPCBindedDoneHandlerOwnedNoReq(T b, TReceiver *receiver, CallbackType onDone) : RPCOwnedDoneHandler(receiver), _b(b), _onDone(onDone) {
 	}
-	virtual void operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
+	virtual bool operator()(mtpRequestId requestId, const mtpPrime *from, const mtpPrime *end) const {
 		if (_owner) (static_cast<TReceiver*>(_owner)->*_onDone)(_b, requestId);
+		return true;
 	}
 
 private:
@@ -718,6 +794,11 @@ public:
 		return RPCDoneHandlerPtr(new RPCDoneHandlerOwnedNoReq<TReturn, TReceiver>(static_cast<TReceiver*>(this), onDone));
 	}
 
+	template <typename TReturn, typename TReceiver, typename TView> // done(view), see mtpParseView
+	RPCDoneHandlerPtr rpcDoneView(TReturn (TReceiver::*onDone)(const TView &)) {
+		return RPCDoneHandlerPtr(new RPCDoneHandlerViewOwned<TReturn, TReceiver, TView>(static_cast<TReceiver*>(this), onDone));
+	}
+
 	template <typename TReceiver> // fail(error)
 	RPCFailHandlerPtr rpcFail(bool (TReceiver::*onFail)(const RPCError &)) {
 		return RPCFailHandlerPtr(new RPCFailHandlerOwned<TReceiver>(static_cast<TReceiver*>(this), onFail));
@@ -807,3 +888,4 @@ public:
 
 typedef void (*MTPStateChangedHandler)(int32 dcId, int32 state);
 typedef void(*MTPSessionResetHandler)(int32 dcId);
+typedef void(*MTPResponsesBatchHandler)(bool started); // received responses are dispatched between started and finished calls
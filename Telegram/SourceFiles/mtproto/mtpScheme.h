@@ -1257,6 +1257,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_resPQ);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_resPQ);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -1288,6 +1289,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_p_q_inner_data);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_p_q_inner_data);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -1334,6 +1336,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -1370,6 +1373,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_server_DH_inner_data);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_server_DH_inner_data);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -1401,6 +1405,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_client_DH_inner_data);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_client_DH_inner_data);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -1459,6 +1464,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -1497,6 +1503,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_msgs_ack);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_msgs_ack);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -1543,6 +1550,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -1579,6 +1587,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_msgs_state_req);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_msgs_state_req);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -1610,6 +1619,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_msgs_state_info);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_msgs_state_info);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -1641,6 +1651,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_msgs_all_info);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_msgs_all_info);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -1687,6 +1698,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -1723,6 +1735,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_msg_resend_req);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_msg_resend_req);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -1754,6 +1767,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_rpc_error);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_rpc_error);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -1788,6 +1802,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -1824,6 +1839,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_future_salt);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_future_salt);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -1855,6 +1871,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_future_salts);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_future_salts);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -1886,6 +1903,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_pong);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_pong);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -1932,6 +1950,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -1968,6 +1987,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_new_session_created);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_new_session_created);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -1999,6 +2019,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_http_wait);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_http_wait);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -2030,6 +2051,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_error);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_error);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -2052,6 +2074,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_null);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_null);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -2109,6 +2132,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -2164,6 +2188,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -2202,6 +2227,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_inputPhoneContact);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_inputPhoneContact);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -2248,6 +2274,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -2431,6 +2458,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -2505,6 +2533,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -2545,6 +2574,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -2583,6 +2613,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -2621,6 +2652,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -2707,6 +2739,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -2752,6 +2785,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -2787,6 +2821,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_inputAppEvent);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_inputAppEvent);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -2833,6 +2868,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -2860,6 +2896,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -2917,6 +2954,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -2968,6 +3006,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -3007,6 +3046,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -3057,6 +3097,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -3136,6 +3177,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -3176,6 +3218,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_chatFull);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_chatFull);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -3207,6 +3250,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_chatParticipant);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_chatParticipant);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -3253,6 +3297,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -3292,6 +3337,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -3354,6 +3400,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -3479,6 +3526,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -3604,6 +3652,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -3653,6 +3702,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_dialog);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_dialog);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -3699,6 +3749,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -3762,6 +3813,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -3815,6 +3867,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -3854,6 +3907,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -3889,6 +3943,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_checkedPhone);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_checkedPhone);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -3935,6 +3990,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -3971,6 +4027,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_authorization);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_authorization);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4002,6 +4059,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_exportedAuthorization);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_exportedAuthorization);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4048,6 +4106,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4078,6 +4137,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4112,6 +4172,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_inputPeerNotifySettings);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_inputPeerNotifySettings);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4134,6 +4195,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4171,6 +4233,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4221,6 +4284,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4257,6 +4321,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_userFull);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_userFull);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4288,6 +4353,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contact);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contact);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4319,6 +4385,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_importedContact);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_importedContact);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4350,6 +4417,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contactBlocked);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contactBlocked);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4381,6 +4449,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contactSuggested);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contactSuggested);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4412,6 +4481,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contactStatus);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contactStatus);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4443,6 +4513,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_chatLocated);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_chatLocated);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4474,6 +4545,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_link);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_link);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4508,6 +4580,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4543,6 +4616,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_importedContacts);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_importedContacts);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4589,6 +4663,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4625,6 +4700,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_suggested);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_suggested);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4671,6 +4747,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4722,6 +4799,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4749,6 +4827,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_messageEmpty);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_messageEmpty);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4794,6 +4873,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4830,6 +4910,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_chats);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_chats);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4861,6 +4942,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_chatFull);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_chatFull);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4892,6 +4974,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_affectedHistory);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_affectedHistory);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -4914,6 +4997,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -5293,6 +5377,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -5383,6 +5468,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_updates_state);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_updates_state);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -5441,6 +5527,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -5530,6 +5617,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -5588,6 +5676,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -5624,6 +5713,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_photos_photo);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_photos_photo);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -5655,6 +5745,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_upload_file);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_upload_file);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -5686,6 +5777,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_dcOption);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_dcOption);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -5717,6 +5809,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_config);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_config);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -5748,6 +5841,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_nearestDc);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_nearestDc);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -5782,6 +5876,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -5817,6 +5912,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_help_inviteText);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_help_inviteText);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -5848,6 +5944,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_inputGeoChat);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_inputGeoChat);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -5906,6 +6003,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -5944,6 +6042,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_statedMessage);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_statedMessage);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -5975,6 +6074,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_located);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_located);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -6021,6 +6121,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -6108,6 +6209,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -6150,6 +6252,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_inputEncryptedChat);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_inputEncryptedChat);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -6184,6 +6287,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -6246,6 +6350,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -6300,6 +6405,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -6351,6 +6457,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -6402,6 +6509,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -6441,6 +6549,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -6479,6 +6588,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -6529,6 +6639,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -6580,6 +6691,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -6616,6 +6728,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_help_support);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_help_support);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -6650,6 +6763,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -6726,6 +6840,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -6772,6 +6887,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contactFound);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contactFound);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -6803,6 +6919,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_found);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_found);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -6825,6 +6942,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_inputPrivacyKeyStatusTimestamp);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_inputPrivacyKeyStatusTimestamp);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -6846,6 +6964,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_privacyKeyStatusTimestamp);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_privacyKeyStatusTimestamp);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -6891,6 +7010,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -6946,6 +7066,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -6986,6 +7107,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_privacyRules);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_privacyRules);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7017,6 +7139,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_accountDaysTTL);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_accountDaysTTL);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7048,6 +7171,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_sentChangePhoneCode);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_sentChangePhoneCode);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7130,6 +7254,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7176,6 +7301,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7211,6 +7337,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_stickerPack);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_stickerPack);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7245,6 +7372,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7280,6 +7408,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_disabledFeature);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_disabledFeature);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7311,6 +7440,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_affectedMessages);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_affectedMessages);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7333,6 +7463,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7396,6 +7527,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7434,6 +7566,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_authorization);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_authorization);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7465,6 +7598,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_authorizations);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_authorizations);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7511,6 +7645,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7547,6 +7682,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_passwordSettings);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_passwordSettings);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7578,6 +7714,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_passwordInputSettings);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_passwordInputSettings);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7609,6 +7746,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_passwordRecovery);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_passwordRecovery);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7640,6 +7778,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_receivedNotifyMessage);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_receivedNotifyMessage);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7674,6 +7813,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7724,6 +7864,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7775,6 +7916,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7812,6 +7954,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_stickerSet);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_stickerSet);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7843,6 +7986,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_stickerSet);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_stickerSet);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7874,6 +8018,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_botCommand);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_botCommand);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7908,6 +8053,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7943,6 +8089,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_keyboardButton);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_keyboardButton);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -7974,6 +8121,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_keyboardButtonRow);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_keyboardButtonRow);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -8032,6 +8180,7 @@ public:
 	uint32 innerLength() const;
 	mtpTypeId type() const;
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons);
 	void write(mtpBuffer &to) const;
 
 	typedef void ResponseType;
@@ -11350,7 +11499,12 @@ public:
 		return mtpc_req_pq;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_req_pq) {
-		vnonce.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPreq_pq");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_req_pq) {
+		if (mtpReadResult result = vnonce.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vnonce.write(to);
@@ -11394,12 +11548,17 @@ public:
 		return mtpc_req_DH_params;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_req_DH_params) {
-		vnonce.read(from, end);
-		vserver_nonce.read(from, end);
-		vp.read(from, end);
-		vq.read(from, end);
-		vpublic_key_fingerprint.read(from, end);
-		vencrypted_data.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPreq_DH_params");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_req_DH_params) {
+		if (mtpReadResult result = vnonce.tryRead(from, end)) return result;
+		if (mtpReadResult result = vserver_nonce.tryRead(from, end)) return result;
+		if (mtpReadResult result = vp.tryRead(from, end)) return result;
+		if (mtpReadResult result = vq.tryRead(from, end)) return result;
+		if (mtpReadResult result = vpublic_key_fingerprint.tryRead(from, end)) return result;
+		if (mtpReadResult result = vencrypted_data.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vnonce.write(to);
@@ -11445,9 +11604,14 @@ public:
 		return mtpc_set_client_DH_params;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_set_client_DH_params) {
-		vnonce.read(from, end);
-		vserver_nonce.read(from, end);
-		vencrypted_data.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPset_client_DH_params");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_set_client_DH_params) {
+		if (mtpReadResult result = vnonce.tryRead(from, end)) return result;
+		if (mtpReadResult result = vserver_nonce.tryRead(from, end)) return result;
+		if (mtpReadResult result = vencrypted_data.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vnonce.write(to);
@@ -11488,7 +11652,12 @@ public:
 		return mtpc_rpc_drop_answer;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_rpc_drop_answer) {
-		vreq_msg_id.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPrpc_drop_answer");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_rpc_drop_answer) {
+		if (mtpReadResult result = vreq_msg_id.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vreq_msg_id.write(to);
@@ -11527,7 +11696,12 @@ public:
 		return mtpc_get_future_salts;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_get_future_salts) {
-		vnum.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPget_future_salts");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_get_future_salts) {
+		if (mtpReadResult result = vnum.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vnum.write(to);
@@ -11566,7 +11740,12 @@ public:
 		return mtpc_ping;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_ping) {
-		vping_id.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPping");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_ping) {
+		if (mtpReadResult result = vping_id.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vping_id.write(to);
@@ -11606,8 +11785,13 @@ public:
 		return mtpc_ping_delay_disconnect;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_ping_delay_disconnect) {
-		vping_id.read(from, end);
-		vdisconnect_delay.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPping_delay_disconnect");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_ping_delay_disconnect) {
+		if (mtpReadResult result = vping_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vdisconnect_delay.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vping_id.write(to);
@@ -11647,7 +11831,12 @@ public:
 		return mtpc_destroy_session;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_destroy_session) {
-		vsession_id.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPdestroy_session");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_destroy_session) {
+		if (mtpReadResult result = vsession_id.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vsession_id.write(to);
@@ -11690,11 +11879,16 @@ public:
 		return mtpc_register_saveDeveloperInfo;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_register_saveDeveloperInfo) {
-		vname.read(from, end);
-		vemail.read(from, end);
-		vphone_number.read(from, end);
-		vage.read(from, end);
-		vcity.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPregister_saveDeveloperInfo");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_register_saveDeveloperInfo) {
+		if (mtpReadResult result = vname.tryRead(from, end)) return result;
+		if (mtpReadResult result = vemail.tryRead(from, end)) return result;
+		if (mtpReadResult result = vphone_number.tryRead(from, end)) return result;
+		if (mtpReadResult result = vage.tryRead(from, end)) return result;
+		if (mtpReadResult result = vcity.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vname.write(to);
@@ -11739,8 +11933,13 @@ public:
 		return mtpc_invokeAfterMsg;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_invokeAfterMsg) {
-		vmsg_id.read(from, end);
-		vquery.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinvokeAfterMsg");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_invokeAfterMsg) {
+		if (mtpReadResult result = vmsg_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vquery.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vmsg_id.write(to);
@@ -11781,8 +11980,13 @@ public:
 		return mtpc_invokeAfterMsgs;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_invokeAfterMsgs) {
-		vmsg_ids.read(from, end);
-		vquery.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinvokeAfterMsgs");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_invokeAfterMsgs) {
+		if (mtpReadResult result = vmsg_ids.tryRead(from, end)) return result;
+		if (mtpReadResult result = vquery.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vmsg_ids.write(to);
@@ -11821,7 +12025,12 @@ public:
 		return mtpc_auth_checkPhone;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_checkPhone) {
-		vphone_number.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_checkPhone");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_checkPhone) {
+		if (mtpReadResult result = vphone_number.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vphone_number.write(to);
@@ -11864,11 +12073,16 @@ public:
 		return mtpc_auth_sendCode;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_sendCode) {
-		vphone_number.read(from, end);
-		vsms_type.read(from, end);
-		vapi_id.read(from, end);
-		vapi_hash.read(from, end);
-		vlang_code.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_sendCode");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_sendCode) {
+		if (mtpReadResult result = vphone_number.tryRead(from, end)) return result;
+		if (mtpReadResult result = vsms_type.tryRead(from, end)) return result;
+		if (mtpReadResult result = vapi_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vapi_hash.tryRead(from, end)) return result;
+		if (mtpReadResult result = vlang_code.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vphone_number.write(to);
@@ -11912,8 +12126,13 @@ public:
 		return mtpc_auth_sendCall;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_sendCall) {
-		vphone_number.read(from, end);
-		vphone_code_hash.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_sendCall");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_sendCall) {
+		if (mtpReadResult result = vphone_number.tryRead(from, end)) return result;
+		if (mtpReadResult result = vphone_code_hash.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vphone_number.write(to);
@@ -11957,11 +12176,16 @@ public:
 		return mtpc_auth_signUp;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_signUp) {
-		vphone_number.read(from, end);
-		vphone_code_hash.read(from, end);
-		vphone_code.read(from, end);
-		vfirst_name.read(from, end);
-		vlast_name.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_signUp");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_signUp) {
+		if (mtpReadResult result = vphone_number.tryRead(from, end)) return result;
+		if (mtpReadResult result = vphone_code_hash.tryRead(from, end)) return result;
+		if (mtpReadResult result = vphone_code.tryRead(from, end)) return result;
+		if (mtpReadResult result = vfirst_name.tryRead(from, end)) return result;
+		if (mtpReadResult result = vlast_name.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vphone_number.write(to);
@@ -12006,9 +12230,14 @@ public:
 		return mtpc_auth_signIn;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_signIn) {
-		vphone_number.read(from, end);
-		vphone_code_hash.read(from, end);
-		vphone_code.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_signIn");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_signIn) {
+		if (mtpReadResult result = vphone_number.tryRead(from, end)) return result;
+		if (mtpReadResult result = vphone_code_hash.tryRead(from, end)) return result;
+		if (mtpReadResult result = vphone_code.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vphone_number.write(to);
@@ -12045,6 +12274,11 @@ public:
 		return mtpc_auth_logOut;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_logOut) {
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_logOut");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_logOut) {
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 	}
@@ -12076,6 +12310,11 @@ public:
 		return mtpc_auth_resetAuthorizations;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_resetAuthorizations) {
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_resetAuthorizations");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_resetAuthorizations) {
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 	}
@@ -12112,8 +12351,13 @@ public:
 		return mtpc_auth_sendInvites;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_sendInvites) {
-		vphone_numbers.read(from, end);
-		vmessage.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_sendInvites");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_sendInvites) {
+		if (mtpReadResult result = vphone_numbers.tryRead(from, end)) return result;
+		if (mtpReadResult result = vmessage.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vphone_numbers.write(to);
@@ -12153,7 +12397,12 @@ public:
 		return mtpc_auth_exportAuthorization;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_exportAuthorization) {
-		vdc_id.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_exportAuthorization");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_exportAuthorization) {
+		if (mtpReadResult result = vdc_id.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vdc_id.write(to);
@@ -12193,8 +12442,13 @@ public:
 		return mtpc_auth_importAuthorization;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_importAuthorization) {
-		vid.read(from, end);
-		vbytes.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_importAuthorization");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_importAuthorization) {
+		if (mtpReadResult result = vid.tryRead(from, end)) return result;
+		if (mtpReadResult result = vbytes.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vid.write(to);
@@ -12237,10 +12491,15 @@ public:
 		return mtpc_auth_bindTempAuthKey;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_bindTempAuthKey) {
-		vperm_auth_key_id.read(from, end);
-		vnonce.read(from, end);
-		vexpires_at.read(from, end);
-		vencrypted_message.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_bindTempAuthKey");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_bindTempAuthKey) {
+		if (mtpReadResult result = vperm_auth_key_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vnonce.tryRead(from, end)) return result;
+		if (mtpReadResult result = vexpires_at.tryRead(from, end)) return result;
+		if (mtpReadResult result = vencrypted_message.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vperm_auth_key_id.write(to);
@@ -12288,13 +12547,18 @@ public:
 		return mtpc_account_registerDevice;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_registerDevice) {
-		vtoken_type.read(from, end);
-		vtoken.read(from, end);
-		vdevice_model.read(from, end);
-		vsystem_version.read(from, end);
-		vapp_version.read(from, end);
-		vapp_sandbox.read(from, end);
-		vlang_code.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_registerDevice");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_registerDevice) {
+		if (mtpReadResult result = vtoken_type.tryRead(from, end)) return result;
+		if (mtpReadResult result = vtoken.tryRead(from, end)) return result;
+		if (mtpReadResult result = vdevice_model.tryRead(from, end)) return result;
+		if (mtpReadResult result = vsystem_version.tryRead(from, end)) return result;
+		if (mtpReadResult result = vapp_version.tryRead(from, end)) return result;
+		if (mtpReadResult result = vapp_sandbox.tryRead(from, end)) return result;
+		if (mtpReadResult result = vlang_code.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vtoken_type.write(to);
@@ -12340,8 +12604,13 @@ public:
 		return mtpc_account_unregisterDevice;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_unregisterDevice) {
-		vtoken_type.read(from, end);
-		vtoken.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_unregisterDevice");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_unregisterDevice) {
+		if (mtpReadResult result = vtoken_type.tryRead(from, end)) return result;
+		if (mtpReadResult result = vtoken.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vtoken_type.write(to);
@@ -12382,8 +12651,13 @@ public:
 		return mtpc_account_updateNotifySettings;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_updateNotifySettings) {
-		vpeer.read(from, end);
-		vsettings.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_updateNotifySettings");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_updateNotifySettings) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (mtpReadResult result = vsettings.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -12423,7 +12697,12 @@ public:
 		return mtpc_account_getNotifySettings;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_getNotifySettings) {
-		vpeer.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_getNotifySettings");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_getNotifySettings) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -12458,6 +12737,11 @@ public:
 		return mtpc_account_resetNotifySettings;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_resetNotifySettings) {
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_resetNotifySettings");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_resetNotifySettings) {
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 	}
@@ -12494,8 +12778,13 @@ public:
 		return mtpc_account_updateProfile;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_updateProfile) {
-		vfirst_name.read(from, end);
-		vlast_name.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_updateProfile");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_updateProfile) {
+		if (mtpReadResult result = vfirst_name.tryRead(from, end)) return result;
+		if (mtpReadResult result = vlast_name.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vfirst_name.write(to);
@@ -12535,7 +12824,12 @@ public:
 		return mtpc_account_updateStatus;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_updateStatus) {
-		voffline.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_updateStatus");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_updateStatus) {
+		if (mtpReadResult result = voffline.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		voffline.write(to);
@@ -12570,6 +12864,11 @@ public:
 		return mtpc_account_getWallPapers;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_getWallPapers) {
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_getWallPapers");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_getWallPapers) {
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 	}
@@ -12605,7 +12904,12 @@ public:
 		return mtpc_users_getUsers;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_users_getUsers) {
-		vid.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPusers_getUsers");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_users_getUsers) {
+		if (mtpReadResult result = vid.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vid.write(to);
@@ -12644,7 +12948,12 @@ public:
 		return mtpc_users_getFullUser;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_users_getFullUser) {
-		vid.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPusers_getFullUser");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_users_getFullUser) {
+		if (mtpReadResult result = vid.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vid.write(to);
@@ -12679,6 +12988,11 @@ public:
 		return mtpc_contacts_getStatuses;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_getStatuses) {
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_getStatuses");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_getStatuses) {
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 	}
@@ -12714,7 +13028,12 @@ public:
 		return mtpc_contacts_getContacts;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_getContacts) {
-		vhash.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_getContacts");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_getContacts) {
+		if (mtpReadResult result = vhash.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vhash.write(to);
@@ -12754,8 +13073,13 @@ public:
 		return mtpc_contacts_importContacts;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_importContacts) {
-		vcontacts.read(from, end);
-		vreplace.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_importContacts");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_importContacts) {
+		if (mtpReadResult result = vcontacts.tryRead(from, end)) return result;
+		if (mtpReadResult result = vreplace.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vcontacts.write(to);
@@ -12795,7 +13119,12 @@ public:
 		return mtpc_contacts_getSuggested;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_getSuggested) {
-		vlimit.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_getSuggested");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_getSuggested) {
+		if (mtpReadResult result = vlimit.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vlimit.write(to);
@@ -12834,7 +13163,12 @@ public:
 		return mtpc_contacts_deleteContact;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_deleteContact) {
-		vid.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_deleteContact");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_deleteContact) {
+		if (mtpReadResult result = vid.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vid.write(to);
@@ -12873,7 +13207,12 @@ public:
 		return mtpc_contacts_deleteContacts;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_deleteContacts) {
-		vid.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_deleteContacts");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_deleteContacts) {
+		if (mtpReadResult result = vid.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vid.write(to);
@@ -12912,7 +13251,12 @@ public:
 		return mtpc_contacts_block;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_block) {
-		vid.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_block");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_block) {
+		if (mtpReadResult result = vid.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vid.write(to);
@@ -12951,7 +13295,12 @@ public:
 		return mtpc_contacts_unblock;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_unblock) {
-		vid.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_unblock");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_unblock) {
+		if (mtpReadResult result = vid.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vid.write(to);
@@ -12991,8 +13340,13 @@ public:
 		return mtpc_contacts_getBlocked;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_getBlocked) {
-		voffset.read(from, end);
-		vlimit.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_getBlocked");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_getBlocked) {
+		if (mtpReadResult result = voffset.tryRead(from, end)) return result;
+		if (mtpReadResult result = vlimit.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		voffset.write(to);
@@ -13028,6 +13382,11 @@ public:
 		return mtpc_contacts_exportCard;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_exportCard) {
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_exportCard");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_exportCard) {
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 	}
@@ -13063,7 +13422,12 @@ public:
 		return mtpc_contacts_importCard;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_importCard) {
-		vexport_card.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_importCard");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_importCard) {
+		if (mtpReadResult result = vexport_card.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vexport_card.write(to);
@@ -13102,7 +13466,12 @@ public:
 		return mtpc_messages_getMessages;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_getMessages) {
-		vid.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_getMessages");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_getMessages) {
+		if (mtpReadResult result = vid.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vid.write(to);
@@ -13143,9 +13512,14 @@ public:
 		return mtpc_messages_getDialogs;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_getDialogs) {
-		voffset.read(from, end);
-		vmax_id.read(from, end);
-		vlimit.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_getDialogs");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_getDialogs) {
+		if (mtpReadResult result = voffset.tryRead(from, end)) return result;
+		if (mtpReadResult result = vmax_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vlimit.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		voffset.write(to);
@@ -13189,10 +13563,15 @@ public:
 		return mtpc_messages_getHistory;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_getHistory) {
-		vpeer.read(from, end);
-		voffset.read(from, end);
-		vmax_id.read(from, end);
-		vlimit.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_getHistory");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_getHistory) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (mtpReadResult result = voffset.tryRead(from, end)) return result;
+		if (mtpReadResult result = vmax_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vlimit.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -13241,14 +13620,19 @@ public:
 		return mtpc_messages_search;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_search) {
-		vpeer.read(from, end);
-		vq.read(from, end);
-		vfilter.read(from, end);
-		vmin_date.read(from, end);
-		vmax_date.read(from, end);
-		voffset.read(from, end);
-		vmax_id.read(from, end);
-		vlimit.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_search");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_search) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (mtpReadResult result = vq.tryRead(from, end)) return result;
+		if (mtpReadResult result = vfilter.tryRead(from, end)) return result;
+		if (mtpReadResult result = vmin_date.tryRead(from, end)) return result;
+		if (mtpReadResult result = vmax_date.tryRead(from, end)) return result;
+		if (mtpReadResult result = voffset.tryRead(from, end)) return result;
+		if (mtpReadResult result = vmax_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vlimit.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -13296,9 +13680,14 @@ public:
 		return mtpc_messages_readHistory;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_readHistory) {
-		vpeer.read(from, end);
-		vmax_id.read(from, end);
-		voffset.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_readHistory");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_readHistory) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (mtpReadResult result = vmax_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = voffset.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -13340,8 +13729,13 @@ public:
 		return mtpc_messages_deleteHistory;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_deleteHistory) {
-		vpeer.read(from, end);
-		voffset.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_deleteHistory");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_deleteHistory) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (mtpReadResult result = voffset.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -13381,7 +13775,12 @@ public:
 		return mtpc_messages_deleteMessages;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_deleteMessages) {
-		vid.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_deleteMessages");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_deleteMessages) {
+		if (mtpReadResult result = vid.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vid.write(to);
@@ -13420,7 +13819,12 @@ public:
 		return mtpc_messages_receivedMessages;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_receivedMessages) {
-		vmax_id.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_receivedMessages");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_receivedMessages) {
+		if (mtpReadResult result = vmax_id.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vmax_id.write(to);
@@ -13460,8 +13864,13 @@ public:
 		return mtpc_messages_setTyping;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_setTyping) {
-		vpeer.read(from, end);
-		vaction.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_setTyping");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_setTyping) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (mtpReadResult result = vaction.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -13514,12 +13923,17 @@ public:
 		return mtpc_messages_sendMessage;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_sendMessage) {
-		vflags.read(from, end);
-		vpeer.read(from, end);
-		if (has_reply_to_msg_id()) { vreply_to_msg_id.read(from, end); } else { vreply_to_msg_id = MTPint(); }
-		vmessage.read(from, end);
-		vrandom_id.read(from, end);
-		if (has_reply_markup()) { vreply_markup.read(from, end); } else { vreply_markup = MTPReplyMarkup(); }
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_sendMessage");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_sendMessage) {
+		if (mtpReadResult result = vflags.tryRead(from, end)) return result;
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (has_reply_to_msg_id()) { if (mtpReadResult result = vreply_to_msg_id.tryRead(from, end)) return result; } else { vreply_to_msg_id = MTPint(); }
+		if (mtpReadResult result = vmessage.tryRead(from, end)) return result;
+		if (mtpReadResult result = vrandom_id.tryRead(from, end)) return result;
+		if (has_reply_markup()) { if (mtpReadResult result = vreply_markup.tryRead(from, end)) return result; } else { vreply_markup = MTPReplyMarkup(); }
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vflags.write(to);
@@ -13576,12 +13990,17 @@ public:
 		return mtpc_messages_sendMedia;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_sendMedia) {
-		vflags.read(from, end);
-		vpeer.read(from, end);
-		if (has_reply_to_msg_id()) { vreply_to_msg_id.read(from, end); } else { vreply_to_msg_id = MTPint(); }
-		vmedia.read(from, end);
-		vrandom_id.read(from, end);
-		if (has_reply_markup()) { vreply_markup.read(from, end); } else { vreply_markup = MTPReplyMarkup(); }
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_sendMedia");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_sendMedia) {
+		if (mtpReadResult result = vflags.tryRead(from, end)) return result;
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (has_reply_to_msg_id()) { if (mtpReadResult result = vreply_to_msg_id.tryRead(from, end)) return result; } else { vreply_to_msg_id = MTPint(); }
+		if (mtpReadResult result = vmedia.tryRead(from, end)) return result;
+		if (mtpReadResult result = vrandom_id.tryRead(from, end)) return result;
+		if (has_reply_markup()) { if (mtpReadResult result = vreply_markup.tryRead(from, end)) return result; } else { vreply_markup = MTPReplyMarkup(); }
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vflags.write(to);
@@ -13627,9 +14046,14 @@ public:
 		return mtpc_messages_forwardMessages;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_forwardMessages) {
-		vpeer.read(from, end);
-		vid.read(from, end);
-		vrandom_id.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_forwardMessages");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_forwardMessages) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (mtpReadResult result = vid.tryRead(from, end)) return result;
+		if (mtpReadResult result = vrandom_id.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -13670,7 +14094,12 @@ public:
 		return mtpc_messages_getChats;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_getChats) {
-		vid.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_getChats");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_getChats) {
+		if (mtpReadResult result = vid.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vid.write(to);
@@ -13709,7 +14138,12 @@ public:
 		return mtpc_messages_getFullChat;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_getFullChat) {
-		vchat_id.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_getFullChat");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_getFullChat) {
+		if (mtpReadResult result = vchat_id.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vchat_id.write(to);
@@ -13749,8 +14183,13 @@ public:
 		return mtpc_messages_editChatTitle;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_editChatTitle) {
-		vchat_id.read(from, end);
-		vtitle.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_editChatTitle");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_editChatTitle) {
+		if (mtpReadResult result = vchat_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vtitle.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vchat_id.write(to);
@@ -13791,8 +14230,13 @@ public:
 		return mtpc_messages_editChatPhoto;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_editChatPhoto) {
-		vchat_id.read(from, end);
-		vphoto.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_editChatPhoto");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_editChatPhoto) {
+		if (mtpReadResult result = vchat_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vphoto.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vchat_id.write(to);
@@ -13834,9 +14278,14 @@ public:
 		return mtpc_messages_addChatUser;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_addChatUser) {
-		vchat_id.read(from, end);
-		vuser_id.read(from, end);
-		vfwd_limit.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_addChatUser");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_addChatUser) {
+		if (mtpReadResult result = vchat_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vuser_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vfwd_limit.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vchat_id.write(to);
@@ -13878,8 +14327,13 @@ public:
 		return mtpc_messages_deleteChatUser;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_deleteChatUser) {
-		vchat_id.read(from, end);
-		vuser_id.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_deleteChatUser");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_deleteChatUser) {
+		if (mtpReadResult result = vchat_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vuser_id.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vchat_id.write(to);
@@ -13920,8 +14374,13 @@ public:
 		return mtpc_messages_createChat;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_createChat) {
-		vusers.read(from, end);
-		vtitle.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_createChat");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_createChat) {
+		if (mtpReadResult result = vusers.tryRead(from, end)) return result;
+		if (mtpReadResult result = vtitle.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vusers.write(to);
@@ -13957,6 +14416,11 @@ public:
 		return mtpc_updates_getState;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_updates_getState) {
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPupdates_getState");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_updates_getState) {
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 	}
@@ -13994,9 +14458,14 @@ public:
 		return mtpc_updates_getDifference;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_updates_getDifference) {
-		vpts.read(from, end);
-		vdate.read(from, end);
-		vqts.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPupdates_getDifference");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_updates_getDifference) {
+		if (mtpReadResult result = vpts.tryRead(from, end)) return result;
+		if (mtpReadResult result = vdate.tryRead(from, end)) return result;
+		if (mtpReadResult result = vqts.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpts.write(to);
@@ -14038,8 +14507,13 @@ public:
 		return mtpc_photos_updateProfilePhoto;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_photos_updateProfilePhoto) {
-		vid.read(from, end);
-		vcrop.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPphotos_updateProfilePhoto");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_photos_updateProfilePhoto) {
+		if (mtpReadResult result = vid.tryRead(from, end)) return result;
+		if (mtpReadResult result = vcrop.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vid.write(to);
@@ -14082,10 +14556,15 @@ public:
 		return mtpc_photos_uploadProfilePhoto;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_photos_uploadProfilePhoto) {
-		vfile.read(from, end);
-		vcaption.read(from, end);
-		vgeo_point.read(from, end);
-		vcrop.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPphotos_uploadProfilePhoto");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_photos_uploadProfilePhoto) {
+		if (mtpReadResult result = vfile.tryRead(from, end)) return result;
+		if (mtpReadResult result = vcaption.tryRead(from, end)) return result;
+		if (mtpReadResult result = vgeo_point.tryRead(from, end)) return result;
+		if (mtpReadResult result = vcrop.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vfile.write(to);
@@ -14127,7 +14606,12 @@ public:
 		return mtpc_photos_deletePhotos;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_photos_deletePhotos) {
-		vid.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPphotos_deletePhotos");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_photos_deletePhotos) {
+		if (mtpReadResult result = vid.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vid.write(to);
@@ -14168,9 +14652,14 @@ public:
 		return mtpc_upload_saveFilePart;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_upload_saveFilePart) {
-		vfile_id.read(from, end);
-		vfile_part.read(from, end);
-		vbytes.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPupload_saveFilePart");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_upload_saveFilePart) {
+		if (mtpReadResult result = vfile_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vfile_part.tryRead(from, end)) return result;
+		if (mtpReadResult result = vbytes.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vfile_id.write(to);
@@ -14213,9 +14702,14 @@ public:
 		return mtpc_upload_getFile;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_upload_getFile) {
-		vlocation.read(from, end);
-		voffset.read(from, end);
-		vlimit.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPupload_getFile");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_upload_getFile) {
+		if (mtpReadResult result = vlocation.tryRead(from, end)) return result;
+		if (mtpReadResult result = voffset.tryRead(from, end)) return result;
+		if (mtpReadResult result = vlimit.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vlocation.write(to);
@@ -14252,6 +14746,11 @@ public:
 		return mtpc_help_getConfig;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_help_getConfig) {
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPhelp_getConfig");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_help_getConfig) {
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 	}
@@ -14283,6 +14782,11 @@ public:
 		return mtpc_help_getNearestDc;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_help_getNearestDc) {
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPhelp_getNearestDc");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_help_getNearestDc) {
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 	}
@@ -14321,10 +14825,15 @@ public:
 		return mtpc_help_getAppUpdate;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_help_getAppUpdate) {
-		vdevice_model.read(from, end);
-		vsystem_version.read(from, end);
-		vapp_version.read(from, end);
-		vlang_code.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPhelp_getAppUpdate");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_help_getAppUpdate) {
+		if (mtpReadResult result = vdevice_model.tryRead(from, end)) return result;
+		if (mtpReadResult result = vsystem_version.tryRead(from, end)) return result;
+		if (mtpReadResult result = vapp_version.tryRead(from, end)) return result;
+		if (mtpReadResult result = vlang_code.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vdevice_model.write(to);
@@ -14366,7 +14875,12 @@ public:
 		return mtpc_help_saveAppLog;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_help_saveAppLog) {
-		vevents.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPhelp_saveAppLog");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_help_saveAppLog) {
+		if (mtpReadResult result = vevents.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vevents.write(to);
@@ -14405,7 +14919,12 @@ public:
 		return mtpc_help_getInviteText;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_help_getInviteText) {
-		vlang_code.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPhelp_getInviteText");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_help_getInviteText) {
+		if (mtpReadResult result = vlang_code.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vlang_code.write(to);
@@ -14447,10 +14966,15 @@ public:
 		return mtpc_photos_getUserPhotos;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_photos_getUserPhotos) {
-		vuser_id.read(from, end);
-		voffset.read(from, end);
-		vmax_id.read(from, end);
-		vlimit.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPphotos_getUserPhotos");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_photos_getUserPhotos) {
+		if (mtpReadResult result = vuser_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = voffset.tryRead(from, end)) return result;
+		if (mtpReadResult result = vmax_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vlimit.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vuser_id.write(to);
@@ -14494,9 +15018,14 @@ public:
 		return mtpc_messages_forwardMessage;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_forwardMessage) {
-		vpeer.read(from, end);
-		vid.read(from, end);
-		vrandom_id.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_forwardMessage");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_forwardMessage) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (mtpReadResult result = vid.tryRead(from, end)) return result;
+		if (mtpReadResult result = vrandom_id.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -14540,10 +15069,15 @@ public:
 		return mtpc_messages_sendBroadcast;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_sendBroadcast) {
-		vcontacts.read(from, end);
-		vrandom_id.read(from, end);
-		vmessage.read(from, end);
-		vmedia.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_sendBroadcast");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_sendBroadcast) {
+		if (mtpReadResult result = vcontacts.tryRead(from, end)) return result;
+		if (mtpReadResult result = vrandom_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vmessage.tryRead(from, end)) return result;
+		if (mtpReadResult result = vmedia.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vcontacts.write(to);
@@ -14587,9 +15121,14 @@ public:
 		return mtpc_geochats_getLocated;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_getLocated) {
-		vgeo_point.read(from, end);
-		vradius.read(from, end);
-		vlimit.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPgeochats_getLocated");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_getLocated) {
+		if (mtpReadResult result = vgeo_point.tryRead(from, end)) return result;
+		if (mtpReadResult result = vradius.tryRead(from, end)) return result;
+		if (mtpReadResult result = vlimit.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vgeo_point.write(to);
@@ -14631,8 +15170,13 @@ public:
 		return mtpc_geochats_getRecents;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_getRecents) {
-		voffset.read(from, end);
-		vlimit.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPgeochats_getRecents");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_getRecents) {
+		if (mtpReadResult result = voffset.tryRead(from, end)) return result;
+		if (mtpReadResult result = vlimit.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		voffset.write(to);
@@ -14672,7 +15216,12 @@ public:
 		return mtpc_geochats_checkin;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_checkin) {
-		vpeer.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPgeochats_checkin");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_checkin) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -14711,7 +15260,12 @@ public:
 		return mtpc_geochats_getFullChat;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_getFullChat) {
-		vpeer.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPgeochats_getFullChat");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_getFullChat) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -14752,9 +15306,14 @@ public:
 		return mtpc_geochats_editChatTitle;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_editChatTitle) {
-		vpeer.read(from, end);
-		vtitle.read(from, end);
-		vaddress.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPgeochats_editChatTitle");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_editChatTitle) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (mtpReadResult result = vtitle.tryRead(from, end)) return result;
+		if (mtpReadResult result = vaddress.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -14796,8 +15355,13 @@ public:
 		return mtpc_geochats_editChatPhoto;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_editChatPhoto) {
-		vpeer.read(from, end);
-		vphoto.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPgeochats_editChatPhoto");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_editChatPhoto) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (mtpReadResult result = vphoto.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -14844,14 +15408,19 @@ public:
 		return mtpc_geochats_search;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_search) {
-		vpeer.read(from, end);
-		vq.read(from, end);
-		vfilter.read(from, end);
-		vmin_date.read(from, end);
-		vmax_date.read(from, end);
-		voffset.read(from, end);
-		vmax_id.read(from, end);
-		vlimit.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPgeochats_search");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_search) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (mtpReadResult result = vq.tryRead(from, end)) return result;
+		if (mtpReadResult result = vfilter.tryRead(from, end)) return result;
+		if (mtpReadResult result = vmin_date.tryRead(from, end)) return result;
+		if (mtpReadResult result = vmax_date.tryRead(from, end)) return result;
+		if (mtpReadResult result = voffset.tryRead(from, end)) return result;
+		if (mtpReadResult result = vmax_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vlimit.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -14900,10 +15469,15 @@ public:
 		return mtpc_geochats_getHistory;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_getHistory) {
-		vpeer.read(from, end);
-		voffset.read(from, end);
-		vmax_id.read(from, end);
-		vlimit.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPgeochats_getHistory");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_getHistory) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (mtpReadResult result = voffset.tryRead(from, end)) return result;
+		if (mtpReadResult result = vmax_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vlimit.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -14946,8 +15520,13 @@ public:
 		return mtpc_geochats_setTyping;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_setTyping) {
-		vpeer.read(from, end);
-		vtyping.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPgeochats_setTyping");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_setTyping) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (mtpReadResult result = vtyping.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -14989,9 +15568,14 @@ public:
 		return mtpc_geochats_sendMessage;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_sendMessage) {
-		vpeer.read(from, end);
-		vmessage.read(from, end);
-		vrandom_id.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPgeochats_sendMessage");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_sendMessage) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (mtpReadResult result = vmessage.tryRead(from, end)) return result;
+		if (mtpReadResult result = vrandom_id.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -15034,9 +15618,14 @@ public:
 		return mtpc_geochats_sendMedia;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_sendMedia) {
-		vpeer.read(from, end);
-		vmedia.read(from, end);
-		vrandom_id.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPgeochats_sendMedia");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_sendMedia) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (mtpReadResult result = vmedia.tryRead(from, end)) return result;
+		if (mtpReadResult result = vrandom_id.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -15080,10 +15669,15 @@ public:
 		return mtpc_geochats_createGeoChat;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_createGeoChat) {
-		vtitle.read(from, end);
-		vgeo_point.read(from, end);
-		vaddress.read(from, end);
-		vvenue.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPgeochats_createGeoChat");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_geochats_createGeoChat) {
+		if (mtpReadResult result = vtitle.tryRead(from, end)) return result;
+		if (mtpReadResult result = vgeo_point.tryRead(from, end)) return result;
+		if (mtpReadResult result = vaddress.tryRead(from, end)) return result;
+		if (mtpReadResult result = vvenue.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vtitle.write(to);
@@ -15126,8 +15720,13 @@ public:
 		return mtpc_messages_getDhConfig;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_getDhConfig) {
-		vversion.read(from, end);
-		vrandom_length.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_getDhConfig");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_getDhConfig) {
+		if (mtpReadResult result = vversion.tryRead(from, end)) return result;
+		if (mtpReadResult result = vrandom_length.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vversion.write(to);
@@ -15169,9 +15768,14 @@ public:
 		return mtpc_messages_requestEncryption;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_requestEncryption) {
-		vuser_id.read(from, end);
-		vrandom_id.read(from, end);
-		vg_a.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_requestEncryption");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_requestEncryption) {
+		if (mtpReadResult result = vuser_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vrandom_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vg_a.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vuser_id.write(to);
@@ -15214,9 +15818,14 @@ public:
 		return mtpc_messages_acceptEncryption;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_acceptEncryption) {
-		vpeer.read(from, end);
-		vg_b.read(from, end);
-		vkey_fingerprint.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_acceptEncryption");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_acceptEncryption) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (mtpReadResult result = vg_b.tryRead(from, end)) return result;
+		if (mtpReadResult result = vkey_fingerprint.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -15257,7 +15866,12 @@ public:
 		return mtpc_messages_discardEncryption;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_discardEncryption) {
-		vchat_id.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_discardEncryption");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_discardEncryption) {
+		if (mtpReadResult result = vchat_id.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vchat_id.write(to);
@@ -15297,8 +15911,13 @@ public:
 		return mtpc_messages_setEncryptedTyping;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_setEncryptedTyping) {
-		vpeer.read(from, end);
-		vtyping.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_setEncryptedTyping");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_setEncryptedTyping) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (mtpReadResult result = vtyping.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -15339,8 +15958,13 @@ public:
 		return mtpc_messages_readEncryptedHistory;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_readEncryptedHistory) {
-		vpeer.read(from, end);
-		vmax_date.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_readEncryptedHistory");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_readEncryptedHistory) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (mtpReadResult result = vmax_date.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -15382,9 +16006,14 @@ public:
 		return mtpc_messages_sendEncrypted;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_sendEncrypted) {
-		vpeer.read(from, end);
-		vrandom_id.read(from, end);
-		vdata.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_sendEncrypted");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_sendEncrypted) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (mtpReadResult result = vrandom_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vdata.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -15428,10 +16057,15 @@ public:
 		return mtpc_messages_sendEncryptedFile;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_sendEncryptedFile) {
-		vpeer.read(from, end);
-		vrandom_id.read(from, end);
-		vdata.read(from, end);
-		vfile.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_sendEncryptedFile");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_sendEncryptedFile) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (mtpReadResult result = vrandom_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vdata.tryRead(from, end)) return result;
+		if (mtpReadResult result = vfile.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -15475,9 +16109,14 @@ public:
 		return mtpc_messages_sendEncryptedService;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_sendEncryptedService) {
-		vpeer.read(from, end);
-		vrandom_id.read(from, end);
-		vdata.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_sendEncryptedService");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_sendEncryptedService) {
+		if (mtpReadResult result = vpeer.tryRead(from, end)) return result;
+		if (mtpReadResult result = vrandom_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vdata.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpeer.write(to);
@@ -15518,7 +16157,12 @@ public:
 		return mtpc_messages_receivedQueue;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_receivedQueue) {
-		vmax_qts.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_receivedQueue");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_receivedQueue) {
+		if (mtpReadResult result = vmax_qts.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vmax_qts.write(to);
@@ -15560,10 +16204,15 @@ public:
 		return mtpc_upload_saveBigFilePart;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_upload_saveBigFilePart) {
-		vfile_id.read(from, end);
-		vfile_part.read(from, end);
-		vfile_total_parts.read(from, end);
-		vbytes.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPupload_saveBigFilePart");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_upload_saveBigFilePart) {
+		if (mtpReadResult result = vfile_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vfile_part.tryRead(from, end)) return result;
+		if (mtpReadResult result = vfile_total_parts.tryRead(from, end)) return result;
+		if (mtpReadResult result = vbytes.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vfile_id.write(to);
@@ -15611,12 +16260,17 @@ public:
 		return mtpc_initConnection;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_initConnection) {
-		vapi_id.read(from, end);
-		vdevice_model.read(from, end);
-		vsystem_version.read(from, end);
-		vapp_version.read(from, end);
-		vlang_code.read(from, end);
-		vquery.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinitConnection");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_initConnection) {
+		if (mtpReadResult result = vapi_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vdevice_model.tryRead(from, end)) return result;
+		if (mtpReadResult result = vsystem_version.tryRead(from, end)) return result;
+		if (mtpReadResult result = vapp_version.tryRead(from, end)) return result;
+		if (mtpReadResult result = vlang_code.tryRead(from, end)) return result;
+		if (mtpReadResult result = vquery.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vapi_id.write(to);
@@ -15655,6 +16309,11 @@ public:
 		return mtpc_help_getSupport;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_help_getSupport) {
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPhelp_getSupport");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_help_getSupport) {
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 	}
@@ -15691,8 +16350,13 @@ public:
 		return mtpc_auth_sendSms;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_sendSms) {
-		vphone_number.read(from, end);
-		vphone_code_hash.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_sendSms");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_sendSms) {
+		if (mtpReadResult result = vphone_number.tryRead(from, end)) return result;
+		if (mtpReadResult result = vphone_code_hash.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vphone_number.write(to);
@@ -15732,7 +16396,12 @@ public:
 		return mtpc_messages_readMessageContents;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_readMessageContents) {
-		vid.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_readMessageContents");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_readMessageContents) {
+		if (mtpReadResult result = vid.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vid.write(to);
@@ -15771,7 +16440,12 @@ public:
 		return mtpc_account_checkUsername;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_checkUsername) {
-		vusername.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_checkUsername");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_checkUsername) {
+		if (mtpReadResult result = vusername.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vusername.write(to);
@@ -15810,7 +16484,12 @@ public:
 		return mtpc_account_updateUsername;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_updateUsername) {
-		vusername.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_updateUsername");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_updateUsername) {
+		if (mtpReadResult result = vusername.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vusername.write(to);
@@ -15850,8 +16529,13 @@ public:
 		return mtpc_contacts_search;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_search) {
-		vq.read(from, end);
-		vlimit.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_search");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_search) {
+		if (mtpReadResult result = vq.tryRead(from, end)) return result;
+		if (mtpReadResult result = vlimit.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vq.write(to);
@@ -15891,7 +16575,12 @@ public:
 		return mtpc_account_getPrivacy;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_getPrivacy) {
-		vkey.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_getPrivacy");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_getPrivacy) {
+		if (mtpReadResult result = vkey.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vkey.write(to);
@@ -15931,8 +16620,13 @@ public:
 		return mtpc_account_setPrivacy;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_setPrivacy) {
-		vkey.read(from, end);
-		vrules.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_setPrivacy");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_setPrivacy) {
+		if (mtpReadResult result = vkey.tryRead(from, end)) return result;
+		if (mtpReadResult result = vrules.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vkey.write(to);
@@ -15972,7 +16666,12 @@ public:
 		return mtpc_account_deleteAccount;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_deleteAccount) {
-		vreason.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_deleteAccount");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_deleteAccount) {
+		if (mtpReadResult result = vreason.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vreason.write(to);
@@ -16007,6 +16706,11 @@ public:
 		return mtpc_account_getAccountTTL;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_getAccountTTL) {
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_getAccountTTL");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_getAccountTTL) {
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 	}
@@ -16042,7 +16746,12 @@ public:
 		return mtpc_account_setAccountTTL;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_setAccountTTL) {
-		vttl.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_setAccountTTL");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_setAccountTTL) {
+		if (mtpReadResult result = vttl.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vttl.write(to);
@@ -16083,8 +16792,13 @@ public:
 		return mtpc_invokeWithLayer;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_invokeWithLayer) {
-		vlayer.read(from, end);
-		vquery.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinvokeWithLayer");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_invokeWithLayer) {
+		if (mtpReadResult result = vlayer.tryRead(from, end)) return result;
+		if (mtpReadResult result = vquery.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vlayer.write(to);
@@ -16123,7 +16837,12 @@ public:
 		return mtpc_contacts_resolveUsername;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_resolveUsername) {
-		vusername.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_resolveUsername");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_contacts_resolveUsername) {
+		if (mtpReadResult result = vusername.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vusername.write(to);
@@ -16162,7 +16881,12 @@ public:
 		return mtpc_account_sendChangePhoneCode;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_sendChangePhoneCode) {
-		vphone_number.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_sendChangePhoneCode");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_sendChangePhoneCode) {
+		if (mtpReadResult result = vphone_number.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vphone_number.write(to);
@@ -16203,9 +16927,14 @@ public:
 		return mtpc_account_changePhone;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_changePhone) {
-		vphone_number.read(from, end);
-		vphone_code_hash.read(from, end);
-		vphone_code.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_changePhone");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_changePhone) {
+		if (mtpReadResult result = vphone_number.tryRead(from, end)) return result;
+		if (mtpReadResult result = vphone_code_hash.tryRead(from, end)) return result;
+		if (mtpReadResult result = vphone_code.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vphone_number.write(to);
@@ -16247,8 +16976,13 @@ public:
 		return mtpc_messages_getStickers;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_getStickers) {
-		vemoticon.read(from, end);
-		vhash.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_getStickers");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_getStickers) {
+		if (mtpReadResult result = vemoticon.tryRead(from, end)) return result;
+		if (mtpReadResult result = vhash.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vemoticon.write(to);
@@ -16288,7 +17022,12 @@ public:
 		return mtpc_messages_getAllStickers;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_getAllStickers) {
-		vhash.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_getAllStickers");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_getAllStickers) {
+		if (mtpReadResult result = vhash.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vhash.write(to);
@@ -16327,7 +17066,12 @@ public:
 		return mtpc_account_updateDeviceLocked;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_updateDeviceLocked) {
-		vperiod.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_updateDeviceLocked");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_updateDeviceLocked) {
+		if (mtpReadResult result = vperiod.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vperiod.write(to);
@@ -16369,10 +17113,15 @@ public:
 		return mtpc_auth_importBotAuthorization;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_importBotAuthorization) {
-		vflags.read(from, end);
-		vapi_id.read(from, end);
-		vapi_hash.read(from, end);
-		vbot_auth_token.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_importBotAuthorization");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_importBotAuthorization) {
+		if (mtpReadResult result = vflags.tryRead(from, end)) return result;
+		if (mtpReadResult result = vapi_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vapi_hash.tryRead(from, end)) return result;
+		if (mtpReadResult result = vbot_auth_token.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vflags.write(to);
@@ -16414,7 +17163,12 @@ public:
 		return mtpc_messages_getWebPagePreview;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_getWebPagePreview) {
-		vmessage.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_getWebPagePreview");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_getWebPagePreview) {
+		if (mtpReadResult result = vmessage.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vmessage.write(to);
@@ -16449,6 +17203,11 @@ public:
 		return mtpc_account_getAuthorizations;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_getAuthorizations) {
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_getAuthorizations");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_getAuthorizations) {
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 	}
@@ -16484,7 +17243,12 @@ public:
 		return mtpc_account_resetAuthorization;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_resetAuthorization) {
-		vhash.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_resetAuthorization");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_resetAuthorization) {
+		if (mtpReadResult result = vhash.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vhash.write(to);
@@ -16519,6 +17283,11 @@ public:
 		return mtpc_account_getPassword;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_getPassword) {
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_getPassword");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_getPassword) {
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 	}
@@ -16554,7 +17323,12 @@ public:
 		return mtpc_account_getPasswordSettings;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_getPasswordSettings) {
-		vcurrent_password_hash.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_getPasswordSettings");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_getPasswordSettings) {
+		if (mtpReadResult result = vcurrent_password_hash.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vcurrent_password_hash.write(to);
@@ -16594,8 +17368,13 @@ public:
 		return mtpc_account_updatePasswordSettings;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_updatePasswordSettings) {
-		vcurrent_password_hash.read(from, end);
-		vnew_settings.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_updatePasswordSettings");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_account_updatePasswordSettings) {
+		if (mtpReadResult result = vcurrent_password_hash.tryRead(from, end)) return result;
+		if (mtpReadResult result = vnew_settings.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vcurrent_password_hash.write(to);
@@ -16635,7 +17414,12 @@ public:
 		return mtpc_auth_checkPassword;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_checkPassword) {
-		vpassword_hash.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_checkPassword");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_checkPassword) {
+		if (mtpReadResult result = vpassword_hash.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vpassword_hash.write(to);
@@ -16670,6 +17454,11 @@ public:
 		return mtpc_auth_requestPasswordRecovery;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_requestPasswordRecovery) {
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_requestPasswordRecovery");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_requestPasswordRecovery) {
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 	}
@@ -16705,7 +17494,12 @@ public:
 		return mtpc_auth_recoverPassword;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_recoverPassword) {
-		vcode.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_recoverPassword");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_auth_recoverPassword) {
+		if (mtpReadResult result = vcode.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vcode.write(to);
@@ -16745,7 +17539,12 @@ public:
 		return mtpc_invokeWithoutUpdates;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_invokeWithoutUpdates) {
-		vquery.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinvokeWithoutUpdates");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_invokeWithoutUpdates) {
+		if (mtpReadResult result = vquery.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vquery.write(to);
@@ -16783,7 +17582,12 @@ public:
 		return mtpc_messages_exportChatInvite;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_exportChatInvite) {
-		vchat_id.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_exportChatInvite");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_exportChatInvite) {
+		if (mtpReadResult result = vchat_id.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vchat_id.write(to);
@@ -16822,7 +17626,12 @@ public:
 		return mtpc_messages_checkChatInvite;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_checkChatInvite) {
-		vhash.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_checkChatInvite");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_checkChatInvite) {
+		if (mtpReadResult result = vhash.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vhash.write(to);
@@ -16861,7 +17670,12 @@ public:
 		return mtpc_messages_importChatInvite;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_importChatInvite) {
-		vhash.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_importChatInvite");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_importChatInvite) {
+		if (mtpReadResult result = vhash.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vhash.write(to);
@@ -16900,7 +17714,12 @@ public:
 		return mtpc_messages_getStickerSet;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_getStickerSet) {
-		vstickerset.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_getStickerSet");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_getStickerSet) {
+		if (mtpReadResult result = vstickerset.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vstickerset.write(to);
@@ -16940,8 +17759,13 @@ public:
 		return mtpc_messages_installStickerSet;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_installStickerSet) {
-		vstickerset.read(from, end);
-		vdisabled.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_installStickerSet");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_installStickerSet) {
+		if (mtpReadResult result = vstickerset.tryRead(from, end)) return result;
+		if (mtpReadResult result = vdisabled.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vstickerset.write(to);
@@ -16981,7 +17805,12 @@ public:
 		return mtpc_messages_uninstallStickerSet;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_uninstallStickerSet) {
-		vstickerset.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_uninstallStickerSet");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_uninstallStickerSet) {
+		if (mtpReadResult result = vstickerset.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vstickerset.write(to);
@@ -17023,10 +17852,15 @@ public:
 		return mtpc_messages_startBot;
 	}
 	void read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_startBot) {
-		vbot.read(from, end);
-		vchat_id.read(from, end);
-		vrandom_id.read(from, end);
-		vstart_param.read(from, end);
+		mtpReadResult result = tryRead(from, end, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_startBot");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons = mtpc_messages_startBot) {
+		if (mtpReadResult result = vbot.tryRead(from, end)) return result;
+		if (mtpReadResult result = vchat_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vrandom_id.tryRead(from, end)) return result;
+		if (mtpReadResult result = vstart_param.tryRead(from, end)) return result;
+		return mtpReadDone;
 	}
 	void write(mtpBuffer &to) const {
 		vbot.write(to);
@@ -17062,14 +17896,19 @@ inline mtpTypeId MTPresPQ::type() const {
 	return mtpc_resPQ;
 }
 inline void MTPresPQ::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_resPQ) throw mtpErrorUnexpected(cons, "MTPresPQ");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPresPQ");
+}
+inline mtpReadResult MTPresPQ::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_resPQ) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDresPQ());
 	MTPDresPQ &v(_resPQ());
-	v.vnonce.read(from, end);
-	v.vserver_nonce.read(from, end);
-	v.vpq.read(from, end);
-	v.vserver_public_key_fingerprints.read(from, end);
+	if (mtpReadResult result = v.vnonce.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vserver_nonce.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vpq.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vserver_public_key_fingerprints.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPresPQ::write(mtpBuffer &to) const {
 	const MTPDresPQ &v(c_resPQ());
@@ -17095,16 +17934,21 @@ inline mtpTypeId MTPp_Q_inner_data::type() const {
 	return mtpc_p_q_inner_data;
 }
 inline void MTPp_Q_inner_data::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_p_q_inner_data) throw mtpErrorUnexpected(cons, "MTPp_Q_inner_data");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPp_Q_inner_data");
+}
+inline mtpReadResult MTPp_Q_inner_data::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_p_q_inner_data) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDp_q_inner_data());
 	MTPDp_q_inner_data &v(_p_q_inner_data());
-	v.vpq.read(from, end);
-	v.vp.read(from, end);
-	v.vq.read(from, end);
-	v.vnonce.read(from, end);
-	v.vserver_nonce.read(from, end);
-	v.vnew_nonce.read(from, end);
+	if (mtpReadResult result = v.vpq.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vp.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vq.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vnonce.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vserver_nonce.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vnew_nonce.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPp_Q_inner_data::write(mtpBuffer &to) const {
 	const MTPDp_q_inner_data &v(c_p_q_inner_data());
@@ -17139,24 +17983,29 @@ inline mtpTypeId MTPserver_DH_Params::type() const {
 	return _type;
 }
 inline void MTPserver_DH_Params::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPserver_DH_Params");
+}
+inline mtpReadResult MTPserver_DH_Params::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_server_DH_params_fail: _type = cons; {
 			if (!data) setData(new MTPDserver_DH_params_fail());
 			MTPDserver_DH_params_fail &v(_server_DH_params_fail());
-			v.vnonce.read(from, end);
-			v.vserver_nonce.read(from, end);
-			v.vnew_nonce_hash.read(from, end);
+			if (mtpReadResult result = v.vnonce.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vserver_nonce.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vnew_nonce_hash.tryRead(from, end)) return result;
 		} break;
 		case mtpc_server_DH_params_ok: _type = cons; {
 			if (!data) setData(new MTPDserver_DH_params_ok());
 			MTPDserver_DH_params_ok &v(_server_DH_params_ok());
-			v.vnonce.read(from, end);
-			v.vserver_nonce.read(from, end);
-			v.vencrypted_answer.read(from, end);
+			if (mtpReadResult result = v.vnonce.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vserver_nonce.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vencrypted_answer.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPserver_DH_Params");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPserver_DH_Params::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -17203,16 +18052,21 @@ inline mtpTypeId MTPserver_DH_inner_data::type() const {
 	return mtpc_server_DH_inner_data;
 }
 inline void MTPserver_DH_inner_data::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_server_DH_inner_data) throw mtpErrorUnexpected(cons, "MTPserver_DH_inner_data");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPserver_DH_inner_data");
+}
+inline mtpReadResult MTPserver_DH_inner_data::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_server_DH_inner_data) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDserver_DH_inner_data());
 	MTPDserver_DH_inner_data &v(_server_DH_inner_data());
-	v.vnonce.read(from, end);
-	v.vserver_nonce.read(from, end);
-	v.vg.read(from, end);
-	v.vdh_prime.read(from, end);
-	v.vg_a.read(from, end);
-	v.vserver_time.read(from, end);
+	if (mtpReadResult result = v.vnonce.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vserver_nonce.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vg.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vdh_prime.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vg_a.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vserver_time.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPserver_DH_inner_data::write(mtpBuffer &to) const {
 	const MTPDserver_DH_inner_data &v(c_server_DH_inner_data());
@@ -17240,14 +18094,19 @@ inline mtpTypeId MTPclient_DH_Inner_Data::type() const {
 	return mtpc_client_DH_inner_data;
 }
 inline void MTPclient_DH_Inner_Data::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_client_DH_inner_data) throw mtpErrorUnexpected(cons, "MTPclient_DH_Inner_Data");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPclient_DH_Inner_Data");
+}
+inline mtpReadResult MTPclient_DH_Inner_Data::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_client_DH_inner_data) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDclient_DH_inner_data());
 	MTPDclient_DH_inner_data &v(_client_DH_inner_data());
-	v.vnonce.read(from, end);
-	v.vserver_nonce.read(from, end);
-	v.vretry_id.read(from, end);
-	v.vg_b.read(from, end);
+	if (mtpReadResult result = v.vnonce.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vserver_nonce.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vretry_id.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vg_b.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPclient_DH_Inner_Data::write(mtpBuffer &to) const {
 	const MTPDclient_DH_inner_data &v(c_client_DH_inner_data());
@@ -17284,31 +18143,36 @@ inline mtpTypeId MTPset_client_DH_params_answer::type() const {
 	return _type;
 }
 inline void MTPset_client_DH_params_answer::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPset_client_DH_params_answer");
+}
+inline mtpReadResult MTPset_client_DH_params_answer::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_dh_gen_ok: _type = cons; {
 			if (!data) setData(new MTPDdh_gen_ok());
 			MTPDdh_gen_ok &v(_dh_gen_ok());
-			v.vnonce.read(from, end);
-			v.vserver_nonce.read(from, end);
-			v.vnew_nonce_hash1.read(from, end);
+			if (mtpReadResult result = v.vnonce.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vserver_nonce.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vnew_nonce_hash1.tryRead(from, end)) return result;
 		} break;
 		case mtpc_dh_gen_retry: _type = cons; {
 			if (!data) setData(new MTPDdh_gen_retry());
 			MTPDdh_gen_retry &v(_dh_gen_retry());
-			v.vnonce.read(from, end);
-			v.vserver_nonce.read(from, end);
-			v.vnew_nonce_hash2.read(from, end);
+			if (mtpReadResult result = v.vnonce.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vserver_nonce.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vnew_nonce_hash2.tryRead(from, end)) return result;
 		} break;
 		case mtpc_dh_gen_fail: _type = cons; {
 			if (!data) setData(new MTPDdh_gen_fail());
 			MTPDdh_gen_fail &v(_dh_gen_fail());
-			v.vnonce.read(from, end);
-			v.vserver_nonce.read(from, end);
-			v.vnew_nonce_hash3.read(from, end);
+			if (mtpReadResult result = v.vnonce.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vserver_nonce.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vnew_nonce_hash3.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPset_client_DH_params_answer");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPset_client_DH_params_answer::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -17367,11 +18231,16 @@ inline mtpTypeId MTPmsgsAck::type() const {
 	return mtpc_msgs_ack;
 }
 inline void MTPmsgsAck::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_msgs_ack) throw mtpErrorUnexpected(cons, "MTPmsgsAck");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmsgsAck");
+}
+inline mtpReadResult MTPmsgsAck::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_msgs_ack) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDmsgs_ack());
 	MTPDmsgs_ack &v(_msgs_ack());
-	v.vmsg_ids.read(from, end);
+	if (mtpReadResult result = v.vmsg_ids.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPmsgsAck::write(mtpBuffer &to) const {
 	const MTPDmsgs_ack &v(c_msgs_ack());
@@ -17401,25 +18270,30 @@ inline mtpTypeId MTPbadMsgNotification::type() const {
 	return _type;
 }
 inline void MTPbadMsgNotification::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPbadMsgNotification");
+}
+inline mtpReadResult MTPbadMsgNotification::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_bad_msg_notification: _type = cons; {
 			if (!data) setData(new MTPDbad_msg_notification());
 			MTPDbad_msg_notification &v(_bad_msg_notification());
-			v.vbad_msg_id.read(from, end);
-			v.vbad_msg_seqno.read(from, end);
-			v.verror_code.read(from, end);
+			if (mtpReadResult result = v.vbad_msg_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vbad_msg_seqno.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.verror_code.tryRead(from, end)) return result;
 		} break;
 		case mtpc_bad_server_salt: _type = cons; {
 			if (!data) setData(new MTPDbad_server_salt());
 			MTPDbad_server_salt &v(_bad_server_salt());
-			v.vbad_msg_id.read(from, end);
-			v.vbad_msg_seqno.read(from, end);
-			v.verror_code.read(from, end);
-			v.vnew_server_salt.read(from, end);
+			if (mtpReadResult result = v.vbad_msg_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vbad_msg_seqno.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.verror_code.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vnew_server_salt.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPbadMsgNotification");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPbadMsgNotification::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -17467,11 +18341,16 @@ inline mtpTypeId MTPmsgsStateReq::type() const {
 	return mtpc_msgs_state_req;
 }
 inline void MTPmsgsStateReq::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_msgs_state_req) throw mtpErrorUnexpected(cons, "MTPmsgsStateReq");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmsgsStateReq");
+}
+inline mtpReadResult MTPmsgsStateReq::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_msgs_state_req) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDmsgs_state_req());
 	MTPDmsgs_state_req &v(_msgs_state_req());
-	v.vmsg_ids.read(from, end);
+	if (mtpReadResult result = v.vmsg_ids.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPmsgsStateReq::write(mtpBuffer &to) const {
 	const MTPDmsgs_state_req &v(c_msgs_state_req());
@@ -17494,12 +18373,17 @@ inline mtpTypeId MTPmsgsStateInfo::type() const {
 	return mtpc_msgs_state_info;
 }
 inline void MTPmsgsStateInfo::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_msgs_state_info) throw mtpErrorUnexpected(cons, "MTPmsgsStateInfo");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmsgsStateInfo");
+}
+inline mtpReadResult MTPmsgsStateInfo::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_msgs_state_info) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDmsgs_state_info());
 	MTPDmsgs_state_info &v(_msgs_state_info());
-	v.vreq_msg_id.read(from, end);
-	v.vinfo.read(from, end);
+	if (mtpReadResult result = v.vreq_msg_id.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vinfo.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPmsgsStateInfo::write(mtpBuffer &to) const {
 	const MTPDmsgs_state_info &v(c_msgs_state_info());
@@ -17523,12 +18407,17 @@ inline mtpTypeId MTPmsgsAllInfo::type() const {
 	return mtpc_msgs_all_info;
 }
 inline void MTPmsgsAllInfo::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_msgs_all_info) throw mtpErrorUnexpected(cons, "MTPmsgsAllInfo");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmsgsAllInfo");
+}
+inline mtpReadResult MTPmsgsAllInfo::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_msgs_all_info) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDmsgs_all_info());
 	MTPDmsgs_all_info &v(_msgs_all_info());
-	v.vmsg_ids.read(from, end);
-	v.vinfo.read(from, end);
+	if (mtpReadResult result = v.vmsg_ids.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vinfo.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPmsgsAllInfo::write(mtpBuffer &to) const {
 	const MTPDmsgs_all_info &v(c_msgs_all_info());
@@ -17559,25 +18448,30 @@ inline mtpTypeId MTPmsgDetailedInfo::type() const {
 	return _type;
 }
 inline void MTPmsgDetailedInfo::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmsgDetailedInfo");
+}
+inline mtpReadResult MTPmsgDetailedInfo::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_msg_detailed_info: _type = cons; {
 			if (!data) setData(new MTPDmsg_detailed_info());
 			MTPDmsg_detailed_info &v(_msg_detailed_info());
-			v.vmsg_id.read(from, end);
-			v.vanswer_msg_id.read(from, end);
-			v.vbytes.read(from, end);
-			v.vstatus.read(from, end);
+			if (mtpReadResult result = v.vmsg_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vanswer_msg_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vbytes.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vstatus.tryRead(from, end)) return result;
 		} break;
 		case mtpc_msg_new_detailed_info: _type = cons; {
 			if (!data) setData(new MTPDmsg_new_detailed_info());
 			MTPDmsg_new_detailed_info &v(_msg_new_detailed_info());
-			v.vanswer_msg_id.read(from, end);
-			v.vbytes.read(from, end);
-			v.vstatus.read(from, end);
+			if (mtpReadResult result = v.vanswer_msg_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vbytes.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vstatus.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPmsgDetailedInfo");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPmsgDetailedInfo::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -17625,11 +18519,16 @@ inline mtpTypeId MTPmsgResendReq::type() const {
 	return mtpc_msg_resend_req;
 }
 inline void MTPmsgResendReq::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_msg_resend_req) throw mtpErrorUnexpected(cons, "MTPmsgResendReq");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmsgResendReq");
+}
+inline mtpReadResult MTPmsgResendReq::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_msg_resend_req) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDmsg_resend_req());
 	MTPDmsg_resend_req &v(_msg_resend_req());
-	v.vmsg_ids.read(from, end);
+	if (mtpReadResult result = v.vmsg_ids.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPmsgResendReq::write(mtpBuffer &to) const {
 	const MTPDmsg_resend_req &v(c_msg_resend_req());
@@ -17652,12 +18551,17 @@ inline mtpTypeId MTPrpcError::type() const {
 	return mtpc_rpc_error;
 }
 inline void MTPrpcError::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_rpc_error) throw mtpErrorUnexpected(cons, "MTPrpcError");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPrpcError");
+}
+inline mtpReadResult MTPrpcError::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_rpc_error) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDrpc_error());
 	MTPDrpc_error &v(_rpc_error());
-	v.verror_code.read(from, end);
-	v.verror_message.read(from, end);
+	if (mtpReadResult result = v.verror_code.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.verror_message.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPrpcError::write(mtpBuffer &to) const {
 	const MTPDrpc_error &v(c_rpc_error());
@@ -17684,6 +18588,10 @@ inline mtpTypeId MTPrpcDropAnswer::type() const {
 	return _type;
 }
 inline void MTPrpcDropAnswer::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPrpcDropAnswer");
+}
+inline mtpReadResult MTPrpcDropAnswer::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_rpc_answer_unknown: _type = cons; break;
@@ -17691,12 +18599,13 @@ inline void MTPrpcDropAnswer::read(const mtpPrime *&from, const mtpPrime *end, m
 		case mtpc_rpc_answer_dropped: _type = cons; {
 			if (!data) setData(new MTPDrpc_answer_dropped());
 			MTPDrpc_answer_dropped &v(_rpc_answer_dropped());
-			v.vmsg_id.read(from, end);
-			v.vseq_no.read(from, end);
-			v.vbytes.read(from, end);
+			if (mtpReadResult result = v.vmsg_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vseq_no.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vbytes.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPrpcDropAnswer");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPrpcDropAnswer::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -17739,13 +18648,18 @@ inline mtpTypeId MTPfutureSalt::type() const {
 	return mtpc_future_salt;
 }
 inline void MTPfutureSalt::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_future_salt) throw mtpErrorUnexpected(cons, "MTPfutureSalt");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPfutureSalt");
+}
+inline mtpReadResult MTPfutureSalt::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_future_salt) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDfuture_salt());
 	MTPDfuture_salt &v(_future_salt());
-	v.vvalid_since.read(from, end);
-	v.vvalid_until.read(from, end);
-	v.vsalt.read(from, end);
+	if (mtpReadResult result = v.vvalid_since.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vvalid_until.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vsalt.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPfutureSalt::write(mtpBuffer &to) const {
 	const MTPDfuture_salt &v(c_future_salt());
@@ -17770,13 +18684,18 @@ inline mtpTypeId MTPfutureSalts::type() const {
 	return mtpc_future_salts;
 }
 inline void MTPfutureSalts::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_future_salts) throw mtpErrorUnexpected(cons, "MTPfutureSalts");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPfutureSalts");
+}
+inline mtpReadResult MTPfutureSalts::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_future_salts) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDfuture_salts());
 	MTPDfuture_salts &v(_future_salts());
-	v.vreq_msg_id.read(from, end);
-	v.vnow.read(from, end);
-	v.vsalts.read(from, end);
+	if (mtpReadResult result = v.vreq_msg_id.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vnow.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vsalts.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPfutureSalts::write(mtpBuffer &to) const {
 	const MTPDfuture_salts &v(c_future_salts());
@@ -17801,12 +18720,17 @@ inline mtpTypeId MTPpong::type() const {
 	return mtpc_pong;
 }
 inline void MTPpong::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_pong) throw mtpErrorUnexpected(cons, "MTPpong");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPpong");
+}
+inline mtpReadResult MTPpong::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_pong) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDpong());
 	MTPDpong &v(_pong());
-	v.vmsg_id.read(from, end);
-	v.vping_id.read(from, end);
+	if (mtpReadResult result = v.vmsg_id.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vping_id.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPpong::write(mtpBuffer &to) const {
 	const MTPDpong &v(c_pong());
@@ -17837,20 +18761,25 @@ inline mtpTypeId MTPdestroySessionRes::type() const {
 	return _type;
 }
 inline void MTPdestroySessionRes::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPdestroySessionRes");
+}
+inline mtpReadResult MTPdestroySessionRes::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_destroy_session_ok: _type = cons; {
 			if (!data) setData(new MTPDdestroy_session_ok());
 			MTPDdestroy_session_ok &v(_destroy_session_ok());
-			v.vsession_id.read(from, end);
+			if (mtpReadResult result = v.vsession_id.tryRead(from, end)) return result;
 		} break;
 		case mtpc_destroy_session_none: _type = cons; {
 			if (!data) setData(new MTPDdestroy_session_none());
 			MTPDdestroy_session_none &v(_destroy_session_none());
-			v.vsession_id.read(from, end);
+			if (mtpReadResult result = v.vsession_id.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPdestroySessionRes");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPdestroySessionRes::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -17893,13 +18822,18 @@ inline mtpTypeId MTPnewSession::type() const {
 	return mtpc_new_session_created;
 }
 inline void MTPnewSession::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_new_session_created) throw mtpErrorUnexpected(cons, "MTPnewSession");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPnewSession");
+}
+inline mtpReadResult MTPnewSession::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_new_session_created) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDnew_session_created());
 	MTPDnew_session_created &v(_new_session_created());
-	v.vfirst_msg_id.read(from, end);
-	v.vunique_id.read(from, end);
-	v.vserver_salt.read(from, end);
+	if (mtpReadResult result = v.vfirst_msg_id.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vunique_id.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vserver_salt.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPnewSession::write(mtpBuffer &to) const {
 	const MTPDnew_session_created &v(c_new_session_created());
@@ -17924,13 +18858,18 @@ inline mtpTypeId MTPhttpWait::type() const {
 	return mtpc_http_wait;
 }
 inline void MTPhttpWait::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_http_wait) throw mtpErrorUnexpected(cons, "MTPhttpWait");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPhttpWait");
+}
+inline mtpReadResult MTPhttpWait::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_http_wait) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDhttp_wait());
 	MTPDhttp_wait &v(_http_wait());
-	v.vmax_delay.read(from, end);
-	v.vwait_after.read(from, end);
-	v.vmax_wait.read(from, end);
+	if (mtpReadResult result = v.vmax_delay.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vwait_after.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vmax_wait.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPhttpWait::write(mtpBuffer &to) const {
 	const MTPDhttp_wait &v(c_http_wait());
@@ -17955,12 +18894,17 @@ inline mtpTypeId MTPerror::type() const {
 	return mtpc_error;
 }
 inline void MTPerror::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_error) throw mtpErrorUnexpected(cons, "MTPerror");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPerror");
+}
+inline mtpReadResult MTPerror::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_error) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDerror());
 	MTPDerror &v(_error());
-	v.vcode.read(from, end);
-	v.vtext.read(from, end);
+	if (mtpReadResult result = v.vcode.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vtext.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPerror::write(mtpBuffer &to) const {
 	const MTPDerror &v(c_error());
@@ -17980,6 +18924,11 @@ inline mtpTypeId MTPnull::type() const {
 	return mtpc_null;
 }
 inline void MTPnull::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPnull");
+}
+inline mtpReadResult MTPnull::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	return mtpReadDone;
 }
 inline void MTPnull::write(mtpBuffer &to) const {
 }
@@ -18009,6 +18958,10 @@ inline mtpTypeId MTPinputPeer::type() const {
 	return _type;
 }
 inline void MTPinputPeer::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputPeer");
+}
+inline mtpReadResult MTPinputPeer::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_inputPeerEmpty: _type = cons; break;
@@ -18016,21 +18969,22 @@ inline void MTPinputPeer::read(const mtpPrime *&from, const mtpPrime *end, mtpTy
 		case mtpc_inputPeerContact: _type = cons; {
 			if (!data) setData(new MTPDinputPeerContact());
 			MTPDinputPeerContact &v(_inputPeerContact());
-			v.vuser_id.read(from, end);
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputPeerForeign: _type = cons; {
 			if (!data) setData(new MTPDinputPeerForeign());
 			MTPDinputPeerForeign &v(_inputPeerForeign());
-			v.vuser_id.read(from, end);
-			v.vaccess_hash.read(from, end);
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputPeerChat: _type = cons; {
 			if (!data) setData(new MTPDinputPeerChat());
 			MTPDinputPeerChat &v(_inputPeerChat());
-			v.vchat_id.read(from, end);
+			if (mtpReadResult result = v.vchat_id.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPinputPeer");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPinputPeer::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -18099,6 +19053,10 @@ inline mtpTypeId MTPinputUser::type() const {
 	return _type;
 }
 inline void MTPinputUser::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputUser");
+}
+inline mtpReadResult MTPinputUser::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_inputUserEmpty: _type = cons; break;
@@ -18106,16 +19064,17 @@ inline void MTPinputUser::read(const mtpPrime *&from, const mtpPrime *end, mtpTy
 		case mtpc_inputUserContact: _type = cons; {
 			if (!data) setData(new MTPDinputUserContact());
 			MTPDinputUserContact &v(_inputUserContact());
-			v.vuser_id.read(from, end);
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputUserForeign: _type = cons; {
 			if (!data) setData(new MTPDinputUserForeign());
 			MTPDinputUserForeign &v(_inputUserForeign());
-			v.vuser_id.read(from, end);
-			v.vaccess_hash.read(from, end);
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPinputUser");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPinputUser::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -18167,14 +19126,19 @@ inline mtpTypeId MTPinputContact::type() const {
 	return mtpc_inputPhoneContact;
 }
 inline void MTPinputContact::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_inputPhoneContact) throw mtpErrorUnexpected(cons, "MTPinputContact");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputContact");
+}
+inline mtpReadResult MTPinputContact::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_inputPhoneContact) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDinputPhoneContact());
 	MTPDinputPhoneContact &v(_inputPhoneContact());
-	v.vclient_id.read(from, end);
-	v.vphone.read(from, end);
-	v.vfirst_name.read(from, end);
-	v.vlast_name.read(from, end);
+	if (mtpReadResult result = v.vclient_id.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vphone.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vfirst_name.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vlast_name.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPinputContact::write(mtpBuffer &to) const {
 	const MTPDinputPhoneContact &v(c_inputPhoneContact());
@@ -18207,25 +19171,30 @@ inline mtpTypeId MTPinputFile::type() const {
 	return _type;
 }
 inline void MTPinputFile::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputFile");
+}
+inline mtpReadResult MTPinputFile::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_inputFile: _type = cons; {
 			if (!data) setData(new MTPDinputFile());
 			MTPDinputFile &v(_inputFile());
-			v.vid.read(from, end);
-			v.vparts.read(from, end);
-			v.vname.read(from, end);
-			v.vmd5_checksum.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vparts.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vname.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmd5_checksum.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputFileBig: _type = cons; {
 			if (!data) setData(new MTPDinputFileBig());
 			MTPDinputFileBig &v(_inputFileBig());
-			v.vid.read(from, end);
-			v.vparts.read(from, end);
-			v.vname.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vparts.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vname.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPinputFile");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPinputFile::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -18324,101 +19293,106 @@ inline mtpTypeId MTPinputMedia::type() const {
 	return _type;
 }
 inline void MTPinputMedia::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputMedia");
+}
+inline mtpReadResult MTPinputMedia::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_inputMediaEmpty: _type = cons; break;
 		case mtpc_inputMediaUploadedPhoto: _type = cons; {
 			if (!data) setData(new MTPDinputMediaUploadedPhoto());
 			MTPDinputMediaUploadedPhoto &v(_inputMediaUploadedPhoto());
-			v.vfile.read(from, end);
-			v.vcaption.read(from, end);
+			if (mtpReadResult result = v.vfile.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vcaption.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputMediaPhoto: _type = cons; {
 			if (!data) setData(new MTPDinputMediaPhoto());
 			MTPDinputMediaPhoto &v(_inputMediaPhoto());
-			v.vid.read(from, end);
-			v.vcaption.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vcaption.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputMediaGeoPoint: _type = cons; {
 			if (!data) setData(new MTPDinputMediaGeoPoint());
 			MTPDinputMediaGeoPoint &v(_inputMediaGeoPoint());
-			v.vgeo_point.read(from, end);
+			if (mtpReadResult result = v.vgeo_point.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputMediaContact: _type = cons; {
 			if (!data) setData(new MTPDinputMediaContact());
 			MTPDinputMediaContact &v(_inputMediaContact());
-			v.vphone_number.read(from, end);
-			v.vfirst_name.read(from, end);
-			v.vlast_name.read(from, end);
+			if (mtpReadResult result = v.vphone_number.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vfirst_name.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vlast_name.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputMediaUploadedVideo: _type = cons; {
 			if (!data) setData(new MTPDinputMediaUploadedVideo());
 			MTPDinputMediaUploadedVideo &v(_inputMediaUploadedVideo());
-			v.vfile.read(from, end);
-			v.vduration.read(from, end);
-			v.vw.read(from, end);
-			v.vh.read(from, end);
-			v.vcaption.read(from, end);
+			if (mtpReadResult result = v.vfile.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vduration.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vw.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vh.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vcaption.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputMediaUploadedThumbVideo: _type = cons; {
 			if (!data) setData(new MTPDinputMediaUploadedThumbVideo());
 			MTPDinputMediaUploadedThumbVideo &v(_inputMediaUploadedThumbVideo());
-			v.vfile.read(from, end);
-			v.vthumb.read(from, end);
-			v.vduration.read(from, end);
-			v.vw.read(from, end);
-			v.vh.read(from, end);
-			v.vcaption.read(from, end);
+			if (mtpReadResult result = v.vfile.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vthumb.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vduration.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vw.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vh.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vcaption.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputMediaVideo: _type = cons; {
 			if (!data) setData(new MTPDinputMediaVideo());
 			MTPDinputMediaVideo &v(_inputMediaVideo());
-			v.vid.read(from, end);
-			v.vcaption.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vcaption.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputMediaUploadedAudio: _type = cons; {
 			if (!data) setData(new MTPDinputMediaUploadedAudio());
 			MTPDinputMediaUploadedAudio &v(_inputMediaUploadedAudio());
-			v.vfile.read(from, end);
-			v.vduration.read(from, end);
-			v.vmime_type.read(from, end);
+			if (mtpReadResult result = v.vfile.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vduration.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmime_type.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputMediaAudio: _type = cons; {
 			if (!data) setData(new MTPDinputMediaAudio());
 			MTPDinputMediaAudio &v(_inputMediaAudio());
-			v.vid.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputMediaUploadedDocument: _type = cons; {
 			if (!data) setData(new MTPDinputMediaUploadedDocument());
 			MTPDinputMediaUploadedDocument &v(_inputMediaUploadedDocument());
-			v.vfile.read(from, end);
-			v.vmime_type.read(from, end);
-			v.vattributes.read(from, end);
+			if (mtpReadResult result = v.vfile.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmime_type.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vattributes.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputMediaUploadedThumbDocument: _type = cons; {
 			if (!data) setData(new MTPDinputMediaUploadedThumbDocument());
 			MTPDinputMediaUploadedThumbDocument &v(_inputMediaUploadedThumbDocument());
-			v.vfile.read(from, end);
-			v.vthumb.read(from, end);
-			v.vmime_type.read(from, end);
-			v.vattributes.read(from, end);
+			if (mtpReadResult result = v.vfile.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vthumb.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmime_type.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vattributes.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputMediaDocument: _type = cons; {
 			if (!data) setData(new MTPDinputMediaDocument());
 			MTPDinputMediaDocument &v(_inputMediaDocument());
-			v.vid.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputMediaVenue: _type = cons; {
 			if (!data) setData(new MTPDinputMediaVenue());
 			MTPDinputMediaVenue &v(_inputMediaVenue());
-			v.vgeo_point.read(from, end);
-			v.vtitle.read(from, end);
-			v.vaddress.read(from, end);
-			v.vprovider.read(from, end);
-			v.vvenue_id.read(from, end);
+			if (mtpReadResult result = v.vgeo_point.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vtitle.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaddress.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vprovider.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vvenue_id.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPinputMedia");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPinputMedia::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -18607,23 +19581,28 @@ inline mtpTypeId MTPinputChatPhoto::type() const {
 	return _type;
 }
 inline void MTPinputChatPhoto::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputChatPhoto");
+}
+inline mtpReadResult MTPinputChatPhoto::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_inputChatPhotoEmpty: _type = cons; break;
 		case mtpc_inputChatUploadedPhoto: _type = cons; {
 			if (!data) setData(new MTPDinputChatUploadedPhoto());
 			MTPDinputChatUploadedPhoto &v(_inputChatUploadedPhoto());
-			v.vfile.read(from, end);
-			v.vcrop.read(from, end);
+			if (mtpReadResult result = v.vfile.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vcrop.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputChatPhoto: _type = cons; {
 			if (!data) setData(new MTPDinputChatPhoto());
 			MTPDinputChatPhoto &v(_inputChatPhoto());
-			v.vid.read(from, end);
-			v.vcrop.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vcrop.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPinputChatPhoto");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPinputChatPhoto::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -18675,17 +19654,22 @@ inline mtpTypeId MTPinputGeoPoint::type() const {
 	return _type;
 }
 inline void MTPinputGeoPoint::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputGeoPoint");
+}
+inline mtpReadResult MTPinputGeoPoint::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_inputGeoPointEmpty: _type = cons; break;
 		case mtpc_inputGeoPoint: _type = cons; {
 			if (!data) setData(new MTPDinputGeoPoint());
 			MTPDinputGeoPoint &v(_inputGeoPoint());
-			v.vlat.read(from, end);
-			v.vlong.read(from, end);
+			if (mtpReadResult result = v.vlat.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vlong.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPinputGeoPoint");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPinputGeoPoint::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -18726,17 +19710,22 @@ inline mtpTypeId MTPinputPhoto::type() const {
 	return _type;
 }
 inline void MTPinputPhoto::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputPhoto");
+}
+inline mtpReadResult MTPinputPhoto::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_inputPhotoEmpty: _type = cons; break;
 		case mtpc_inputPhoto: _type = cons; {
 			if (!data) setData(new MTPDinputPhoto());
 			MTPDinputPhoto &v(_inputPhoto());
-			v.vid.read(from, end);
-			v.vaccess_hash.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPinputPhoto");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPinputPhoto::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -18777,17 +19766,22 @@ inline mtpTypeId MTPinputVideo::type() const {
 	return _type;
 }
 inline void MTPinputVideo::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputVideo");
+}
+inline mtpReadResult MTPinputVideo::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_inputVideoEmpty: _type = cons; break;
 		case mtpc_inputVideo: _type = cons; {
 			if (!data) setData(new MTPDinputVideo());
 			MTPDinputVideo &v(_inputVideo());
-			v.vid.read(from, end);
-			v.vaccess_hash.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPinputVideo");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPinputVideo::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -18844,41 +19838,46 @@ inline mtpTypeId MTPinputFileLocation::type() const {
 	return _type;
 }
 inline void MTPinputFileLocation::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputFileLocation");
+}
+inline mtpReadResult MTPinputFileLocation::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_inputFileLocation: _type = cons; {
 			if (!data) setData(new MTPDinputFileLocation());
 			MTPDinputFileLocation &v(_inputFileLocation());
-			v.vvolume_id.read(from, end);
-			v.vlocal_id.read(from, end);
-			v.vsecret.read(from, end);
+			if (mtpReadResult result = v.vvolume_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vlocal_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vsecret.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputVideoFileLocation: _type = cons; {
 			if (!data) setData(new MTPDinputVideoFileLocation());
 			MTPDinputVideoFileLocation &v(_inputVideoFileLocation());
-			v.vid.read(from, end);
-			v.vaccess_hash.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputEncryptedFileLocation: _type = cons; {
 			if (!data) setData(new MTPDinputEncryptedFileLocation());
 			MTPDinputEncryptedFileLocation &v(_inputEncryptedFileLocation());
-			v.vid.read(from, end);
-			v.vaccess_hash.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputAudioFileLocation: _type = cons; {
 			if (!data) setData(new MTPDinputAudioFileLocation());
 			MTPDinputAudioFileLocation &v(_inputAudioFileLocation());
-			v.vid.read(from, end);
-			v.vaccess_hash.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputDocumentFileLocation: _type = cons; {
 			if (!data) setData(new MTPDinputDocumentFileLocation());
 			MTPDinputDocumentFileLocation &v(_inputDocumentFileLocation());
-			v.vid.read(from, end);
-			v.vaccess_hash.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPinputFileLocation");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPinputFileLocation::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -18960,18 +19959,23 @@ inline mtpTypeId MTPinputPhotoCrop::type() const {
 	return _type;
 }
 inline void MTPinputPhotoCrop::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputPhotoCrop");
+}
+inline mtpReadResult MTPinputPhotoCrop::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_inputPhotoCropAuto: _type = cons; break;
 		case mtpc_inputPhotoCrop: _type = cons; {
 			if (!data) setData(new MTPDinputPhotoCrop());
 			MTPDinputPhotoCrop &v(_inputPhotoCrop());
-			v.vcrop_left.read(from, end);
-			v.vcrop_top.read(from, end);
-			v.vcrop_width.read(from, end);
+			if (mtpReadResult result = v.vcrop_left.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vcrop_top.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vcrop_width.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPinputPhotoCrop");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPinputPhotoCrop::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -19010,14 +20014,19 @@ inline mtpTypeId MTPinputAppEvent::type() const {
 	return mtpc_inputAppEvent;
 }
 inline void MTPinputAppEvent::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_inputAppEvent) throw mtpErrorUnexpected(cons, "MTPinputAppEvent");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputAppEvent");
+}
+inline mtpReadResult MTPinputAppEvent::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_inputAppEvent) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDinputAppEvent());
 	MTPDinputAppEvent &v(_inputAppEvent());
-	v.vtime.read(from, end);
-	v.vtype.read(from, end);
-	v.vpeer.read(from, end);
-	v.vdata.read(from, end);
+	if (mtpReadResult result = v.vtime.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vtype.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vpeer.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vdata.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPinputAppEvent::write(mtpBuffer &to) const {
 	const MTPDinputAppEvent &v(c_inputAppEvent());
@@ -19050,20 +20059,25 @@ inline mtpTypeId MTPpeer::type() const {
 	return _type;
 }
 inline void MTPpeer::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPpeer");
+}
+inline mtpReadResult MTPpeer::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_peerUser: _type = cons; {
 			if (!data) setData(new MTPDpeerUser());
 			MTPDpeerUser &v(_peerUser());
-			v.vuser_id.read(from, end);
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
 		} break;
 		case mtpc_peerChat: _type = cons; {
 			if (!data) setData(new MTPDpeerChat());
 			MTPDpeerChat &v(_peerChat());
-			v.vchat_id.read(from, end);
+			if (mtpReadResult result = v.vchat_id.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPpeer");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPpeer::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -19103,6 +20117,10 @@ inline mtpTypeId MTPstorage_fileType::type() const {
 	return _type;
 }
 inline void MTPstorage_fileType::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPstorage_fileType");
+}
+inline mtpReadResult MTPstorage_fileType::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	switch (cons) {
 		case mtpc_storage_fileUnknown: _type = cons; break;
 		case mtpc_storage_fileJpeg: _type = cons; break;
@@ -19114,8 +20132,9 @@ inline void MTPstorage_fileType::read(const mtpPrime *&from, const mtpPrime *end
 		case mtpc_storage_filePartial: _type = cons; break;
 		case mtpc_storage_fileMp4: _type = cons; break;
 		case mtpc_storage_fileWebp: _type = cons; break;
-		default: throw mtpErrorUnexpected(cons, "MTPstorage_fileType");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPstorage_fileType::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -19185,25 +20204,30 @@ inline mtpTypeId MTPfileLocation::type() const {
 	return _type;
 }
 inline void MTPfileLocation::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPfileLocation");
+}
+inline mtpReadResult MTPfileLocation::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_fileLocationUnavailable: _type = cons; {
 			if (!data) setData(new MTPDfileLocationUnavailable());
 			MTPDfileLocationUnavailable &v(_fileLocationUnavailable());
-			v.vvolume_id.read(from, end);
-			v.vlocal_id.read(from, end);
-			v.vsecret.read(from, end);
+			if (mtpReadResult result = v.vvolume_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vlocal_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vsecret.tryRead(from, end)) return result;
 		} break;
 		case mtpc_fileLocation: _type = cons; {
 			if (!data) setData(new MTPDfileLocation());
 			MTPDfileLocation &v(_fileLocation());
-			v.vdc_id.read(from, end);
-			v.vvolume_id.read(from, end);
-			v.vlocal_id.read(from, end);
-			v.vsecret.read(from, end);
+			if (mtpReadResult result = v.vdc_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vvolume_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vlocal_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vsecret.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPfileLocation");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPfileLocation::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -19258,29 +20282,34 @@ inline mtpTypeId MTPuser::type() const {
 	return _type;
 }
 inline void MTPuser::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPuser");
+}
+inline mtpReadResult MTPuser::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_userEmpty: _type = cons; {
 			if (!data) setData(new MTPDuserEmpty());
 			MTPDuserEmpty &v(_userEmpty());
-			v.vid.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
 		} break;
 		case mtpc_user: _type = cons; {
 			if (!data) setData(new MTPDuser());
 			MTPDuser &v(_user());
-			v.vflags.read(from, end);
-			v.vid.read(from, end);
-			if (v.has_access_hash()) { v.vaccess_hash.read(from, end); } else { v.vaccess_hash = MTPlong(); }
-			if (v.has_first_name()) { v.vfirst_name.read(from, end); } else { v.vfirst_name = MTPstring(); }
-			if (v.has_last_name()) { v.vlast_name.read(from, end); } else { v.vlast_name = MTPstring(); }
-			if (v.has_username()) { v.vusername.read(from, end); } else { v.vusername = MTPstring(); }
-			if (v.has_phone()) { v.vphone.read(from, end); } else { v.vphone = MTPstring(); }
-			if (v.has_photo()) { v.vphoto.read(from, end); } else { v.vphoto = MTPUserProfilePhoto(); }
-			if (v.has_status()) { v.vstatus.read(from, end); } else { v.vstatus = MTPUserStatus(); }
-			if (v.has_bot_info_version()) { v.vbot_info_version.read(from, end); } else { v.vbot_info_version = MTPint(); }
+			if (mtpReadResult result = v.vflags.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (v.has_access_hash()) { if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result; } else { v.vaccess_hash = MTPlong(); }
+			if (v.has_first_name()) { if (mtpReadResult result = v.vfirst_name.tryRead(from, end)) return result; } else { v.vfirst_name = MTPstring(); }
+			if (v.has_last_name()) { if (mtpReadResult result = v.vlast_name.tryRead(from, end)) return result; } else { v.vlast_name = MTPstring(); }
+			if (v.has_username()) { if (mtpReadResult result = v.vusername.tryRead(from, end)) return result; } else { v.vusername = MTPstring(); }
+			if (v.has_phone()) { if (mtpReadResult result = v.vphone.tryRead(from, end)) return result; } else { v.vphone = MTPstring(); }
+			if (v.has_photo()) { if (mtpReadResult result = v.vphoto.tryRead(from, end)) return result; } else { v.vphoto = MTPUserProfilePhoto(); }
+			if (v.has_status()) { if (mtpReadResult result = v.vstatus.tryRead(from, end)) return result; } else { v.vstatus = MTPUserStatus(); }
+			if (v.has_bot_info_version()) { if (mtpReadResult result = v.vbot_info_version.tryRead(from, end)) return result; } else { v.vbot_info_version = MTPint(); }
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPuser");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPuser::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -19335,18 +20364,23 @@ inline mtpTypeId MTPuserProfilePhoto::type() const {
 	return _type;
 }
 inline void MTPuserProfilePhoto::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPuserProfilePhoto");
+}
+inline mtpReadResult MTPuserProfilePhoto::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_userProfilePhotoEmpty: _type = cons; break;
 		case mtpc_userProfilePhoto: _type = cons; {
 			if (!data) setData(new MTPDuserProfilePhoto());
 			MTPDuserProfilePhoto &v(_userProfilePhoto());
-			v.vphoto_id.read(from, end);
-			v.vphoto_small.read(from, end);
-			v.vphoto_big.read(from, end);
+			if (mtpReadResult result = v.vphoto_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vphoto_small.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vphoto_big.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPuserProfilePhoto");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPuserProfilePhoto::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -19392,24 +20426,29 @@ inline mtpTypeId MTPuserStatus::type() const {
 	return _type;
 }
 inline void MTPuserStatus::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPuserStatus");
+}
+inline mtpReadResult MTPuserStatus::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_userStatusEmpty: _type = cons; break;
 		case mtpc_userStatusOnline: _type = cons; {
 			if (!data) setData(new MTPDuserStatusOnline());
 			MTPDuserStatusOnline &v(_userStatusOnline());
-			v.vexpires.read(from, end);
+			if (mtpReadResult result = v.vexpires.tryRead(from, end)) return result;
 		} break;
 		case mtpc_userStatusOffline: _type = cons; {
 			if (!data) setData(new MTPDuserStatusOffline());
 			MTPDuserStatusOffline &v(_userStatusOffline());
-			v.vwas_online.read(from, end);
+			if (mtpReadResult result = v.vwas_online.tryRead(from, end)) return result;
 		} break;
 		case mtpc_userStatusRecently: _type = cons; break;
 		case mtpc_userStatusLastWeek: _type = cons; break;
 		case mtpc_userStatusLastMonth: _type = cons; break;
-		default: throw mtpErrorUnexpected(cons, "MTPuserStatus");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPuserStatus::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -19483,48 +20522,53 @@ inline mtpTypeId MTPchat::type() const {
 	return _type;
 }
 inline void MTPchat::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPchat");
+}
+inline mtpReadResult MTPchat::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_chatEmpty: _type = cons; {
 			if (!data) setData(new MTPDchatEmpty());
 			MTPDchatEmpty &v(_chatEmpty());
-			v.vid.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
 		} break;
 		case mtpc_chat: _type = cons; {
 			if (!data) setData(new MTPDchat());
 			MTPDchat &v(_chat());
-			v.vid.read(from, end);
-			v.vtitle.read(from, end);
-			v.vphoto.read(from, end);
-			v.vparticipants_count.read(from, end);
-			v.vdate.read(from, end);
-			v.vleft.read(from, end);
-			v.vversion.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vtitle.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vphoto.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vparticipants_count.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vleft.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vversion.tryRead(from, end)) return result;
 		} break;
 		case mtpc_chatForbidden: _type = cons; {
 			if (!data) setData(new MTPDchatForbidden());
 			MTPDchatForbidden &v(_chatForbidden());
-			v.vid.read(from, end);
-			v.vtitle.read(from, end);
-			v.vdate.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vtitle.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
 		} break;
 		case mtpc_geoChat: _type = cons; {
 			if (!data) setData(new MTPDgeoChat());
 			MTPDgeoChat &v(_geoChat());
-			v.vid.read(from, end);
-			v.vaccess_hash.read(from, end);
-			v.vtitle.read(from, end);
-			v.vaddress.read(from, end);
-			v.vvenue.read(from, end);
-			v.vgeo.read(from, end);
-			v.vphoto.read(from, end);
-			v.vparticipants_count.read(from, end);
-			v.vdate.read(from, end);
-			v.vchecked_in.read(from, end);
-			v.vversion.read(from, end);
-		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPchat");
-	}
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vtitle.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaddress.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vvenue.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vgeo.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vphoto.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vparticipants_count.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vchecked_in.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vversion.tryRead(from, end)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
 }
 inline void MTPchat::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -19605,16 +20649,21 @@ inline mtpTypeId MTPchatFull::type() const {
 	return mtpc_chatFull;
 }
 inline void MTPchatFull::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_chatFull) throw mtpErrorUnexpected(cons, "MTPchatFull");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPchatFull");
+}
+inline mtpReadResult MTPchatFull::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_chatFull) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDchatFull());
 	MTPDchatFull &v(_chatFull());
-	v.vid.read(from, end);
-	v.vparticipants.read(from, end);
-	v.vchat_photo.read(from, end);
-	v.vnotify_settings.read(from, end);
-	v.vexported_invite.read(from, end);
-	v.vbot_info.read(from, end);
+	if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vparticipants.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vchat_photo.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vnotify_settings.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vexported_invite.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vbot_info.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPchatFull::write(mtpBuffer &to) const {
 	const MTPDchatFull &v(c_chatFull());
@@ -19642,13 +20691,18 @@ inline mtpTypeId MTPchatParticipant::type() const {
 	return mtpc_chatParticipant;
 }
 inline void MTPchatParticipant::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_chatParticipant) throw mtpErrorUnexpected(cons, "MTPchatParticipant");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPchatParticipant");
+}
+inline mtpReadResult MTPchatParticipant::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_chatParticipant) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDchatParticipant());
 	MTPDchatParticipant &v(_chatParticipant());
-	v.vuser_id.read(from, end);
-	v.vinviter_id.read(from, end);
-	v.vdate.read(from, end);
+	if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vinviter_id.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPchatParticipant::write(mtpBuffer &to) const {
 	const MTPDchatParticipant &v(c_chatParticipant());
@@ -19680,23 +20734,28 @@ inline mtpTypeId MTPchatParticipants::type() const {
 	return _type;
 }
 inline void MTPchatParticipants::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPchatParticipants");
+}
+inline mtpReadResult MTPchatParticipants::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_chatParticipantsForbidden: _type = cons; {
 			if (!data) setData(new MTPDchatParticipantsForbidden());
 			MTPDchatParticipantsForbidden &v(_chatParticipantsForbidden());
-			v.vchat_id.read(from, end);
+			if (mtpReadResult result = v.vchat_id.tryRead(from, end)) return result;
 		} break;
 		case mtpc_chatParticipants: _type = cons; {
 			if (!data) setData(new MTPDchatParticipants());
 			MTPDchatParticipants &v(_chatParticipants());
-			v.vchat_id.read(from, end);
-			v.vadmin_id.read(from, end);
-			v.vparticipants.read(from, end);
-			v.vversion.read(from, end);
+			if (mtpReadResult result = v.vchat_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vadmin_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vparticipants.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vversion.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPchatParticipants");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPchatParticipants::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -19745,17 +20804,22 @@ inline mtpTypeId MTPchatPhoto::type() const {
 	return _type;
 }
 inline void MTPchatPhoto::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPchatPhoto");
+}
+inline mtpReadResult MTPchatPhoto::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_chatPhotoEmpty: _type = cons; break;
 		case mtpc_chatPhoto: _type = cons; {
 			if (!data) setData(new MTPDchatPhoto());
 			MTPDchatPhoto &v(_chatPhoto());
-			v.vphoto_small.read(from, end);
-			v.vphoto_big.read(from, end);
+			if (mtpReadResult result = v.vphoto_small.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vphoto_big.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPchatPhoto");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPchatPhoto::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -19804,40 +20868,45 @@ inline mtpTypeId MTPmessage::type() const {
 	return _type;
 }
 inline void MTPmessage::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessage");
+}
+inline mtpReadResult MTPmessage::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_messageEmpty: _type = cons; {
 			if (!data) setData(new MTPDmessageEmpty());
 			MTPDmessageEmpty &v(_messageEmpty());
-			v.vid.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
 		} break;
 		case mtpc_message: _type = cons; {
 			if (!data) setData(new MTPDmessage());
 			MTPDmessage &v(_message());
-			v.vflags.read(from, end);
-			v.vid.read(from, end);
-			v.vfrom_id.read(from, end);
-			v.vto_id.read(from, end);
-			if (v.has_fwd_from_id()) { v.vfwd_from_id.read(from, end); } else { v.vfwd_from_id = MTPint(); }
-			if (v.has_fwd_date()) { v.vfwd_date.read(from, end); } else { v.vfwd_date = MTPint(); }
-			if (v.has_reply_to_msg_id()) { v.vreply_to_msg_id.read(from, end); } else { v.vreply_to_msg_id = MTPint(); }
-			v.vdate.read(from, end);
-			v.vmessage.read(from, end);
-			v.vmedia.read(from, end);
-			if (v.has_reply_markup()) { v.vreply_markup.read(from, end); } else { v.vreply_markup = MTPReplyMarkup(); }
+			if (mtpReadResult result = v.vflags.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vfrom_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vto_id.tryRead(from, end)) return result;
+			if (v.has_fwd_from_id()) { if (mtpReadResult result = v.vfwd_from_id.tryRead(from, end)) return result; } else { v.vfwd_from_id = MTPint(); }
+			if (v.has_fwd_date()) { if (mtpReadResult result = v.vfwd_date.tryRead(from, end)) return result; } else { v.vfwd_date = MTPint(); }
+			if (v.has_reply_to_msg_id()) { if (mtpReadResult result = v.vreply_to_msg_id.tryRead(from, end)) return result; } else { v.vreply_to_msg_id = MTPint(); }
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmessage.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmedia.tryRead(from, end)) return result;
+			if (v.has_reply_markup()) { if (mtpReadResult result = v.vreply_markup.tryRead(from, end)) return result; } else { v.vreply_markup = MTPReplyMarkup(); }
 		} break;
 		case mtpc_messageService: _type = cons; {
 			if (!data) setData(new MTPDmessageService());
 			MTPDmessageService &v(_messageService());
-			v.vflags.read(from, end);
-			v.vid.read(from, end);
-			v.vfrom_id.read(from, end);
-			v.vto_id.read(from, end);
-			v.vdate.read(from, end);
-			v.vaction.read(from, end);
+			if (mtpReadResult result = v.vflags.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vfrom_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vto_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaction.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPmessage");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPmessage::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -19936,61 +21005,66 @@ inline mtpTypeId MTPmessageMedia::type() const {
 	return _type;
 }
 inline void MTPmessageMedia::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessageMedia");
+}
+inline mtpReadResult MTPmessageMedia::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_messageMediaEmpty: _type = cons; break;
 		case mtpc_messageMediaPhoto: _type = cons; {
 			if (!data) setData(new MTPDmessageMediaPhoto());
 			MTPDmessageMediaPhoto &v(_messageMediaPhoto());
-			v.vphoto.read(from, end);
-			v.vcaption.read(from, end);
+			if (mtpReadResult result = v.vphoto.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vcaption.tryRead(from, end)) return result;
 		} break;
 		case mtpc_messageMediaVideo: _type = cons; {
 			if (!data) setData(new MTPDmessageMediaVideo());
 			MTPDmessageMediaVideo &v(_messageMediaVideo());
-			v.vvideo.read(from, end);
-			v.vcaption.read(from, end);
+			if (mtpReadResult result = v.vvideo.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vcaption.tryRead(from, end)) return result;
 		} break;
 		case mtpc_messageMediaGeo: _type = cons; {
 			if (!data) setData(new MTPDmessageMediaGeo());
 			MTPDmessageMediaGeo &v(_messageMediaGeo());
-			v.vgeo.read(from, end);
+			if (mtpReadResult result = v.vgeo.tryRead(from, end)) return result;
 		} break;
 		case mtpc_messageMediaContact: _type = cons; {
 			if (!data) setData(new MTPDmessageMediaContact());
 			MTPDmessageMediaContact &v(_messageMediaContact());
-			v.vphone_number.read(from, end);
-			v.vfirst_name.read(from, end);
-			v.vlast_name.read(from, end);
-			v.vuser_id.read(from, end);
+			if (mtpReadResult result = v.vphone_number.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vfirst_name.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vlast_name.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
 		} break;
 		case mtpc_messageMediaUnsupported: _type = cons; break;
 		case mtpc_messageMediaDocument: _type = cons; {
 			if (!data) setData(new MTPDmessageMediaDocument());
 			MTPDmessageMediaDocument &v(_messageMediaDocument());
-			v.vdocument.read(from, end);
+			if (mtpReadResult result = v.vdocument.tryRead(from, end)) return result;
 		} break;
 		case mtpc_messageMediaAudio: _type = cons; {
 			if (!data) setData(new MTPDmessageMediaAudio());
 			MTPDmessageMediaAudio &v(_messageMediaAudio());
-			v.vaudio.read(from, end);
+			if (mtpReadResult result = v.vaudio.tryRead(from, end)) return result;
 		} break;
 		case mtpc_messageMediaWebPage: _type = cons; {
 			if (!data) setData(new MTPDmessageMediaWebPage());
 			MTPDmessageMediaWebPage &v(_messageMediaWebPage());
-			v.vwebpage.read(from, end);
+			if (mtpReadResult result = v.vwebpage.tryRead(from, end)) return result;
 		} break;
 		case mtpc_messageMediaVenue: _type = cons; {
 			if (!data) setData(new MTPDmessageMediaVenue());
 			MTPDmessageMediaVenue &v(_messageMediaVenue());
-			v.vgeo.read(from, end);
-			v.vtitle.read(from, end);
-			v.vaddress.read(from, end);
-			v.vprovider.read(from, end);
-			v.vvenue_id.read(from, end);
+			if (mtpReadResult result = v.vgeo.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vtitle.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaddress.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vprovider.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vvenue_id.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPmessageMedia");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPmessageMedia::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -20137,50 +21211,55 @@ inline mtpTypeId MTPmessageAction::type() const {
 	return _type;
 }
 inline void MTPmessageAction::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessageAction");
+}
+inline mtpReadResult MTPmessageAction::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_messageActionEmpty: _type = cons; break;
 		case mtpc_messageActionChatCreate: _type = cons; {
 			if (!data) setData(new MTPDmessageActionChatCreate());
 			MTPDmessageActionChatCreate &v(_messageActionChatCreate());
-			v.vtitle.read(from, end);
-			v.vusers.read(from, end);
+			if (mtpReadResult result = v.vtitle.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
 		} break;
 		case mtpc_messageActionChatEditTitle: _type = cons; {
 			if (!data) setData(new MTPDmessageActionChatEditTitle());
 			MTPDmessageActionChatEditTitle &v(_messageActionChatEditTitle());
-			v.vtitle.read(from, end);
+			if (mtpReadResult result = v.vtitle.tryRead(from, end)) return result;
 		} break;
 		case mtpc_messageActionChatEditPhoto: _type = cons; {
 			if (!data) setData(new MTPDmessageActionChatEditPhoto());
 			MTPDmessageActionChatEditPhoto &v(_messageActionChatEditPhoto());
-			v.vphoto.read(from, end);
+			if (mtpReadResult result = v.vphoto.tryRead(from, end)) return result;
 		} break;
 		case mtpc_messageActionChatDeletePhoto: _type = cons; break;
 		case mtpc_messageActionChatAddUser: _type = cons; {
 			if (!data) setData(new MTPDmessageActionChatAddUser());
 			MTPDmessageActionChatAddUser &v(_messageActionChatAddUser());
-			v.vuser_id.read(from, end);
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
 		} break;
 		case mtpc_messageActionChatDeleteUser: _type = cons; {
 			if (!data) setData(new MTPDmessageActionChatDeleteUser());
 			MTPDmessageActionChatDeleteUser &v(_messageActionChatDeleteUser());
-			v.vuser_id.read(from, end);
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
 		} break;
 		case mtpc_messageActionGeoChatCreate: _type = cons; {
 			if (!data) setData(new MTPDmessageActionGeoChatCreate());
 			MTPDmessageActionGeoChatCreate &v(_messageActionGeoChatCreate());
-			v.vtitle.read(from, end);
-			v.vaddress.read(from, end);
+			if (mtpReadResult result = v.vtitle.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaddress.tryRead(from, end)) return result;
 		} break;
 		case mtpc_messageActionGeoChatCheckin: _type = cons; break;
 		case mtpc_messageActionChatJoinedByLink: _type = cons; {
 			if (!data) setData(new MTPDmessageActionChatJoinedByLink());
 			MTPDmessageActionChatJoinedByLink &v(_messageActionChatJoinedByLink());
-			v.vinviter_id.read(from, end);
+			if (mtpReadResult result = v.vinviter_id.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPmessageAction");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPmessageAction::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -20287,15 +21366,20 @@ inline mtpTypeId MTPdialog::type() const {
 	return mtpc_dialog;
 }
 inline void MTPdialog::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_dialog) throw mtpErrorUnexpected(cons, "MTPdialog");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPdialog");
+}
+inline mtpReadResult MTPdialog::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_dialog) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDdialog());
 	MTPDdialog &v(_dialog());
-	v.vpeer.read(from, end);
-	v.vtop_message.read(from, end);
-	v.vread_inbox_max_id.read(from, end);
-	v.vunread_count.read(from, end);
-	v.vnotify_settings.read(from, end);
+	if (mtpReadResult result = v.vpeer.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vtop_message.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vread_inbox_max_id.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vunread_count.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vnotify_settings.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPdialog::write(mtpBuffer &to) const {
 	const MTPDdialog &v(c_dialog());
@@ -20329,25 +21413,30 @@ inline mtpTypeId MTPphoto::type() const {
 	return _type;
 }
 inline void MTPphoto::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPphoto");
+}
+inline mtpReadResult MTPphoto::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_photoEmpty: _type = cons; {
 			if (!data) setData(new MTPDphotoEmpty());
 			MTPDphotoEmpty &v(_photoEmpty());
-			v.vid.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
 		} break;
 		case mtpc_photo: _type = cons; {
 			if (!data) setData(new MTPDphoto());
 			MTPDphoto &v(_photo());
-			v.vid.read(from, end);
-			v.vaccess_hash.read(from, end);
-			v.vuser_id.read(from, end);
-			v.vdate.read(from, end);
-			v.vgeo.read(from, end);
-			v.vsizes.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vgeo.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vsizes.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPphoto");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPphoto::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -20406,33 +21495,38 @@ inline mtpTypeId MTPphotoSize::type() const {
 	return _type;
 }
 inline void MTPphotoSize::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPphotoSize");
+}
+inline mtpReadResult MTPphotoSize::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_photoSizeEmpty: _type = cons; {
 			if (!data) setData(new MTPDphotoSizeEmpty());
 			MTPDphotoSizeEmpty &v(_photoSizeEmpty());
-			v.vtype.read(from, end);
+			if (mtpReadResult result = v.vtype.tryRead(from, end)) return result;
 		} break;
 		case mtpc_photoSize: _type = cons; {
 			if (!data) setData(new MTPDphotoSize());
 			MTPDphotoSize &v(_photoSize());
-			v.vtype.read(from, end);
-			v.vlocation.read(from, end);
-			v.vw.read(from, end);
-			v.vh.read(from, end);
-			v.vsize.read(from, end);
+			if (mtpReadResult result = v.vtype.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vlocation.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vw.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vh.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vsize.tryRead(from, end)) return result;
 		} break;
 		case mtpc_photoCachedSize: _type = cons; {
 			if (!data) setData(new MTPDphotoCachedSize());
 			MTPDphotoCachedSize &v(_photoCachedSize());
-			v.vtype.read(from, end);
-			v.vlocation.read(from, end);
-			v.vw.read(from, end);
-			v.vh.read(from, end);
-			v.vbytes.read(from, end);
+			if (mtpReadResult result = v.vtype.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vlocation.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vw.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vh.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vbytes.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPphotoSize");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPphotoSize::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -20500,29 +21594,34 @@ inline mtpTypeId MTPvideo::type() const {
 	return _type;
 }
 inline void MTPvideo::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPvideo");
+}
+inline mtpReadResult MTPvideo::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_videoEmpty: _type = cons; {
 			if (!data) setData(new MTPDvideoEmpty());
 			MTPDvideoEmpty &v(_videoEmpty());
-			v.vid.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
 		} break;
 		case mtpc_video: _type = cons; {
 			if (!data) setData(new MTPDvideo());
 			MTPDvideo &v(_video());
-			v.vid.read(from, end);
-			v.vaccess_hash.read(from, end);
-			v.vuser_id.read(from, end);
-			v.vdate.read(from, end);
-			v.vduration.read(from, end);
-			v.vsize.read(from, end);
-			v.vthumb.read(from, end);
-			v.vdc_id.read(from, end);
-			v.vw.read(from, end);
-			v.vh.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vduration.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vsize.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vthumb.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdc_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vw.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vh.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPvideo");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPvideo::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -20577,17 +21676,22 @@ inline mtpTypeId MTPgeoPoint::type() const {
 	return _type;
 }
 inline void MTPgeoPoint::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPgeoPoint");
+}
+inline mtpReadResult MTPgeoPoint::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_geoPointEmpty: _type = cons; break;
 		case mtpc_geoPoint: _type = cons; {
 			if (!data) setData(new MTPDgeoPoint());
 			MTPDgeoPoint &v(_geoPoint());
-			v.vlong.read(from, end);
-			v.vlat.read(from, end);
+			if (mtpReadResult result = v.vlong.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vlat.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPgeoPoint");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPgeoPoint::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -20625,11 +21729,16 @@ inline mtpTypeId MTPauth_checkedPhone::type() const {
 	return mtpc_auth_checkedPhone;
 }
 inline void MTPauth_checkedPhone::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_auth_checkedPhone) throw mtpErrorUnexpected(cons, "MTPauth_checkedPhone");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_checkedPhone");
+}
+inline mtpReadResult MTPauth_checkedPhone::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_auth_checkedPhone) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDauth_checkedPhone());
 	MTPDauth_checkedPhone &v(_auth_checkedPhone());
-	v.vphone_registered.read(from, end);
+	if (mtpReadResult result = v.vphone_registered.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPauth_checkedPhone::write(mtpBuffer &to) const {
 	const MTPDauth_checkedPhone &v(c_auth_checkedPhone());
@@ -20659,26 +21768,31 @@ inline mtpTypeId MTPauth_sentCode::type() const {
 	return _type;
 }
 inline void MTPauth_sentCode::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_sentCode");
+}
+inline mtpReadResult MTPauth_sentCode::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_auth_sentCode: _type = cons; {
 			if (!data) setData(new MTPDauth_sentCode());
 			MTPDauth_sentCode &v(_auth_sentCode());
-			v.vphone_registered.read(from, end);
-			v.vphone_code_hash.read(from, end);
-			v.vsend_call_timeout.read(from, end);
-			v.vis_password.read(from, end);
+			if (mtpReadResult result = v.vphone_registered.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vphone_code_hash.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vsend_call_timeout.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vis_password.tryRead(from, end)) return result;
 		} break;
 		case mtpc_auth_sentAppCode: _type = cons; {
 			if (!data) setData(new MTPDauth_sentAppCode());
 			MTPDauth_sentAppCode &v(_auth_sentAppCode());
-			v.vphone_registered.read(from, end);
-			v.vphone_code_hash.read(from, end);
-			v.vsend_call_timeout.read(from, end);
-			v.vis_password.read(from, end);
+			if (mtpReadResult result = v.vphone_registered.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vphone_code_hash.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vsend_call_timeout.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vis_password.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPauth_sentCode");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPauth_sentCode::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -20727,11 +21841,16 @@ inline mtpTypeId MTPauth_authorization::type() const {
 	return mtpc_auth_authorization;
 }
 inline void MTPauth_authorization::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_auth_authorization) throw mtpErrorUnexpected(cons, "MTPauth_authorization");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_authorization");
+}
+inline mtpReadResult MTPauth_authorization::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_auth_authorization) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDauth_authorization());
 	MTPDauth_authorization &v(_auth_authorization());
-	v.vuser.read(from, end);
+	if (mtpReadResult result = v.vuser.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPauth_authorization::write(mtpBuffer &to) const {
 	const MTPDauth_authorization &v(c_auth_authorization());
@@ -20754,12 +21873,17 @@ inline mtpTypeId MTPauth_exportedAuthorization::type() const {
 	return mtpc_auth_exportedAuthorization;
 }
 inline void MTPauth_exportedAuthorization::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_auth_exportedAuthorization) throw mtpErrorUnexpected(cons, "MTPauth_exportedAuthorization");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_exportedAuthorization");
+}
+inline mtpReadResult MTPauth_exportedAuthorization::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_auth_exportedAuthorization) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDauth_exportedAuthorization());
 	MTPDauth_exportedAuthorization &v(_auth_exportedAuthorization());
-	v.vid.read(from, end);
-	v.vbytes.read(from, end);
+	if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vbytes.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPauth_exportedAuthorization::write(mtpBuffer &to) const {
 	const MTPDauth_exportedAuthorization &v(c_auth_exportedAuthorization());
@@ -20790,12 +21914,16 @@ inline mtpTypeId MTPinputNotifyPeer::type() const {
 	return _type;
 }
 inline void MTPinputNotifyPeer::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputNotifyPeer");
+}
+inline mtpReadResult MTPinputNotifyPeer::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_inputNotifyPeer: _type = cons; {
 			if (!data) setData(new MTPDinputNotifyPeer());
 			MTPDinputNotifyPeer &v(_inputNotifyPeer());
-			v.vpeer.read(from, end);
+			if (mtpReadResult result = v.vpeer.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputNotifyUsers: _type = cons; break;
 		case mtpc_inputNotifyChats: _type = cons; break;
@@ -20803,10 +21931,11 @@ inline void MTPinputNotifyPeer::read(const mtpPrime *&from, const mtpPrime *end,
 		case mtpc_inputNotifyGeoChatPeer: _type = cons; {
 			if (!data) setData(new MTPDinputNotifyGeoChatPeer());
 			MTPDinputNotifyGeoChatPeer &v(_inputNotifyGeoChatPeer());
-			v.vpeer.read(from, end);
+			if (mtpReadResult result = v.vpeer.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPinputNotifyPeer");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPinputNotifyPeer::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -20858,11 +21987,16 @@ inline mtpTypeId MTPinputPeerNotifyEvents::type() const {
 	return _type;
 }
 inline void MTPinputPeerNotifyEvents::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputPeerNotifyEvents");
+}
+inline mtpReadResult MTPinputPeerNotifyEvents::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	switch (cons) {
 		case mtpc_inputPeerNotifyEventsEmpty: _type = cons; break;
 		case mtpc_inputPeerNotifyEventsAll: _type = cons; break;
-		default: throw mtpErrorUnexpected(cons, "MTPinputPeerNotifyEvents");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPinputPeerNotifyEvents::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -20893,14 +22027,19 @@ inline mtpTypeId MTPinputPeerNotifySettings::type() const {
 	return mtpc_inputPeerNotifySettings;
 }
 inline void MTPinputPeerNotifySettings::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_inputPeerNotifySettings) throw mtpErrorUnexpected(cons, "MTPinputPeerNotifySettings");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputPeerNotifySettings");
+}
+inline mtpReadResult MTPinputPeerNotifySettings::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_inputPeerNotifySettings) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDinputPeerNotifySettings());
 	MTPDinputPeerNotifySettings &v(_inputPeerNotifySettings());
-	v.vmute_until.read(from, end);
-	v.vsound.read(from, end);
-	v.vshow_previews.read(from, end);
-	v.vevents_mask.read(from, end);
+	if (mtpReadResult result = v.vmute_until.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vsound.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vshow_previews.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vevents_mask.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPinputPeerNotifySettings::write(mtpBuffer &to) const {
 	const MTPDinputPeerNotifySettings &v(c_inputPeerNotifySettings());
@@ -20923,11 +22062,16 @@ inline mtpTypeId MTPpeerNotifyEvents::type() const {
 	return _type;
 }
 inline void MTPpeerNotifyEvents::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPpeerNotifyEvents");
+}
+inline mtpReadResult MTPpeerNotifyEvents::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	switch (cons) {
 		case mtpc_peerNotifyEventsEmpty: _type = cons; break;
 		case mtpc_peerNotifyEventsAll: _type = cons; break;
-		default: throw mtpErrorUnexpected(cons, "MTPpeerNotifyEvents");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPpeerNotifyEvents::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -20961,19 +22105,24 @@ inline mtpTypeId MTPpeerNotifySettings::type() const {
 	return _type;
 }
 inline void MTPpeerNotifySettings::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPpeerNotifySettings");
+}
+inline mtpReadResult MTPpeerNotifySettings::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_peerNotifySettingsEmpty: _type = cons; break;
 		case mtpc_peerNotifySettings: _type = cons; {
 			if (!data) setData(new MTPDpeerNotifySettings());
 			MTPDpeerNotifySettings &v(_peerNotifySettings());
-			v.vmute_until.read(from, end);
-			v.vsound.read(from, end);
-			v.vshow_previews.read(from, end);
-			v.vevents_mask.read(from, end);
+			if (mtpReadResult result = v.vmute_until.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vsound.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vshow_previews.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vevents_mask.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPpeerNotifySettings");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPpeerNotifySettings::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -21020,26 +22169,31 @@ inline mtpTypeId MTPwallPaper::type() const {
 	return _type;
 }
 inline void MTPwallPaper::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPwallPaper");
+}
+inline mtpReadResult MTPwallPaper::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_wallPaper: _type = cons; {
 			if (!data) setData(new MTPDwallPaper());
 			MTPDwallPaper &v(_wallPaper());
-			v.vid.read(from, end);
-			v.vtitle.read(from, end);
-			v.vsizes.read(from, end);
-			v.vcolor.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vtitle.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vsizes.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vcolor.tryRead(from, end)) return result;
 		} break;
 		case mtpc_wallPaperSolid: _type = cons; {
 			if (!data) setData(new MTPDwallPaperSolid());
 			MTPDwallPaperSolid &v(_wallPaperSolid());
-			v.vid.read(from, end);
-			v.vtitle.read(from, end);
-			v.vbg_color.read(from, end);
-			v.vcolor.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vtitle.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vbg_color.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vcolor.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPwallPaper");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPwallPaper::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -21088,16 +22242,21 @@ inline mtpTypeId MTPuserFull::type() const {
 	return mtpc_userFull;
 }
 inline void MTPuserFull::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_userFull) throw mtpErrorUnexpected(cons, "MTPuserFull");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPuserFull");
+}
+inline mtpReadResult MTPuserFull::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_userFull) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDuserFull());
 	MTPDuserFull &v(_userFull());
-	v.vuser.read(from, end);
-	v.vlink.read(from, end);
-	v.vprofile_photo.read(from, end);
-	v.vnotify_settings.read(from, end);
-	v.vblocked.read(from, end);
-	v.vbot_info.read(from, end);
+	if (mtpReadResult result = v.vuser.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vlink.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vprofile_photo.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vnotify_settings.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vblocked.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vbot_info.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPuserFull::write(mtpBuffer &to) const {
 	const MTPDuserFull &v(c_userFull());
@@ -21125,12 +22284,17 @@ inline mtpTypeId MTPcontact::type() const {
 	return mtpc_contact;
 }
 inline void MTPcontact::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_contact) throw mtpErrorUnexpected(cons, "MTPcontact");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontact");
+}
+inline mtpReadResult MTPcontact::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_contact) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDcontact());
 	MTPDcontact &v(_contact());
-	v.vuser_id.read(from, end);
-	v.vmutual.read(from, end);
+	if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vmutual.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPcontact::write(mtpBuffer &to) const {
 	const MTPDcontact &v(c_contact());
@@ -21154,12 +22318,17 @@ inline mtpTypeId MTPimportedContact::type() const {
 	return mtpc_importedContact;
 }
 inline void MTPimportedContact::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_importedContact) throw mtpErrorUnexpected(cons, "MTPimportedContact");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPimportedContact");
+}
+inline mtpReadResult MTPimportedContact::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_importedContact) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDimportedContact());
 	MTPDimportedContact &v(_importedContact());
-	v.vuser_id.read(from, end);
-	v.vclient_id.read(from, end);
+	if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vclient_id.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPimportedContact::write(mtpBuffer &to) const {
 	const MTPDimportedContact &v(c_importedContact());
@@ -21183,12 +22352,17 @@ inline mtpTypeId MTPcontactBlocked::type() const {
 	return mtpc_contactBlocked;
 }
 inline void MTPcontactBlocked::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_contactBlocked) throw mtpErrorUnexpected(cons, "MTPcontactBlocked");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontactBlocked");
+}
+inline mtpReadResult MTPcontactBlocked::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_contactBlocked) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDcontactBlocked());
 	MTPDcontactBlocked &v(_contactBlocked());
-	v.vuser_id.read(from, end);
-	v.vdate.read(from, end);
+	if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPcontactBlocked::write(mtpBuffer &to) const {
 	const MTPDcontactBlocked &v(c_contactBlocked());
@@ -21212,12 +22386,17 @@ inline mtpTypeId MTPcontactSuggested::type() const {
 	return mtpc_contactSuggested;
 }
 inline void MTPcontactSuggested::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_contactSuggested) throw mtpErrorUnexpected(cons, "MTPcontactSuggested");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontactSuggested");
+}
+inline mtpReadResult MTPcontactSuggested::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_contactSuggested) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDcontactSuggested());
 	MTPDcontactSuggested &v(_contactSuggested());
-	v.vuser_id.read(from, end);
-	v.vmutual_contacts.read(from, end);
+	if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vmutual_contacts.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPcontactSuggested::write(mtpBuffer &to) const {
 	const MTPDcontactSuggested &v(c_contactSuggested());
@@ -21241,12 +22420,17 @@ inline mtpTypeId MTPcontactStatus::type() const {
 	return mtpc_contactStatus;
 }
 inline void MTPcontactStatus::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_contactStatus) throw mtpErrorUnexpected(cons, "MTPcontactStatus");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontactStatus");
+}
+inline mtpReadResult MTPcontactStatus::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_contactStatus) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDcontactStatus());
 	MTPDcontactStatus &v(_contactStatus());
-	v.vuser_id.read(from, end);
-	v.vstatus.read(from, end);
+	if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vstatus.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPcontactStatus::write(mtpBuffer &to) const {
 	const MTPDcontactStatus &v(c_contactStatus());
@@ -21270,12 +22454,17 @@ inline mtpTypeId MTPchatLocated::type() const {
 	return mtpc_chatLocated;
 }
 inline void MTPchatLocated::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_chatLocated) throw mtpErrorUnexpected(cons, "MTPchatLocated");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPchatLocated");
+}
+inline mtpReadResult MTPchatLocated::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_chatLocated) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDchatLocated());
 	MTPDchatLocated &v(_chatLocated());
-	v.vchat_id.read(from, end);
-	v.vdistance.read(from, end);
+	if (mtpReadResult result = v.vchat_id.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vdistance.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPchatLocated::write(mtpBuffer &to) const {
 	const MTPDchatLocated &v(c_chatLocated());
@@ -21299,13 +22488,18 @@ inline mtpTypeId MTPcontacts_link::type() const {
 	return mtpc_contacts_link;
 }
 inline void MTPcontacts_link::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_contacts_link) throw mtpErrorUnexpected(cons, "MTPcontacts_link");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_link");
+}
+inline mtpReadResult MTPcontacts_link::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_contacts_link) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDcontacts_link());
 	MTPDcontacts_link &v(_contacts_link());
-	v.vmy_link.read(from, end);
-	v.vforeign_link.read(from, end);
-	v.vuser.read(from, end);
+	if (mtpReadResult result = v.vmy_link.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vforeign_link.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vuser.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPcontacts_link::write(mtpBuffer &to) const {
 	const MTPDcontacts_link &v(c_contacts_link());
@@ -21333,17 +22527,22 @@ inline mtpTypeId MTPcontacts_contacts::type() const {
 	return _type;
 }
 inline void MTPcontacts_contacts::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_contacts");
+}
+inline mtpReadResult MTPcontacts_contacts::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_contacts_contactsNotModified: _type = cons; break;
 		case mtpc_contacts_contacts: _type = cons; {
 			if (!data) setData(new MTPDcontacts_contacts());
 			MTPDcontacts_contacts &v(_contacts_contacts());
-			v.vcontacts.read(from, end);
-			v.vusers.read(from, end);
+			if (mtpReadResult result = v.vcontacts.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPcontacts_contacts");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPcontacts_contacts::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -21381,13 +22580,18 @@ inline mtpTypeId MTPcontacts_importedContacts::type() const {
 	return mtpc_contacts_importedContacts;
 }
 inline void MTPcontacts_importedContacts::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_contacts_importedContacts) throw mtpErrorUnexpected(cons, "MTPcontacts_importedContacts");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_importedContacts");
+}
+inline mtpReadResult MTPcontacts_importedContacts::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_contacts_importedContacts) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDcontacts_importedContacts());
 	MTPDcontacts_importedContacts &v(_contacts_importedContacts());
-	v.vimported.read(from, end);
-	v.vretry_contacts.read(from, end);
-	v.vusers.read(from, end);
+	if (mtpReadResult result = v.vimported.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vretry_contacts.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPcontacts_importedContacts::write(mtpBuffer &to) const {
 	const MTPDcontacts_importedContacts &v(c_contacts_importedContacts());
@@ -21419,23 +22623,28 @@ inline mtpTypeId MTPcontacts_blocked::type() const {
 	return _type;
 }
 inline void MTPcontacts_blocked::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_blocked");
+}
+inline mtpReadResult MTPcontacts_blocked::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_contacts_blocked: _type = cons; {
 			if (!data) setData(new MTPDcontacts_blocked());
 			MTPDcontacts_blocked &v(_contacts_blocked());
-			v.vblocked.read(from, end);
-			v.vusers.read(from, end);
+			if (mtpReadResult result = v.vblocked.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
 		} break;
 		case mtpc_contacts_blockedSlice: _type = cons; {
 			if (!data) setData(new MTPDcontacts_blockedSlice());
 			MTPDcontacts_blockedSlice &v(_contacts_blockedSlice());
-			v.vcount.read(from, end);
-			v.vblocked.read(from, end);
-			v.vusers.read(from, end);
+			if (mtpReadResult result = v.vcount.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vblocked.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPcontacts_blocked");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPcontacts_blocked::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -21481,12 +22690,17 @@ inline mtpTypeId MTPcontacts_suggested::type() const {
 	return mtpc_contacts_suggested;
 }
 inline void MTPcontacts_suggested::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_contacts_suggested) throw mtpErrorUnexpected(cons, "MTPcontacts_suggested");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_suggested");
+}
+inline mtpReadResult MTPcontacts_suggested::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_contacts_suggested) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDcontacts_suggested());
 	MTPDcontacts_suggested &v(_contacts_suggested());
-	v.vresults.read(from, end);
-	v.vusers.read(from, end);
+	if (mtpReadResult result = v.vresults.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPcontacts_suggested::write(mtpBuffer &to) const {
 	const MTPDcontacts_suggested &v(c_contacts_suggested());
@@ -21517,27 +22731,32 @@ inline mtpTypeId MTPmessages_dialogs::type() const {
 	return _type;
 }
 inline void MTPmessages_dialogs::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_dialogs");
+}
+inline mtpReadResult MTPmessages_dialogs::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_messages_dialogs: _type = cons; {
 			if (!data) setData(new MTPDmessages_dialogs());
 			MTPDmessages_dialogs &v(_messages_dialogs());
-			v.vdialogs.read(from, end);
-			v.vmessages.read(from, end);
-			v.vchats.read(from, end);
-			v.vusers.read(from, end);
+			if (mtpReadResult result = v.vdialogs.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmessages.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vchats.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
 		} break;
 		case mtpc_messages_dialogsSlice: _type = cons; {
 			if (!data) setData(new MTPDmessages_dialogsSlice());
 			MTPDmessages_dialogsSlice &v(_messages_dialogsSlice());
-			v.vcount.read(from, end);
-			v.vdialogs.read(from, end);
-			v.vmessages.read(from, end);
-			v.vchats.read(from, end);
-			v.vusers.read(from, end);
+			if (mtpReadResult result = v.vcount.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdialogs.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmessages.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vchats.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPmessages_dialogs");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPmessages_dialogs::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -21594,25 +22813,30 @@ inline mtpTypeId MTPmessages_messages::type() const {
 	return _type;
 }
 inline void MTPmessages_messages::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_messages");
+}
+inline mtpReadResult MTPmessages_messages::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_messages_messages: _type = cons; {
 			if (!data) setData(new MTPDmessages_messages());
 			MTPDmessages_messages &v(_messages_messages());
-			v.vmessages.read(from, end);
-			v.vchats.read(from, end);
-			v.vusers.read(from, end);
+			if (mtpReadResult result = v.vmessages.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vchats.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
 		} break;
 		case mtpc_messages_messagesSlice: _type = cons; {
 			if (!data) setData(new MTPDmessages_messagesSlice());
 			MTPDmessages_messagesSlice &v(_messages_messagesSlice());
-			v.vcount.read(from, end);
-			v.vmessages.read(from, end);
-			v.vchats.read(from, end);
-			v.vusers.read(from, end);
+			if (mtpReadResult result = v.vcount.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmessages.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vchats.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPmessages_messages");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPmessages_messages::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -21656,6 +22880,11 @@ inline mtpTypeId MTPmessages_message::type() const {
 	return mtpc_messages_messageEmpty;
 }
 inline void MTPmessages_message::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_message");
+}
+inline mtpReadResult MTPmessages_message::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	return mtpReadDone;
 }
 inline void MTPmessages_message::write(mtpBuffer &to) const {
 }
@@ -21681,30 +22910,35 @@ inline mtpTypeId MTPmessages_sentMessage::type() const {
 	return _type;
 }
 inline void MTPmessages_sentMessage::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_sentMessage");
+}
+inline mtpReadResult MTPmessages_sentMessage::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_messages_sentMessage: _type = cons; {
 			if (!data) setData(new MTPDmessages_sentMessage());
 			MTPDmessages_sentMessage &v(_messages_sentMessage());
-			v.vid.read(from, end);
-			v.vdate.read(from, end);
-			v.vmedia.read(from, end);
-			v.vpts.read(from, end);
-			v.vpts_count.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmedia.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vpts.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vpts_count.tryRead(from, end)) return result;
 		} break;
 		case mtpc_messages_sentMessageLink: _type = cons; {
 			if (!data) setData(new MTPDmessages_sentMessageLink());
 			MTPDmessages_sentMessageLink &v(_messages_sentMessageLink());
-			v.vid.read(from, end);
-			v.vdate.read(from, end);
-			v.vmedia.read(from, end);
-			v.vpts.read(from, end);
-			v.vpts_count.read(from, end);
-			v.vlinks.read(from, end);
-			v.vseq.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmedia.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vpts.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vpts_count.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vlinks.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vseq.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPmessages_sentMessage");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPmessages_sentMessage::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -21757,11 +22991,16 @@ inline mtpTypeId MTPmessages_chats::type() const {
 	return mtpc_messages_chats;
 }
 inline void MTPmessages_chats::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_messages_chats) throw mtpErrorUnexpected(cons, "MTPmessages_chats");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_chats");
+}
+inline mtpReadResult MTPmessages_chats::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_messages_chats) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDmessages_chats());
 	MTPDmessages_chats &v(_messages_chats());
-	v.vchats.read(from, end);
+	if (mtpReadResult result = v.vchats.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPmessages_chats::write(mtpBuffer &to) const {
 	const MTPDmessages_chats &v(c_messages_chats());
@@ -21784,13 +23023,18 @@ inline mtpTypeId MTPmessages_chatFull::type() const {
 	return mtpc_messages_chatFull;
 }
 inline void MTPmessages_chatFull::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_messages_chatFull) throw mtpErrorUnexpected(cons, "MTPmessages_chatFull");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_chatFull");
+}
+inline mtpReadResult MTPmessages_chatFull::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_messages_chatFull) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDmessages_chatFull());
 	MTPDmessages_chatFull &v(_messages_chatFull());
-	v.vfull_chat.read(from, end);
-	v.vchats.read(from, end);
-	v.vusers.read(from, end);
+	if (mtpReadResult result = v.vfull_chat.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vchats.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPmessages_chatFull::write(mtpBuffer &to) const {
 	const MTPDmessages_chatFull &v(c_messages_chatFull());
@@ -21815,13 +23059,18 @@ inline mtpTypeId MTPmessages_affectedHistory::type() const {
 	return mtpc_messages_affectedHistory;
 }
 inline void MTPmessages_affectedHistory::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_messages_affectedHistory) throw mtpErrorUnexpected(cons, "MTPmessages_affectedHistory");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_affectedHistory");
+}
+inline mtpReadResult MTPmessages_affectedHistory::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_messages_affectedHistory) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDmessages_affectedHistory());
 	MTPDmessages_affectedHistory &v(_messages_affectedHistory());
-	v.vpts.read(from, end);
-	v.vpts_count.read(from, end);
-	v.voffset.read(from, end);
+	if (mtpReadResult result = v.vpts.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vpts_count.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.voffset.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPmessages_affectedHistory::write(mtpBuffer &to) const {
 	const MTPDmessages_affectedHistory &v(c_messages_affectedHistory());
@@ -21843,6 +23092,10 @@ inline mtpTypeId MTPmessagesFilter::type() const {
 	return _type;
 }
 inline void MTPmessagesFilter::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessagesFilter");
+}
+inline mtpReadResult MTPmessagesFilter::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	switch (cons) {
 		case mtpc_inputMessagesFilterEmpty: _type = cons; break;
 		case mtpc_inputMessagesFilterPhotos: _type = cons; break;
@@ -21852,8 +23105,9 @@ inline void MTPmessagesFilter::read(const mtpPrime *&from, const mtpPrime *end,
 		case mtpc_inputMessagesFilterDocument: _type = cons; break;
 		case mtpc_inputMessagesFilterAudio: _type = cons; break;
 		case mtpc_inputMessagesFilterAudioDocuments: _type = cons; break;
-		default: throw mtpErrorUnexpected(cons, "MTPmessagesFilter");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPmessagesFilter::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -22023,200 +23277,205 @@ inline mtpTypeId MTPupdate::type() const {
 	return _type;
 }
 inline void MTPupdate::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPupdate");
+}
+inline mtpReadResult MTPupdate::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_updateNewMessage: _type = cons; {
 			if (!data) setData(new MTPDupdateNewMessage());
 			MTPDupdateNewMessage &v(_updateNewMessage());
-			v.vmessage.read(from, end);
-			v.vpts.read(from, end);
-			v.vpts_count.read(from, end);
+			if (mtpReadResult result = v.vmessage.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vpts.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vpts_count.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateMessageID: _type = cons; {
 			if (!data) setData(new MTPDupdateMessageID());
 			MTPDupdateMessageID &v(_updateMessageID());
-			v.vid.read(from, end);
-			v.vrandom_id.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vrandom_id.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateDeleteMessages: _type = cons; {
 			if (!data) setData(new MTPDupdateDeleteMessages());
 			MTPDupdateDeleteMessages &v(_updateDeleteMessages());
-			v.vmessages.read(from, end);
-			v.vpts.read(from, end);
-			v.vpts_count.read(from, end);
+			if (mtpReadResult result = v.vmessages.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vpts.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vpts_count.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateUserTyping: _type = cons; {
 			if (!data) setData(new MTPDupdateUserTyping());
 			MTPDupdateUserTyping &v(_updateUserTyping());
-			v.vuser_id.read(from, end);
-			v.vaction.read(from, end);
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaction.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateChatUserTyping: _type = cons; {
 			if (!data) setData(new MTPDupdateChatUserTyping());
 			MTPDupdateChatUserTyping &v(_updateChatUserTyping());
-			v.vchat_id.read(from, end);
-			v.vuser_id.read(from, end);
-			v.vaction.read(from, end);
+			if (mtpReadResult result = v.vchat_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaction.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateChatParticipants: _type = cons; {
 			if (!data) setData(new MTPDupdateChatParticipants());
 			MTPDupdateChatParticipants &v(_updateChatParticipants());
-			v.vparticipants.read(from, end);
+			if (mtpReadResult result = v.vparticipants.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateUserStatus: _type = cons; {
 			if (!data) setData(new MTPDupdateUserStatus());
 			MTPDupdateUserStatus &v(_updateUserStatus());
-			v.vuser_id.read(from, end);
-			v.vstatus.read(from, end);
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vstatus.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateUserName: _type = cons; {
 			if (!data) setData(new MTPDupdateUserName());
 			MTPDupdateUserName &v(_updateUserName());
-			v.vuser_id.read(from, end);
-			v.vfirst_name.read(from, end);
-			v.vlast_name.read(from, end);
-			v.vusername.read(from, end);
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vfirst_name.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vlast_name.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vusername.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateUserPhoto: _type = cons; {
 			if (!data) setData(new MTPDupdateUserPhoto());
 			MTPDupdateUserPhoto &v(_updateUserPhoto());
-			v.vuser_id.read(from, end);
-			v.vdate.read(from, end);
-			v.vphoto.read(from, end);
-			v.vprevious.read(from, end);
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vphoto.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vprevious.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateContactRegistered: _type = cons; {
 			if (!data) setData(new MTPDupdateContactRegistered());
 			MTPDupdateContactRegistered &v(_updateContactRegistered());
-			v.vuser_id.read(from, end);
-			v.vdate.read(from, end);
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateContactLink: _type = cons; {
 			if (!data) setData(new MTPDupdateContactLink());
 			MTPDupdateContactLink &v(_updateContactLink());
-			v.vuser_id.read(from, end);
-			v.vmy_link.read(from, end);
-			v.vforeign_link.read(from, end);
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmy_link.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vforeign_link.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateNewAuthorization: _type = cons; {
 			if (!data) setData(new MTPDupdateNewAuthorization());
 			MTPDupdateNewAuthorization &v(_updateNewAuthorization());
-			v.vauth_key_id.read(from, end);
-			v.vdate.read(from, end);
-			v.vdevice.read(from, end);
-			v.vlocation.read(from, end);
+			if (mtpReadResult result = v.vauth_key_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdevice.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vlocation.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateNewGeoChatMessage: _type = cons; {
 			if (!data) setData(new MTPDupdateNewGeoChatMessage());
 			MTPDupdateNewGeoChatMessage &v(_updateNewGeoChatMessage());
-			v.vmessage.read(from, end);
+			if (mtpReadResult result = v.vmessage.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateNewEncryptedMessage: _type = cons; {
 			if (!data) setData(new MTPDupdateNewEncryptedMessage());
 			MTPDupdateNewEncryptedMessage &v(_updateNewEncryptedMessage());
-			v.vmessage.read(from, end);
-			v.vqts.read(from, end);
+			if (mtpReadResult result = v.vmessage.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vqts.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateEncryptedChatTyping: _type = cons; {
 			if (!data) setData(new MTPDupdateEncryptedChatTyping());
 			MTPDupdateEncryptedChatTyping &v(_updateEncryptedChatTyping());
-			v.vchat_id.read(from, end);
+			if (mtpReadResult result = v.vchat_id.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateEncryption: _type = cons; {
 			if (!data) setData(new MTPDupdateEncryption());
 			MTPDupdateEncryption &v(_updateEncryption());
-			v.vchat.read(from, end);
-			v.vdate.read(from, end);
+			if (mtpReadResult result = v.vchat.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateEncryptedMessagesRead: _type = cons; {
 			if (!data) setData(new MTPDupdateEncryptedMessagesRead());
 			MTPDupdateEncryptedMessagesRead &v(_updateEncryptedMessagesRead());
-			v.vchat_id.read(from, end);
-			v.vmax_date.read(from, end);
-			v.vdate.read(from, end);
+			if (mtpReadResult result = v.vchat_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmax_date.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateChatParticipantAdd: _type = cons; {
 			if (!data) setData(new MTPDupdateChatParticipantAdd());
 			MTPDupdateChatParticipantAdd &v(_updateChatParticipantAdd());
-			v.vchat_id.read(from, end);
-			v.vuser_id.read(from, end);
-			v.vinviter_id.read(from, end);
-			v.vversion.read(from, end);
+			if (mtpReadResult result = v.vchat_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vinviter_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vversion.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateChatParticipantDelete: _type = cons; {
 			if (!data) setData(new MTPDupdateChatParticipantDelete());
 			MTPDupdateChatParticipantDelete &v(_updateChatParticipantDelete());
-			v.vchat_id.read(from, end);
-			v.vuser_id.read(from, end);
-			v.vversion.read(from, end);
+			if (mtpReadResult result = v.vchat_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vversion.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateDcOptions: _type = cons; {
 			if (!data) setData(new MTPDupdateDcOptions());
 			MTPDupdateDcOptions &v(_updateDcOptions());
-			v.vdc_options.read(from, end);
+			if (mtpReadResult result = v.vdc_options.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateUserBlocked: _type = cons; {
 			if (!data) setData(new MTPDupdateUserBlocked());
 			MTPDupdateUserBlocked &v(_updateUserBlocked());
-			v.vuser_id.read(from, end);
-			v.vblocked.read(from, end);
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vblocked.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateNotifySettings: _type = cons; {
 			if (!data) setData(new MTPDupdateNotifySettings());
 			MTPDupdateNotifySettings &v(_updateNotifySettings());
-			v.vpeer.read(from, end);
-			v.vnotify_settings.read(from, end);
+			if (mtpReadResult result = v.vpeer.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vnotify_settings.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateServiceNotification: _type = cons; {
 			if (!data) setData(new MTPDupdateServiceNotification());
 			MTPDupdateServiceNotification &v(_updateServiceNotification());
-			v.vtype.read(from, end);
-			v.vmessage.read(from, end);
-			v.vmedia.read(from, end);
-			v.vpopup.read(from, end);
+			if (mtpReadResult result = v.vtype.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmessage.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmedia.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vpopup.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updatePrivacy: _type = cons; {
 			if (!data) setData(new MTPDupdatePrivacy());
 			MTPDupdatePrivacy &v(_updatePrivacy());
-			v.vkey.read(from, end);
-			v.vrules.read(from, end);
+			if (mtpReadResult result = v.vkey.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vrules.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateUserPhone: _type = cons; {
 			if (!data) setData(new MTPDupdateUserPhone());
 			MTPDupdateUserPhone &v(_updateUserPhone());
-			v.vuser_id.read(from, end);
-			v.vphone.read(from, end);
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vphone.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateReadHistoryInbox: _type = cons; {
 			if (!data) setData(new MTPDupdateReadHistoryInbox());
 			MTPDupdateReadHistoryInbox &v(_updateReadHistoryInbox());
-			v.vpeer.read(from, end);
-			v.vmax_id.read(from, end);
-			v.vpts.read(from, end);
-			v.vpts_count.read(from, end);
+			if (mtpReadResult result = v.vpeer.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmax_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vpts.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vpts_count.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateReadHistoryOutbox: _type = cons; {
 			if (!data) setData(new MTPDupdateReadHistoryOutbox());
 			MTPDupdateReadHistoryOutbox &v(_updateReadHistoryOutbox());
-			v.vpeer.read(from, end);
-			v.vmax_id.read(from, end);
-			v.vpts.read(from, end);
-			v.vpts_count.read(from, end);
+			if (mtpReadResult result = v.vpeer.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmax_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vpts.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vpts_count.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateWebPage: _type = cons; {
 			if (!data) setData(new MTPDupdateWebPage());
 			MTPDupdateWebPage &v(_updateWebPage());
-			v.vwebpage.read(from, end);
+			if (mtpReadResult result = v.vwebpage.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updateReadMessagesContents: _type = cons; {
 			if (!data) setData(new MTPDupdateReadMessagesContents());
 			MTPDupdateReadMessagesContents &v(_updateReadMessagesContents());
-			v.vmessages.read(from, end);
-			v.vpts.read(from, end);
-			v.vpts_count.read(from, end);
+			if (mtpReadResult result = v.vmessages.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vpts.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vpts_count.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPupdate");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPupdate::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -22574,15 +23833,20 @@ inline mtpTypeId MTPupdates_state::type() const {
 	return mtpc_updates_state;
 }
 inline void MTPupdates_state::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_updates_state) throw mtpErrorUnexpected(cons, "MTPupdates_state");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPupdates_state");
+}
+inline mtpReadResult MTPupdates_state::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_updates_state) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDupdates_state());
 	MTPDupdates_state &v(_updates_state());
-	v.vpts.read(from, end);
-	v.vqts.read(from, end);
-	v.vdate.read(from, end);
-	v.vseq.read(from, end);
-	v.vunread_count.read(from, end);
+	if (mtpReadResult result = v.vpts.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vqts.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vseq.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vunread_count.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPupdates_state::write(mtpBuffer &to) const {
 	const MTPDupdates_state &v(c_updates_state());
@@ -22620,36 +23884,41 @@ inline mtpTypeId MTPupdates_difference::type() const {
 	return _type;
 }
 inline void MTPupdates_difference::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPupdates_difference");
+}
+inline mtpReadResult MTPupdates_difference::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_updates_differenceEmpty: _type = cons; {
 			if (!data) setData(new MTPDupdates_differenceEmpty());
 			MTPDupdates_differenceEmpty &v(_updates_differenceEmpty());
-			v.vdate.read(from, end);
-			v.vseq.read(from, end);
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vseq.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updates_difference: _type = cons; {
 			if (!data) setData(new MTPDupdates_difference());
 			MTPDupdates_difference &v(_updates_difference());
-			v.vnew_messages.read(from, end);
-			v.vnew_encrypted_messages.read(from, end);
-			v.vother_updates.read(from, end);
-			v.vchats.read(from, end);
-			v.vusers.read(from, end);
-			v.vstate.read(from, end);
+			if (mtpReadResult result = v.vnew_messages.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vnew_encrypted_messages.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vother_updates.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vchats.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vstate.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updates_differenceSlice: _type = cons; {
 			if (!data) setData(new MTPDupdates_differenceSlice());
 			MTPDupdates_differenceSlice &v(_updates_differenceSlice());
-			v.vnew_messages.read(from, end);
-			v.vnew_encrypted_messages.read(from, end);
-			v.vother_updates.read(from, end);
-			v.vchats.read(from, end);
-			v.vusers.read(from, end);
-			v.vintermediate_state.read(from, end);
+			if (mtpReadResult result = v.vnew_messages.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vnew_encrypted_messages.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vother_updates.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vchats.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vintermediate_state.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPupdates_difference");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPupdates_difference::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -22732,65 +24001,70 @@ inline mtpTypeId MTPupdates::type() const {
 	return _type;
 }
 inline void MTPupdates::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPupdates");
+}
+inline mtpReadResult MTPupdates::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_updatesTooLong: _type = cons; break;
 		case mtpc_updateShortMessage: _type = cons; {
 			if (!data) setData(new MTPDupdateShortMessage());
 			MTPDupdateShortMessage &v(_updateShortMessage());
-			v.vflags.read(from, end);
-			v.vid.read(from, end);
-			v.vuser_id.read(from, end);
-			v.vmessage.read(from, end);
-			v.vpts.read(from, end);
-			v.vpts_count.read(from, end);
-			v.vdate.read(from, end);
-			if (v.has_fwd_from_id()) { v.vfwd_from_id.read(from, end); } else { v.vfwd_from_id = MTPint(); }
-			if (v.has_fwd_date()) { v.vfwd_date.read(from, end); } else { v.vfwd_date = MTPint(); }
-			if (v.has_reply_to_msg_id()) { v.vreply_to_msg_id.read(from, end); } else { v.vreply_to_msg_id = MTPint(); }
+			if (mtpReadResult result = v.vflags.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmessage.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vpts.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vpts_count.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (v.has_fwd_from_id()) { if (mtpReadResult result = v.vfwd_from_id.tryRead(from, end)) return result; } else { v.vfwd_from_id = MTPint(); }
+			if (v.has_fwd_date()) { if (mtpReadResult result = v.vfwd_date.tryRead(from, end)) return result; } else { v.vfwd_date = MTPint(); }
+			if (v.has_reply_to_msg_id()) { if (mtpReadResult result = v.vreply_to_msg_id.tryRead(from, end)) return result; } else { v.vreply_to_msg_id = MTPint(); }
 		} break;
 		case mtpc_updateShortChatMessage: _type = cons; {
 			if (!data) setData(new MTPDupdateShortChatMessage());
 			MTPDupdateShortChatMessage &v(_updateShortChatMessage());
-			v.vflags.read(from, end);
-			v.vid.read(from, end);
-			v.vfrom_id.read(from, end);
-			v.vchat_id.read(from, end);
-			v.vmessage.read(from, end);
-			v.vpts.read(from, end);
-			v.vpts_count.read(from, end);
-			v.vdate.read(from, end);
-			if (v.has_fwd_from_id()) { v.vfwd_from_id.read(from, end); } else { v.vfwd_from_id = MTPint(); }
-			if (v.has_fwd_date()) { v.vfwd_date.read(from, end); } else { v.vfwd_date = MTPint(); }
-			if (v.has_reply_to_msg_id()) { v.vreply_to_msg_id.read(from, end); } else { v.vreply_to_msg_id = MTPint(); }
+			if (mtpReadResult result = v.vflags.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vfrom_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vchat_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmessage.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vpts.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vpts_count.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (v.has_fwd_from_id()) { if (mtpReadResult result = v.vfwd_from_id.tryRead(from, end)) return result; } else { v.vfwd_from_id = MTPint(); }
+			if (v.has_fwd_date()) { if (mtpReadResult result = v.vfwd_date.tryRead(from, end)) return result; } else { v.vfwd_date = MTPint(); }
+			if (v.has_reply_to_msg_id()) { if (mtpReadResult result = v.vreply_to_msg_id.tryRead(from, end)) return result; } else { v.vreply_to_msg_id = MTPint(); }
 		} break;
 		case mtpc_updateShort: _type = cons; {
 			if (!data) setData(new MTPDupdateShort());
 			MTPDupdateShort &v(_updateShort());
-			v.vupdate.read(from, end);
-			v.vdate.read(from, end);
+			if (mtpReadResult result = v.vupdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updatesCombined: _type = cons; {
 			if (!data) setData(new MTPDupdatesCombined());
 			MTPDupdatesCombined &v(_updatesCombined());
-			v.vupdates.read(from, end);
-			v.vusers.read(from, end);
-			v.vchats.read(from, end);
-			v.vdate.read(from, end);
-			v.vseq_start.read(from, end);
-			v.vseq.read(from, end);
+			if (mtpReadResult result = v.vupdates.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vchats.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vseq_start.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vseq.tryRead(from, end)) return result;
 		} break;
 		case mtpc_updates: _type = cons; {
 			if (!data) setData(new MTPDupdates());
 			MTPDupdates &v(_updates());
-			v.vupdates.read(from, end);
-			v.vusers.read(from, end);
-			v.vchats.read(from, end);
-			v.vdate.read(from, end);
-			v.vseq.read(from, end);
+			if (mtpReadResult result = v.vupdates.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vchats.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vseq.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPupdates");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPupdates::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -22903,23 +24177,28 @@ inline mtpTypeId MTPphotos_photos::type() const {
 	return _type;
 }
 inline void MTPphotos_photos::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPphotos_photos");
+}
+inline mtpReadResult MTPphotos_photos::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_photos_photos: _type = cons; {
 			if (!data) setData(new MTPDphotos_photos());
 			MTPDphotos_photos &v(_photos_photos());
-			v.vphotos.read(from, end);
-			v.vusers.read(from, end);
+			if (mtpReadResult result = v.vphotos.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
 		} break;
 		case mtpc_photos_photosSlice: _type = cons; {
 			if (!data) setData(new MTPDphotos_photosSlice());
 			MTPDphotos_photosSlice &v(_photos_photosSlice());
-			v.vcount.read(from, end);
-			v.vphotos.read(from, end);
-			v.vusers.read(from, end);
+			if (mtpReadResult result = v.vcount.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vphotos.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPphotos_photos");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPphotos_photos::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -22965,12 +24244,17 @@ inline mtpTypeId MTPphotos_photo::type() const {
 	return mtpc_photos_photo;
 }
 inline void MTPphotos_photo::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_photos_photo) throw mtpErrorUnexpected(cons, "MTPphotos_photo");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPphotos_photo");
+}
+inline mtpReadResult MTPphotos_photo::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_photos_photo) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDphotos_photo());
 	MTPDphotos_photo &v(_photos_photo());
-	v.vphoto.read(from, end);
-	v.vusers.read(from, end);
+	if (mtpReadResult result = v.vphoto.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPphotos_photo::write(mtpBuffer &to) const {
 	const MTPDphotos_photo &v(c_photos_photo());
@@ -22994,13 +24278,18 @@ inline mtpTypeId MTPupload_file::type() const {
 	return mtpc_upload_file;
 }
 inline void MTPupload_file::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_upload_file) throw mtpErrorUnexpected(cons, "MTPupload_file");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPupload_file");
+}
+inline mtpReadResult MTPupload_file::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_upload_file) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDupload_file());
 	MTPDupload_file &v(_upload_file());
-	v.vtype.read(from, end);
-	v.vmtime.read(from, end);
-	v.vbytes.read(from, end);
+	if (mtpReadResult result = v.vtype.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vmtime.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vbytes.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPupload_file::write(mtpBuffer &to) const {
 	const MTPDupload_file &v(c_upload_file());
@@ -23025,14 +24314,19 @@ inline mtpTypeId MTPdcOption::type() const {
 	return mtpc_dcOption;
 }
 inline void MTPdcOption::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_dcOption) throw mtpErrorUnexpected(cons, "MTPdcOption");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPdcOption");
+}
+inline mtpReadResult MTPdcOption::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_dcOption) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDdcOption());
 	MTPDdcOption &v(_dcOption());
-	v.vflags.read(from, end);
-	v.vid.read(from, end);
-	v.vip_address.read(from, end);
-	v.vport.read(from, end);
+	if (mtpReadResult result = v.vflags.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vip_address.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vport.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPdcOption::write(mtpBuffer &to) const {
 	const MTPDdcOption &v(c_dcOption());
@@ -23058,28 +24352,33 @@ inline mtpTypeId MTPconfig::type() const {
 	return mtpc_config;
 }
 inline void MTPconfig::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_config) throw mtpErrorUnexpected(cons, "MTPconfig");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPconfig");
+}
+inline mtpReadResult MTPconfig::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_config) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDconfig());
 	MTPDconfig &v(_config());
-	v.vdate.read(from, end);
-	v.vexpires.read(from, end);
-	v.vtest_mode.read(from, end);
-	v.vthis_dc.read(from, end);
-	v.vdc_options.read(from, end);
-	v.vchat_size_max.read(from, end);
-	v.vbroadcast_size_max.read(from, end);
-	v.vforwarded_count_max.read(from, end);
-	v.vonline_update_period_ms.read(from, end);
-	v.voffline_blur_timeout_ms.read(from, end);
-	v.voffline_idle_timeout_ms.read(from, end);
-	v.vonline_cloud_timeout_ms.read(from, end);
-	v.vnotify_cloud_delay_ms.read(from, end);
-	v.vnotify_default_delay_ms.read(from, end);
-	v.vchat_big_size.read(from, end);
-	v.vpush_chat_period_ms.read(from, end);
-	v.vpush_chat_limit.read(from, end);
-	v.vdisabled_features.read(from, end);
+	if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vexpires.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vtest_mode.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vthis_dc.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vdc_options.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vchat_size_max.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vbroadcast_size_max.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vforwarded_count_max.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vonline_update_period_ms.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.voffline_blur_timeout_ms.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.voffline_idle_timeout_ms.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vonline_cloud_timeout_ms.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vnotify_cloud_delay_ms.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vnotify_default_delay_ms.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vchat_big_size.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vpush_chat_period_ms.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vpush_chat_limit.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vdisabled_features.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPconfig::write(mtpBuffer &to) const {
 	const MTPDconfig &v(c_config());
@@ -23119,13 +24418,18 @@ inline mtpTypeId MTPnearestDc::type() const {
 	return mtpc_nearestDc;
 }
 inline void MTPnearestDc::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_nearestDc) throw mtpErrorUnexpected(cons, "MTPnearestDc");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPnearestDc");
+}
+inline mtpReadResult MTPnearestDc::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_nearestDc) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDnearestDc());
 	MTPDnearestDc &v(_nearestDc());
-	v.vcountry.read(from, end);
-	v.vthis_dc.read(from, end);
-	v.vnearest_dc.read(from, end);
+	if (mtpReadResult result = v.vcountry.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vthis_dc.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vnearest_dc.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPnearestDc::write(mtpBuffer &to) const {
 	const MTPDnearestDc &v(c_nearestDc());
@@ -23153,19 +24457,24 @@ inline mtpTypeId MTPhelp_appUpdate::type() const {
 	return _type;
 }
 inline void MTPhelp_appUpdate::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPhelp_appUpdate");
+}
+inline mtpReadResult MTPhelp_appUpdate::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_help_appUpdate: _type = cons; {
 			if (!data) setData(new MTPDhelp_appUpdate());
 			MTPDhelp_appUpdate &v(_help_appUpdate());
-			v.vid.read(from, end);
-			v.vcritical.read(from, end);
-			v.vurl.read(from, end);
-			v.vtext.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vcritical.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vurl.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vtext.tryRead(from, end)) return result;
 		} break;
 		case mtpc_help_noAppUpdate: _type = cons; break;
-		default: throw mtpErrorUnexpected(cons, "MTPhelp_appUpdate");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPhelp_appUpdate::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -23205,11 +24514,16 @@ inline mtpTypeId MTPhelp_inviteText::type() const {
 	return mtpc_help_inviteText;
 }
 inline void MTPhelp_inviteText::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_help_inviteText) throw mtpErrorUnexpected(cons, "MTPhelp_inviteText");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPhelp_inviteText");
+}
+inline mtpReadResult MTPhelp_inviteText::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_help_inviteText) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDhelp_inviteText());
 	MTPDhelp_inviteText &v(_help_inviteText());
-	v.vmessage.read(from, end);
+	if (mtpReadResult result = v.vmessage.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPhelp_inviteText::write(mtpBuffer &to) const {
 	const MTPDhelp_inviteText &v(c_help_inviteText());
@@ -23232,12 +24546,17 @@ inline mtpTypeId MTPinputGeoChat::type() const {
 	return mtpc_inputGeoChat;
 }
 inline void MTPinputGeoChat::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_inputGeoChat) throw mtpErrorUnexpected(cons, "MTPinputGeoChat");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputGeoChat");
+}
+inline mtpReadResult MTPinputGeoChat::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_inputGeoChat) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDinputGeoChat());
 	MTPDinputGeoChat &v(_inputGeoChat());
-	v.vchat_id.read(from, end);
-	v.vaccess_hash.read(from, end);
+	if (mtpReadResult result = v.vchat_id.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPinputGeoChat::write(mtpBuffer &to) const {
 	const MTPDinputGeoChat &v(c_inputGeoChat());
@@ -23272,35 +24591,40 @@ inline mtpTypeId MTPgeoChatMessage::type() const {
 	return _type;
 }
 inline void MTPgeoChatMessage::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPgeoChatMessage");
+}
+inline mtpReadResult MTPgeoChatMessage::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_geoChatMessageEmpty: _type = cons; {
 			if (!data) setData(new MTPDgeoChatMessageEmpty());
 			MTPDgeoChatMessageEmpty &v(_geoChatMessageEmpty());
-			v.vchat_id.read(from, end);
-			v.vid.read(from, end);
+			if (mtpReadResult result = v.vchat_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
 		} break;
 		case mtpc_geoChatMessage: _type = cons; {
 			if (!data) setData(new MTPDgeoChatMessage());
 			MTPDgeoChatMessage &v(_geoChatMessage());
-			v.vchat_id.read(from, end);
-			v.vid.read(from, end);
-			v.vfrom_id.read(from, end);
-			v.vdate.read(from, end);
-			v.vmessage.read(from, end);
-			v.vmedia.read(from, end);
+			if (mtpReadResult result = v.vchat_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vfrom_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmessage.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmedia.tryRead(from, end)) return result;
 		} break;
 		case mtpc_geoChatMessageService: _type = cons; {
 			if (!data) setData(new MTPDgeoChatMessageService());
 			MTPDgeoChatMessageService &v(_geoChatMessageService());
-			v.vchat_id.read(from, end);
-			v.vid.read(from, end);
-			v.vfrom_id.read(from, end);
-			v.vdate.read(from, end);
-			v.vaction.read(from, end);
+			if (mtpReadResult result = v.vchat_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vfrom_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaction.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPgeoChatMessage");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPgeoChatMessage::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -23363,14 +24687,19 @@ inline mtpTypeId MTPgeochats_statedMessage::type() const {
 	return mtpc_geochats_statedMessage;
 }
 inline void MTPgeochats_statedMessage::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_geochats_statedMessage) throw mtpErrorUnexpected(cons, "MTPgeochats_statedMessage");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPgeochats_statedMessage");
+}
+inline mtpReadResult MTPgeochats_statedMessage::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_geochats_statedMessage) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDgeochats_statedMessage());
 	MTPDgeochats_statedMessage &v(_geochats_statedMessage());
-	v.vmessage.read(from, end);
-	v.vchats.read(from, end);
-	v.vusers.read(from, end);
-	v.vseq.read(from, end);
+	if (mtpReadResult result = v.vmessage.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vchats.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vseq.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPgeochats_statedMessage::write(mtpBuffer &to) const {
 	const MTPDgeochats_statedMessage &v(c_geochats_statedMessage());
@@ -23396,14 +24725,19 @@ inline mtpTypeId MTPgeochats_located::type() const {
 	return mtpc_geochats_located;
 }
 inline void MTPgeochats_located::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_geochats_located) throw mtpErrorUnexpected(cons, "MTPgeochats_located");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPgeochats_located");
+}
+inline mtpReadResult MTPgeochats_located::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_geochats_located) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDgeochats_located());
 	MTPDgeochats_located &v(_geochats_located());
-	v.vresults.read(from, end);
-	v.vmessages.read(from, end);
-	v.vchats.read(from, end);
-	v.vusers.read(from, end);
+	if (mtpReadResult result = v.vresults.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vmessages.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vchats.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPgeochats_located::write(mtpBuffer &to) const {
 	const MTPDgeochats_located &v(c_geochats_located());
@@ -23436,25 +24770,30 @@ inline mtpTypeId MTPgeochats_messages::type() const {
 	return _type;
 }
 inline void MTPgeochats_messages::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPgeochats_messages");
+}
+inline mtpReadResult MTPgeochats_messages::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_geochats_messages: _type = cons; {
 			if (!data) setData(new MTPDgeochats_messages());
 			MTPDgeochats_messages &v(_geochats_messages());
-			v.vmessages.read(from, end);
-			v.vchats.read(from, end);
-			v.vusers.read(from, end);
+			if (mtpReadResult result = v.vmessages.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vchats.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
 		} break;
 		case mtpc_geochats_messagesSlice: _type = cons; {
 			if (!data) setData(new MTPDgeochats_messagesSlice());
 			MTPDgeochats_messagesSlice &v(_geochats_messagesSlice());
-			v.vcount.read(from, end);
-			v.vmessages.read(from, end);
-			v.vchats.read(from, end);
-			v.vusers.read(from, end);
+			if (mtpReadResult result = v.vcount.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmessages.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vchats.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPgeochats_messages");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPgeochats_messages::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -23521,50 +24860,55 @@ inline mtpTypeId MTPencryptedChat::type() const {
 	return _type;
 }
 inline void MTPencryptedChat::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPencryptedChat");
+}
+inline mtpReadResult MTPencryptedChat::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_encryptedChatEmpty: _type = cons; {
 			if (!data) setData(new MTPDencryptedChatEmpty());
 			MTPDencryptedChatEmpty &v(_encryptedChatEmpty());
-			v.vid.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
 		} break;
 		case mtpc_encryptedChatWaiting: _type = cons; {
 			if (!data) setData(new MTPDencryptedChatWaiting());
 			MTPDencryptedChatWaiting &v(_encryptedChatWaiting());
-			v.vid.read(from, end);
-			v.vaccess_hash.read(from, end);
-			v.vdate.read(from, end);
-			v.vadmin_id.read(from, end);
-			v.vparticipant_id.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vadmin_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vparticipant_id.tryRead(from, end)) return result;
 		} break;
 		case mtpc_encryptedChatRequested: _type = cons; {
 			if (!data) setData(new MTPDencryptedChatRequested());
 			MTPDencryptedChatRequested &v(_encryptedChatRequested());
-			v.vid.read(from, end);
-			v.vaccess_hash.read(from, end);
-			v.vdate.read(from, end);
-			v.vadmin_id.read(from, end);
-			v.vparticipant_id.read(from, end);
-			v.vg_a.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vadmin_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vparticipant_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vg_a.tryRead(from, end)) return result;
 		} break;
 		case mtpc_encryptedChat: _type = cons; {
 			if (!data) setData(new MTPDencryptedChat());
 			MTPDencryptedChat &v(_encryptedChat());
-			v.vid.read(from, end);
-			v.vaccess_hash.read(from, end);
-			v.vdate.read(from, end);
-			v.vadmin_id.read(from, end);
-			v.vparticipant_id.read(from, end);
-			v.vg_a_or_b.read(from, end);
-			v.vkey_fingerprint.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vadmin_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vparticipant_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vg_a_or_b.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vkey_fingerprint.tryRead(from, end)) return result;
 		} break;
 		case mtpc_encryptedChatDiscarded: _type = cons; {
 			if (!data) setData(new MTPDencryptedChatDiscarded());
 			MTPDencryptedChatDiscarded &v(_encryptedChatDiscarded());
-			v.vid.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPencryptedChat");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPencryptedChat::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -23652,12 +24996,17 @@ inline mtpTypeId MTPinputEncryptedChat::type() const {
 	return mtpc_inputEncryptedChat;
 }
 inline void MTPinputEncryptedChat::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_inputEncryptedChat) throw mtpErrorUnexpected(cons, "MTPinputEncryptedChat");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputEncryptedChat");
+}
+inline mtpReadResult MTPinputEncryptedChat::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_inputEncryptedChat) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDinputEncryptedChat());
 	MTPDinputEncryptedChat &v(_inputEncryptedChat());
-	v.vchat_id.read(from, end);
-	v.vaccess_hash.read(from, end);
+	if (mtpReadResult result = v.vchat_id.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPinputEncryptedChat::write(mtpBuffer &to) const {
 	const MTPDinputEncryptedChat &v(c_inputEncryptedChat());
@@ -23684,20 +25033,25 @@ inline mtpTypeId MTPencryptedFile::type() const {
 	return _type;
 }
 inline void MTPencryptedFile::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPencryptedFile");
+}
+inline mtpReadResult MTPencryptedFile::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_encryptedFileEmpty: _type = cons; break;
 		case mtpc_encryptedFile: _type = cons; {
 			if (!data) setData(new MTPDencryptedFile());
 			MTPDencryptedFile &v(_encryptedFile());
-			v.vid.read(from, end);
-			v.vaccess_hash.read(from, end);
-			v.vsize.read(from, end);
-			v.vdc_id.read(from, end);
-			v.vkey_fingerprint.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vsize.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdc_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vkey_fingerprint.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPencryptedFile");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPencryptedFile::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -23749,32 +25103,37 @@ inline mtpTypeId MTPinputEncryptedFile::type() const {
 	return _type;
 }
 inline void MTPinputEncryptedFile::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputEncryptedFile");
+}
+inline mtpReadResult MTPinputEncryptedFile::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_inputEncryptedFileEmpty: _type = cons; break;
 		case mtpc_inputEncryptedFileUploaded: _type = cons; {
 			if (!data) setData(new MTPDinputEncryptedFileUploaded());
 			MTPDinputEncryptedFileUploaded &v(_inputEncryptedFileUploaded());
-			v.vid.read(from, end);
-			v.vparts.read(from, end);
-			v.vmd5_checksum.read(from, end);
-			v.vkey_fingerprint.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vparts.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmd5_checksum.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vkey_fingerprint.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputEncryptedFile: _type = cons; {
 			if (!data) setData(new MTPDinputEncryptedFile());
 			MTPDinputEncryptedFile &v(_inputEncryptedFile());
-			v.vid.read(from, end);
-			v.vaccess_hash.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputEncryptedFileBigUploaded: _type = cons; {
 			if (!data) setData(new MTPDinputEncryptedFileBigUploaded());
 			MTPDinputEncryptedFileBigUploaded &v(_inputEncryptedFileBigUploaded());
-			v.vid.read(from, end);
-			v.vparts.read(from, end);
-			v.vkey_fingerprint.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vparts.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vkey_fingerprint.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPinputEncryptedFile");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPinputEncryptedFile::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -23844,27 +25203,32 @@ inline mtpTypeId MTPencryptedMessage::type() const {
 	return _type;
 }
 inline void MTPencryptedMessage::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPencryptedMessage");
+}
+inline mtpReadResult MTPencryptedMessage::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_encryptedMessage: _type = cons; {
 			if (!data) setData(new MTPDencryptedMessage());
 			MTPDencryptedMessage &v(_encryptedMessage());
-			v.vrandom_id.read(from, end);
-			v.vchat_id.read(from, end);
-			v.vdate.read(from, end);
-			v.vbytes.read(from, end);
-			v.vfile.read(from, end);
+			if (mtpReadResult result = v.vrandom_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vchat_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vbytes.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vfile.tryRead(from, end)) return result;
 		} break;
 		case mtpc_encryptedMessageService: _type = cons; {
 			if (!data) setData(new MTPDencryptedMessageService());
 			MTPDencryptedMessageService &v(_encryptedMessageService());
-			v.vrandom_id.read(from, end);
-			v.vchat_id.read(from, end);
-			v.vdate.read(from, end);
-			v.vbytes.read(from, end);
+			if (mtpReadResult result = v.vrandom_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vchat_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vbytes.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPencryptedMessage");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPencryptedMessage::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -23921,23 +25285,28 @@ inline mtpTypeId MTPmessages_dhConfig::type() const {
 	return _type;
 }
 inline void MTPmessages_dhConfig::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_dhConfig");
+}
+inline mtpReadResult MTPmessages_dhConfig::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_messages_dhConfigNotModified: _type = cons; {
 			if (!data) setData(new MTPDmessages_dhConfigNotModified());
 			MTPDmessages_dhConfigNotModified &v(_messages_dhConfigNotModified());
-			v.vrandom.read(from, end);
+			if (mtpReadResult result = v.vrandom.tryRead(from, end)) return result;
 		} break;
 		case mtpc_messages_dhConfig: _type = cons; {
 			if (!data) setData(new MTPDmessages_dhConfig());
 			MTPDmessages_dhConfig &v(_messages_dhConfig());
-			v.vg.read(from, end);
-			v.vp.read(from, end);
-			v.vversion.read(from, end);
-			v.vrandom.read(from, end);
+			if (mtpReadResult result = v.vg.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vp.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vversion.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vrandom.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPmessages_dhConfig");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPmessages_dhConfig::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -23990,21 +25359,26 @@ inline mtpTypeId MTPmessages_sentEncryptedMessage::type() const {
 	return _type;
 }
 inline void MTPmessages_sentEncryptedMessage::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_sentEncryptedMessage");
+}
+inline mtpReadResult MTPmessages_sentEncryptedMessage::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_messages_sentEncryptedMessage: _type = cons; {
 			if (!data) setData(new MTPDmessages_sentEncryptedMessage());
 			MTPDmessages_sentEncryptedMessage &v(_messages_sentEncryptedMessage());
-			v.vdate.read(from, end);
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
 		} break;
 		case mtpc_messages_sentEncryptedFile: _type = cons; {
 			if (!data) setData(new MTPDmessages_sentEncryptedFile());
 			MTPDmessages_sentEncryptedFile &v(_messages_sentEncryptedFile());
-			v.vdate.read(from, end);
-			v.vfile.read(from, end);
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vfile.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPmessages_sentEncryptedMessage");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPmessages_sentEncryptedMessage::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -24051,17 +25425,22 @@ inline mtpTypeId MTPinputAudio::type() const {
 	return _type;
 }
 inline void MTPinputAudio::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputAudio");
+}
+inline mtpReadResult MTPinputAudio::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_inputAudioEmpty: _type = cons; break;
 		case mtpc_inputAudio: _type = cons; {
 			if (!data) setData(new MTPDinputAudio());
 			MTPDinputAudio &v(_inputAudio());
-			v.vid.read(from, end);
-			v.vaccess_hash.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPinputAudio");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPinputAudio::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -24102,17 +25481,22 @@ inline mtpTypeId MTPinputDocument::type() const {
 	return _type;
 }
 inline void MTPinputDocument::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputDocument");
+}
+inline mtpReadResult MTPinputDocument::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_inputDocumentEmpty: _type = cons; break;
 		case mtpc_inputDocument: _type = cons; {
 			if (!data) setData(new MTPDinputDocument());
 			MTPDinputDocument &v(_inputDocument());
-			v.vid.read(from, end);
-			v.vaccess_hash.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPinputDocument");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPinputDocument::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -24157,27 +25541,32 @@ inline mtpTypeId MTPaudio::type() const {
 	return _type;
 }
 inline void MTPaudio::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaudio");
+}
+inline mtpReadResult MTPaudio::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_audioEmpty: _type = cons; {
 			if (!data) setData(new MTPDaudioEmpty());
 			MTPDaudioEmpty &v(_audioEmpty());
-			v.vid.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
 		} break;
 		case mtpc_audio: _type = cons; {
 			if (!data) setData(new MTPDaudio());
 			MTPDaudio &v(_audio());
-			v.vid.read(from, end);
-			v.vaccess_hash.read(from, end);
-			v.vuser_id.read(from, end);
-			v.vdate.read(from, end);
-			v.vduration.read(from, end);
-			v.vmime_type.read(from, end);
-			v.vsize.read(from, end);
-			v.vdc_id.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vduration.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmime_type.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vsize.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdc_id.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPaudio");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPaudio::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -24234,27 +25623,32 @@ inline mtpTypeId MTPdocument::type() const {
 	return _type;
 }
 inline void MTPdocument::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPdocument");
+}
+inline mtpReadResult MTPdocument::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_documentEmpty: _type = cons; {
 			if (!data) setData(new MTPDdocumentEmpty());
 			MTPDdocumentEmpty &v(_documentEmpty());
-			v.vid.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
 		} break;
 		case mtpc_document: _type = cons; {
 			if (!data) setData(new MTPDdocument());
 			MTPDdocument &v(_document());
-			v.vid.read(from, end);
-			v.vaccess_hash.read(from, end);
-			v.vdate.read(from, end);
-			v.vmime_type.read(from, end);
-			v.vsize.read(from, end);
-			v.vthumb.read(from, end);
-			v.vdc_id.read(from, end);
-			v.vattributes.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vmime_type.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vsize.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vthumb.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdc_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vattributes.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPdocument");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPdocument::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -24304,12 +25698,17 @@ inline mtpTypeId MTPhelp_support::type() const {
 	return mtpc_help_support;
 }
 inline void MTPhelp_support::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_help_support) throw mtpErrorUnexpected(cons, "MTPhelp_support");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPhelp_support");
+}
+inline mtpReadResult MTPhelp_support::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_help_support) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDhelp_support());
 	MTPDhelp_support &v(_help_support());
-	v.vphone_number.read(from, end);
-	v.vuser.read(from, end);
+	if (mtpReadResult result = v.vphone_number.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vuser.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPhelp_support::write(mtpBuffer &to) const {
 	const MTPDhelp_support &v(c_help_support());
@@ -24336,18 +25735,23 @@ inline mtpTypeId MTPnotifyPeer::type() const {
 	return _type;
 }
 inline void MTPnotifyPeer::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPnotifyPeer");
+}
+inline mtpReadResult MTPnotifyPeer::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_notifyPeer: _type = cons; {
 			if (!data) setData(new MTPDnotifyPeer());
 			MTPDnotifyPeer &v(_notifyPeer());
-			v.vpeer.read(from, end);
+			if (mtpReadResult result = v.vpeer.tryRead(from, end)) return result;
 		} break;
 		case mtpc_notifyUsers: _type = cons; break;
 		case mtpc_notifyChats: _type = cons; break;
 		case mtpc_notifyAll: _type = cons; break;
-		default: throw mtpErrorUnexpected(cons, "MTPnotifyPeer");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPnotifyPeer::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -24407,6 +25811,10 @@ inline mtpTypeId MTPsendMessageAction::type() const {
 	return _type;
 }
 inline void MTPsendMessageAction::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPsendMessageAction");
+}
+inline mtpReadResult MTPsendMessageAction::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_sendMessageTypingAction: _type = cons; break;
@@ -24415,28 +25823,29 @@ inline void MTPsendMessageAction::read(const mtpPrime *&from, const mtpPrime *en
 		case mtpc_sendMessageUploadVideoAction: _type = cons; {
 			if (!data) setData(new MTPDsendMessageUploadVideoAction());
 			MTPDsendMessageUploadVideoAction &v(_sendMessageUploadVideoAction());
-			v.vprogress.read(from, end);
+			if (mtpReadResult result = v.vprogress.tryRead(from, end)) return result;
 		} break;
 		case mtpc_sendMessageRecordAudioAction: _type = cons; break;
 		case mtpc_sendMessageUploadAudioAction: _type = cons; {
 			if (!data) setData(new MTPDsendMessageUploadAudioAction());
 			MTPDsendMessageUploadAudioAction &v(_sendMessageUploadAudioAction());
-			v.vprogress.read(from, end);
+			if (mtpReadResult result = v.vprogress.tryRead(from, end)) return result;
 		} break;
 		case mtpc_sendMessageUploadPhotoAction: _type = cons; {
 			if (!data) setData(new MTPDsendMessageUploadPhotoAction());
 			MTPDsendMessageUploadPhotoAction &v(_sendMessageUploadPhotoAction());
-			v.vprogress.read(from, end);
+			if (mtpReadResult result = v.vprogress.tryRead(from, end)) return result;
 		} break;
 		case mtpc_sendMessageUploadDocumentAction: _type = cons; {
 			if (!data) setData(new MTPDsendMessageUploadDocumentAction());
 			MTPDsendMessageUploadDocumentAction &v(_sendMessageUploadDocumentAction());
-			v.vprogress.read(from, end);
+			if (mtpReadResult result = v.vprogress.tryRead(from, end)) return result;
 		} break;
 		case mtpc_sendMessageGeoLocationAction: _type = cons; break;
 		case mtpc_sendMessageChooseContactAction: _type = cons; break;
-		default: throw mtpErrorUnexpected(cons, "MTPsendMessageAction");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPsendMessageAction::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -24523,11 +25932,16 @@ inline mtpTypeId MTPcontactFound::type() const {
 	return mtpc_contactFound;
 }
 inline void MTPcontactFound::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_contactFound) throw mtpErrorUnexpected(cons, "MTPcontactFound");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontactFound");
+}
+inline mtpReadResult MTPcontactFound::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_contactFound) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDcontactFound());
 	MTPDcontactFound &v(_contactFound());
-	v.vuser_id.read(from, end);
+	if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPcontactFound::write(mtpBuffer &to) const {
 	const MTPDcontactFound &v(c_contactFound());
@@ -24550,12 +25964,17 @@ inline mtpTypeId MTPcontacts_found::type() const {
 	return mtpc_contacts_found;
 }
 inline void MTPcontacts_found::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_contacts_found) throw mtpErrorUnexpected(cons, "MTPcontacts_found");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_found");
+}
+inline mtpReadResult MTPcontacts_found::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_contacts_found) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDcontacts_found());
 	MTPDcontacts_found &v(_contacts_found());
-	v.vresults.read(from, end);
-	v.vusers.read(from, end);
+	if (mtpReadResult result = v.vresults.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPcontacts_found::write(mtpBuffer &to) const {
 	const MTPDcontacts_found &v(c_contacts_found());
@@ -24575,6 +25994,11 @@ inline mtpTypeId MTPinputPrivacyKey::type() const {
 	return mtpc_inputPrivacyKeyStatusTimestamp;
 }
 inline void MTPinputPrivacyKey::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputPrivacyKey");
+}
+inline mtpReadResult MTPinputPrivacyKey::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	return mtpReadDone;
 }
 inline void MTPinputPrivacyKey::write(mtpBuffer &to) const {
 }
@@ -24589,6 +26013,11 @@ inline mtpTypeId MTPprivacyKey::type() const {
 	return mtpc_privacyKeyStatusTimestamp;
 }
 inline void MTPprivacyKey::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPprivacyKey");
+}
+inline mtpReadResult MTPprivacyKey::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	return mtpReadDone;
 }
 inline void MTPprivacyKey::write(mtpBuffer &to) const {
 }
@@ -24614,6 +26043,10 @@ inline mtpTypeId MTPinputPrivacyRule::type() const {
 	return _type;
 }
 inline void MTPinputPrivacyRule::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputPrivacyRule");
+}
+inline mtpReadResult MTPinputPrivacyRule::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_inputPrivacyValueAllowContacts: _type = cons; break;
@@ -24621,17 +26054,18 @@ inline void MTPinputPrivacyRule::read(const mtpPrime *&from, const mtpPrime *end
 		case mtpc_inputPrivacyValueAllowUsers: _type = cons; {
 			if (!data) setData(new MTPDinputPrivacyValueAllowUsers());
 			MTPDinputPrivacyValueAllowUsers &v(_inputPrivacyValueAllowUsers());
-			v.vusers.read(from, end);
+			if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputPrivacyValueDisallowContacts: _type = cons; break;
 		case mtpc_inputPrivacyValueDisallowAll: _type = cons; break;
 		case mtpc_inputPrivacyValueDisallowUsers: _type = cons; {
 			if (!data) setData(new MTPDinputPrivacyValueDisallowUsers());
 			MTPDinputPrivacyValueDisallowUsers &v(_inputPrivacyValueDisallowUsers());
-			v.vusers.read(from, end);
+			if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPinputPrivacyRule");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPinputPrivacyRule::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -24697,6 +26131,10 @@ inline mtpTypeId MTPprivacyRule::type() const {
 	return _type;
 }
 inline void MTPprivacyRule::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPprivacyRule");
+}
+inline mtpReadResult MTPprivacyRule::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_privacyValueAllowContacts: _type = cons; break;
@@ -24704,17 +26142,18 @@ inline void MTPprivacyRule::read(const mtpPrime *&from, const mtpPrime *end, mtp
 		case mtpc_privacyValueAllowUsers: _type = cons; {
 			if (!data) setData(new MTPDprivacyValueAllowUsers());
 			MTPDprivacyValueAllowUsers &v(_privacyValueAllowUsers());
-			v.vusers.read(from, end);
+			if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
 		} break;
 		case mtpc_privacyValueDisallowContacts: _type = cons; break;
 		case mtpc_privacyValueDisallowAll: _type = cons; break;
 		case mtpc_privacyValueDisallowUsers: _type = cons; {
 			if (!data) setData(new MTPDprivacyValueDisallowUsers());
 			MTPDprivacyValueDisallowUsers &v(_privacyValueDisallowUsers());
-			v.vusers.read(from, end);
+			if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPprivacyRule");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPprivacyRule::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -24773,12 +26212,17 @@ inline mtpTypeId MTPaccount_privacyRules::type() const {
 	return mtpc_account_privacyRules;
 }
 inline void MTPaccount_privacyRules::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_account_privacyRules) throw mtpErrorUnexpected(cons, "MTPaccount_privacyRules");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_privacyRules");
+}
+inline mtpReadResult MTPaccount_privacyRules::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_account_privacyRules) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDaccount_privacyRules());
 	MTPDaccount_privacyRules &v(_account_privacyRules());
-	v.vrules.read(from, end);
-	v.vusers.read(from, end);
+	if (mtpReadResult result = v.vrules.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vusers.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPaccount_privacyRules::write(mtpBuffer &to) const {
 	const MTPDaccount_privacyRules &v(c_account_privacyRules());
@@ -24802,11 +26246,16 @@ inline mtpTypeId MTPaccountDaysTTL::type() const {
 	return mtpc_accountDaysTTL;
 }
 inline void MTPaccountDaysTTL::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_accountDaysTTL) throw mtpErrorUnexpected(cons, "MTPaccountDaysTTL");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccountDaysTTL");
+}
+inline mtpReadResult MTPaccountDaysTTL::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_accountDaysTTL) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDaccountDaysTTL());
 	MTPDaccountDaysTTL &v(_accountDaysTTL());
-	v.vdays.read(from, end);
+	if (mtpReadResult result = v.vdays.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPaccountDaysTTL::write(mtpBuffer &to) const {
 	const MTPDaccountDaysTTL &v(c_accountDaysTTL());
@@ -24829,12 +26278,17 @@ inline mtpTypeId MTPaccount_sentChangePhoneCode::type() const {
 	return mtpc_account_sentChangePhoneCode;
 }
 inline void MTPaccount_sentChangePhoneCode::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_account_sentChangePhoneCode) throw mtpErrorUnexpected(cons, "MTPaccount_sentChangePhoneCode");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_sentChangePhoneCode");
+}
+inline mtpReadResult MTPaccount_sentChangePhoneCode::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_account_sentChangePhoneCode) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDaccount_sentChangePhoneCode());
 	MTPDaccount_sentChangePhoneCode &v(_account_sentChangePhoneCode());
-	v.vphone_code_hash.read(from, end);
-	v.vsend_call_timeout.read(from, end);
+	if (mtpReadResult result = v.vphone_code_hash.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vsend_call_timeout.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPaccount_sentChangePhoneCode::write(mtpBuffer &to) const {
 	const MTPDaccount_sentChangePhoneCode &v(c_account_sentChangePhoneCode());
@@ -24877,42 +26331,47 @@ inline mtpTypeId MTPdocumentAttribute::type() const {
 	return _type;
 }
 inline void MTPdocumentAttribute::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPdocumentAttribute");
+}
+inline mtpReadResult MTPdocumentAttribute::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_documentAttributeImageSize: _type = cons; {
 			if (!data) setData(new MTPDdocumentAttributeImageSize());
 			MTPDdocumentAttributeImageSize &v(_documentAttributeImageSize());
-			v.vw.read(from, end);
-			v.vh.read(from, end);
+			if (mtpReadResult result = v.vw.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vh.tryRead(from, end)) return result;
 		} break;
 		case mtpc_documentAttributeAnimated: _type = cons; break;
 		case mtpc_documentAttributeSticker: _type = cons; {
 			if (!data) setData(new MTPDdocumentAttributeSticker());
 			MTPDdocumentAttributeSticker &v(_documentAttributeSticker());
-			v.valt.read(from, end);
-			v.vstickerset.read(from, end);
+			if (mtpReadResult result = v.valt.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vstickerset.tryRead(from, end)) return result;
 		} break;
 		case mtpc_documentAttributeVideo: _type = cons; {
 			if (!data) setData(new MTPDdocumentAttributeVideo());
 			MTPDdocumentAttributeVideo &v(_documentAttributeVideo());
-			v.vduration.read(from, end);
-			v.vw.read(from, end);
-			v.vh.read(from, end);
+			if (mtpReadResult result = v.vduration.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vw.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vh.tryRead(from, end)) return result;
 		} break;
 		case mtpc_documentAttributeAudio: _type = cons; {
 			if (!data) setData(new MTPDdocumentAttributeAudio());
 			MTPDdocumentAttributeAudio &v(_documentAttributeAudio());
-			v.vduration.read(from, end);
-			v.vtitle.read(from, end);
-			v.vperformer.read(from, end);
+			if (mtpReadResult result = v.vduration.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vtitle.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vperformer.tryRead(from, end)) return result;
 		} break;
 		case mtpc_documentAttributeFilename: _type = cons; {
 			if (!data) setData(new MTPDdocumentAttributeFilename());
 			MTPDdocumentAttributeFilename &v(_documentAttributeFilename());
-			v.vfile_name.read(from, end);
+			if (mtpReadResult result = v.vfile_name.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPdocumentAttribute");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPdocumentAttribute::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -24998,17 +26457,22 @@ inline mtpTypeId MTPmessages_stickers::type() const {
 	return _type;
 }
 inline void MTPmessages_stickers::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_stickers");
+}
+inline mtpReadResult MTPmessages_stickers::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_messages_stickersNotModified: _type = cons; break;
 		case mtpc_messages_stickers: _type = cons; {
 			if (!data) setData(new MTPDmessages_stickers());
 			MTPDmessages_stickers &v(_messages_stickers());
-			v.vhash.read(from, end);
-			v.vstickers.read(from, end);
+			if (mtpReadResult result = v.vhash.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vstickers.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPmessages_stickers");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPmessages_stickers::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -25046,12 +26510,17 @@ inline mtpTypeId MTPstickerPack::type() const {
 	return mtpc_stickerPack;
 }
 inline void MTPstickerPack::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_stickerPack) throw mtpErrorUnexpected(cons, "MTPstickerPack");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPstickerPack");
+}
+inline mtpReadResult MTPstickerPack::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_stickerPack) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDstickerPack());
 	MTPDstickerPack &v(_stickerPack());
-	v.vemoticon.read(from, end);
-	v.vdocuments.read(from, end);
+	if (mtpReadResult result = v.vemoticon.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vdocuments.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPstickerPack::write(mtpBuffer &to) const {
 	const MTPDstickerPack &v(c_stickerPack());
@@ -25078,17 +26547,22 @@ inline mtpTypeId MTPmessages_allStickers::type() const {
 	return _type;
 }
 inline void MTPmessages_allStickers::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_allStickers");
+}
+inline mtpReadResult MTPmessages_allStickers::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_messages_allStickersNotModified: _type = cons; break;
 		case mtpc_messages_allStickers: _type = cons; {
 			if (!data) setData(new MTPDmessages_allStickers());
 			MTPDmessages_allStickers &v(_messages_allStickers());
-			v.vhash.read(from, end);
-			v.vsets.read(from, end);
+			if (mtpReadResult result = v.vhash.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vsets.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPmessages_allStickers");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPmessages_allStickers::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -25126,12 +26600,17 @@ inline mtpTypeId MTPdisabledFeature::type() const {
 	return mtpc_disabledFeature;
 }
 inline void MTPdisabledFeature::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_disabledFeature) throw mtpErrorUnexpected(cons, "MTPdisabledFeature");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPdisabledFeature");
+}
+inline mtpReadResult MTPdisabledFeature::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_disabledFeature) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDdisabledFeature());
 	MTPDdisabledFeature &v(_disabledFeature());
-	v.vfeature.read(from, end);
-	v.vdescription.read(from, end);
+	if (mtpReadResult result = v.vfeature.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vdescription.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPdisabledFeature::write(mtpBuffer &to) const {
 	const MTPDdisabledFeature &v(c_disabledFeature());
@@ -25155,12 +26634,17 @@ inline mtpTypeId MTPmessages_affectedMessages::type() const {
 	return mtpc_messages_affectedMessages;
 }
 inline void MTPmessages_affectedMessages::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_messages_affectedMessages) throw mtpErrorUnexpected(cons, "MTPmessages_affectedMessages");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_affectedMessages");
+}
+inline mtpReadResult MTPmessages_affectedMessages::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_messages_affectedMessages) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDmessages_affectedMessages());
 	MTPDmessages_affectedMessages &v(_messages_affectedMessages());
-	v.vpts.read(from, end);
-	v.vpts_count.read(from, end);
+	if (mtpReadResult result = v.vpts.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vpts_count.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPmessages_affectedMessages::write(mtpBuffer &to) const {
 	const MTPDmessages_affectedMessages &v(c_messages_affectedMessages());
@@ -25181,13 +26665,18 @@ inline mtpTypeId MTPcontactLink::type() const {
 	return _type;
 }
 inline void MTPcontactLink::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontactLink");
+}
+inline mtpReadResult MTPcontactLink::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	switch (cons) {
 		case mtpc_contactLinkUnknown: _type = cons; break;
 		case mtpc_contactLinkNone: _type = cons; break;
 		case mtpc_contactLinkHasPhone: _type = cons; break;
 		case mtpc_contactLinkContact: _type = cons; break;
-		default: throw mtpErrorUnexpected(cons, "MTPcontactLink");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPcontactLink::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -25237,40 +26726,45 @@ inline mtpTypeId MTPwebPage::type() const {
 	return _type;
 }
 inline void MTPwebPage::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPwebPage");
+}
+inline mtpReadResult MTPwebPage::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_webPageEmpty: _type = cons; {
 			if (!data) setData(new MTPDwebPageEmpty());
 			MTPDwebPageEmpty &v(_webPageEmpty());
-			v.vid.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
 		} break;
 		case mtpc_webPagePending: _type = cons; {
 			if (!data) setData(new MTPDwebPagePending());
 			MTPDwebPagePending &v(_webPagePending());
-			v.vid.read(from, end);
-			v.vdate.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdate.tryRead(from, end)) return result;
 		} break;
 		case mtpc_webPage: _type = cons; {
 			if (!data) setData(new MTPDwebPage());
 			MTPDwebPage &v(_webPage());
-			v.vflags.read(from, end);
-			v.vid.read(from, end);
-			v.vurl.read(from, end);
-			v.vdisplay_url.read(from, end);
-			if (v.has_type()) { v.vtype.read(from, end); } else { v.vtype = MTPstring(); }
-			if (v.has_site_name()) { v.vsite_name.read(from, end); } else { v.vsite_name = MTPstring(); }
-			if (v.has_title()) { v.vtitle.read(from, end); } else { v.vtitle = MTPstring(); }
-			if (v.has_description()) { v.vdescription.read(from, end); } else { v.vdescription = MTPstring(); }
-			if (v.has_photo()) { v.vphoto.read(from, end); } else { v.vphoto = MTPPhoto(); }
-			if (v.has_embed_url()) { v.vembed_url.read(from, end); } else { v.vembed_url = MTPstring(); }
-			if (v.has_embed_type()) { v.vembed_type.read(from, end); } else { v.vembed_type = MTPstring(); }
-			if (v.has_embed_width()) { v.vembed_width.read(from, end); } else { v.vembed_width = MTPint(); }
-			if (v.has_embed_height()) { v.vembed_height.read(from, end); } else { v.vembed_height = MTPint(); }
-			if (v.has_duration()) { v.vduration.read(from, end); } else { v.vduration = MTPint(); }
-			if (v.has_author()) { v.vauthor.read(from, end); } else { v.vauthor = MTPstring(); }
-		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPwebPage");
-	}
+			if (mtpReadResult result = v.vflags.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vurl.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdisplay_url.tryRead(from, end)) return result;
+			if (v.has_type()) { if (mtpReadResult result = v.vtype.tryRead(from, end)) return result; } else { v.vtype = MTPstring(); }
+			if (v.has_site_name()) { if (mtpReadResult result = v.vsite_name.tryRead(from, end)) return result; } else { v.vsite_name = MTPstring(); }
+			if (v.has_title()) { if (mtpReadResult result = v.vtitle.tryRead(from, end)) return result; } else { v.vtitle = MTPstring(); }
+			if (v.has_description()) { if (mtpReadResult result = v.vdescription.tryRead(from, end)) return result; } else { v.vdescription = MTPstring(); }
+			if (v.has_photo()) { if (mtpReadResult result = v.vphoto.tryRead(from, end)) return result; } else { v.vphoto = MTPPhoto(); }
+			if (v.has_embed_url()) { if (mtpReadResult result = v.vembed_url.tryRead(from, end)) return result; } else { v.vembed_url = MTPstring(); }
+			if (v.has_embed_type()) { if (mtpReadResult result = v.vembed_type.tryRead(from, end)) return result; } else { v.vembed_type = MTPstring(); }
+			if (v.has_embed_width()) { if (mtpReadResult result = v.vembed_width.tryRead(from, end)) return result; } else { v.vembed_width = MTPint(); }
+			if (v.has_embed_height()) { if (mtpReadResult result = v.vembed_height.tryRead(from, end)) return result; } else { v.vembed_height = MTPint(); }
+			if (v.has_duration()) { if (mtpReadResult result = v.vduration.tryRead(from, end)) return result; } else { v.vduration = MTPint(); }
+			if (v.has_author()) { if (mtpReadResult result = v.vauthor.tryRead(from, end)) return result; } else { v.vauthor = MTPstring(); }
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
 }
 inline void MTPwebPage::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -25338,23 +26832,28 @@ inline mtpTypeId MTPauthorization::type() const {
 	return mtpc_authorization;
 }
 inline void MTPauthorization::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_authorization) throw mtpErrorUnexpected(cons, "MTPauthorization");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauthorization");
+}
+inline mtpReadResult MTPauthorization::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_authorization) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDauthorization());
 	MTPDauthorization &v(_authorization());
-	v.vhash.read(from, end);
-	v.vflags.read(from, end);
-	v.vdevice_model.read(from, end);
-	v.vplatform.read(from, end);
-	v.vsystem_version.read(from, end);
-	v.vapi_id.read(from, end);
-	v.vapp_name.read(from, end);
-	v.vapp_version.read(from, end);
-	v.vdate_created.read(from, end);
-	v.vdate_active.read(from, end);
-	v.vip.read(from, end);
-	v.vcountry.read(from, end);
-	v.vregion.read(from, end);
+	if (mtpReadResult result = v.vhash.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vflags.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vdevice_model.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vplatform.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vsystem_version.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vapi_id.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vapp_name.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vapp_version.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vdate_created.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vdate_active.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vip.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vcountry.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vregion.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPauthorization::write(mtpBuffer &to) const {
 	const MTPDauthorization &v(c_authorization());
@@ -25389,11 +26888,16 @@ inline mtpTypeId MTPaccount_authorizations::type() const {
 	return mtpc_account_authorizations;
 }
 inline void MTPaccount_authorizations::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_account_authorizations) throw mtpErrorUnexpected(cons, "MTPaccount_authorizations");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_authorizations");
+}
+inline mtpReadResult MTPaccount_authorizations::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_account_authorizations) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDaccount_authorizations());
 	MTPDaccount_authorizations &v(_account_authorizations());
-	v.vauthorizations.read(from, end);
+	if (mtpReadResult result = v.vauthorizations.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPaccount_authorizations::write(mtpBuffer &to) const {
 	const MTPDaccount_authorizations &v(c_account_authorizations());
@@ -25423,25 +26927,30 @@ inline mtpTypeId MTPaccount_password::type() const {
 	return _type;
 }
 inline void MTPaccount_password::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_password");
+}
+inline mtpReadResult MTPaccount_password::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_account_noPassword: _type = cons; {
 			if (!data) setData(new MTPDaccount_noPassword());
 			MTPDaccount_noPassword &v(_account_noPassword());
-			v.vnew_salt.read(from, end);
-			v.vemail_unconfirmed_pattern.read(from, end);
+			if (mtpReadResult result = v.vnew_salt.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vemail_unconfirmed_pattern.tryRead(from, end)) return result;
 		} break;
 		case mtpc_account_password: _type = cons; {
 			if (!data) setData(new MTPDaccount_password());
 			MTPDaccount_password &v(_account_password());
-			v.vcurrent_salt.read(from, end);
-			v.vnew_salt.read(from, end);
-			v.vhint.read(from, end);
-			v.vhas_recovery.read(from, end);
-			v.vemail_unconfirmed_pattern.read(from, end);
+			if (mtpReadResult result = v.vcurrent_salt.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vnew_salt.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vhint.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vhas_recovery.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vemail_unconfirmed_pattern.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPaccount_password");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPaccount_password::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -25489,11 +26998,16 @@ inline mtpTypeId MTPaccount_passwordSettings::type() const {
 	return mtpc_account_passwordSettings;
 }
 inline void MTPaccount_passwordSettings::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_account_passwordSettings) throw mtpErrorUnexpected(cons, "MTPaccount_passwordSettings");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_passwordSettings");
+}
+inline mtpReadResult MTPaccount_passwordSettings::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_account_passwordSettings) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDaccount_passwordSettings());
 	MTPDaccount_passwordSettings &v(_account_passwordSettings());
-	v.vemail.read(from, end);
+	if (mtpReadResult result = v.vemail.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPaccount_passwordSettings::write(mtpBuffer &to) const {
 	const MTPDaccount_passwordSettings &v(c_account_passwordSettings());
@@ -25516,15 +27030,20 @@ inline mtpTypeId MTPaccount_passwordInputSettings::type() const {
 	return mtpc_account_passwordInputSettings;
 }
 inline void MTPaccount_passwordInputSettings::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_account_passwordInputSettings) throw mtpErrorUnexpected(cons, "MTPaccount_passwordInputSettings");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_passwordInputSettings");
+}
+inline mtpReadResult MTPaccount_passwordInputSettings::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_account_passwordInputSettings) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDaccount_passwordInputSettings());
 	MTPDaccount_passwordInputSettings &v(_account_passwordInputSettings());
-	v.vflags.read(from, end);
-	if (v.has_new_salt()) { v.vnew_salt.read(from, end); } else { v.vnew_salt = MTPbytes(); }
-	if (v.has_new_password_hash()) { v.vnew_password_hash.read(from, end); } else { v.vnew_password_hash = MTPbytes(); }
-	if (v.has_hint()) { v.vhint.read(from, end); } else { v.vhint = MTPstring(); }
-	if (v.has_email()) { v.vemail.read(from, end); } else { v.vemail = MTPstring(); }
+	if (mtpReadResult result = v.vflags.tryRead(from, end)) return result;
+	if (v.has_new_salt()) { if (mtpReadResult result = v.vnew_salt.tryRead(from, end)) return result; } else { v.vnew_salt = MTPbytes(); }
+	if (v.has_new_password_hash()) { if (mtpReadResult result = v.vnew_password_hash.tryRead(from, end)) return result; } else { v.vnew_password_hash = MTPbytes(); }
+	if (v.has_hint()) { if (mtpReadResult result = v.vhint.tryRead(from, end)) return result; } else { v.vhint = MTPstring(); }
+	if (v.has_email()) { if (mtpReadResult result = v.vemail.tryRead(from, end)) return result; } else { v.vemail = MTPstring(); }
+	return mtpReadDone;
 }
 inline void MTPaccount_passwordInputSettings::write(mtpBuffer &to) const {
 	const MTPDaccount_passwordInputSettings &v(c_account_passwordInputSettings());
@@ -25551,11 +27070,16 @@ inline mtpTypeId MTPauth_passwordRecovery::type() const {
 	return mtpc_auth_passwordRecovery;
 }
 inline void MTPauth_passwordRecovery::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_auth_passwordRecovery) throw mtpErrorUnexpected(cons, "MTPauth_passwordRecovery");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_passwordRecovery");
+}
+inline mtpReadResult MTPauth_passwordRecovery::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_auth_passwordRecovery) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDauth_passwordRecovery());
 	MTPDauth_passwordRecovery &v(_auth_passwordRecovery());
-	v.vemail_pattern.read(from, end);
+	if (mtpReadResult result = v.vemail_pattern.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPauth_passwordRecovery::write(mtpBuffer &to) const {
 	const MTPDauth_passwordRecovery &v(c_auth_passwordRecovery());
@@ -25578,12 +27102,17 @@ inline mtpTypeId MTPreceivedNotifyMessage::type() const {
 	return mtpc_receivedNotifyMessage;
 }
 inline void MTPreceivedNotifyMessage::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_receivedNotifyMessage) throw mtpErrorUnexpected(cons, "MTPreceivedNotifyMessage");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPreceivedNotifyMessage");
+}
+inline mtpReadResult MTPreceivedNotifyMessage::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_receivedNotifyMessage) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDreceivedNotifyMessage());
 	MTPDreceivedNotifyMessage &v(_receivedNotifyMessage());
-	v.vid.read(from, end);
-	v.vflags.read(from, end);
+	if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vflags.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPreceivedNotifyMessage::write(mtpBuffer &to) const {
 	const MTPDreceivedNotifyMessage &v(c_receivedNotifyMessage());
@@ -25610,16 +27139,21 @@ inline mtpTypeId MTPexportedChatInvite::type() const {
 	return _type;
 }
 inline void MTPexportedChatInvite::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPexportedChatInvite");
+}
+inline mtpReadResult MTPexportedChatInvite::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_chatInviteEmpty: _type = cons; break;
 		case mtpc_chatInviteExported: _type = cons; {
 			if (!data) setData(new MTPDchatInviteExported());
 			MTPDchatInviteExported &v(_chatInviteExported());
-			v.vlink.read(from, end);
+			if (mtpReadResult result = v.vlink.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPexportedChatInvite");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPexportedChatInvite::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -25663,20 +27197,25 @@ inline mtpTypeId MTPchatInvite::type() const {
 	return _type;
 }
 inline void MTPchatInvite::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPchatInvite");
+}
+inline mtpReadResult MTPchatInvite::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_chatInviteAlready: _type = cons; {
 			if (!data) setData(new MTPDchatInviteAlready());
 			MTPDchatInviteAlready &v(_chatInviteAlready());
-			v.vchat.read(from, end);
+			if (mtpReadResult result = v.vchat.tryRead(from, end)) return result;
 		} break;
 		case mtpc_chatInvite: _type = cons; {
 			if (!data) setData(new MTPDchatInvite());
 			MTPDchatInvite &v(_chatInvite());
-			v.vtitle.read(from, end);
+			if (mtpReadResult result = v.vtitle.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPchatInvite");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPchatInvite::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -25726,22 +27265,27 @@ inline mtpTypeId MTPinputStickerSet::type() const {
 	return _type;
 }
 inline void MTPinputStickerSet::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputStickerSet");
+}
+inline mtpReadResult MTPinputStickerSet::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_inputStickerSetEmpty: _type = cons; break;
 		case mtpc_inputStickerSetID: _type = cons; {
 			if (!data) setData(new MTPDinputStickerSetID());
 			MTPDinputStickerSetID &v(_inputStickerSetID());
-			v.vid.read(from, end);
-			v.vaccess_hash.read(from, end);
+			if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
 		} break;
 		case mtpc_inputStickerSetShortName: _type = cons; {
 			if (!data) setData(new MTPDinputStickerSetShortName());
 			MTPDinputStickerSetShortName &v(_inputStickerSetShortName());
-			v.vshort_name.read(from, end);
+			if (mtpReadResult result = v.vshort_name.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPinputStickerSet");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPinputStickerSet::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -25789,17 +27333,22 @@ inline mtpTypeId MTPstickerSet::type() const {
 	return mtpc_stickerSet;
 }
 inline void MTPstickerSet::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_stickerSet) throw mtpErrorUnexpected(cons, "MTPstickerSet");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPstickerSet");
+}
+inline mtpReadResult MTPstickerSet::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_stickerSet) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDstickerSet());
 	MTPDstickerSet &v(_stickerSet());
-	v.vflags.read(from, end);
-	v.vid.read(from, end);
-	v.vaccess_hash.read(from, end);
-	v.vtitle.read(from, end);
-	v.vshort_name.read(from, end);
-	v.vcount.read(from, end);
-	v.vhash.read(from, end);
+	if (mtpReadResult result = v.vflags.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vid.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vaccess_hash.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vtitle.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vshort_name.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vcount.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vhash.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPstickerSet::write(mtpBuffer &to) const {
 	const MTPDstickerSet &v(c_stickerSet());
@@ -25828,13 +27377,18 @@ inline mtpTypeId MTPmessages_stickerSet::type() const {
 	return mtpc_messages_stickerSet;
 }
 inline void MTPmessages_stickerSet::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_messages_stickerSet) throw mtpErrorUnexpected(cons, "MTPmessages_stickerSet");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_stickerSet");
+}
+inline mtpReadResult MTPmessages_stickerSet::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_messages_stickerSet) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDmessages_stickerSet());
 	MTPDmessages_stickerSet &v(_messages_stickerSet());
-	v.vset.read(from, end);
-	v.vpacks.read(from, end);
-	v.vdocuments.read(from, end);
+	if (mtpReadResult result = v.vset.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vpacks.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vdocuments.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPmessages_stickerSet::write(mtpBuffer &to) const {
 	const MTPDmessages_stickerSet &v(c_messages_stickerSet());
@@ -25859,12 +27413,17 @@ inline mtpTypeId MTPbotCommand::type() const {
 	return mtpc_botCommand;
 }
 inline void MTPbotCommand::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_botCommand) throw mtpErrorUnexpected(cons, "MTPbotCommand");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPbotCommand");
+}
+inline mtpReadResult MTPbotCommand::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_botCommand) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDbotCommand());
 	MTPDbotCommand &v(_botCommand());
-	v.vcommand.read(from, end);
-	v.vdescription.read(from, end);
+	if (mtpReadResult result = v.vcommand.tryRead(from, end)) return result;
+	if (mtpReadResult result = v.vdescription.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPbotCommand::write(mtpBuffer &to) const {
 	const MTPDbotCommand &v(c_botCommand());
@@ -25891,20 +27450,25 @@ inline mtpTypeId MTPbotInfo::type() const {
 	return _type;
 }
 inline void MTPbotInfo::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPbotInfo");
+}
+inline mtpReadResult MTPbotInfo::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_botInfoEmpty: _type = cons; break;
 		case mtpc_botInfo: _type = cons; {
 			if (!data) setData(new MTPDbotInfo());
 			MTPDbotInfo &v(_botInfo());
-			v.vuser_id.read(from, end);
-			v.vversion.read(from, end);
-			v.vshare_text.read(from, end);
-			v.vdescription.read(from, end);
-			v.vcommands.read(from, end);
+			if (mtpReadResult result = v.vuser_id.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vversion.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vshare_text.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vdescription.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vcommands.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPbotInfo");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPbotInfo::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -25945,11 +27509,16 @@ inline mtpTypeId MTPkeyboardButton::type() const {
 	return mtpc_keyboardButton;
 }
 inline void MTPkeyboardButton::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_keyboardButton) throw mtpErrorUnexpected(cons, "MTPkeyboardButton");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPkeyboardButton");
+}
+inline mtpReadResult MTPkeyboardButton::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_keyboardButton) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDkeyboardButton());
 	MTPDkeyboardButton &v(_keyboardButton());
-	v.vtext.read(from, end);
+	if (mtpReadResult result = v.vtext.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPkeyboardButton::write(mtpBuffer &to) const {
 	const MTPDkeyboardButton &v(c_keyboardButton());
@@ -25972,11 +27541,16 @@ inline mtpTypeId MTPkeyboardButtonRow::type() const {
 	return mtpc_keyboardButtonRow;
 }
 inline void MTPkeyboardButtonRow::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
-	if (cons != mtpc_keyboardButtonRow) throw mtpErrorUnexpected(cons, "MTPkeyboardButtonRow");
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPkeyboardButtonRow");
+}
+inline mtpReadResult MTPkeyboardButtonRow::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	if (cons != mtpc_keyboardButtonRow) return mtpReadUnexpected;
 
 	if (!data) setData(new MTPDkeyboardButtonRow());
 	MTPDkeyboardButtonRow &v(_keyboardButtonRow());
-	v.vbuttons.read(from, end);
+	if (mtpReadResult result = v.vbuttons.tryRead(from, end)) return result;
+	return mtpReadDone;
 }
 inline void MTPkeyboardButtonRow::write(mtpBuffer &to) const {
 	const MTPDkeyboardButtonRow &v(c_keyboardButtonRow());
@@ -26010,26 +27584,31 @@ inline mtpTypeId MTPreplyMarkup::type() const {
 	return _type;
 }
 inline void MTPreplyMarkup::read(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
+	mtpReadResult result = tryRead(from, end, cons);
+	if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPreplyMarkup");
+}
+inline mtpReadResult MTPreplyMarkup::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpTypeId cons) {
 	if (cons != _type) setData(0);
 	switch (cons) {
 		case mtpc_replyKeyboardHide: _type = cons; {
 			if (!data) setData(new MTPDreplyKeyboardHide());
 			MTPDreplyKeyboardHide &v(_replyKeyboardHide());
-			v.vflags.read(from, end);
+			if (mtpReadResult result = v.vflags.tryRead(from, end)) return result;
 		} break;
 		case mtpc_replyKeyboardForceReply: _type = cons; {
 			if (!data) setData(new MTPDreplyKeyboardForceReply());
 			MTPDreplyKeyboardForceReply &v(_replyKeyboardForceReply());
-			v.vflags.read(from, end);
+			if (mtpReadResult result = v.vflags.tryRead(from, end)) return result;
 		} break;
 		case mtpc_replyKeyboardMarkup: _type = cons; {
 			if (!data) setData(new MTPDreplyKeyboardMarkup());
 			MTPDreplyKeyboardMarkup &v(_replyKeyboardMarkup());
-			v.vflags.read(from, end);
-			v.vrows.read(from, end);
+			if (mtpReadResult result = v.vflags.tryRead(from, end)) return result;
+			if (mtpReadResult result = v.vrows.tryRead(from, end)) return result;
 		} break;
-		default: throw mtpErrorUnexpected(cons, "MTPreplyMarkup");
+		default: return mtpReadUnexpected;
 	}
+	return mtpReadDone;
 }
 inline void MTPreplyMarkup::write(mtpBuffer &to) const {
 	switch (_type) {
@@ -26072,6 +27651,9443 @@ inline MTPreplyMarkup MTP_replyKeyboardMarkup(MTPint _flags, const MTPVector<MTP
 	return MTPreplyMarkup(new MTPDreplyKeyboardMarkup(_flags, _rows));
 }
 
+// Read-only view forward declarations
+class MTPresPQView;
+class MTPDresPQView;
+class MTPp_Q_inner_dataView;
+class MTPDp_q_inner_dataView;
+class MTPserver_DH_ParamsView;
+class MTPDserver_DH_params_failView;
+class MTPDserver_DH_params_okView;
+class MTPserver_DH_inner_dataView;
+class MTPDserver_DH_inner_dataView;
+class MTPclient_DH_Inner_DataView;
+class MTPDclient_DH_inner_dataView;
+class MTPset_client_DH_params_answerView;
+class MTPDdh_gen_okView;
+class MTPDdh_gen_retryView;
+class MTPDdh_gen_failView;
+class MTPmsgsAckView;
+class MTPDmsgs_ackView;
+class MTPbadMsgNotificationView;
+class MTPDbad_msg_notificationView;
+class MTPDbad_server_saltView;
+class MTPmsgsStateReqView;
+class MTPDmsgs_state_reqView;
+class MTPmsgsStateInfoView;
+class MTPDmsgs_state_infoView;
+class MTPmsgsAllInfoView;
+class MTPDmsgs_all_infoView;
+class MTPmsgDetailedInfoView;
+class MTPDmsg_detailed_infoView;
+class MTPDmsg_new_detailed_infoView;
+class MTPmsgResendReqView;
+class MTPDmsg_resend_reqView;
+class MTPrpcErrorView;
+class MTPDrpc_errorView;
+class MTPrpcDropAnswerView;
+class MTPDrpc_answer_droppedView;
+class MTPfutureSaltView;
+class MTPDfuture_saltView;
+class MTPfutureSaltsView;
+class MTPDfuture_saltsView;
+class MTPpongView;
+class MTPDpongView;
+class MTPdestroySessionResView;
+class MTPDdestroy_session_okView;
+class MTPDdestroy_session_noneView;
+class MTPnewSessionView;
+class MTPDnew_session_createdView;
+class MTPhttpWaitView;
+class MTPDhttp_waitView;
+class MTPerrorView;
+class MTPDerrorView;
+class MTPnullView;
+class MTPinputPeerView;
+class MTPDinputPeerContactView;
+class MTPDinputPeerForeignView;
+class MTPDinputPeerChatView;
+class MTPinputUserView;
+class MTPDinputUserContactView;
+class MTPDinputUserForeignView;
+class MTPinputContactView;
+class MTPDinputPhoneContactView;
+class MTPinputFileView;
+class MTPDinputFileView;
+class MTPDinputFileBigView;
+class MTPinputMediaView;
+class MTPDinputMediaUploadedPhotoView;
+class MTPDinputMediaPhotoView;
+class MTPDinputMediaGeoPointView;
+class MTPDinputMediaContactView;
+class MTPDinputMediaUploadedVideoView;
+class MTPDinputMediaUploadedThumbVideoView;
+class MTPDinputMediaVideoView;
+class MTPDinputMediaUploadedAudioView;
+class MTPDinputMediaAudioView;
+class MTPDinputMediaUploadedDocumentView;
+class MTPDinputMediaUploadedThumbDocumentView;
+class MTPDinputMediaDocumentView;
+class MTPDinputMediaVenueView;
+class MTPinputChatPhotoView;
+class MTPDinputChatUploadedPhotoView;
+class MTPDinputChatPhotoView;
+class MTPinputGeoPointView;
+class MTPDinputGeoPointView;
+class MTPinputPhotoView;
+class MTPDinputPhotoView;
+class MTPinputVideoView;
+class MTPDinputVideoView;
+class MTPinputFileLocationView;
+class MTPDinputFileLocationView;
+class MTPDinputVideoFileLocationView;
+class MTPDinputEncryptedFileLocationView;
+class MTPDinputAudioFileLocationView;
+class MTPDinputDocumentFileLocationView;
+class MTPinputPhotoCropView;
+class MTPDinputPhotoCropView;
+class MTPinputAppEventView;
+class MTPDinputAppEventView;
+class MTPpeerView;
+class MTPDpeerUserView;
+class MTPDpeerChatView;
+class MTPstorage_fileTypeView;
+class MTPfileLocationView;
+class MTPDfileLocationUnavailableView;
+class MTPDfileLocationView;
+class MTPuserView;
+class MTPDuserEmptyView;
+class MTPDuserView;
+class MTPuserProfilePhotoView;
+class MTPDuserProfilePhotoView;
+class MTPuserStatusView;
+class MTPDuserStatusOnlineView;
+class MTPDuserStatusOfflineView;
+class MTPchatView;
+class MTPDchatEmptyView;
+class MTPDchatView;
+class MTPDchatForbiddenView;
+class MTPDgeoChatView;
+class MTPchatFullView;
+class MTPDchatFullView;
+class MTPchatParticipantView;
+class MTPDchatParticipantView;
+class MTPchatParticipantsView;
+class MTPDchatParticipantsForbiddenView;
+class MTPDchatParticipantsView;
+class MTPchatPhotoView;
+class MTPDchatPhotoView;
+class MTPmessageView;
+class MTPDmessageEmptyView;
+class MTPDmessageView;
+class MTPDmessageServiceView;
+class MTPmessageMediaView;
+class MTPDmessageMediaPhotoView;
+class MTPDmessageMediaVideoView;
+class MTPDmessageMediaGeoView;
+class MTPDmessageMediaContactView;
+class MTPDmessageMediaDocumentView;
+class MTPDmessageMediaAudioView;
+class MTPDmessageMediaWebPageView;
+class MTPDmessageMediaVenueView;
+class MTPmessageActionView;
+class MTPDmessageActionChatCreateView;
+class MTPDmessageActionChatEditTitleView;
+class MTPDmessageActionChatEditPhotoView;
+class MTPDmessageActionChatAddUserView;
+class MTPDmessageActionChatDeleteUserView;
+class MTPDmessageActionGeoChatCreateView;
+class MTPDmessageActionChatJoinedByLinkView;
+class MTPdialogView;
+class MTPDdialogView;
+class MTPphotoView;
+class MTPDphotoEmptyView;
+class MTPDphotoView;
+class MTPphotoSizeView;
+class MTPDphotoSizeEmptyView;
+class MTPDphotoSizeView;
+class MTPDphotoCachedSizeView;
+class MTPvideoView;
+class MTPDvideoEmptyView;
+class MTPDvideoView;
+class MTPgeoPointView;
+class MTPDgeoPointView;
+class MTPauth_checkedPhoneView;
+class MTPDauth_checkedPhoneView;
+class MTPauth_sentCodeView;
+class MTPDauth_sentCodeView;
+class MTPDauth_sentAppCodeView;
+class MTPauth_authorizationView;
+class MTPDauth_authorizationView;
+class MTPauth_exportedAuthorizationView;
+class MTPDauth_exportedAuthorizationView;
+class MTPinputNotifyPeerView;
+class MTPDinputNotifyPeerView;
+class MTPDinputNotifyGeoChatPeerView;
+class MTPinputPeerNotifyEventsView;
+class MTPinputPeerNotifySettingsView;
+class MTPDinputPeerNotifySettingsView;
+class MTPpeerNotifyEventsView;
+class MTPpeerNotifySettingsView;
+class MTPDpeerNotifySettingsView;
+class MTPwallPaperView;
+class MTPDwallPaperView;
+class MTPDwallPaperSolidView;
+class MTPuserFullView;
+class MTPDuserFullView;
+class MTPcontactView;
+class MTPDcontactView;
+class MTPimportedContactView;
+class MTPDimportedContactView;
+class MTPcontactBlockedView;
+class MTPDcontactBlockedView;
+class MTPcontactSuggestedView;
+class MTPDcontactSuggestedView;
+class MTPcontactStatusView;
+class MTPDcontactStatusView;
+class MTPchatLocatedView;
+class MTPDchatLocatedView;
+class MTPcontacts_linkView;
+class MTPDcontacts_linkView;
+class MTPcontacts_contactsView;
+class MTPDcontacts_contactsView;
+class MTPcontacts_importedContactsView;
+class MTPDcontacts_importedContactsView;
+class MTPcontacts_blockedView;
+class MTPDcontacts_blockedView;
+class MTPDcontacts_blockedSliceView;
+class MTPcontacts_suggestedView;
+class MTPDcontacts_suggestedView;
+class MTPmessages_dialogsView;
+class MTPDmessages_dialogsView;
+class MTPDmessages_dialogsSliceView;
+class MTPmessages_messagesView;
+class MTPDmessages_messagesView;
+class MTPDmessages_messagesSliceView;
+class MTPmessages_messageView;
+class MTPmessages_sentMessageView;
+class MTPDmessages_sentMessageView;
+class MTPDmessages_sentMessageLinkView;
+class MTPmessages_chatsView;
+class MTPDmessages_chatsView;
+class MTPmessages_chatFullView;
+class MTPDmessages_chatFullView;
+class MTPmessages_affectedHistoryView;
+class MTPDmessages_affectedHistoryView;
+class MTPmessagesFilterView;
+class MTPupdateView;
+class MTPDupdateNewMessageView;
+class MTPDupdateMessageIDView;
+class MTPDupdateDeleteMessagesView;
+class MTPDupdateUserTypingView;
+class MTPDupdateChatUserTypingView;
+class MTPDupdateChatParticipantsView;
+class MTPDupdateUserStatusView;
+class MTPDupdateUserNameView;
+class MTPDupdateUserPhotoView;
+class MTPDupdateContactRegisteredView;
+class MTPDupdateContactLinkView;
+class MTPDupdateNewAuthorizationView;
+class MTPDupdateNewGeoChatMessageView;
+class MTPDupdateNewEncryptedMessageView;
+class MTPDupdateEncryptedChatTypingView;
+class MTPDupdateEncryptionView;
+class MTPDupdateEncryptedMessagesReadView;
+class MTPDupdateChatParticipantAddView;
+class MTPDupdateChatParticipantDeleteView;
+class MTPDupdateDcOptionsView;
+class MTPDupdateUserBlockedView;
+class MTPDupdateNotifySettingsView;
+class MTPDupdateServiceNotificationView;
+class MTPDupdatePrivacyView;
+class MTPDupdateUserPhoneView;
+class MTPDupdateReadHistoryInboxView;
+class MTPDupdateReadHistoryOutboxView;
+class MTPDupdateWebPageView;
+class MTPDupdateReadMessagesContentsView;
+class MTPupdates_stateView;
+class MTPDupdates_stateView;
+class MTPupdates_differenceView;
+class MTPDupdates_differenceEmptyView;
+class MTPDupdates_differenceView;
+class MTPDupdates_differenceSliceView;
+class MTPupdatesView;
+class MTPDupdateShortMessageView;
+class MTPDupdateShortChatMessageView;
+class MTPDupdateShortView;
+class MTPDupdatesCombinedView;
+class MTPDupdatesView;
+class MTPphotos_photosView;
+class MTPDphotos_photosView;
+class MTPDphotos_photosSliceView;
+class MTPphotos_photoView;
+class MTPDphotos_photoView;
+class MTPupload_fileView;
+class MTPDupload_fileView;
+class MTPdcOptionView;
+class MTPDdcOptionView;
+class MTPconfigView;
+class MTPDconfigView;
+class MTPnearestDcView;
+class MTPDnearestDcView;
+class MTPhelp_appUpdateView;
+class MTPDhelp_appUpdateView;
+class MTPhelp_inviteTextView;
+class MTPDhelp_inviteTextView;
+class MTPinputGeoChatView;
+class MTPDinputGeoChatView;
+class MTPgeoChatMessageView;
+class MTPDgeoChatMessageEmptyView;
+class MTPDgeoChatMessageView;
+class MTPDgeoChatMessageServiceView;
+class MTPgeochats_statedMessageView;
+class MTPDgeochats_statedMessageView;
+class MTPgeochats_locatedView;
+class MTPDgeochats_locatedView;
+class MTPgeochats_messagesView;
+class MTPDgeochats_messagesView;
+class MTPDgeochats_messagesSliceView;
+class MTPencryptedChatView;
+class MTPDencryptedChatEmptyView;
+class MTPDencryptedChatWaitingView;
+class MTPDencryptedChatRequestedView;
+class MTPDencryptedChatView;
+class MTPDencryptedChatDiscardedView;
+class MTPinputEncryptedChatView;
+class MTPDinputEncryptedChatView;
+class MTPencryptedFileView;
+class MTPDencryptedFileView;
+class MTPinputEncryptedFileView;
+class MTPDinputEncryptedFileUploadedView;
+class MTPDinputEncryptedFileView;
+class MTPDinputEncryptedFileBigUploadedView;
+class MTPencryptedMessageView;
+class MTPDencryptedMessageView;
+class MTPDencryptedMessageServiceView;
+class MTPmessages_dhConfigView;
+class MTPDmessages_dhConfigNotModifiedView;
+class MTPDmessages_dhConfigView;
+class MTPmessages_sentEncryptedMessageView;
+class MTPDmessages_sentEncryptedMessageView;
+class MTPDmessages_sentEncryptedFileView;
+class MTPinputAudioView;
+class MTPDinputAudioView;
+class MTPinputDocumentView;
+class MTPDinputDocumentView;
+class MTPaudioView;
+class MTPDaudioEmptyView;
+class MTPDaudioView;
+class MTPdocumentView;
+class MTPDdocumentEmptyView;
+class MTPDdocumentView;
+class MTPhelp_supportView;
+class MTPDhelp_supportView;
+class MTPnotifyPeerView;
+class MTPDnotifyPeerView;
+class MTPsendMessageActionView;
+class MTPDsendMessageUploadVideoActionView;
+class MTPDsendMessageUploadAudioActionView;
+class MTPDsendMessageUploadPhotoActionView;
+class MTPDsendMessageUploadDocumentActionView;
+class MTPcontactFoundView;
+class MTPDcontactFoundView;
+class MTPcontacts_foundView;
+class MTPDcontacts_foundView;
+class MTPinputPrivacyKeyView;
+class MTPprivacyKeyView;
+class MTPinputPrivacyRuleView;
+class MTPDinputPrivacyValueAllowUsersView;
+class MTPDinputPrivacyValueDisallowUsersView;
+class MTPprivacyRuleView;
+class MTPDprivacyValueAllowUsersView;
+class MTPDprivacyValueDisallowUsersView;
+class MTPaccount_privacyRulesView;
+class MTPDaccount_privacyRulesView;
+class MTPaccountDaysTTLView;
+class MTPDaccountDaysTTLView;
+class MTPaccount_sentChangePhoneCodeView;
+class MTPDaccount_sentChangePhoneCodeView;
+class MTPdocumentAttributeView;
+class MTPDdocumentAttributeImageSizeView;
+class MTPDdocumentAttributeStickerView;
+class MTPDdocumentAttributeVideoView;
+class MTPDdocumentAttributeAudioView;
+class MTPDdocumentAttributeFilenameView;
+class MTPmessages_stickersView;
+class MTPDmessages_stickersView;
+class MTPstickerPackView;
+class MTPDstickerPackView;
+class MTPmessages_allStickersView;
+class MTPDmessages_allStickersView;
+class MTPdisabledFeatureView;
+class MTPDdisabledFeatureView;
+class MTPmessages_affectedMessagesView;
+class MTPDmessages_affectedMessagesView;
+class MTPcontactLinkView;
+class MTPwebPageView;
+class MTPDwebPageEmptyView;
+class MTPDwebPagePendingView;
+class MTPDwebPageView;
+class MTPauthorizationView;
+class MTPDauthorizationView;
+class MTPaccount_authorizationsView;
+class MTPDaccount_authorizationsView;
+class MTPaccount_passwordView;
+class MTPDaccount_noPasswordView;
+class MTPDaccount_passwordView;
+class MTPaccount_passwordSettingsView;
+class MTPDaccount_passwordSettingsView;
+class MTPaccount_passwordInputSettingsView;
+class MTPDaccount_passwordInputSettingsView;
+class MTPauth_passwordRecoveryView;
+class MTPDauth_passwordRecoveryView;
+class MTPreceivedNotifyMessageView;
+class MTPDreceivedNotifyMessageView;
+class MTPexportedChatInviteView;
+class MTPDchatInviteExportedView;
+class MTPchatInviteView;
+class MTPDchatInviteAlreadyView;
+class MTPDchatInviteView;
+class MTPinputStickerSetView;
+class MTPDinputStickerSetIDView;
+class MTPDinputStickerSetShortNameView;
+class MTPstickerSetView;
+class MTPDstickerSetView;
+class MTPmessages_stickerSetView;
+class MTPDmessages_stickerSetView;
+class MTPbotCommandView;
+class MTPDbotCommandView;
+class MTPbotInfoView;
+class MTPDbotInfoView;
+class MTPkeyboardButtonView;
+class MTPDkeyboardButtonView;
+class MTPkeyboardButtonRowView;
+class MTPDkeyboardButtonRowView;
+class MTPreplyMarkupView;
+class MTPDreplyKeyboardHideView;
+class MTPDreplyKeyboardForceReplyView;
+class MTPDreplyKeyboardMarkupView;
+
+// Read-only view classes definitions
+
+class MTPresPQView {
+public:
+	MTPresPQView() : _data(0) {
+	}
+
+	const MTPDresPQView &c_resPQ() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDresPQView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_resPQ;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_resPQ) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPresPQView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_resPQ);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPresPQView> MTPResPQView;
+
+class MTPp_Q_inner_dataView {
+public:
+	MTPp_Q_inner_dataView() : _data(0) {
+	}
+
+	const MTPDp_q_inner_dataView &c_p_q_inner_data() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDp_q_inner_dataView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_p_q_inner_data;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_p_q_inner_data) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPp_Q_inner_dataView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_p_q_inner_data);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPp_Q_inner_dataView> MTPP_Q_inner_dataView;
+
+class MTPserver_DH_ParamsView {
+public:
+	MTPserver_DH_ParamsView() : _data(0), _type(0) {
+	}
+
+	const MTPDserver_DH_params_failView &c_server_DH_params_fail() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_server_DH_params_fail) throw mtpErrorWrongTypeId(_type, mtpc_server_DH_params_fail);
+		return *(const MTPDserver_DH_params_failView*)_data;
+	}
+	const MTPDserver_DH_params_okView &c_server_DH_params_ok() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_server_DH_params_ok) throw mtpErrorWrongTypeId(_type, mtpc_server_DH_params_ok);
+		return *(const MTPDserver_DH_params_okView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPserver_DH_ParamsView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPserver_DH_ParamsView> MTPServer_DH_ParamsView;
+
+class MTPserver_DH_inner_dataView {
+public:
+	MTPserver_DH_inner_dataView() : _data(0) {
+	}
+
+	const MTPDserver_DH_inner_dataView &c_server_DH_inner_data() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDserver_DH_inner_dataView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_server_DH_inner_data;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_server_DH_inner_data) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPserver_DH_inner_dataView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_server_DH_inner_data);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPserver_DH_inner_dataView> MTPServer_DH_inner_dataView;
+
+class MTPclient_DH_Inner_DataView {
+public:
+	MTPclient_DH_Inner_DataView() : _data(0) {
+	}
+
+	const MTPDclient_DH_inner_dataView &c_client_DH_inner_data() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDclient_DH_inner_dataView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_client_DH_inner_data;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_client_DH_inner_data) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPclient_DH_Inner_DataView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_client_DH_inner_data);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPclient_DH_Inner_DataView> MTPClient_DH_Inner_DataView;
+
+class MTPset_client_DH_params_answerView {
+public:
+	MTPset_client_DH_params_answerView() : _data(0), _type(0) {
+	}
+
+	const MTPDdh_gen_okView &c_dh_gen_ok() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_dh_gen_ok) throw mtpErrorWrongTypeId(_type, mtpc_dh_gen_ok);
+		return *(const MTPDdh_gen_okView*)_data;
+	}
+	const MTPDdh_gen_retryView &c_dh_gen_retry() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_dh_gen_retry) throw mtpErrorWrongTypeId(_type, mtpc_dh_gen_retry);
+		return *(const MTPDdh_gen_retryView*)_data;
+	}
+	const MTPDdh_gen_failView &c_dh_gen_fail() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_dh_gen_fail) throw mtpErrorWrongTypeId(_type, mtpc_dh_gen_fail);
+		return *(const MTPDdh_gen_failView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPset_client_DH_params_answerView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPset_client_DH_params_answerView> MTPSet_client_DH_params_answerView;
+
+class MTPmsgsAckView {
+public:
+	MTPmsgsAckView() : _data(0) {
+	}
+
+	const MTPDmsgs_ackView &c_msgs_ack() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDmsgs_ackView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_msgs_ack;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_msgs_ack) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmsgsAckView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_msgs_ack);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPmsgsAckView> MTPMsgsAckView;
+
+class MTPbadMsgNotificationView {
+public:
+	MTPbadMsgNotificationView() : _data(0), _type(0) {
+	}
+
+	const MTPDbad_msg_notificationView &c_bad_msg_notification() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_bad_msg_notification) throw mtpErrorWrongTypeId(_type, mtpc_bad_msg_notification);
+		return *(const MTPDbad_msg_notificationView*)_data;
+	}
+	const MTPDbad_server_saltView &c_bad_server_salt() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_bad_server_salt) throw mtpErrorWrongTypeId(_type, mtpc_bad_server_salt);
+		return *(const MTPDbad_server_saltView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPbadMsgNotificationView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPbadMsgNotificationView> MTPBadMsgNotificationView;
+
+class MTPmsgsStateReqView {
+public:
+	MTPmsgsStateReqView() : _data(0) {
+	}
+
+	const MTPDmsgs_state_reqView &c_msgs_state_req() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDmsgs_state_reqView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_msgs_state_req;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_msgs_state_req) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmsgsStateReqView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_msgs_state_req);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPmsgsStateReqView> MTPMsgsStateReqView;
+
+class MTPmsgsStateInfoView {
+public:
+	MTPmsgsStateInfoView() : _data(0) {
+	}
+
+	const MTPDmsgs_state_infoView &c_msgs_state_info() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDmsgs_state_infoView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_msgs_state_info;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_msgs_state_info) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmsgsStateInfoView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_msgs_state_info);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPmsgsStateInfoView> MTPMsgsStateInfoView;
+
+class MTPmsgsAllInfoView {
+public:
+	MTPmsgsAllInfoView() : _data(0) {
+	}
+
+	const MTPDmsgs_all_infoView &c_msgs_all_info() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDmsgs_all_infoView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_msgs_all_info;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_msgs_all_info) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmsgsAllInfoView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_msgs_all_info);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPmsgsAllInfoView> MTPMsgsAllInfoView;
+
+class MTPmsgDetailedInfoView {
+public:
+	MTPmsgDetailedInfoView() : _data(0), _type(0) {
+	}
+
+	const MTPDmsg_detailed_infoView &c_msg_detailed_info() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_msg_detailed_info) throw mtpErrorWrongTypeId(_type, mtpc_msg_detailed_info);
+		return *(const MTPDmsg_detailed_infoView*)_data;
+	}
+	const MTPDmsg_new_detailed_infoView &c_msg_new_detailed_info() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_msg_new_detailed_info) throw mtpErrorWrongTypeId(_type, mtpc_msg_new_detailed_info);
+		return *(const MTPDmsg_new_detailed_infoView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmsgDetailedInfoView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPmsgDetailedInfoView> MTPMsgDetailedInfoView;
+
+class MTPmsgResendReqView {
+public:
+	MTPmsgResendReqView() : _data(0) {
+	}
+
+	const MTPDmsg_resend_reqView &c_msg_resend_req() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDmsg_resend_reqView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_msg_resend_req;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_msg_resend_req) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmsgResendReqView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_msg_resend_req);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPmsgResendReqView> MTPMsgResendReqView;
+
+class MTPrpcErrorView {
+public:
+	MTPrpcErrorView() : _data(0) {
+	}
+
+	const MTPDrpc_errorView &c_rpc_error() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDrpc_errorView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_rpc_error;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_rpc_error) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPrpcErrorView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_rpc_error);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPrpcErrorView> MTPRpcErrorView;
+
+class MTPrpcDropAnswerView {
+public:
+	MTPrpcDropAnswerView() : _data(0), _type(0) {
+	}
+
+	const MTPDrpc_answer_droppedView &c_rpc_answer_dropped() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_rpc_answer_dropped) throw mtpErrorWrongTypeId(_type, mtpc_rpc_answer_dropped);
+		return *(const MTPDrpc_answer_droppedView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPrpcDropAnswerView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPrpcDropAnswerView> MTPRpcDropAnswerView;
+
+class MTPfutureSaltView {
+public:
+	MTPfutureSaltView() : _data(0) {
+	}
+
+	const MTPDfuture_saltView &c_future_salt() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDfuture_saltView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_future_salt;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_future_salt) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPfutureSaltView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_future_salt);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPfutureSaltView> MTPFutureSaltView;
+
+class MTPfutureSaltsView {
+public:
+	MTPfutureSaltsView() : _data(0) {
+	}
+
+	const MTPDfuture_saltsView &c_future_salts() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDfuture_saltsView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_future_salts;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_future_salts) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPfutureSaltsView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_future_salts);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPfutureSaltsView> MTPFutureSaltsView;
+
+class MTPpongView {
+public:
+	MTPpongView() : _data(0) {
+	}
+
+	const MTPDpongView &c_pong() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDpongView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_pong;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_pong) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPpongView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_pong);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPpongView> MTPPongView;
+
+class MTPdestroySessionResView {
+public:
+	MTPdestroySessionResView() : _data(0), _type(0) {
+	}
+
+	const MTPDdestroy_session_okView &c_destroy_session_ok() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_destroy_session_ok) throw mtpErrorWrongTypeId(_type, mtpc_destroy_session_ok);
+		return *(const MTPDdestroy_session_okView*)_data;
+	}
+	const MTPDdestroy_session_noneView &c_destroy_session_none() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_destroy_session_none) throw mtpErrorWrongTypeId(_type, mtpc_destroy_session_none);
+		return *(const MTPDdestroy_session_noneView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPdestroySessionResView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPdestroySessionResView> MTPDestroySessionResView;
+
+class MTPnewSessionView {
+public:
+	MTPnewSessionView() : _data(0) {
+	}
+
+	const MTPDnew_session_createdView &c_new_session_created() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDnew_session_createdView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_new_session_created;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_new_session_created) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPnewSessionView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_new_session_created);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPnewSessionView> MTPNewSessionView;
+
+class MTPhttpWaitView {
+public:
+	MTPhttpWaitView() : _data(0) {
+	}
+
+	const MTPDhttp_waitView &c_http_wait() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDhttp_waitView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_http_wait;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_http_wait) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPhttpWaitView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_http_wait);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPhttpWaitView> MTPHttpWaitView;
+
+class MTPerrorView {
+public:
+	MTPerrorView() : _data(0) {
+	}
+
+	const MTPDerrorView &c_error() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDerrorView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_error;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_error) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPerrorView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_error);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPerrorView> MTPErrorView;
+
+class MTPnullView {
+public:
+	MTPnullView() {
+	}
+
+	mtpTypeId type() const {
+		return mtpc_null;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_null) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPnullView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_null);
+};
+typedef MTPBoxedView<MTPnullView> MTPNullView;
+
+class MTPinputPeerView {
+public:
+	MTPinputPeerView() : _data(0), _type(0) {
+	}
+
+	const MTPDinputPeerContactView &c_inputPeerContact() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputPeerContact) throw mtpErrorWrongTypeId(_type, mtpc_inputPeerContact);
+		return *(const MTPDinputPeerContactView*)_data;
+	}
+	const MTPDinputPeerForeignView &c_inputPeerForeign() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputPeerForeign) throw mtpErrorWrongTypeId(_type, mtpc_inputPeerForeign);
+		return *(const MTPDinputPeerForeignView*)_data;
+	}
+	const MTPDinputPeerChatView &c_inputPeerChat() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputPeerChat) throw mtpErrorWrongTypeId(_type, mtpc_inputPeerChat);
+		return *(const MTPDinputPeerChatView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputPeerView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPinputPeerView> MTPInputPeerView;
+
+class MTPinputUserView {
+public:
+	MTPinputUserView() : _data(0), _type(0) {
+	}
+
+	const MTPDinputUserContactView &c_inputUserContact() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputUserContact) throw mtpErrorWrongTypeId(_type, mtpc_inputUserContact);
+		return *(const MTPDinputUserContactView*)_data;
+	}
+	const MTPDinputUserForeignView &c_inputUserForeign() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputUserForeign) throw mtpErrorWrongTypeId(_type, mtpc_inputUserForeign);
+		return *(const MTPDinputUserForeignView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputUserView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPinputUserView> MTPInputUserView;
+
+class MTPinputContactView {
+public:
+	MTPinputContactView() : _data(0) {
+	}
+
+	const MTPDinputPhoneContactView &c_inputPhoneContact() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDinputPhoneContactView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_inputPhoneContact;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_inputPhoneContact) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputContactView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_inputPhoneContact);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPinputContactView> MTPInputContactView;
+
+class MTPinputFileView {
+public:
+	MTPinputFileView() : _data(0), _type(0) {
+	}
+
+	const MTPDinputFileView &c_inputFile() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputFile) throw mtpErrorWrongTypeId(_type, mtpc_inputFile);
+		return *(const MTPDinputFileView*)_data;
+	}
+	const MTPDinputFileBigView &c_inputFileBig() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputFileBig) throw mtpErrorWrongTypeId(_type, mtpc_inputFileBig);
+		return *(const MTPDinputFileBigView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputFileView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPinputFileView> MTPInputFileView;
+
+class MTPinputMediaView {
+public:
+	MTPinputMediaView() : _data(0), _type(0) {
+	}
+
+	const MTPDinputMediaUploadedPhotoView &c_inputMediaUploadedPhoto() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputMediaUploadedPhoto) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaUploadedPhoto);
+		return *(const MTPDinputMediaUploadedPhotoView*)_data;
+	}
+	const MTPDinputMediaPhotoView &c_inputMediaPhoto() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputMediaPhoto) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaPhoto);
+		return *(const MTPDinputMediaPhotoView*)_data;
+	}
+	const MTPDinputMediaGeoPointView &c_inputMediaGeoPoint() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputMediaGeoPoint) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaGeoPoint);
+		return *(const MTPDinputMediaGeoPointView*)_data;
+	}
+	const MTPDinputMediaContactView &c_inputMediaContact() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputMediaContact) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaContact);
+		return *(const MTPDinputMediaContactView*)_data;
+	}
+	const MTPDinputMediaUploadedVideoView &c_inputMediaUploadedVideo() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputMediaUploadedVideo) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaUploadedVideo);
+		return *(const MTPDinputMediaUploadedVideoView*)_data;
+	}
+	const MTPDinputMediaUploadedThumbVideoView &c_inputMediaUploadedThumbVideo() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputMediaUploadedThumbVideo) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaUploadedThumbVideo);
+		return *(const MTPDinputMediaUploadedThumbVideoView*)_data;
+	}
+	const MTPDinputMediaVideoView &c_inputMediaVideo() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputMediaVideo) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaVideo);
+		return *(const MTPDinputMediaVideoView*)_data;
+	}
+	const MTPDinputMediaUploadedAudioView &c_inputMediaUploadedAudio() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputMediaUploadedAudio) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaUploadedAudio);
+		return *(const MTPDinputMediaUploadedAudioView*)_data;
+	}
+	const MTPDinputMediaAudioView &c_inputMediaAudio() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputMediaAudio) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaAudio);
+		return *(const MTPDinputMediaAudioView*)_data;
+	}
+	const MTPDinputMediaUploadedDocumentView &c_inputMediaUploadedDocument() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputMediaUploadedDocument) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaUploadedDocument);
+		return *(const MTPDinputMediaUploadedDocumentView*)_data;
+	}
+	const MTPDinputMediaUploadedThumbDocumentView &c_inputMediaUploadedThumbDocument() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputMediaUploadedThumbDocument) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaUploadedThumbDocument);
+		return *(const MTPDinputMediaUploadedThumbDocumentView*)_data;
+	}
+	const MTPDinputMediaDocumentView &c_inputMediaDocument() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputMediaDocument) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaDocument);
+		return *(const MTPDinputMediaDocumentView*)_data;
+	}
+	const MTPDinputMediaVenueView &c_inputMediaVenue() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputMediaVenue) throw mtpErrorWrongTypeId(_type, mtpc_inputMediaVenue);
+		return *(const MTPDinputMediaVenueView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputMediaView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPinputMediaView> MTPInputMediaView;
+
+class MTPinputChatPhotoView {
+public:
+	MTPinputChatPhotoView() : _data(0), _type(0) {
+	}
+
+	const MTPDinputChatUploadedPhotoView &c_inputChatUploadedPhoto() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputChatUploadedPhoto) throw mtpErrorWrongTypeId(_type, mtpc_inputChatUploadedPhoto);
+		return *(const MTPDinputChatUploadedPhotoView*)_data;
+	}
+	const MTPDinputChatPhotoView &c_inputChatPhoto() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputChatPhoto) throw mtpErrorWrongTypeId(_type, mtpc_inputChatPhoto);
+		return *(const MTPDinputChatPhotoView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputChatPhotoView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPinputChatPhotoView> MTPInputChatPhotoView;
+
+class MTPinputGeoPointView {
+public:
+	MTPinputGeoPointView() : _data(0), _type(0) {
+	}
+
+	const MTPDinputGeoPointView &c_inputGeoPoint() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputGeoPoint) throw mtpErrorWrongTypeId(_type, mtpc_inputGeoPoint);
+		return *(const MTPDinputGeoPointView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputGeoPointView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPinputGeoPointView> MTPInputGeoPointView;
+
+class MTPinputPhotoView {
+public:
+	MTPinputPhotoView() : _data(0), _type(0) {
+	}
+
+	const MTPDinputPhotoView &c_inputPhoto() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputPhoto) throw mtpErrorWrongTypeId(_type, mtpc_inputPhoto);
+		return *(const MTPDinputPhotoView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputPhotoView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPinputPhotoView> MTPInputPhotoView;
+
+class MTPinputVideoView {
+public:
+	MTPinputVideoView() : _data(0), _type(0) {
+	}
+
+	const MTPDinputVideoView &c_inputVideo() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputVideo) throw mtpErrorWrongTypeId(_type, mtpc_inputVideo);
+		return *(const MTPDinputVideoView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputVideoView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPinputVideoView> MTPInputVideoView;
+
+class MTPinputFileLocationView {
+public:
+	MTPinputFileLocationView() : _data(0), _type(0) {
+	}
+
+	const MTPDinputFileLocationView &c_inputFileLocation() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputFileLocation) throw mtpErrorWrongTypeId(_type, mtpc_inputFileLocation);
+		return *(const MTPDinputFileLocationView*)_data;
+	}
+	const MTPDinputVideoFileLocationView &c_inputVideoFileLocation() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputVideoFileLocation) throw mtpErrorWrongTypeId(_type, mtpc_inputVideoFileLocation);
+		return *(const MTPDinputVideoFileLocationView*)_data;
+	}
+	const MTPDinputEncryptedFileLocationView &c_inputEncryptedFileLocation() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputEncryptedFileLocation) throw mtpErrorWrongTypeId(_type, mtpc_inputEncryptedFileLocation);
+		return *(const MTPDinputEncryptedFileLocationView*)_data;
+	}
+	const MTPDinputAudioFileLocationView &c_inputAudioFileLocation() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputAudioFileLocation) throw mtpErrorWrongTypeId(_type, mtpc_inputAudioFileLocation);
+		return *(const MTPDinputAudioFileLocationView*)_data;
+	}
+	const MTPDinputDocumentFileLocationView &c_inputDocumentFileLocation() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputDocumentFileLocation) throw mtpErrorWrongTypeId(_type, mtpc_inputDocumentFileLocation);
+		return *(const MTPDinputDocumentFileLocationView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputFileLocationView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPinputFileLocationView> MTPInputFileLocationView;
+
+class MTPinputPhotoCropView {
+public:
+	MTPinputPhotoCropView() : _data(0), _type(0) {
+	}
+
+	const MTPDinputPhotoCropView &c_inputPhotoCrop() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputPhotoCrop) throw mtpErrorWrongTypeId(_type, mtpc_inputPhotoCrop);
+		return *(const MTPDinputPhotoCropView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputPhotoCropView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPinputPhotoCropView> MTPInputPhotoCropView;
+
+class MTPinputAppEventView {
+public:
+	MTPinputAppEventView() : _data(0) {
+	}
+
+	const MTPDinputAppEventView &c_inputAppEvent() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDinputAppEventView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_inputAppEvent;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_inputAppEvent) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputAppEventView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_inputAppEvent);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPinputAppEventView> MTPInputAppEventView;
+
+class MTPpeerView {
+public:
+	MTPpeerView() : _data(0), _type(0) {
+	}
+
+	const MTPDpeerUserView &c_peerUser() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_peerUser) throw mtpErrorWrongTypeId(_type, mtpc_peerUser);
+		return *(const MTPDpeerUserView*)_data;
+	}
+	const MTPDpeerChatView &c_peerChat() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_peerChat) throw mtpErrorWrongTypeId(_type, mtpc_peerChat);
+		return *(const MTPDpeerChatView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPpeerView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPpeerView> MTPPeerView;
+
+class MTPstorage_fileTypeView {
+public:
+	MTPstorage_fileTypeView() : _type(0) {
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPstorage_fileTypeView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPstorage_fileTypeView> MTPstorage_FileTypeView;
+
+class MTPfileLocationView {
+public:
+	MTPfileLocationView() : _data(0), _type(0) {
+	}
+
+	const MTPDfileLocationUnavailableView &c_fileLocationUnavailable() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_fileLocationUnavailable) throw mtpErrorWrongTypeId(_type, mtpc_fileLocationUnavailable);
+		return *(const MTPDfileLocationUnavailableView*)_data;
+	}
+	const MTPDfileLocationView &c_fileLocation() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_fileLocation) throw mtpErrorWrongTypeId(_type, mtpc_fileLocation);
+		return *(const MTPDfileLocationView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPfileLocationView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPfileLocationView> MTPFileLocationView;
+
+class MTPuserView {
+public:
+	MTPuserView() : _data(0), _type(0) {
+	}
+
+	const MTPDuserEmptyView &c_userEmpty() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_userEmpty) throw mtpErrorWrongTypeId(_type, mtpc_userEmpty);
+		return *(const MTPDuserEmptyView*)_data;
+	}
+	const MTPDuserView &c_user() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_user) throw mtpErrorWrongTypeId(_type, mtpc_user);
+		return *(const MTPDuserView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPuserView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPuserView> MTPUserView;
+
+class MTPuserProfilePhotoView {
+public:
+	MTPuserProfilePhotoView() : _data(0), _type(0) {
+	}
+
+	const MTPDuserProfilePhotoView &c_userProfilePhoto() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_userProfilePhoto) throw mtpErrorWrongTypeId(_type, mtpc_userProfilePhoto);
+		return *(const MTPDuserProfilePhotoView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPuserProfilePhotoView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPuserProfilePhotoView> MTPUserProfilePhotoView;
+
+class MTPuserStatusView {
+public:
+	MTPuserStatusView() : _data(0), _type(0) {
+	}
+
+	const MTPDuserStatusOnlineView &c_userStatusOnline() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_userStatusOnline) throw mtpErrorWrongTypeId(_type, mtpc_userStatusOnline);
+		return *(const MTPDuserStatusOnlineView*)_data;
+	}
+	const MTPDuserStatusOfflineView &c_userStatusOffline() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_userStatusOffline) throw mtpErrorWrongTypeId(_type, mtpc_userStatusOffline);
+		return *(const MTPDuserStatusOfflineView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPuserStatusView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPuserStatusView> MTPUserStatusView;
+
+class MTPchatView {
+public:
+	MTPchatView() : _data(0), _type(0) {
+	}
+
+	const MTPDchatEmptyView &c_chatEmpty() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_chatEmpty) throw mtpErrorWrongTypeId(_type, mtpc_chatEmpty);
+		return *(const MTPDchatEmptyView*)_data;
+	}
+	const MTPDchatView &c_chat() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_chat) throw mtpErrorWrongTypeId(_type, mtpc_chat);
+		return *(const MTPDchatView*)_data;
+	}
+	const MTPDchatForbiddenView &c_chatForbidden() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_chatForbidden) throw mtpErrorWrongTypeId(_type, mtpc_chatForbidden);
+		return *(const MTPDchatForbiddenView*)_data;
+	}
+	const MTPDgeoChatView &c_geoChat() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_geoChat) throw mtpErrorWrongTypeId(_type, mtpc_geoChat);
+		return *(const MTPDgeoChatView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPchatView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPchatView> MTPChatView;
+
+class MTPchatFullView {
+public:
+	MTPchatFullView() : _data(0) {
+	}
+
+	const MTPDchatFullView &c_chatFull() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDchatFullView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_chatFull;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_chatFull) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPchatFullView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_chatFull);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPchatFullView> MTPChatFullView;
+
+class MTPchatParticipantView {
+public:
+	MTPchatParticipantView() : _data(0) {
+	}
+
+	const MTPDchatParticipantView &c_chatParticipant() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDchatParticipantView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_chatParticipant;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_chatParticipant) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPchatParticipantView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_chatParticipant);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPchatParticipantView> MTPChatParticipantView;
+
+class MTPchatParticipantsView {
+public:
+	MTPchatParticipantsView() : _data(0), _type(0) {
+	}
+
+	const MTPDchatParticipantsForbiddenView &c_chatParticipantsForbidden() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_chatParticipantsForbidden) throw mtpErrorWrongTypeId(_type, mtpc_chatParticipantsForbidden);
+		return *(const MTPDchatParticipantsForbiddenView*)_data;
+	}
+	const MTPDchatParticipantsView &c_chatParticipants() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_chatParticipants) throw mtpErrorWrongTypeId(_type, mtpc_chatParticipants);
+		return *(const MTPDchatParticipantsView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPchatParticipantsView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPchatParticipantsView> MTPChatParticipantsView;
+
+class MTPchatPhotoView {
+public:
+	MTPchatPhotoView() : _data(0), _type(0) {
+	}
+
+	const MTPDchatPhotoView &c_chatPhoto() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_chatPhoto) throw mtpErrorWrongTypeId(_type, mtpc_chatPhoto);
+		return *(const MTPDchatPhotoView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPchatPhotoView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPchatPhotoView> MTPChatPhotoView;
+
+class MTPmessageView {
+public:
+	MTPmessageView() : _data(0), _type(0) {
+	}
+
+	const MTPDmessageEmptyView &c_messageEmpty() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messageEmpty) throw mtpErrorWrongTypeId(_type, mtpc_messageEmpty);
+		return *(const MTPDmessageEmptyView*)_data;
+	}
+	const MTPDmessageView &c_message() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_message) throw mtpErrorWrongTypeId(_type, mtpc_message);
+		return *(const MTPDmessageView*)_data;
+	}
+	const MTPDmessageServiceView &c_messageService() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messageService) throw mtpErrorWrongTypeId(_type, mtpc_messageService);
+		return *(const MTPDmessageServiceView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessageView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPmessageView> MTPMessageView;
+
+class MTPmessageMediaView {
+public:
+	MTPmessageMediaView() : _data(0), _type(0) {
+	}
+
+	const MTPDmessageMediaPhotoView &c_messageMediaPhoto() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messageMediaPhoto) throw mtpErrorWrongTypeId(_type, mtpc_messageMediaPhoto);
+		return *(const MTPDmessageMediaPhotoView*)_data;
+	}
+	const MTPDmessageMediaVideoView &c_messageMediaVideo() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messageMediaVideo) throw mtpErrorWrongTypeId(_type, mtpc_messageMediaVideo);
+		return *(const MTPDmessageMediaVideoView*)_data;
+	}
+	const MTPDmessageMediaGeoView &c_messageMediaGeo() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messageMediaGeo) throw mtpErrorWrongTypeId(_type, mtpc_messageMediaGeo);
+		return *(const MTPDmessageMediaGeoView*)_data;
+	}
+	const MTPDmessageMediaContactView &c_messageMediaContact() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messageMediaContact) throw mtpErrorWrongTypeId(_type, mtpc_messageMediaContact);
+		return *(const MTPDmessageMediaContactView*)_data;
+	}
+	const MTPDmessageMediaDocumentView &c_messageMediaDocument() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messageMediaDocument) throw mtpErrorWrongTypeId(_type, mtpc_messageMediaDocument);
+		return *(const MTPDmessageMediaDocumentView*)_data;
+	}
+	const MTPDmessageMediaAudioView &c_messageMediaAudio() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messageMediaAudio) throw mtpErrorWrongTypeId(_type, mtpc_messageMediaAudio);
+		return *(const MTPDmessageMediaAudioView*)_data;
+	}
+	const MTPDmessageMediaWebPageView &c_messageMediaWebPage() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messageMediaWebPage) throw mtpErrorWrongTypeId(_type, mtpc_messageMediaWebPage);
+		return *(const MTPDmessageMediaWebPageView*)_data;
+	}
+	const MTPDmessageMediaVenueView &c_messageMediaVenue() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messageMediaVenue) throw mtpErrorWrongTypeId(_type, mtpc_messageMediaVenue);
+		return *(const MTPDmessageMediaVenueView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessageMediaView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPmessageMediaView> MTPMessageMediaView;
+
+class MTPmessageActionView {
+public:
+	MTPmessageActionView() : _data(0), _type(0) {
+	}
+
+	const MTPDmessageActionChatCreateView &c_messageActionChatCreate() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messageActionChatCreate) throw mtpErrorWrongTypeId(_type, mtpc_messageActionChatCreate);
+		return *(const MTPDmessageActionChatCreateView*)_data;
+	}
+	const MTPDmessageActionChatEditTitleView &c_messageActionChatEditTitle() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messageActionChatEditTitle) throw mtpErrorWrongTypeId(_type, mtpc_messageActionChatEditTitle);
+		return *(const MTPDmessageActionChatEditTitleView*)_data;
+	}
+	const MTPDmessageActionChatEditPhotoView &c_messageActionChatEditPhoto() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messageActionChatEditPhoto) throw mtpErrorWrongTypeId(_type, mtpc_messageActionChatEditPhoto);
+		return *(const MTPDmessageActionChatEditPhotoView*)_data;
+	}
+	const MTPDmessageActionChatAddUserView &c_messageActionChatAddUser() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messageActionChatAddUser) throw mtpErrorWrongTypeId(_type, mtpc_messageActionChatAddUser);
+		return *(const MTPDmessageActionChatAddUserView*)_data;
+	}
+	const MTPDmessageActionChatDeleteUserView &c_messageActionChatDeleteUser() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messageActionChatDeleteUser) throw mtpErrorWrongTypeId(_type, mtpc_messageActionChatDeleteUser);
+		return *(const MTPDmessageActionChatDeleteUserView*)_data;
+	}
+	const MTPDmessageActionGeoChatCreateView &c_messageActionGeoChatCreate() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messageActionGeoChatCreate) throw mtpErrorWrongTypeId(_type, mtpc_messageActionGeoChatCreate);
+		return *(const MTPDmessageActionGeoChatCreateView*)_data;
+	}
+	const MTPDmessageActionChatJoinedByLinkView &c_messageActionChatJoinedByLink() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messageActionChatJoinedByLink) throw mtpErrorWrongTypeId(_type, mtpc_messageActionChatJoinedByLink);
+		return *(const MTPDmessageActionChatJoinedByLinkView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessageActionView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPmessageActionView> MTPMessageActionView;
+
+class MTPdialogView {
+public:
+	MTPdialogView() : _data(0) {
+	}
+
+	const MTPDdialogView &c_dialog() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDdialogView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_dialog;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_dialog) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPdialogView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_dialog);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPdialogView> MTPDialogView;
+
+class MTPphotoView {
+public:
+	MTPphotoView() : _data(0), _type(0) {
+	}
+
+	const MTPDphotoEmptyView &c_photoEmpty() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_photoEmpty) throw mtpErrorWrongTypeId(_type, mtpc_photoEmpty);
+		return *(const MTPDphotoEmptyView*)_data;
+	}
+	const MTPDphotoView &c_photo() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_photo) throw mtpErrorWrongTypeId(_type, mtpc_photo);
+		return *(const MTPDphotoView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPphotoView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPphotoView> MTPPhotoView;
+
+class MTPphotoSizeView {
+public:
+	MTPphotoSizeView() : _data(0), _type(0) {
+	}
+
+	const MTPDphotoSizeEmptyView &c_photoSizeEmpty() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_photoSizeEmpty) throw mtpErrorWrongTypeId(_type, mtpc_photoSizeEmpty);
+		return *(const MTPDphotoSizeEmptyView*)_data;
+	}
+	const MTPDphotoSizeView &c_photoSize() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_photoSize) throw mtpErrorWrongTypeId(_type, mtpc_photoSize);
+		return *(const MTPDphotoSizeView*)_data;
+	}
+	const MTPDphotoCachedSizeView &c_photoCachedSize() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_photoCachedSize) throw mtpErrorWrongTypeId(_type, mtpc_photoCachedSize);
+		return *(const MTPDphotoCachedSizeView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPphotoSizeView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPphotoSizeView> MTPPhotoSizeView;
+
+class MTPvideoView {
+public:
+	MTPvideoView() : _data(0), _type(0) {
+	}
+
+	const MTPDvideoEmptyView &c_videoEmpty() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_videoEmpty) throw mtpErrorWrongTypeId(_type, mtpc_videoEmpty);
+		return *(const MTPDvideoEmptyView*)_data;
+	}
+	const MTPDvideoView &c_video() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_video) throw mtpErrorWrongTypeId(_type, mtpc_video);
+		return *(const MTPDvideoView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPvideoView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPvideoView> MTPVideoView;
+
+class MTPgeoPointView {
+public:
+	MTPgeoPointView() : _data(0), _type(0) {
+	}
+
+	const MTPDgeoPointView &c_geoPoint() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_geoPoint) throw mtpErrorWrongTypeId(_type, mtpc_geoPoint);
+		return *(const MTPDgeoPointView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPgeoPointView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPgeoPointView> MTPGeoPointView;
+
+class MTPauth_checkedPhoneView {
+public:
+	MTPauth_checkedPhoneView() : _data(0) {
+	}
+
+	const MTPDauth_checkedPhoneView &c_auth_checkedPhone() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDauth_checkedPhoneView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_auth_checkedPhone;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_auth_checkedPhone) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_checkedPhoneView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_auth_checkedPhone);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPauth_checkedPhoneView> MTPauth_CheckedPhoneView;
+
+class MTPauth_sentCodeView {
+public:
+	MTPauth_sentCodeView() : _data(0), _type(0) {
+	}
+
+	const MTPDauth_sentCodeView &c_auth_sentCode() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_auth_sentCode) throw mtpErrorWrongTypeId(_type, mtpc_auth_sentCode);
+		return *(const MTPDauth_sentCodeView*)_data;
+	}
+	const MTPDauth_sentAppCodeView &c_auth_sentAppCode() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_auth_sentAppCode) throw mtpErrorWrongTypeId(_type, mtpc_auth_sentAppCode);
+		return *(const MTPDauth_sentAppCodeView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_sentCodeView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPauth_sentCodeView> MTPauth_SentCodeView;
+
+class MTPauth_authorizationView {
+public:
+	MTPauth_authorizationView() : _data(0) {
+	}
+
+	const MTPDauth_authorizationView &c_auth_authorization() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDauth_authorizationView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_auth_authorization;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_auth_authorization) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_authorizationView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_auth_authorization);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPauth_authorizationView> MTPauth_AuthorizationView;
+
+class MTPauth_exportedAuthorizationView {
+public:
+	MTPauth_exportedAuthorizationView() : _data(0) {
+	}
+
+	const MTPDauth_exportedAuthorizationView &c_auth_exportedAuthorization() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDauth_exportedAuthorizationView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_auth_exportedAuthorization;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_auth_exportedAuthorization) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_exportedAuthorizationView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_auth_exportedAuthorization);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPauth_exportedAuthorizationView> MTPauth_ExportedAuthorizationView;
+
+class MTPinputNotifyPeerView {
+public:
+	MTPinputNotifyPeerView() : _data(0), _type(0) {
+	}
+
+	const MTPDinputNotifyPeerView &c_inputNotifyPeer() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputNotifyPeer) throw mtpErrorWrongTypeId(_type, mtpc_inputNotifyPeer);
+		return *(const MTPDinputNotifyPeerView*)_data;
+	}
+	const MTPDinputNotifyGeoChatPeerView &c_inputNotifyGeoChatPeer() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputNotifyGeoChatPeer) throw mtpErrorWrongTypeId(_type, mtpc_inputNotifyGeoChatPeer);
+		return *(const MTPDinputNotifyGeoChatPeerView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputNotifyPeerView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPinputNotifyPeerView> MTPInputNotifyPeerView;
+
+class MTPinputPeerNotifyEventsView {
+public:
+	MTPinputPeerNotifyEventsView() : _type(0) {
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputPeerNotifyEventsView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPinputPeerNotifyEventsView> MTPInputPeerNotifyEventsView;
+
+class MTPinputPeerNotifySettingsView {
+public:
+	MTPinputPeerNotifySettingsView() : _data(0) {
+	}
+
+	const MTPDinputPeerNotifySettingsView &c_inputPeerNotifySettings() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDinputPeerNotifySettingsView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_inputPeerNotifySettings;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_inputPeerNotifySettings) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputPeerNotifySettingsView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_inputPeerNotifySettings);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPinputPeerNotifySettingsView> MTPInputPeerNotifySettingsView;
+
+class MTPpeerNotifyEventsView {
+public:
+	MTPpeerNotifyEventsView() : _type(0) {
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPpeerNotifyEventsView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPpeerNotifyEventsView> MTPPeerNotifyEventsView;
+
+class MTPpeerNotifySettingsView {
+public:
+	MTPpeerNotifySettingsView() : _data(0), _type(0) {
+	}
+
+	const MTPDpeerNotifySettingsView &c_peerNotifySettings() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_peerNotifySettings) throw mtpErrorWrongTypeId(_type, mtpc_peerNotifySettings);
+		return *(const MTPDpeerNotifySettingsView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPpeerNotifySettingsView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPpeerNotifySettingsView> MTPPeerNotifySettingsView;
+
+class MTPwallPaperView {
+public:
+	MTPwallPaperView() : _data(0), _type(0) {
+	}
+
+	const MTPDwallPaperView &c_wallPaper() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_wallPaper) throw mtpErrorWrongTypeId(_type, mtpc_wallPaper);
+		return *(const MTPDwallPaperView*)_data;
+	}
+	const MTPDwallPaperSolidView &c_wallPaperSolid() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_wallPaperSolid) throw mtpErrorWrongTypeId(_type, mtpc_wallPaperSolid);
+		return *(const MTPDwallPaperSolidView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPwallPaperView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPwallPaperView> MTPWallPaperView;
+
+class MTPuserFullView {
+public:
+	MTPuserFullView() : _data(0) {
+	}
+
+	const MTPDuserFullView &c_userFull() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDuserFullView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_userFull;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_userFull) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPuserFullView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_userFull);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPuserFullView> MTPUserFullView;
+
+class MTPcontactView {
+public:
+	MTPcontactView() : _data(0) {
+	}
+
+	const MTPDcontactView &c_contact() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDcontactView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_contact;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_contact) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontactView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_contact);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPcontactView> MTPContactView;
+
+class MTPimportedContactView {
+public:
+	MTPimportedContactView() : _data(0) {
+	}
+
+	const MTPDimportedContactView &c_importedContact() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDimportedContactView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_importedContact;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_importedContact) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPimportedContactView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_importedContact);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPimportedContactView> MTPImportedContactView;
+
+class MTPcontactBlockedView {
+public:
+	MTPcontactBlockedView() : _data(0) {
+	}
+
+	const MTPDcontactBlockedView &c_contactBlocked() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDcontactBlockedView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_contactBlocked;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_contactBlocked) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontactBlockedView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_contactBlocked);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPcontactBlockedView> MTPContactBlockedView;
+
+class MTPcontactSuggestedView {
+public:
+	MTPcontactSuggestedView() : _data(0) {
+	}
+
+	const MTPDcontactSuggestedView &c_contactSuggested() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDcontactSuggestedView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_contactSuggested;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_contactSuggested) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontactSuggestedView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_contactSuggested);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPcontactSuggestedView> MTPContactSuggestedView;
+
+class MTPcontactStatusView {
+public:
+	MTPcontactStatusView() : _data(0) {
+	}
+
+	const MTPDcontactStatusView &c_contactStatus() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDcontactStatusView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_contactStatus;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_contactStatus) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontactStatusView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_contactStatus);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPcontactStatusView> MTPContactStatusView;
+
+class MTPchatLocatedView {
+public:
+	MTPchatLocatedView() : _data(0) {
+	}
+
+	const MTPDchatLocatedView &c_chatLocated() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDchatLocatedView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_chatLocated;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_chatLocated) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPchatLocatedView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_chatLocated);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPchatLocatedView> MTPChatLocatedView;
+
+class MTPcontacts_linkView {
+public:
+	MTPcontacts_linkView() : _data(0) {
+	}
+
+	const MTPDcontacts_linkView &c_contacts_link() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDcontacts_linkView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_contacts_link;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_contacts_link) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_linkView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_contacts_link);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPcontacts_linkView> MTPcontacts_LinkView;
+
+class MTPcontacts_contactsView {
+public:
+	MTPcontacts_contactsView() : _data(0), _type(0) {
+	}
+
+	const MTPDcontacts_contactsView &c_contacts_contacts() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_contacts_contacts) throw mtpErrorWrongTypeId(_type, mtpc_contacts_contacts);
+		return *(const MTPDcontacts_contactsView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_contactsView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPcontacts_contactsView> MTPcontacts_ContactsView;
+
+class MTPcontacts_importedContactsView {
+public:
+	MTPcontacts_importedContactsView() : _data(0) {
+	}
+
+	const MTPDcontacts_importedContactsView &c_contacts_importedContacts() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDcontacts_importedContactsView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_contacts_importedContacts;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_contacts_importedContacts) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_importedContactsView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_contacts_importedContacts);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPcontacts_importedContactsView> MTPcontacts_ImportedContactsView;
+
+class MTPcontacts_blockedView {
+public:
+	MTPcontacts_blockedView() : _data(0), _type(0) {
+	}
+
+	const MTPDcontacts_blockedView &c_contacts_blocked() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_contacts_blocked) throw mtpErrorWrongTypeId(_type, mtpc_contacts_blocked);
+		return *(const MTPDcontacts_blockedView*)_data;
+	}
+	const MTPDcontacts_blockedSliceView &c_contacts_blockedSlice() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_contacts_blockedSlice) throw mtpErrorWrongTypeId(_type, mtpc_contacts_blockedSlice);
+		return *(const MTPDcontacts_blockedSliceView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_blockedView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPcontacts_blockedView> MTPcontacts_BlockedView;
+
+class MTPcontacts_suggestedView {
+public:
+	MTPcontacts_suggestedView() : _data(0) {
+	}
+
+	const MTPDcontacts_suggestedView &c_contacts_suggested() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDcontacts_suggestedView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_contacts_suggested;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_contacts_suggested) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_suggestedView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_contacts_suggested);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPcontacts_suggestedView> MTPcontacts_SuggestedView;
+
+class MTPmessages_dialogsView {
+public:
+	MTPmessages_dialogsView() : _data(0), _type(0) {
+	}
+
+	const MTPDmessages_dialogsView &c_messages_dialogs() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messages_dialogs) throw mtpErrorWrongTypeId(_type, mtpc_messages_dialogs);
+		return *(const MTPDmessages_dialogsView*)_data;
+	}
+	const MTPDmessages_dialogsSliceView &c_messages_dialogsSlice() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messages_dialogsSlice) throw mtpErrorWrongTypeId(_type, mtpc_messages_dialogsSlice);
+		return *(const MTPDmessages_dialogsSliceView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_dialogsView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPmessages_dialogsView> MTPmessages_DialogsView;
+
+class MTPmessages_messagesView {
+public:
+	MTPmessages_messagesView() : _data(0), _type(0) {
+	}
+
+	const MTPDmessages_messagesView &c_messages_messages() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messages_messages) throw mtpErrorWrongTypeId(_type, mtpc_messages_messages);
+		return *(const MTPDmessages_messagesView*)_data;
+	}
+	const MTPDmessages_messagesSliceView &c_messages_messagesSlice() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messages_messagesSlice) throw mtpErrorWrongTypeId(_type, mtpc_messages_messagesSlice);
+		return *(const MTPDmessages_messagesSliceView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_messagesView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPmessages_messagesView> MTPmessages_MessagesView;
+
+class MTPmessages_messageView {
+public:
+	MTPmessages_messageView() {
+	}
+
+	mtpTypeId type() const {
+		return mtpc_messages_messageEmpty;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_messages_messageEmpty) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_messageView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_messages_messageEmpty);
+};
+typedef MTPBoxedView<MTPmessages_messageView> MTPmessages_MessageView;
+
+class MTPmessages_sentMessageView {
+public:
+	MTPmessages_sentMessageView() : _data(0), _type(0) {
+	}
+
+	const MTPDmessages_sentMessageView &c_messages_sentMessage() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messages_sentMessage) throw mtpErrorWrongTypeId(_type, mtpc_messages_sentMessage);
+		return *(const MTPDmessages_sentMessageView*)_data;
+	}
+	const MTPDmessages_sentMessageLinkView &c_messages_sentMessageLink() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messages_sentMessageLink) throw mtpErrorWrongTypeId(_type, mtpc_messages_sentMessageLink);
+		return *(const MTPDmessages_sentMessageLinkView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_sentMessageView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPmessages_sentMessageView> MTPmessages_SentMessageView;
+
+class MTPmessages_chatsView {
+public:
+	MTPmessages_chatsView() : _data(0) {
+	}
+
+	const MTPDmessages_chatsView &c_messages_chats() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDmessages_chatsView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_messages_chats;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_messages_chats) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_chatsView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_messages_chats);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPmessages_chatsView> MTPmessages_ChatsView;
+
+class MTPmessages_chatFullView {
+public:
+	MTPmessages_chatFullView() : _data(0) {
+	}
+
+	const MTPDmessages_chatFullView &c_messages_chatFull() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDmessages_chatFullView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_messages_chatFull;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_messages_chatFull) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_chatFullView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_messages_chatFull);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPmessages_chatFullView> MTPmessages_ChatFullView;
+
+class MTPmessages_affectedHistoryView {
+public:
+	MTPmessages_affectedHistoryView() : _data(0) {
+	}
+
+	const MTPDmessages_affectedHistoryView &c_messages_affectedHistory() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDmessages_affectedHistoryView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_messages_affectedHistory;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_messages_affectedHistory) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_affectedHistoryView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_messages_affectedHistory);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPmessages_affectedHistoryView> MTPmessages_AffectedHistoryView;
+
+class MTPmessagesFilterView {
+public:
+	MTPmessagesFilterView() : _type(0) {
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessagesFilterView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPmessagesFilterView> MTPMessagesFilterView;
+
+class MTPupdateView {
+public:
+	MTPupdateView() : _data(0), _type(0) {
+	}
+
+	const MTPDupdateNewMessageView &c_updateNewMessage() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateNewMessage) throw mtpErrorWrongTypeId(_type, mtpc_updateNewMessage);
+		return *(const MTPDupdateNewMessageView*)_data;
+	}
+	const MTPDupdateMessageIDView &c_updateMessageID() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateMessageID) throw mtpErrorWrongTypeId(_type, mtpc_updateMessageID);
+		return *(const MTPDupdateMessageIDView*)_data;
+	}
+	const MTPDupdateDeleteMessagesView &c_updateDeleteMessages() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateDeleteMessages) throw mtpErrorWrongTypeId(_type, mtpc_updateDeleteMessages);
+		return *(const MTPDupdateDeleteMessagesView*)_data;
+	}
+	const MTPDupdateUserTypingView &c_updateUserTyping() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateUserTyping) throw mtpErrorWrongTypeId(_type, mtpc_updateUserTyping);
+		return *(const MTPDupdateUserTypingView*)_data;
+	}
+	const MTPDupdateChatUserTypingView &c_updateChatUserTyping() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateChatUserTyping) throw mtpErrorWrongTypeId(_type, mtpc_updateChatUserTyping);
+		return *(const MTPDupdateChatUserTypingView*)_data;
+	}
+	const MTPDupdateChatParticipantsView &c_updateChatParticipants() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateChatParticipants) throw mtpErrorWrongTypeId(_type, mtpc_updateChatParticipants);
+		return *(const MTPDupdateChatParticipantsView*)_data;
+	}
+	const MTPDupdateUserStatusView &c_updateUserStatus() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateUserStatus) throw mtpErrorWrongTypeId(_type, mtpc_updateUserStatus);
+		return *(const MTPDupdateUserStatusView*)_data;
+	}
+	const MTPDupdateUserNameView &c_updateUserName() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateUserName) throw mtpErrorWrongTypeId(_type, mtpc_updateUserName);
+		return *(const MTPDupdateUserNameView*)_data;
+	}
+	const MTPDupdateUserPhotoView &c_updateUserPhoto() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateUserPhoto) throw mtpErrorWrongTypeId(_type, mtpc_updateUserPhoto);
+		return *(const MTPDupdateUserPhotoView*)_data;
+	}
+	const MTPDupdateContactRegisteredView &c_updateContactRegistered() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateContactRegistered) throw mtpErrorWrongTypeId(_type, mtpc_updateContactRegistered);
+		return *(const MTPDupdateContactRegisteredView*)_data;
+	}
+	const MTPDupdateContactLinkView &c_updateContactLink() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateContactLink) throw mtpErrorWrongTypeId(_type, mtpc_updateContactLink);
+		return *(const MTPDupdateContactLinkView*)_data;
+	}
+	const MTPDupdateNewAuthorizationView &c_updateNewAuthorization() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateNewAuthorization) throw mtpErrorWrongTypeId(_type, mtpc_updateNewAuthorization);
+		return *(const MTPDupdateNewAuthorizationView*)_data;
+	}
+	const MTPDupdateNewGeoChatMessageView &c_updateNewGeoChatMessage() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateNewGeoChatMessage) throw mtpErrorWrongTypeId(_type, mtpc_updateNewGeoChatMessage);
+		return *(const MTPDupdateNewGeoChatMessageView*)_data;
+	}
+	const MTPDupdateNewEncryptedMessageView &c_updateNewEncryptedMessage() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateNewEncryptedMessage) throw mtpErrorWrongTypeId(_type, mtpc_updateNewEncryptedMessage);
+		return *(const MTPDupdateNewEncryptedMessageView*)_data;
+	}
+	const MTPDupdateEncryptedChatTypingView &c_updateEncryptedChatTyping() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateEncryptedChatTyping) throw mtpErrorWrongTypeId(_type, mtpc_updateEncryptedChatTyping);
+		return *(const MTPDupdateEncryptedChatTypingView*)_data;
+	}
+	const MTPDupdateEncryptionView &c_updateEncryption() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateEncryption) throw mtpErrorWrongTypeId(_type, mtpc_updateEncryption);
+		return *(const MTPDupdateEncryptionView*)_data;
+	}
+	const MTPDupdateEncryptedMessagesReadView &c_updateEncryptedMessagesRead() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateEncryptedMessagesRead) throw mtpErrorWrongTypeId(_type, mtpc_updateEncryptedMessagesRead);
+		return *(const MTPDupdateEncryptedMessagesReadView*)_data;
+	}
+	const MTPDupdateChatParticipantAddView &c_updateChatParticipantAdd() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateChatParticipantAdd) throw mtpErrorWrongTypeId(_type, mtpc_updateChatParticipantAdd);
+		return *(const MTPDupdateChatParticipantAddView*)_data;
+	}
+	const MTPDupdateChatParticipantDeleteView &c_updateChatParticipantDelete() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateChatParticipantDelete) throw mtpErrorWrongTypeId(_type, mtpc_updateChatParticipantDelete);
+		return *(const MTPDupdateChatParticipantDeleteView*)_data;
+	}
+	const MTPDupdateDcOptionsView &c_updateDcOptions() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateDcOptions) throw mtpErrorWrongTypeId(_type, mtpc_updateDcOptions);
+		return *(const MTPDupdateDcOptionsView*)_data;
+	}
+	const MTPDupdateUserBlockedView &c_updateUserBlocked() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateUserBlocked) throw mtpErrorWrongTypeId(_type, mtpc_updateUserBlocked);
+		return *(const MTPDupdateUserBlockedView*)_data;
+	}
+	const MTPDupdateNotifySettingsView &c_updateNotifySettings() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateNotifySettings) throw mtpErrorWrongTypeId(_type, mtpc_updateNotifySettings);
+		return *(const MTPDupdateNotifySettingsView*)_data;
+	}
+	const MTPDupdateServiceNotificationView &c_updateServiceNotification() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateServiceNotification) throw mtpErrorWrongTypeId(_type, mtpc_updateServiceNotification);
+		return *(const MTPDupdateServiceNotificationView*)_data;
+	}
+	const MTPDupdatePrivacyView &c_updatePrivacy() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updatePrivacy) throw mtpErrorWrongTypeId(_type, mtpc_updatePrivacy);
+		return *(const MTPDupdatePrivacyView*)_data;
+	}
+	const MTPDupdateUserPhoneView &c_updateUserPhone() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateUserPhone) throw mtpErrorWrongTypeId(_type, mtpc_updateUserPhone);
+		return *(const MTPDupdateUserPhoneView*)_data;
+	}
+	const MTPDupdateReadHistoryInboxView &c_updateReadHistoryInbox() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateReadHistoryInbox) throw mtpErrorWrongTypeId(_type, mtpc_updateReadHistoryInbox);
+		return *(const MTPDupdateReadHistoryInboxView*)_data;
+	}
+	const MTPDupdateReadHistoryOutboxView &c_updateReadHistoryOutbox() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateReadHistoryOutbox) throw mtpErrorWrongTypeId(_type, mtpc_updateReadHistoryOutbox);
+		return *(const MTPDupdateReadHistoryOutboxView*)_data;
+	}
+	const MTPDupdateWebPageView &c_updateWebPage() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateWebPage) throw mtpErrorWrongTypeId(_type, mtpc_updateWebPage);
+		return *(const MTPDupdateWebPageView*)_data;
+	}
+	const MTPDupdateReadMessagesContentsView &c_updateReadMessagesContents() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateReadMessagesContents) throw mtpErrorWrongTypeId(_type, mtpc_updateReadMessagesContents);
+		return *(const MTPDupdateReadMessagesContentsView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPupdateView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPupdateView> MTPUpdateView;
+
+class MTPupdates_stateView {
+public:
+	MTPupdates_stateView() : _data(0) {
+	}
+
+	const MTPDupdates_stateView &c_updates_state() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDupdates_stateView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_updates_state;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_updates_state) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPupdates_stateView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_updates_state);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPupdates_stateView> MTPupdates_StateView;
+
+class MTPupdates_differenceView {
+public:
+	MTPupdates_differenceView() : _data(0), _type(0) {
+	}
+
+	const MTPDupdates_differenceEmptyView &c_updates_differenceEmpty() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updates_differenceEmpty) throw mtpErrorWrongTypeId(_type, mtpc_updates_differenceEmpty);
+		return *(const MTPDupdates_differenceEmptyView*)_data;
+	}
+	const MTPDupdates_differenceView &c_updates_difference() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updates_difference) throw mtpErrorWrongTypeId(_type, mtpc_updates_difference);
+		return *(const MTPDupdates_differenceView*)_data;
+	}
+	const MTPDupdates_differenceSliceView &c_updates_differenceSlice() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updates_differenceSlice) throw mtpErrorWrongTypeId(_type, mtpc_updates_differenceSlice);
+		return *(const MTPDupdates_differenceSliceView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPupdates_differenceView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPupdates_differenceView> MTPupdates_DifferenceView;
+
+class MTPupdatesView {
+public:
+	MTPupdatesView() : _data(0), _type(0) {
+	}
+
+	const MTPDupdateShortMessageView &c_updateShortMessage() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateShortMessage) throw mtpErrorWrongTypeId(_type, mtpc_updateShortMessage);
+		return *(const MTPDupdateShortMessageView*)_data;
+	}
+	const MTPDupdateShortChatMessageView &c_updateShortChatMessage() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateShortChatMessage) throw mtpErrorWrongTypeId(_type, mtpc_updateShortChatMessage);
+		return *(const MTPDupdateShortChatMessageView*)_data;
+	}
+	const MTPDupdateShortView &c_updateShort() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updateShort) throw mtpErrorWrongTypeId(_type, mtpc_updateShort);
+		return *(const MTPDupdateShortView*)_data;
+	}
+	const MTPDupdatesCombinedView &c_updatesCombined() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updatesCombined) throw mtpErrorWrongTypeId(_type, mtpc_updatesCombined);
+		return *(const MTPDupdatesCombinedView*)_data;
+	}
+	const MTPDupdatesView &c_updates() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_updates) throw mtpErrorWrongTypeId(_type, mtpc_updates);
+		return *(const MTPDupdatesView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPupdatesView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPupdatesView> MTPUpdatesView;
+
+class MTPphotos_photosView {
+public:
+	MTPphotos_photosView() : _data(0), _type(0) {
+	}
+
+	const MTPDphotos_photosView &c_photos_photos() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_photos_photos) throw mtpErrorWrongTypeId(_type, mtpc_photos_photos);
+		return *(const MTPDphotos_photosView*)_data;
+	}
+	const MTPDphotos_photosSliceView &c_photos_photosSlice() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_photos_photosSlice) throw mtpErrorWrongTypeId(_type, mtpc_photos_photosSlice);
+		return *(const MTPDphotos_photosSliceView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPphotos_photosView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPphotos_photosView> MTPphotos_PhotosView;
+
+class MTPphotos_photoView {
+public:
+	MTPphotos_photoView() : _data(0) {
+	}
+
+	const MTPDphotos_photoView &c_photos_photo() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDphotos_photoView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_photos_photo;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_photos_photo) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPphotos_photoView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_photos_photo);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPphotos_photoView> MTPphotos_PhotoView;
+
+class MTPupload_fileView {
+public:
+	MTPupload_fileView() : _data(0) {
+	}
+
+	const MTPDupload_fileView &c_upload_file() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDupload_fileView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_upload_file;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_upload_file) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPupload_fileView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_upload_file);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPupload_fileView> MTPupload_FileView;
+
+class MTPdcOptionView {
+public:
+	MTPdcOptionView() : _data(0) {
+	}
+
+	const MTPDdcOptionView &c_dcOption() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDdcOptionView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_dcOption;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_dcOption) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPdcOptionView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_dcOption);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPdcOptionView> MTPDcOptionView;
+
+class MTPconfigView {
+public:
+	MTPconfigView() : _data(0) {
+	}
+
+	const MTPDconfigView &c_config() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDconfigView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_config;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_config) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPconfigView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_config);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPconfigView> MTPConfigView;
+
+class MTPnearestDcView {
+public:
+	MTPnearestDcView() : _data(0) {
+	}
+
+	const MTPDnearestDcView &c_nearestDc() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDnearestDcView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_nearestDc;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_nearestDc) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPnearestDcView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_nearestDc);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPnearestDcView> MTPNearestDcView;
+
+class MTPhelp_appUpdateView {
+public:
+	MTPhelp_appUpdateView() : _data(0), _type(0) {
+	}
+
+	const MTPDhelp_appUpdateView &c_help_appUpdate() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_help_appUpdate) throw mtpErrorWrongTypeId(_type, mtpc_help_appUpdate);
+		return *(const MTPDhelp_appUpdateView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPhelp_appUpdateView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPhelp_appUpdateView> MTPhelp_AppUpdateView;
+
+class MTPhelp_inviteTextView {
+public:
+	MTPhelp_inviteTextView() : _data(0) {
+	}
+
+	const MTPDhelp_inviteTextView &c_help_inviteText() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDhelp_inviteTextView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_help_inviteText;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_help_inviteText) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPhelp_inviteTextView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_help_inviteText);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPhelp_inviteTextView> MTPhelp_InviteTextView;
+
+class MTPinputGeoChatView {
+public:
+	MTPinputGeoChatView() : _data(0) {
+	}
+
+	const MTPDinputGeoChatView &c_inputGeoChat() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDinputGeoChatView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_inputGeoChat;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_inputGeoChat) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputGeoChatView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_inputGeoChat);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPinputGeoChatView> MTPInputGeoChatView;
+
+class MTPgeoChatMessageView {
+public:
+	MTPgeoChatMessageView() : _data(0), _type(0) {
+	}
+
+	const MTPDgeoChatMessageEmptyView &c_geoChatMessageEmpty() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_geoChatMessageEmpty) throw mtpErrorWrongTypeId(_type, mtpc_geoChatMessageEmpty);
+		return *(const MTPDgeoChatMessageEmptyView*)_data;
+	}
+	const MTPDgeoChatMessageView &c_geoChatMessage() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_geoChatMessage) throw mtpErrorWrongTypeId(_type, mtpc_geoChatMessage);
+		return *(const MTPDgeoChatMessageView*)_data;
+	}
+	const MTPDgeoChatMessageServiceView &c_geoChatMessageService() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_geoChatMessageService) throw mtpErrorWrongTypeId(_type, mtpc_geoChatMessageService);
+		return *(const MTPDgeoChatMessageServiceView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPgeoChatMessageView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPgeoChatMessageView> MTPGeoChatMessageView;
+
+class MTPgeochats_statedMessageView {
+public:
+	MTPgeochats_statedMessageView() : _data(0) {
+	}
+
+	const MTPDgeochats_statedMessageView &c_geochats_statedMessage() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDgeochats_statedMessageView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_geochats_statedMessage;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_geochats_statedMessage) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPgeochats_statedMessageView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_geochats_statedMessage);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPgeochats_statedMessageView> MTPgeochats_StatedMessageView;
+
+class MTPgeochats_locatedView {
+public:
+	MTPgeochats_locatedView() : _data(0) {
+	}
+
+	const MTPDgeochats_locatedView &c_geochats_located() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDgeochats_locatedView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_geochats_located;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_geochats_located) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPgeochats_locatedView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_geochats_located);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPgeochats_locatedView> MTPgeochats_LocatedView;
+
+class MTPgeochats_messagesView {
+public:
+	MTPgeochats_messagesView() : _data(0), _type(0) {
+	}
+
+	const MTPDgeochats_messagesView &c_geochats_messages() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_geochats_messages) throw mtpErrorWrongTypeId(_type, mtpc_geochats_messages);
+		return *(const MTPDgeochats_messagesView*)_data;
+	}
+	const MTPDgeochats_messagesSliceView &c_geochats_messagesSlice() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_geochats_messagesSlice) throw mtpErrorWrongTypeId(_type, mtpc_geochats_messagesSlice);
+		return *(const MTPDgeochats_messagesSliceView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPgeochats_messagesView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPgeochats_messagesView> MTPgeochats_MessagesView;
+
+class MTPencryptedChatView {
+public:
+	MTPencryptedChatView() : _data(0), _type(0) {
+	}
+
+	const MTPDencryptedChatEmptyView &c_encryptedChatEmpty() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_encryptedChatEmpty) throw mtpErrorWrongTypeId(_type, mtpc_encryptedChatEmpty);
+		return *(const MTPDencryptedChatEmptyView*)_data;
+	}
+	const MTPDencryptedChatWaitingView &c_encryptedChatWaiting() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_encryptedChatWaiting) throw mtpErrorWrongTypeId(_type, mtpc_encryptedChatWaiting);
+		return *(const MTPDencryptedChatWaitingView*)_data;
+	}
+	const MTPDencryptedChatRequestedView &c_encryptedChatRequested() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_encryptedChatRequested) throw mtpErrorWrongTypeId(_type, mtpc_encryptedChatRequested);
+		return *(const MTPDencryptedChatRequestedView*)_data;
+	}
+	const MTPDencryptedChatView &c_encryptedChat() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_encryptedChat) throw mtpErrorWrongTypeId(_type, mtpc_encryptedChat);
+		return *(const MTPDencryptedChatView*)_data;
+	}
+	const MTPDencryptedChatDiscardedView &c_encryptedChatDiscarded() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_encryptedChatDiscarded) throw mtpErrorWrongTypeId(_type, mtpc_encryptedChatDiscarded);
+		return *(const MTPDencryptedChatDiscardedView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPencryptedChatView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPencryptedChatView> MTPEncryptedChatView;
+
+class MTPinputEncryptedChatView {
+public:
+	MTPinputEncryptedChatView() : _data(0) {
+	}
+
+	const MTPDinputEncryptedChatView &c_inputEncryptedChat() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDinputEncryptedChatView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_inputEncryptedChat;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_inputEncryptedChat) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputEncryptedChatView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_inputEncryptedChat);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPinputEncryptedChatView> MTPInputEncryptedChatView;
+
+class MTPencryptedFileView {
+public:
+	MTPencryptedFileView() : _data(0), _type(0) {
+	}
+
+	const MTPDencryptedFileView &c_encryptedFile() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_encryptedFile) throw mtpErrorWrongTypeId(_type, mtpc_encryptedFile);
+		return *(const MTPDencryptedFileView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPencryptedFileView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPencryptedFileView> MTPEncryptedFileView;
+
+class MTPinputEncryptedFileView {
+public:
+	MTPinputEncryptedFileView() : _data(0), _type(0) {
+	}
+
+	const MTPDinputEncryptedFileUploadedView &c_inputEncryptedFileUploaded() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputEncryptedFileUploaded) throw mtpErrorWrongTypeId(_type, mtpc_inputEncryptedFileUploaded);
+		return *(const MTPDinputEncryptedFileUploadedView*)_data;
+	}
+	const MTPDinputEncryptedFileView &c_inputEncryptedFile() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputEncryptedFile) throw mtpErrorWrongTypeId(_type, mtpc_inputEncryptedFile);
+		return *(const MTPDinputEncryptedFileView*)_data;
+	}
+	const MTPDinputEncryptedFileBigUploadedView &c_inputEncryptedFileBigUploaded() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputEncryptedFileBigUploaded) throw mtpErrorWrongTypeId(_type, mtpc_inputEncryptedFileBigUploaded);
+		return *(const MTPDinputEncryptedFileBigUploadedView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputEncryptedFileView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPinputEncryptedFileView> MTPInputEncryptedFileView;
+
+class MTPencryptedMessageView {
+public:
+	MTPencryptedMessageView() : _data(0), _type(0) {
+	}
+
+	const MTPDencryptedMessageView &c_encryptedMessage() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_encryptedMessage) throw mtpErrorWrongTypeId(_type, mtpc_encryptedMessage);
+		return *(const MTPDencryptedMessageView*)_data;
+	}
+	const MTPDencryptedMessageServiceView &c_encryptedMessageService() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_encryptedMessageService) throw mtpErrorWrongTypeId(_type, mtpc_encryptedMessageService);
+		return *(const MTPDencryptedMessageServiceView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPencryptedMessageView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPencryptedMessageView> MTPEncryptedMessageView;
+
+class MTPmessages_dhConfigView {
+public:
+	MTPmessages_dhConfigView() : _data(0), _type(0) {
+	}
+
+	const MTPDmessages_dhConfigNotModifiedView &c_messages_dhConfigNotModified() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messages_dhConfigNotModified) throw mtpErrorWrongTypeId(_type, mtpc_messages_dhConfigNotModified);
+		return *(const MTPDmessages_dhConfigNotModifiedView*)_data;
+	}
+	const MTPDmessages_dhConfigView &c_messages_dhConfig() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messages_dhConfig) throw mtpErrorWrongTypeId(_type, mtpc_messages_dhConfig);
+		return *(const MTPDmessages_dhConfigView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_dhConfigView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPmessages_dhConfigView> MTPmessages_DhConfigView;
+
+class MTPmessages_sentEncryptedMessageView {
+public:
+	MTPmessages_sentEncryptedMessageView() : _data(0), _type(0) {
+	}
+
+	const MTPDmessages_sentEncryptedMessageView &c_messages_sentEncryptedMessage() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messages_sentEncryptedMessage) throw mtpErrorWrongTypeId(_type, mtpc_messages_sentEncryptedMessage);
+		return *(const MTPDmessages_sentEncryptedMessageView*)_data;
+	}
+	const MTPDmessages_sentEncryptedFileView &c_messages_sentEncryptedFile() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messages_sentEncryptedFile) throw mtpErrorWrongTypeId(_type, mtpc_messages_sentEncryptedFile);
+		return *(const MTPDmessages_sentEncryptedFileView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_sentEncryptedMessageView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPmessages_sentEncryptedMessageView> MTPmessages_SentEncryptedMessageView;
+
+class MTPinputAudioView {
+public:
+	MTPinputAudioView() : _data(0), _type(0) {
+	}
+
+	const MTPDinputAudioView &c_inputAudio() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputAudio) throw mtpErrorWrongTypeId(_type, mtpc_inputAudio);
+		return *(const MTPDinputAudioView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputAudioView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPinputAudioView> MTPInputAudioView;
+
+class MTPinputDocumentView {
+public:
+	MTPinputDocumentView() : _data(0), _type(0) {
+	}
+
+	const MTPDinputDocumentView &c_inputDocument() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputDocument) throw mtpErrorWrongTypeId(_type, mtpc_inputDocument);
+		return *(const MTPDinputDocumentView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputDocumentView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPinputDocumentView> MTPInputDocumentView;
+
+class MTPaudioView {
+public:
+	MTPaudioView() : _data(0), _type(0) {
+	}
+
+	const MTPDaudioEmptyView &c_audioEmpty() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_audioEmpty) throw mtpErrorWrongTypeId(_type, mtpc_audioEmpty);
+		return *(const MTPDaudioEmptyView*)_data;
+	}
+	const MTPDaudioView &c_audio() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_audio) throw mtpErrorWrongTypeId(_type, mtpc_audio);
+		return *(const MTPDaudioView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaudioView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPaudioView> MTPAudioView;
+
+class MTPdocumentView {
+public:
+	MTPdocumentView() : _data(0), _type(0) {
+	}
+
+	const MTPDdocumentEmptyView &c_documentEmpty() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_documentEmpty) throw mtpErrorWrongTypeId(_type, mtpc_documentEmpty);
+		return *(const MTPDdocumentEmptyView*)_data;
+	}
+	const MTPDdocumentView &c_document() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_document) throw mtpErrorWrongTypeId(_type, mtpc_document);
+		return *(const MTPDdocumentView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPdocumentView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPdocumentView> MTPDocumentView;
+
+class MTPhelp_supportView {
+public:
+	MTPhelp_supportView() : _data(0) {
+	}
+
+	const MTPDhelp_supportView &c_help_support() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDhelp_supportView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_help_support;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_help_support) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPhelp_supportView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_help_support);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPhelp_supportView> MTPhelp_SupportView;
+
+class MTPnotifyPeerView {
+public:
+	MTPnotifyPeerView() : _data(0), _type(0) {
+	}
+
+	const MTPDnotifyPeerView &c_notifyPeer() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_notifyPeer) throw mtpErrorWrongTypeId(_type, mtpc_notifyPeer);
+		return *(const MTPDnotifyPeerView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPnotifyPeerView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPnotifyPeerView> MTPNotifyPeerView;
+
+class MTPsendMessageActionView {
+public:
+	MTPsendMessageActionView() : _data(0), _type(0) {
+	}
+
+	const MTPDsendMessageUploadVideoActionView &c_sendMessageUploadVideoAction() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_sendMessageUploadVideoAction) throw mtpErrorWrongTypeId(_type, mtpc_sendMessageUploadVideoAction);
+		return *(const MTPDsendMessageUploadVideoActionView*)_data;
+	}
+	const MTPDsendMessageUploadAudioActionView &c_sendMessageUploadAudioAction() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_sendMessageUploadAudioAction) throw mtpErrorWrongTypeId(_type, mtpc_sendMessageUploadAudioAction);
+		return *(const MTPDsendMessageUploadAudioActionView*)_data;
+	}
+	const MTPDsendMessageUploadPhotoActionView &c_sendMessageUploadPhotoAction() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_sendMessageUploadPhotoAction) throw mtpErrorWrongTypeId(_type, mtpc_sendMessageUploadPhotoAction);
+		return *(const MTPDsendMessageUploadPhotoActionView*)_data;
+	}
+	const MTPDsendMessageUploadDocumentActionView &c_sendMessageUploadDocumentAction() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_sendMessageUploadDocumentAction) throw mtpErrorWrongTypeId(_type, mtpc_sendMessageUploadDocumentAction);
+		return *(const MTPDsendMessageUploadDocumentActionView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPsendMessageActionView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPsendMessageActionView> MTPSendMessageActionView;
+
+class MTPcontactFoundView {
+public:
+	MTPcontactFoundView() : _data(0) {
+	}
+
+	const MTPDcontactFoundView &c_contactFound() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDcontactFoundView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_contactFound;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_contactFound) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontactFoundView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_contactFound);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPcontactFoundView> MTPContactFoundView;
+
+class MTPcontacts_foundView {
+public:
+	MTPcontacts_foundView() : _data(0) {
+	}
+
+	const MTPDcontacts_foundView &c_contacts_found() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDcontacts_foundView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_contacts_found;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_contacts_found) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontacts_foundView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_contacts_found);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPcontacts_foundView> MTPcontacts_FoundView;
+
+class MTPinputPrivacyKeyView {
+public:
+	MTPinputPrivacyKeyView() {
+	}
+
+	mtpTypeId type() const {
+		return mtpc_inputPrivacyKeyStatusTimestamp;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_inputPrivacyKeyStatusTimestamp) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputPrivacyKeyView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_inputPrivacyKeyStatusTimestamp);
+};
+typedef MTPBoxedView<MTPinputPrivacyKeyView> MTPInputPrivacyKeyView;
+
+class MTPprivacyKeyView {
+public:
+	MTPprivacyKeyView() {
+	}
+
+	mtpTypeId type() const {
+		return mtpc_privacyKeyStatusTimestamp;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_privacyKeyStatusTimestamp) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPprivacyKeyView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_privacyKeyStatusTimestamp);
+};
+typedef MTPBoxedView<MTPprivacyKeyView> MTPPrivacyKeyView;
+
+class MTPinputPrivacyRuleView {
+public:
+	MTPinputPrivacyRuleView() : _data(0), _type(0) {
+	}
+
+	const MTPDinputPrivacyValueAllowUsersView &c_inputPrivacyValueAllowUsers() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputPrivacyValueAllowUsers) throw mtpErrorWrongTypeId(_type, mtpc_inputPrivacyValueAllowUsers);
+		return *(const MTPDinputPrivacyValueAllowUsersView*)_data;
+	}
+	const MTPDinputPrivacyValueDisallowUsersView &c_inputPrivacyValueDisallowUsers() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputPrivacyValueDisallowUsers) throw mtpErrorWrongTypeId(_type, mtpc_inputPrivacyValueDisallowUsers);
+		return *(const MTPDinputPrivacyValueDisallowUsersView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputPrivacyRuleView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPinputPrivacyRuleView> MTPInputPrivacyRuleView;
+
+class MTPprivacyRuleView {
+public:
+	MTPprivacyRuleView() : _data(0), _type(0) {
+	}
+
+	const MTPDprivacyValueAllowUsersView &c_privacyValueAllowUsers() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_privacyValueAllowUsers) throw mtpErrorWrongTypeId(_type, mtpc_privacyValueAllowUsers);
+		return *(const MTPDprivacyValueAllowUsersView*)_data;
+	}
+	const MTPDprivacyValueDisallowUsersView &c_privacyValueDisallowUsers() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_privacyValueDisallowUsers) throw mtpErrorWrongTypeId(_type, mtpc_privacyValueDisallowUsers);
+		return *(const MTPDprivacyValueDisallowUsersView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPprivacyRuleView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPprivacyRuleView> MTPPrivacyRuleView;
+
+class MTPaccount_privacyRulesView {
+public:
+	MTPaccount_privacyRulesView() : _data(0) {
+	}
+
+	const MTPDaccount_privacyRulesView &c_account_privacyRules() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDaccount_privacyRulesView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_account_privacyRules;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_account_privacyRules) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_privacyRulesView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_account_privacyRules);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPaccount_privacyRulesView> MTPaccount_PrivacyRulesView;
+
+class MTPaccountDaysTTLView {
+public:
+	MTPaccountDaysTTLView() : _data(0) {
+	}
+
+	const MTPDaccountDaysTTLView &c_accountDaysTTL() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDaccountDaysTTLView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_accountDaysTTL;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_accountDaysTTL) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccountDaysTTLView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_accountDaysTTL);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPaccountDaysTTLView> MTPAccountDaysTTLView;
+
+class MTPaccount_sentChangePhoneCodeView {
+public:
+	MTPaccount_sentChangePhoneCodeView() : _data(0) {
+	}
+
+	const MTPDaccount_sentChangePhoneCodeView &c_account_sentChangePhoneCode() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDaccount_sentChangePhoneCodeView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_account_sentChangePhoneCode;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_account_sentChangePhoneCode) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_sentChangePhoneCodeView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_account_sentChangePhoneCode);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPaccount_sentChangePhoneCodeView> MTPaccount_SentChangePhoneCodeView;
+
+class MTPdocumentAttributeView {
+public:
+	MTPdocumentAttributeView() : _data(0), _type(0) {
+	}
+
+	const MTPDdocumentAttributeImageSizeView &c_documentAttributeImageSize() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_documentAttributeImageSize) throw mtpErrorWrongTypeId(_type, mtpc_documentAttributeImageSize);
+		return *(const MTPDdocumentAttributeImageSizeView*)_data;
+	}
+	const MTPDdocumentAttributeStickerView &c_documentAttributeSticker() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_documentAttributeSticker) throw mtpErrorWrongTypeId(_type, mtpc_documentAttributeSticker);
+		return *(const MTPDdocumentAttributeStickerView*)_data;
+	}
+	const MTPDdocumentAttributeVideoView &c_documentAttributeVideo() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_documentAttributeVideo) throw mtpErrorWrongTypeId(_type, mtpc_documentAttributeVideo);
+		return *(const MTPDdocumentAttributeVideoView*)_data;
+	}
+	const MTPDdocumentAttributeAudioView &c_documentAttributeAudio() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_documentAttributeAudio) throw mtpErrorWrongTypeId(_type, mtpc_documentAttributeAudio);
+		return *(const MTPDdocumentAttributeAudioView*)_data;
+	}
+	const MTPDdocumentAttributeFilenameView &c_documentAttributeFilename() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_documentAttributeFilename) throw mtpErrorWrongTypeId(_type, mtpc_documentAttributeFilename);
+		return *(const MTPDdocumentAttributeFilenameView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPdocumentAttributeView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPdocumentAttributeView> MTPDocumentAttributeView;
+
+class MTPmessages_stickersView {
+public:
+	MTPmessages_stickersView() : _data(0), _type(0) {
+	}
+
+	const MTPDmessages_stickersView &c_messages_stickers() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messages_stickers) throw mtpErrorWrongTypeId(_type, mtpc_messages_stickers);
+		return *(const MTPDmessages_stickersView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_stickersView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPmessages_stickersView> MTPmessages_StickersView;
+
+class MTPstickerPackView {
+public:
+	MTPstickerPackView() : _data(0) {
+	}
+
+	const MTPDstickerPackView &c_stickerPack() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDstickerPackView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_stickerPack;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_stickerPack) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPstickerPackView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_stickerPack);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPstickerPackView> MTPStickerPackView;
+
+class MTPmessages_allStickersView {
+public:
+	MTPmessages_allStickersView() : _data(0), _type(0) {
+	}
+
+	const MTPDmessages_allStickersView &c_messages_allStickers() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_messages_allStickers) throw mtpErrorWrongTypeId(_type, mtpc_messages_allStickers);
+		return *(const MTPDmessages_allStickersView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_allStickersView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPmessages_allStickersView> MTPmessages_AllStickersView;
+
+class MTPdisabledFeatureView {
+public:
+	MTPdisabledFeatureView() : _data(0) {
+	}
+
+	const MTPDdisabledFeatureView &c_disabledFeature() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDdisabledFeatureView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_disabledFeature;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_disabledFeature) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPdisabledFeatureView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_disabledFeature);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPdisabledFeatureView> MTPDisabledFeatureView;
+
+class MTPmessages_affectedMessagesView {
+public:
+	MTPmessages_affectedMessagesView() : _data(0) {
+	}
+
+	const MTPDmessages_affectedMessagesView &c_messages_affectedMessages() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDmessages_affectedMessagesView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_messages_affectedMessages;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_messages_affectedMessages) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_affectedMessagesView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_messages_affectedMessages);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPmessages_affectedMessagesView> MTPmessages_AffectedMessagesView;
+
+class MTPcontactLinkView {
+public:
+	MTPcontactLinkView() : _type(0) {
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPcontactLinkView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPcontactLinkView> MTPContactLinkView;
+
+class MTPwebPageView {
+public:
+	MTPwebPageView() : _data(0), _type(0) {
+	}
+
+	const MTPDwebPageEmptyView &c_webPageEmpty() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_webPageEmpty) throw mtpErrorWrongTypeId(_type, mtpc_webPageEmpty);
+		return *(const MTPDwebPageEmptyView*)_data;
+	}
+	const MTPDwebPagePendingView &c_webPagePending() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_webPagePending) throw mtpErrorWrongTypeId(_type, mtpc_webPagePending);
+		return *(const MTPDwebPagePendingView*)_data;
+	}
+	const MTPDwebPageView &c_webPage() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_webPage) throw mtpErrorWrongTypeId(_type, mtpc_webPage);
+		return *(const MTPDwebPageView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPwebPageView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPwebPageView> MTPWebPageView;
+
+class MTPauthorizationView {
+public:
+	MTPauthorizationView() : _data(0) {
+	}
+
+	const MTPDauthorizationView &c_authorization() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDauthorizationView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_authorization;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_authorization) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauthorizationView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_authorization);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPauthorizationView> MTPAuthorizationView;
+
+class MTPaccount_authorizationsView {
+public:
+	MTPaccount_authorizationsView() : _data(0) {
+	}
+
+	const MTPDaccount_authorizationsView &c_account_authorizations() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDaccount_authorizationsView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_account_authorizations;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_account_authorizations) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_authorizationsView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_account_authorizations);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPaccount_authorizationsView> MTPaccount_AuthorizationsView;
+
+class MTPaccount_passwordView {
+public:
+	MTPaccount_passwordView() : _data(0), _type(0) {
+	}
+
+	const MTPDaccount_noPasswordView &c_account_noPassword() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_account_noPassword) throw mtpErrorWrongTypeId(_type, mtpc_account_noPassword);
+		return *(const MTPDaccount_noPasswordView*)_data;
+	}
+	const MTPDaccount_passwordView &c_account_password() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_account_password) throw mtpErrorWrongTypeId(_type, mtpc_account_password);
+		return *(const MTPDaccount_passwordView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_passwordView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPaccount_passwordView> MTPaccount_PasswordView;
+
+class MTPaccount_passwordSettingsView {
+public:
+	MTPaccount_passwordSettingsView() : _data(0) {
+	}
+
+	const MTPDaccount_passwordSettingsView &c_account_passwordSettings() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDaccount_passwordSettingsView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_account_passwordSettings;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_account_passwordSettings) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_passwordSettingsView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_account_passwordSettings);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPaccount_passwordSettingsView> MTPaccount_PasswordSettingsView;
+
+class MTPaccount_passwordInputSettingsView {
+public:
+	MTPaccount_passwordInputSettingsView() : _data(0) {
+	}
+
+	const MTPDaccount_passwordInputSettingsView &c_account_passwordInputSettings() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDaccount_passwordInputSettingsView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_account_passwordInputSettings;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_account_passwordInputSettings) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPaccount_passwordInputSettingsView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_account_passwordInputSettings);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPaccount_passwordInputSettingsView> MTPaccount_PasswordInputSettingsView;
+
+class MTPauth_passwordRecoveryView {
+public:
+	MTPauth_passwordRecoveryView() : _data(0) {
+	}
+
+	const MTPDauth_passwordRecoveryView &c_auth_passwordRecovery() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDauth_passwordRecoveryView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_auth_passwordRecovery;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_auth_passwordRecovery) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPauth_passwordRecoveryView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_auth_passwordRecovery);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPauth_passwordRecoveryView> MTPauth_PasswordRecoveryView;
+
+class MTPreceivedNotifyMessageView {
+public:
+	MTPreceivedNotifyMessageView() : _data(0) {
+	}
+
+	const MTPDreceivedNotifyMessageView &c_receivedNotifyMessage() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDreceivedNotifyMessageView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_receivedNotifyMessage;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_receivedNotifyMessage) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPreceivedNotifyMessageView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_receivedNotifyMessage);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPreceivedNotifyMessageView> MTPReceivedNotifyMessageView;
+
+class MTPexportedChatInviteView {
+public:
+	MTPexportedChatInviteView() : _data(0), _type(0) {
+	}
+
+	const MTPDchatInviteExportedView &c_chatInviteExported() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_chatInviteExported) throw mtpErrorWrongTypeId(_type, mtpc_chatInviteExported);
+		return *(const MTPDchatInviteExportedView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPexportedChatInviteView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPexportedChatInviteView> MTPExportedChatInviteView;
+
+class MTPchatInviteView {
+public:
+	MTPchatInviteView() : _data(0), _type(0) {
+	}
+
+	const MTPDchatInviteAlreadyView &c_chatInviteAlready() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_chatInviteAlready) throw mtpErrorWrongTypeId(_type, mtpc_chatInviteAlready);
+		return *(const MTPDchatInviteAlreadyView*)_data;
+	}
+	const MTPDchatInviteView &c_chatInvite() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_chatInvite) throw mtpErrorWrongTypeId(_type, mtpc_chatInvite);
+		return *(const MTPDchatInviteView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPchatInviteView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPchatInviteView> MTPChatInviteView;
+
+class MTPinputStickerSetView {
+public:
+	MTPinputStickerSetView() : _data(0), _type(0) {
+	}
+
+	const MTPDinputStickerSetIDView &c_inputStickerSetID() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputStickerSetID) throw mtpErrorWrongTypeId(_type, mtpc_inputStickerSetID);
+		return *(const MTPDinputStickerSetIDView*)_data;
+	}
+	const MTPDinputStickerSetShortNameView &c_inputStickerSetShortName() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_inputStickerSetShortName) throw mtpErrorWrongTypeId(_type, mtpc_inputStickerSetShortName);
+		return *(const MTPDinputStickerSetShortNameView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPinputStickerSetView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPinputStickerSetView> MTPInputStickerSetView;
+
+class MTPstickerSetView {
+public:
+	MTPstickerSetView() : _data(0) {
+	}
+
+	const MTPDstickerSetView &c_stickerSet() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDstickerSetView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_stickerSet;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_stickerSet) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPstickerSetView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_stickerSet);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPstickerSetView> MTPStickerSetView;
+
+class MTPmessages_stickerSetView {
+public:
+	MTPmessages_stickerSetView() : _data(0) {
+	}
+
+	const MTPDmessages_stickerSetView &c_messages_stickerSet() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDmessages_stickerSetView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_messages_stickerSet;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_messages_stickerSet) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPmessages_stickerSetView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_messages_stickerSet);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPmessages_stickerSetView> MTPmessages_StickerSetView;
+
+class MTPbotCommandView {
+public:
+	MTPbotCommandView() : _data(0) {
+	}
+
+	const MTPDbotCommandView &c_botCommand() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDbotCommandView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_botCommand;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_botCommand) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPbotCommandView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_botCommand);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPbotCommandView> MTPBotCommandView;
+
+class MTPbotInfoView {
+public:
+	MTPbotInfoView() : _data(0), _type(0) {
+	}
+
+	const MTPDbotInfoView &c_botInfo() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_botInfo) throw mtpErrorWrongTypeId(_type, mtpc_botInfo);
+		return *(const MTPDbotInfoView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPbotInfoView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPbotInfoView> MTPBotInfoView;
+
+class MTPkeyboardButtonView {
+public:
+	MTPkeyboardButtonView() : _data(0) {
+	}
+
+	const MTPDkeyboardButtonView &c_keyboardButton() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDkeyboardButtonView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_keyboardButton;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_keyboardButton) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPkeyboardButtonView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_keyboardButton);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPkeyboardButtonView> MTPKeyboardButtonView;
+
+class MTPkeyboardButtonRowView {
+public:
+	MTPkeyboardButtonRowView() : _data(0) {
+	}
+
+	const MTPDkeyboardButtonRowView &c_keyboardButtonRow() const {
+		if (!_data) throw mtpErrorUninitialized();
+		return *(const MTPDkeyboardButtonRowView*)_data;
+	}
+
+	mtpTypeId type() const {
+		return mtpc_keyboardButtonRow;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_keyboardButtonRow) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPkeyboardButtonRowView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons = mtpc_keyboardButtonRow);
+
+private:
+	const void *_data;
+};
+typedef MTPBoxedView<MTPkeyboardButtonRowView> MTPKeyboardButtonRowView;
+
+class MTPreplyMarkupView {
+public:
+	MTPreplyMarkupView() : _data(0), _type(0) {
+	}
+
+	const MTPDreplyKeyboardHideView &c_replyKeyboardHide() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_replyKeyboardHide) throw mtpErrorWrongTypeId(_type, mtpc_replyKeyboardHide);
+		return *(const MTPDreplyKeyboardHideView*)_data;
+	}
+	const MTPDreplyKeyboardForceReplyView &c_replyKeyboardForceReply() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_replyKeyboardForceReply) throw mtpErrorWrongTypeId(_type, mtpc_replyKeyboardForceReply);
+		return *(const MTPDreplyKeyboardForceReplyView*)_data;
+	}
+	const MTPDreplyKeyboardMarkupView &c_replyKeyboardMarkup() const {
+		if (!_data) throw mtpErrorUninitialized();
+		if (_type != mtpc_replyKeyboardMarkup) throw mtpErrorWrongTypeId(_type, mtpc_replyKeyboardMarkup);
+		return *(const MTPDreplyKeyboardMarkupView*)_data;
+	}
+
+	mtpTypeId type() const {
+		if (!_type) throw mtpErrorUninitialized();
+		return _type;
+	}
+	void read(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+		mtpReadResult result = tryRead(from, end, arena, cons);
+		if (result != mtpReadDone) mtpReadFailed(result, cons, "MTPreplyMarkupView");
+	}
+	mtpReadResult tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons);
+
+private:
+	const void *_data;
+	mtpTypeId _type;
+};
+typedef MTPBoxedView<MTPreplyMarkupView> MTPReplyMarkupView;
+
+// Read-only views of constructors with data
+
+class MTPDresPQView {
+public:
+	MTPint128 vnonce;
+	MTPint128 vserver_nonce;
+	MTPstringView vpq;
+	MTPVectorView<MTPlong > vserver_public_key_fingerprints;
+};
+
+class MTPDp_q_inner_dataView {
+public:
+	MTPstringView vpq;
+	MTPstringView vp;
+	MTPstringView vq;
+	MTPint128 vnonce;
+	MTPint128 vserver_nonce;
+	MTPint256 vnew_nonce;
+};
+
+class MTPDserver_DH_params_failView {
+public:
+	MTPint128 vnonce;
+	MTPint128 vserver_nonce;
+	MTPint128 vnew_nonce_hash;
+};
+
+class MTPDserver_DH_params_okView {
+public:
+	MTPint128 vnonce;
+	MTPint128 vserver_nonce;
+	MTPstringView vencrypted_answer;
+};
+
+class MTPDserver_DH_inner_dataView {
+public:
+	MTPint128 vnonce;
+	MTPint128 vserver_nonce;
+	MTPint vg;
+	MTPstringView vdh_prime;
+	MTPstringView vg_a;
+	MTPint vserver_time;
+};
+
+class MTPDclient_DH_inner_dataView {
+public:
+	MTPint128 vnonce;
+	MTPint128 vserver_nonce;
+	MTPlong vretry_id;
+	MTPstringView vg_b;
+};
+
+class MTPDdh_gen_okView {
+public:
+	MTPint128 vnonce;
+	MTPint128 vserver_nonce;
+	MTPint128 vnew_nonce_hash1;
+};
+
+class MTPDdh_gen_retryView {
+public:
+	MTPint128 vnonce;
+	MTPint128 vserver_nonce;
+	MTPint128 vnew_nonce_hash2;
+};
+
+class MTPDdh_gen_failView {
+public:
+	MTPint128 vnonce;
+	MTPint128 vserver_nonce;
+	MTPint128 vnew_nonce_hash3;
+};
+
+class MTPDmsgs_ackView {
+public:
+	MTPVectorView<MTPlong > vmsg_ids;
+};
+
+class MTPDbad_msg_notificationView {
+public:
+	MTPlong vbad_msg_id;
+	MTPint vbad_msg_seqno;
+	MTPint verror_code;
+};
+
+class MTPDbad_server_saltView {
+public:
+	MTPlong vbad_msg_id;
+	MTPint vbad_msg_seqno;
+	MTPint verror_code;
+	MTPlong vnew_server_salt;
+};
+
+class MTPDmsgs_state_reqView {
+public:
+	MTPVectorView<MTPlong > vmsg_ids;
+};
+
+class MTPDmsgs_state_infoView {
+public:
+	MTPlong vreq_msg_id;
+	MTPstringView vinfo;
+};
+
+class MTPDmsgs_all_infoView {
+public:
+	MTPVectorView<MTPlong > vmsg_ids;
+	MTPstringView vinfo;
+};
+
+class MTPDmsg_detailed_infoView {
+public:
+	MTPlong vmsg_id;
+	MTPlong vanswer_msg_id;
+	MTPint vbytes;
+	MTPint vstatus;
+};
+
+class MTPDmsg_new_detailed_infoView {
+public:
+	MTPlong vanswer_msg_id;
+	MTPint vbytes;
+	MTPint vstatus;
+};
+
+class MTPDmsg_resend_reqView {
+public:
+	MTPVectorView<MTPlong > vmsg_ids;
+};
+
+class MTPDrpc_errorView {
+public:
+	MTPint verror_code;
+	MTPstringView verror_message;
+};
+
+class MTPDrpc_answer_droppedView {
+public:
+	MTPlong vmsg_id;
+	MTPint vseq_no;
+	MTPint vbytes;
+};
+
+class MTPDfuture_saltView {
+public:
+	MTPint vvalid_since;
+	MTPint vvalid_until;
+	MTPlong vsalt;
+};
+
+class MTPDfuture_saltsView {
+public:
+	MTPlong vreq_msg_id;
+	MTPint vnow;
+	MTPvectorView<MTPfutureSaltView > vsalts;
+};
+
+class MTPDpongView {
+public:
+	MTPlong vmsg_id;
+	MTPlong vping_id;
+};
+
+class MTPDdestroy_session_okView {
+public:
+	MTPlong vsession_id;
+};
+
+class MTPDdestroy_session_noneView {
+public:
+	MTPlong vsession_id;
+};
+
+class MTPDnew_session_createdView {
+public:
+	MTPlong vfirst_msg_id;
+	MTPlong vunique_id;
+	MTPlong vserver_salt;
+};
+
+class MTPDhttp_waitView {
+public:
+	MTPint vmax_delay;
+	MTPint vwait_after;
+	MTPint vmax_wait;
+};
+
+class MTPDerrorView {
+public:
+	MTPint vcode;
+	MTPstringView vtext;
+};
+
+class MTPDinputPeerContactView {
+public:
+	MTPint vuser_id;
+};
+
+class MTPDinputPeerForeignView {
+public:
+	MTPint vuser_id;
+	MTPlong vaccess_hash;
+};
+
+class MTPDinputPeerChatView {
+public:
+	MTPint vchat_id;
+};
+
+class MTPDinputUserContactView {
+public:
+	MTPint vuser_id;
+};
+
+class MTPDinputUserForeignView {
+public:
+	MTPint vuser_id;
+	MTPlong vaccess_hash;
+};
+
+class MTPDinputPhoneContactView {
+public:
+	MTPlong vclient_id;
+	MTPstringView vphone;
+	MTPstringView vfirst_name;
+	MTPstringView vlast_name;
+};
+
+class MTPDinputFileView {
+public:
+	MTPlong vid;
+	MTPint vparts;
+	MTPstringView vname;
+	MTPstringView vmd5_checksum;
+};
+
+class MTPDinputFileBigView {
+public:
+	MTPlong vid;
+	MTPint vparts;
+	MTPstringView vname;
+};
+
+class MTPDinputMediaUploadedPhotoView {
+public:
+	MTPInputFileView vfile;
+	MTPstringView vcaption;
+};
+
+class MTPDinputMediaPhotoView {
+public:
+	MTPInputPhotoView vid;
+	MTPstringView vcaption;
+};
+
+class MTPDinputMediaGeoPointView {
+public:
+	MTPInputGeoPointView vgeo_point;
+};
+
+class MTPDinputMediaContactView {
+public:
+	MTPstringView vphone_number;
+	MTPstringView vfirst_name;
+	MTPstringView vlast_name;
+};
+
+class MTPDinputMediaUploadedVideoView {
+public:
+	MTPInputFileView vfile;
+	MTPint vduration;
+	MTPint vw;
+	MTPint vh;
+	MTPstringView vcaption;
+};
+
+class MTPDinputMediaUploadedThumbVideoView {
+public:
+	MTPInputFileView vfile;
+	MTPInputFileView vthumb;
+	MTPint vduration;
+	MTPint vw;
+	MTPint vh;
+	MTPstringView vcaption;
+};
+
+class MTPDinputMediaVideoView {
+public:
+	MTPInputVideoView vid;
+	MTPstringView vcaption;
+};
+
+class MTPDinputMediaUploadedAudioView {
+public:
+	MTPInputFileView vfile;
+	MTPint vduration;
+	MTPstringView vmime_type;
+};
+
+class MTPDinputMediaAudioView {
+public:
+	MTPInputAudioView vid;
+};
+
+class MTPDinputMediaUploadedDocumentView {
+public:
+	MTPInputFileView vfile;
+	MTPstringView vmime_type;
+	MTPVectorView<MTPDocumentAttributeView > vattributes;
+};
+
+class MTPDinputMediaUploadedThumbDocumentView {
+public:
+	MTPInputFileView vfile;
+	MTPInputFileView vthumb;
+	MTPstringView vmime_type;
+	MTPVectorView<MTPDocumentAttributeView > vattributes;
+};
+
+class MTPDinputMediaDocumentView {
+public:
+	MTPInputDocumentView vid;
+};
+
+class MTPDinputMediaVenueView {
+public:
+	MTPInputGeoPointView vgeo_point;
+	MTPstringView vtitle;
+	MTPstringView vaddress;
+	MTPstringView vprovider;
+	MTPstringView vvenue_id;
+};
+
+class MTPDinputChatUploadedPhotoView {
+public:
+	MTPInputFileView vfile;
+	MTPInputPhotoCropView vcrop;
+};
+
+class MTPDinputChatPhotoView {
+public:
+	MTPInputPhotoView vid;
+	MTPInputPhotoCropView vcrop;
+};
+
+class MTPDinputGeoPointView {
+public:
+	MTPdouble vlat;
+	MTPdouble vlong;
+};
+
+class MTPDinputPhotoView {
+public:
+	MTPlong vid;
+	MTPlong vaccess_hash;
+};
+
+class MTPDinputVideoView {
+public:
+	MTPlong vid;
+	MTPlong vaccess_hash;
+};
+
+class MTPDinputFileLocationView {
+public:
+	MTPlong vvolume_id;
+	MTPint vlocal_id;
+	MTPlong vsecret;
+};
+
+class MTPDinputVideoFileLocationView {
+public:
+	MTPlong vid;
+	MTPlong vaccess_hash;
+};
+
+class MTPDinputEncryptedFileLocationView {
+public:
+	MTPlong vid;
+	MTPlong vaccess_hash;
+};
+
+class MTPDinputAudioFileLocationView {
+public:
+	MTPlong vid;
+	MTPlong vaccess_hash;
+};
+
+class MTPDinputDocumentFileLocationView {
+public:
+	MTPlong vid;
+	MTPlong vaccess_hash;
+};
+
+class MTPDinputPhotoCropView {
+public:
+	MTPdouble vcrop_left;
+	MTPdouble vcrop_top;
+	MTPdouble vcrop_width;
+};
+
+class MTPDinputAppEventView {
+public:
+	MTPdouble vtime;
+	MTPstringView vtype;
+	MTPlong vpeer;
+	MTPstringView vdata;
+};
+
+class MTPDpeerUserView {
+public:
+	MTPint vuser_id;
+};
+
+class MTPDpeerChatView {
+public:
+	MTPint vchat_id;
+};
+
+class MTPDfileLocationUnavailableView {
+public:
+	MTPlong vvolume_id;
+	MTPint vlocal_id;
+	MTPlong vsecret;
+};
+
+class MTPDfileLocationView {
+public:
+	MTPint vdc_id;
+	MTPlong vvolume_id;
+	MTPint vlocal_id;
+	MTPlong vsecret;
+};
+
+class MTPDuserEmptyView {
+public:
+	MTPint vid;
+};
+
+class MTPDuserView {
+public:
+	MTPint vflags;
+	MTPint vid;
+	MTPlong vaccess_hash;
+	MTPstringView vfirst_name;
+	MTPstringView vlast_name;
+	MTPstringView vusername;
+	MTPstringView vphone;
+	MTPUserProfilePhotoView vphoto;
+	MTPUserStatusView vstatus;
+	MTPint vbot_info_version;
+
+	enum {
+		flag_access_hash = (1 << 0),
+		flag_first_name = (1 << 1),
+		flag_last_name = (1 << 2),
+		flag_username = (1 << 3),
+		flag_phone = (1 << 4),
+		flag_photo = (1 << 5),
+		flag_status = (1 << 6),
+		flag_bot_info_version = (1 << 14),
+	};
+
+	bool has_access_hash() const { return vflags.v & flag_access_hash; }
+	bool has_first_name() const { return vflags.v & flag_first_name; }
+	bool has_last_name() const { return vflags.v & flag_last_name; }
+	bool has_username() const { return vflags.v & flag_username; }
+	bool has_phone() const { return vflags.v & flag_phone; }
+	bool has_photo() const { return vflags.v & flag_photo; }
+	bool has_status() const { return vflags.v & flag_status; }
+	bool has_bot_info_version() const { return vflags.v & flag_bot_info_version; }
+};
+
+class MTPDuserProfilePhotoView {
+public:
+	MTPlong vphoto_id;
+	MTPFileLocationView vphoto_small;
+	MTPFileLocationView vphoto_big;
+};
+
+class MTPDuserStatusOnlineView {
+public:
+	MTPint vexpires;
+};
+
+class MTPDuserStatusOfflineView {
+public:
+	MTPint vwas_online;
+};
+
+class MTPDchatEmptyView {
+public:
+	MTPint vid;
+};
+
+class MTPDchatView {
+public:
+	MTPint vid;
+	MTPstringView vtitle;
+	MTPChatPhotoView vphoto;
+	MTPint vparticipants_count;
+	MTPint vdate;
+	MTPBool vleft;
+	MTPint vversion;
+};
+
+class MTPDchatForbiddenView {
+public:
+	MTPint vid;
+	MTPstringView vtitle;
+	MTPint vdate;
+};
+
+class MTPDgeoChatView {
+public:
+	MTPint vid;
+	MTPlong vaccess_hash;
+	MTPstringView vtitle;
+	MTPstringView vaddress;
+	MTPstringView vvenue;
+	MTPGeoPointView vgeo;
+	MTPChatPhotoView vphoto;
+	MTPint vparticipants_count;
+	MTPint vdate;
+	MTPBool vchecked_in;
+	MTPint vversion;
+};
+
+class MTPDchatFullView {
+public:
+	MTPint vid;
+	MTPChatParticipantsView vparticipants;
+	MTPPhotoView vchat_photo;
+	MTPPeerNotifySettingsView vnotify_settings;
+	MTPExportedChatInviteView vexported_invite;
+	MTPVectorView<MTPBotInfoView > vbot_info;
+};
+
+class MTPDchatParticipantView {
+public:
+	MTPint vuser_id;
+	MTPint vinviter_id;
+	MTPint vdate;
+};
+
+class MTPDchatParticipantsForbiddenView {
+public:
+	MTPint vchat_id;
+};
+
+class MTPDchatParticipantsView {
+public:
+	MTPint vchat_id;
+	MTPint vadmin_id;
+	MTPVectorView<MTPChatParticipantView > vparticipants;
+	MTPint vversion;
+};
+
+class MTPDchatPhotoView {
+public:
+	MTPFileLocationView vphoto_small;
+	MTPFileLocationView vphoto_big;
+};
+
+class MTPDmessageEmptyView {
+public:
+	MTPint vid;
+};
+
+class MTPDmessageView {
+public:
+	MTPint vflags;
+	MTPint vid;
+	MTPint vfrom_id;
+	MTPPeerView vto_id;
+	MTPint vfwd_from_id;
+	MTPint vfwd_date;
+	MTPint vreply_to_msg_id;
+	MTPint vdate;
+	MTPstringView vmessage;
+	MTPMessageMediaView vmedia;
+	MTPReplyMarkupView vreply_markup;
+
+	enum {
+		flag_fwd_from_id = (1 << 2),
+		flag_fwd_date = (1 << 2),
+		flag_reply_to_msg_id = (1 << 3),
+		flag_reply_markup = (1 << 6),
+	};
+
+	bool has_fwd_from_id() const { return vflags.v & flag_fwd_from_id; }
+	bool has_fwd_date() const { return vflags.v & flag_fwd_date; }
+	bool has_reply_to_msg_id() const { return vflags.v & flag_reply_to_msg_id; }
+	bool has_reply_markup() const { return vflags.v & flag_reply_markup; }
+};
+
+class MTPDmessageServiceView {
+public:
+	MTPint vflags;
+	MTPint vid;
+	MTPint vfrom_id;
+	MTPPeerView vto_id;
+	MTPint vdate;
+	MTPMessageActionView vaction;
+};
+
+class MTPDmessageMediaPhotoView {
+public:
+	MTPPhotoView vphoto;
+	MTPstringView vcaption;
+};
+
+class MTPDmessageMediaVideoView {
+public:
+	MTPVideoView vvideo;
+	MTPstringView vcaption;
+};
+
+class MTPDmessageMediaGeoView {
+public:
+	MTPGeoPointView vgeo;
+};
+
+class MTPDmessageMediaContactView {
+public:
+	MTPstringView vphone_number;
+	MTPstringView vfirst_name;
+	MTPstringView vlast_name;
+	MTPint vuser_id;
+};
+
+class MTPDmessageMediaDocumentView {
+public:
+	MTPDocumentView vdocument;
+};
+
+class MTPDmessageMediaAudioView {
+public:
+	MTPAudioView vaudio;
+};
+
+class MTPDmessageMediaWebPageView {
+public:
+	MTPWebPageView vwebpage;
+};
+
+class MTPDmessageMediaVenueView {
+public:
+	MTPGeoPointView vgeo;
+	MTPstringView vtitle;
+	MTPstringView vaddress;
+	MTPstringView vprovider;
+	MTPstringView vvenue_id;
+};
+
+class MTPDmessageActionChatCreateView {
+public:
+	MTPstringView vtitle;
+	MTPVectorView<MTPint > vusers;
+};
+
+class MTPDmessageActionChatEditTitleView {
+public:
+	MTPstringView vtitle;
+};
+
+class MTPDmessageActionChatEditPhotoView {
+public:
+	MTPPhotoView vphoto;
+};
+
+class MTPDmessageActionChatAddUserView {
+public:
+	MTPint vuser_id;
+};
+
+class MTPDmessageActionChatDeleteUserView {
+public:
+	MTPint vuser_id;
+};
+
+class MTPDmessageActionGeoChatCreateView {
+public:
+	MTPstringView vtitle;
+	MTPstringView vaddress;
+};
+
+class MTPDmessageActionChatJoinedByLinkView {
+public:
+	MTPint vinviter_id;
+};
+
+class MTPDdialogView {
+public:
+	MTPPeerView vpeer;
+	MTPint vtop_message;
+	MTPint vread_inbox_max_id;
+	MTPint vunread_count;
+	MTPPeerNotifySettingsView vnotify_settings;
+};
+
+class MTPDphotoEmptyView {
+public:
+	MTPlong vid;
+};
+
+class MTPDphotoView {
+public:
+	MTPlong vid;
+	MTPlong vaccess_hash;
+	MTPint vuser_id;
+	MTPint vdate;
+	MTPGeoPointView vgeo;
+	MTPVectorView<MTPPhotoSizeView > vsizes;
+};
+
+class MTPDphotoSizeEmptyView {
+public:
+	MTPstringView vtype;
+};
+
+class MTPDphotoSizeView {
+public:
+	MTPstringView vtype;
+	MTPFileLocationView vlocation;
+	MTPint vw;
+	MTPint vh;
+	MTPint vsize;
+};
+
+class MTPDphotoCachedSizeView {
+public:
+	MTPstringView vtype;
+	MTPFileLocationView vlocation;
+	MTPint vw;
+	MTPint vh;
+	MTPbytesView vbytes;
+};
+
+class MTPDvideoEmptyView {
+public:
+	MTPlong vid;
+};
+
+class MTPDvideoView {
+public:
+	MTPlong vid;
+	MTPlong vaccess_hash;
+	MTPint vuser_id;
+	MTPint vdate;
+	MTPint vduration;
+	MTPint vsize;
+	MTPPhotoSizeView vthumb;
+	MTPint vdc_id;
+	MTPint vw;
+	MTPint vh;
+};
+
+class MTPDgeoPointView {
+public:
+	MTPdouble vlong;
+	MTPdouble vlat;
+};
+
+class MTPDauth_checkedPhoneView {
+public:
+	MTPBool vphone_registered;
+};
+
+class MTPDauth_sentCodeView {
+public:
+	MTPBool vphone_registered;
+	MTPstringView vphone_code_hash;
+	MTPint vsend_call_timeout;
+	MTPBool vis_password;
+};
+
+class MTPDauth_sentAppCodeView {
+public:
+	MTPBool vphone_registered;
+	MTPstringView vphone_code_hash;
+	MTPint vsend_call_timeout;
+	MTPBool vis_password;
+};
+
+class MTPDauth_authorizationView {
+public:
+	MTPUserView vuser;
+};
+
+class MTPDauth_exportedAuthorizationView {
+public:
+	MTPint vid;
+	MTPbytesView vbytes;
+};
+
+class MTPDinputNotifyPeerView {
+public:
+	MTPInputPeerView vpeer;
+};
+
+class MTPDinputNotifyGeoChatPeerView {
+public:
+	MTPInputGeoChatView vpeer;
+};
+
+class MTPDinputPeerNotifySettingsView {
+public:
+	MTPint vmute_until;
+	MTPstringView vsound;
+	MTPBool vshow_previews;
+	MTPint vevents_mask;
+};
+
+class MTPDpeerNotifySettingsView {
+public:
+	MTPint vmute_until;
+	MTPstringView vsound;
+	MTPBool vshow_previews;
+	MTPint vevents_mask;
+};
+
+class MTPDwallPaperView {
+public:
+	MTPint vid;
+	MTPstringView vtitle;
+	MTPVectorView<MTPPhotoSizeView > vsizes;
+	MTPint vcolor;
+};
+
+class MTPDwallPaperSolidView {
+public:
+	MTPint vid;
+	MTPstringView vtitle;
+	MTPint vbg_color;
+	MTPint vcolor;
+};
+
+class MTPDuserFullView {
+public:
+	MTPUserView vuser;
+	MTPcontacts_LinkView vlink;
+	MTPPhotoView vprofile_photo;
+	MTPPeerNotifySettingsView vnotify_settings;
+	MTPBool vblocked;
+	MTPBotInfoView vbot_info;
+};
+
+class MTPDcontactView {
+public:
+	MTPint vuser_id;
+	MTPBool vmutual;
+};
+
+class MTPDimportedContactView {
+public:
+	MTPint vuser_id;
+	MTPlong vclient_id;
+};
+
+class MTPDcontactBlockedView {
+public:
+	MTPint vuser_id;
+	MTPint vdate;
+};
+
+class MTPDcontactSuggestedView {
+public:
+	MTPint vuser_id;
+	MTPint vmutual_contacts;
+};
+
+class MTPDcontactStatusView {
+public:
+	MTPint vuser_id;
+	MTPUserStatusView vstatus;
+};
+
+class MTPDchatLocatedView {
+public:
+	MTPint vchat_id;
+	MTPint vdistance;
+};
+
+class MTPDcontacts_linkView {
+public:
+	MTPContactLinkView vmy_link;
+	MTPContactLinkView vforeign_link;
+	MTPUserView vuser;
+};
+
+class MTPDcontacts_contactsView {
+public:
+	MTPVectorView<MTPContactView > vcontacts;
+	MTPVectorView<MTPUserView > vusers;
+};
+
+class MTPDcontacts_importedContactsView {
+public:
+	MTPVectorView<MTPImportedContactView > vimported;
+	MTPVectorView<MTPlong > vretry_contacts;
+	MTPVectorView<MTPUserView > vusers;
+};
+
+class MTPDcontacts_blockedView {
+public:
+	MTPVectorView<MTPContactBlockedView > vblocked;
+	MTPVectorView<MTPUserView > vusers;
+};
+
+class MTPDcontacts_blockedSliceView {
+public:
+	MTPint vcount;
+	MTPVectorView<MTPContactBlockedView > vblocked;
+	MTPVectorView<MTPUserView > vusers;
+};
+
+class MTPDcontacts_suggestedView {
+public:
+	MTPVectorView<MTPContactSuggestedView > vresults;
+	MTPVectorView<MTPUserView > vusers;
+};
+
+class MTPDmessages_dialogsView {
+public:
+	MTPVectorView<MTPDialogView > vdialogs;
+	MTPVectorView<MTPMessageView > vmessages;
+	MTPVectorView<MTPChatView > vchats;
+	MTPVectorView<MTPUserView > vusers;
+};
+
+class MTPDmessages_dialogsSliceView {
+public:
+	MTPint vcount;
+	MTPVectorView<MTPDialogView > vdialogs;
+	MTPVectorView<MTPMessageView > vmessages;
+	MTPVectorView<MTPChatView > vchats;
+	MTPVectorView<MTPUserView > vusers;
+};
+
+class MTPDmessages_messagesView {
+public:
+	MTPVectorView<MTPMessageView > vmessages;
+	MTPVectorView<MTPChatView > vchats;
+	MTPVectorView<MTPUserView > vusers;
+};
+
+class MTPDmessages_messagesSliceView {
+public:
+	MTPint vcount;
+	MTPVectorView<MTPMessageView > vmessages;
+	MTPVectorView<MTPChatView > vchats;
+	MTPVectorView<MTPUserView > vusers;
+};
+
+class MTPDmessages_sentMessageView {
+public:
+	MTPint vid;
+	MTPint vdate;
+	MTPMessageMediaView vmedia;
+	MTPint vpts;
+	MTPint vpts_count;
+};
+
+class MTPDmessages_sentMessageLinkView {
+public:
+	MTPint vid;
+	MTPint vdate;
+	MTPMessageMediaView vmedia;
+	MTPint vpts;
+	MTPint vpts_count;
+	MTPVectorView<MTPcontacts_LinkView > vlinks;
+	MTPint vseq;
+};
+
+class MTPDmessages_chatsView {
+public:
+	MTPVectorView<MTPChatView > vchats;
+};
+
+class MTPDmessages_chatFullView {
+public:
+	MTPChatFullView vfull_chat;
+	MTPVectorView<MTPChatView > vchats;
+	MTPVectorView<MTPUserView > vusers;
+};
+
+class MTPDmessages_affectedHistoryView {
+public:
+	MTPint vpts;
+	MTPint vpts_count;
+	MTPint voffset;
+};
+
+class MTPDupdateNewMessageView {
+public:
+	MTPMessageView vmessage;
+	MTPint vpts;
+	MTPint vpts_count;
+};
+
+class MTPDupdateMessageIDView {
+public:
+	MTPint vid;
+	MTPlong vrandom_id;
+};
+
+class MTPDupdateDeleteMessagesView {
+public:
+	MTPVectorView<MTPint > vmessages;
+	MTPint vpts;
+	MTPint vpts_count;
+};
+
+class MTPDupdateUserTypingView {
+public:
+	MTPint vuser_id;
+	MTPSendMessageActionView vaction;
+};
+
+class MTPDupdateChatUserTypingView {
+public:
+	MTPint vchat_id;
+	MTPint vuser_id;
+	MTPSendMessageActionView vaction;
+};
+
+class MTPDupdateChatParticipantsView {
+public:
+	MTPChatParticipantsView vparticipants;
+};
+
+class MTPDupdateUserStatusView {
+public:
+	MTPint vuser_id;
+	MTPUserStatusView vstatus;
+};
+
+class MTPDupdateUserNameView {
+public:
+	MTPint vuser_id;
+	MTPstringView vfirst_name;
+	MTPstringView vlast_name;
+	MTPstringView vusername;
+};
+
+class MTPDupdateUserPhotoView {
+public:
+	MTPint vuser_id;
+	MTPint vdate;
+	MTPUserProfilePhotoView vphoto;
+	MTPBool vprevious;
+};
+
+class MTPDupdateContactRegisteredView {
+public:
+	MTPint vuser_id;
+	MTPint vdate;
+};
+
+class MTPDupdateContactLinkView {
+public:
+	MTPint vuser_id;
+	MTPContactLinkView vmy_link;
+	MTPContactLinkView vforeign_link;
+};
+
+class MTPDupdateNewAuthorizationView {
+public:
+	MTPlong vauth_key_id;
+	MTPint vdate;
+	MTPstringView vdevice;
+	MTPstringView vlocation;
+};
+
+class MTPDupdateNewGeoChatMessageView {
+public:
+	MTPGeoChatMessageView vmessage;
+};
+
+class MTPDupdateNewEncryptedMessageView {
+public:
+	MTPEncryptedMessageView vmessage;
+	MTPint vqts;
+};
+
+class MTPDupdateEncryptedChatTypingView {
+public:
+	MTPint vchat_id;
+};
+
+class MTPDupdateEncryptionView {
+public:
+	MTPEncryptedChatView vchat;
+	MTPint vdate;
+};
+
+class MTPDupdateEncryptedMessagesReadView {
+public:
+	MTPint vchat_id;
+	MTPint vmax_date;
+	MTPint vdate;
+};
+
+class MTPDupdateChatParticipantAddView {
+public:
+	MTPint vchat_id;
+	MTPint vuser_id;
+	MTPint vinviter_id;
+	MTPint vversion;
+};
+
+class MTPDupdateChatParticipantDeleteView {
+public:
+	MTPint vchat_id;
+	MTPint vuser_id;
+	MTPint vversion;
+};
+
+class MTPDupdateDcOptionsView {
+public:
+	MTPVectorView<MTPDcOptionView > vdc_options;
+};
+
+class MTPDupdateUserBlockedView {
+public:
+	MTPint vuser_id;
+	MTPBool vblocked;
+};
+
+class MTPDupdateNotifySettingsView {
+public:
+	MTPNotifyPeerView vpeer;
+	MTPPeerNotifySettingsView vnotify_settings;
+};
+
+class MTPDupdateServiceNotificationView {
+public:
+	MTPstringView vtype;
+	MTPstringView vmessage;
+	MTPMessageMediaView vmedia;
+	MTPBool vpopup;
+};
+
+class MTPDupdatePrivacyView {
+public:
+	MTPPrivacyKeyView vkey;
+	MTPVectorView<MTPPrivacyRuleView > vrules;
+};
+
+class MTPDupdateUserPhoneView {
+public:
+	MTPint vuser_id;
+	MTPstringView vphone;
+};
+
+class MTPDupdateReadHistoryInboxView {
+public:
+	MTPPeerView vpeer;
+	MTPint vmax_id;
+	MTPint vpts;
+	MTPint vpts_count;
+};
+
+class MTPDupdateReadHistoryOutboxView {
+public:
+	MTPPeerView vpeer;
+	MTPint vmax_id;
+	MTPint vpts;
+	MTPint vpts_count;
+};
+
+class MTPDupdateWebPageView {
+public:
+	MTPWebPageView vwebpage;
+};
+
+class MTPDupdateReadMessagesContentsView {
+public:
+	MTPVectorView<MTPint > vmessages;
+	MTPint vpts;
+	MTPint vpts_count;
+};
+
+class MTPDupdates_stateView {
+public:
+	MTPint vpts;
+	MTPint vqts;
+	MTPint vdate;
+	MTPint vseq;
+	MTPint vunread_count;
+};
+
+class MTPDupdates_differenceEmptyView {
+public:
+	MTPint vdate;
+	MTPint vseq;
+};
+
+class MTPDupdates_differenceView {
+public:
+	MTPVectorView<MTPMessageView > vnew_messages;
+	MTPVectorView<MTPEncryptedMessageView > vnew_encrypted_messages;
+	MTPVectorView<MTPUpdateView > vother_updates;
+	MTPVectorView<MTPChatView > vchats;
+	MTPVectorView<MTPUserView > vusers;
+	MTPupdates_StateView vstate;
+};
+
+class MTPDupdates_differenceSliceView {
+public:
+	MTPVectorView<MTPMessageView > vnew_messages;
+	MTPVectorView<MTPEncryptedMessageView > vnew_encrypted_messages;
+	MTPVectorView<MTPUpdateView > vother_updates;
+	MTPVectorView<MTPChatView > vchats;
+	MTPVectorView<MTPUserView > vusers;
+	MTPupdates_StateView vintermediate_state;
+};
+
+class MTPDupdateShortMessageView {
+public:
+	MTPint vflags;
+	MTPint vid;
+	MTPint vuser_id;
+	MTPstringView vmessage;
+	MTPint vpts;
+	MTPint vpts_count;
+	MTPint vdate;
+	MTPint vfwd_from_id;
+	MTPint vfwd_date;
+	MTPint vreply_to_msg_id;
+
+	enum {
+		flag_fwd_from_id = (1 << 2),
+		flag_fwd_date = (1 << 2),
+		flag_reply_to_msg_id = (1 << 3),
+	};
+
+	bool has_fwd_from_id() const { return vflags.v & flag_fwd_from_id; }
+	bool has_fwd_date() const { return vflags.v & flag_fwd_date; }
+	bool has_reply_to_msg_id() const { return vflags.v & flag_reply_to_msg_id; }
+};
+
+class MTPDupdateShortChatMessageView {
+public:
+	MTPint vflags;
+	MTPint vid;
+	MTPint vfrom_id;
+	MTPint vchat_id;
+	MTPstringView vmessage;
+	MTPint vpts;
+	MTPint vpts_count;
+	MTPint vdate;
+	MTPint vfwd_from_id;
+	MTPint vfwd_date;
+	MTPint vreply_to_msg_id;
+
+	enum {
+		flag_fwd_from_id = (1 << 2),
+		flag_fwd_date = (1 << 2),
+		flag_reply_to_msg_id = (1 << 3),
+	};
+
+	bool has_fwd_from_id() const { return vflags.v & flag_fwd_from_id; }
+	bool has_fwd_date() const { return vflags.v & flag_fwd_date; }
+	bool has_reply_to_msg_id() const { return vflags.v & flag_reply_to_msg_id; }
+};
+
+class MTPDupdateShortView {
+public:
+	MTPUpdateView vupdate;
+	MTPint vdate;
+};
+
+class MTPDupdatesCombinedView {
+public:
+	MTPVectorView<MTPUpdateView > vupdates;
+	MTPVectorView<MTPUserView > vusers;
+	MTPVectorView<MTPChatView > vchats;
+	MTPint vdate;
+	MTPint vseq_start;
+	MTPint vseq;
+};
+
+class MTPDupdatesView {
+public:
+	MTPVectorView<MTPUpdateView > vupdates;
+	MTPVectorView<MTPUserView > vusers;
+	MTPVectorView<MTPChatView > vchats;
+	MTPint vdate;
+	MTPint vseq;
+};
+
+class MTPDphotos_photosView {
+public:
+	MTPVectorView<MTPPhotoView > vphotos;
+	MTPVectorView<MTPUserView > vusers;
+};
+
+class MTPDphotos_photosSliceView {
+public:
+	MTPint vcount;
+	MTPVectorView<MTPPhotoView > vphotos;
+	MTPVectorView<MTPUserView > vusers;
+};
+
+class MTPDphotos_photoView {
+public:
+	MTPPhotoView vphoto;
+	MTPVectorView<MTPUserView > vusers;
+};
+
+class MTPDupload_fileView {
+public:
+	MTPstorage_FileTypeView vtype;
+	MTPint vmtime;
+	MTPbytesView vbytes;
+};
+
+class MTPDdcOptionView {
+public:
+	MTPint vflags;
+	MTPint vid;
+	MTPstringView vip_address;
+	MTPint vport;
+};
+
+class MTPDconfigView {
+public:
+	MTPint vdate;
+	MTPint vexpires;
+	MTPBool vtest_mode;
+	MTPint vthis_dc;
+	MTPVectorView<MTPDcOptionView > vdc_options;
+	MTPint vchat_size_max;
+	MTPint vbroadcast_size_max;
+	MTPint vforwarded_count_max;
+	MTPint vonline_update_period_ms;
+	MTPint voffline_blur_timeout_ms;
+	MTPint voffline_idle_timeout_ms;
+	MTPint vonline_cloud_timeout_ms;
+	MTPint vnotify_cloud_delay_ms;
+	MTPint vnotify_default_delay_ms;
+	MTPint vchat_big_size;
+	MTPint vpush_chat_period_ms;
+	MTPint vpush_chat_limit;
+	MTPVectorView<MTPDisabledFeatureView > vdisabled_features;
+};
+
+class MTPDnearestDcView {
+public:
+	MTPstringView vcountry;
+	MTPint vthis_dc;
+	MTPint vnearest_dc;
+};
+
+class MTPDhelp_appUpdateView {
+public:
+	MTPint vid;
+	MTPBool vcritical;
+	MTPstringView vurl;
+	MTPstringView vtext;
+};
+
+class MTPDhelp_inviteTextView {
+public:
+	MTPstringView vmessage;
+};
+
+class MTPDinputGeoChatView {
+public:
+	MTPint vchat_id;
+	MTPlong vaccess_hash;
+};
+
+class MTPDgeoChatMessageEmptyView {
+public:
+	MTPint vchat_id;
+	MTPint vid;
+};
+
+class MTPDgeoChatMessageView {
+public:
+	MTPint vchat_id;
+	MTPint vid;
+	MTPint vfrom_id;
+	MTPint vdate;
+	MTPstringView vmessage;
+	MTPMessageMediaView vmedia;
+};
+
+class MTPDgeoChatMessageServiceView {
+public:
+	MTPint vchat_id;
+	MTPint vid;
+	MTPint vfrom_id;
+	MTPint vdate;
+	MTPMessageActionView vaction;
+};
+
+class MTPDgeochats_statedMessageView {
+public:
+	MTPGeoChatMessageView vmessage;
+	MTPVectorView<MTPChatView > vchats;
+	MTPVectorView<MTPUserView > vusers;
+	MTPint vseq;
+};
+
+class MTPDgeochats_locatedView {
+public:
+	MTPVectorView<MTPChatLocatedView > vresults;
+	MTPVectorView<MTPGeoChatMessageView > vmessages;
+	MTPVectorView<MTPChatView > vchats;
+	MTPVectorView<MTPUserView > vusers;
+};
+
+class MTPDgeochats_messagesView {
+public:
+	MTPVectorView<MTPGeoChatMessageView > vmessages;
+	MTPVectorView<MTPChatView > vchats;
+	MTPVectorView<MTPUserView > vusers;
+};
+
+class MTPDgeochats_messagesSliceView {
+public:
+	MTPint vcount;
+	MTPVectorView<MTPGeoChatMessageView > vmessages;
+	MTPVectorView<MTPChatView > vchats;
+	MTPVectorView<MTPUserView > vusers;
+};
+
+class MTPDencryptedChatEmptyView {
+public:
+	MTPint vid;
+};
+
+class MTPDencryptedChatWaitingView {
+public:
+	MTPint vid;
+	MTPlong vaccess_hash;
+	MTPint vdate;
+	MTPint vadmin_id;
+	MTPint vparticipant_id;
+};
+
+class MTPDencryptedChatRequestedView {
+public:
+	MTPint vid;
+	MTPlong vaccess_hash;
+	MTPint vdate;
+	MTPint vadmin_id;
+	MTPint vparticipant_id;
+	MTPbytesView vg_a;
+};
+
+class MTPDencryptedChatView {
+public:
+	MTPint vid;
+	MTPlong vaccess_hash;
+	MTPint vdate;
+	MTPint vadmin_id;
+	MTPint vparticipant_id;
+	MTPbytesView vg_a_or_b;
+	MTPlong vkey_fingerprint;
+};
+
+class MTPDencryptedChatDiscardedView {
+public:
+	MTPint vid;
+};
+
+class MTPDinputEncryptedChatView {
+public:
+	MTPint vchat_id;
+	MTPlong vaccess_hash;
+};
+
+class MTPDencryptedFileView {
+public:
+	MTPlong vid;
+	MTPlong vaccess_hash;
+	MTPint vsize;
+	MTPint vdc_id;
+	MTPint vkey_fingerprint;
+};
+
+class MTPDinputEncryptedFileUploadedView {
+public:
+	MTPlong vid;
+	MTPint vparts;
+	MTPstringView vmd5_checksum;
+	MTPint vkey_fingerprint;
+};
+
+class MTPDinputEncryptedFileView {
+public:
+	MTPlong vid;
+	MTPlong vaccess_hash;
+};
+
+class MTPDinputEncryptedFileBigUploadedView {
+public:
+	MTPlong vid;
+	MTPint vparts;
+	MTPint vkey_fingerprint;
+};
+
+class MTPDencryptedMessageView {
+public:
+	MTPlong vrandom_id;
+	MTPint vchat_id;
+	MTPint vdate;
+	MTPbytesView vbytes;
+	MTPEncryptedFileView vfile;
+};
+
+class MTPDencryptedMessageServiceView {
+public:
+	MTPlong vrandom_id;
+	MTPint vchat_id;
+	MTPint vdate;
+	MTPbytesView vbytes;
+};
+
+class MTPDmessages_dhConfigNotModifiedView {
+public:
+	MTPbytesView vrandom;
+};
+
+class MTPDmessages_dhConfigView {
+public:
+	MTPint vg;
+	MTPbytesView vp;
+	MTPint vversion;
+	MTPbytesView vrandom;
+};
+
+class MTPDmessages_sentEncryptedMessageView {
+public:
+	MTPint vdate;
+};
+
+class MTPDmessages_sentEncryptedFileView {
+public:
+	MTPint vdate;
+	MTPEncryptedFileView vfile;
+};
+
+class MTPDinputAudioView {
+public:
+	MTPlong vid;
+	MTPlong vaccess_hash;
+};
+
+class MTPDinputDocumentView {
+public:
+	MTPlong vid;
+	MTPlong vaccess_hash;
+};
+
+class MTPDaudioEmptyView {
+public:
+	MTPlong vid;
+};
+
+class MTPDaudioView {
+public:
+	MTPlong vid;
+	MTPlong vaccess_hash;
+	MTPint vuser_id;
+	MTPint vdate;
+	MTPint vduration;
+	MTPstringView vmime_type;
+	MTPint vsize;
+	MTPint vdc_id;
+};
+
+class MTPDdocumentEmptyView {
+public:
+	MTPlong vid;
+};
+
+class MTPDdocumentView {
+public:
+	MTPlong vid;
+	MTPlong vaccess_hash;
+	MTPint vdate;
+	MTPstringView vmime_type;
+	MTPint vsize;
+	MTPPhotoSizeView vthumb;
+	MTPint vdc_id;
+	MTPVectorView<MTPDocumentAttributeView > vattributes;
+};
+
+class MTPDhelp_supportView {
+public:
+	MTPstringView vphone_number;
+	MTPUserView vuser;
+};
+
+class MTPDnotifyPeerView {
+public:
+	MTPPeerView vpeer;
+};
+
+class MTPDsendMessageUploadVideoActionView {
+public:
+	MTPint vprogress;
+};
+
+class MTPDsendMessageUploadAudioActionView {
+public:
+	MTPint vprogress;
+};
+
+class MTPDsendMessageUploadPhotoActionView {
+public:
+	MTPint vprogress;
+};
+
+class MTPDsendMessageUploadDocumentActionView {
+public:
+	MTPint vprogress;
+};
+
+class MTPDcontactFoundView {
+public:
+	MTPint vuser_id;
+};
+
+class MTPDcontacts_foundView {
+public:
+	MTPVectorView<MTPContactFoundView > vresults;
+	MTPVectorView<MTPUserView > vusers;
+};
+
+class MTPDinputPrivacyValueAllowUsersView {
+public:
+	MTPVectorView<MTPInputUserView > vusers;
+};
+
+class MTPDinputPrivacyValueDisallowUsersView {
+public:
+	MTPVectorView<MTPInputUserView > vusers;
+};
+
+class MTPDprivacyValueAllowUsersView {
+public:
+	MTPVectorView<MTPint > vusers;
+};
+
+class MTPDprivacyValueDisallowUsersView {
+public:
+	MTPVectorView<MTPint > vusers;
+};
+
+class MTPDaccount_privacyRulesView {
+public:
+	MTPVectorView<MTPPrivacyRuleView > vrules;
+	MTPVectorView<MTPUserView > vusers;
+};
+
+class MTPDaccountDaysTTLView {
+public:
+	MTPint vdays;
+};
+
+class MTPDaccount_sentChangePhoneCodeView {
+public:
+	MTPstringView vphone_code_hash;
+	MTPint vsend_call_timeout;
+};
+
+class MTPDdocumentAttributeImageSizeView {
+public:
+	MTPint vw;
+	MTPint vh;
+};
+
+class MTPDdocumentAttributeStickerView {
+public:
+	MTPstringView valt;
+	MTPInputStickerSetView vstickerset;
+};
+
+class MTPDdocumentAttributeVideoView {
+public:
+	MTPint vduration;
+	MTPint vw;
+	MTPint vh;
+};
+
+class MTPDdocumentAttributeAudioView {
+public:
+	MTPint vduration;
+	MTPstringView vtitle;
+	MTPstringView vperformer;
+};
+
+class MTPDdocumentAttributeFilenameView {
+public:
+	MTPstringView vfile_name;
+};
+
+class MTPDmessages_stickersView {
+public:
+	MTPstringView vhash;
+	MTPVectorView<MTPDocumentView > vstickers;
+};
+
+class MTPDstickerPackView {
+public:
+	MTPstringView vemoticon;
+	MTPVectorView<MTPlong > vdocuments;
+};
+
+class MTPDmessages_allStickersView {
+public:
+	MTPstringView vhash;
+	MTPVectorView<MTPStickerSetView > vsets;
+};
+
+class MTPDdisabledFeatureView {
+public:
+	MTPstringView vfeature;
+	MTPstringView vdescription;
+};
+
+class MTPDmessages_affectedMessagesView {
+public:
+	MTPint vpts;
+	MTPint vpts_count;
+};
+
+class MTPDwebPageEmptyView {
+public:
+	MTPlong vid;
+};
+
+class MTPDwebPagePendingView {
+public:
+	MTPlong vid;
+	MTPint vdate;
+};
+
+class MTPDwebPageView {
+public:
+	MTPint vflags;
+	MTPlong vid;
+	MTPstringView vurl;
+	MTPstringView vdisplay_url;
+	MTPstringView vtype;
+	MTPstringView vsite_name;
+	MTPstringView vtitle;
+	MTPstringView vdescription;
+	MTPPhotoView vphoto;
+	MTPstringView vembed_url;
+	MTPstringView vembed_type;
+	MTPint vembed_width;
+	MTPint vembed_height;
+	MTPint vduration;
+	MTPstringView vauthor;
+
+	enum {
+		flag_type = (1 << 0),
+		flag_site_name = (1 << 1),
+		flag_title = (1 << 2),
+		flag_description = (1 << 3),
+		flag_photo = (1 << 4),
+		flag_embed_url = (1 << 5),
+		flag_embed_type = (1 << 5),
+		flag_embed_width = (1 << 6),
+		flag_embed_height = (1 << 6),
+		flag_duration = (1 << 7),
+		flag_author = (1 << 8),
+	};
+
+	bool has_type() const { return vflags.v & flag_type; }
+	bool has_site_name() const { return vflags.v & flag_site_name; }
+	bool has_title() const { return vflags.v & flag_title; }
+	bool has_description() const { return vflags.v & flag_description; }
+	bool has_photo() const { return vflags.v & flag_photo; }
+	bool has_embed_url() const { return vflags.v & flag_embed_url; }
+	bool has_embed_type() const { return vflags.v & flag_embed_type; }
+	bool has_embed_width() const { return vflags.v & flag_embed_width; }
+	bool has_embed_height() const { return vflags.v & flag_embed_height; }
+	bool has_duration() const { return vflags.v & flag_duration; }
+	bool has_author() const { return vflags.v & flag_author; }
+};
+
+class MTPDauthorizationView {
+public:
+	MTPlong vhash;
+	MTPint vflags;
+	MTPstringView vdevice_model;
+	MTPstringView vplatform;
+	MTPstringView vsystem_version;
+	MTPint vapi_id;
+	MTPstringView vapp_name;
+	MTPstringView vapp_version;
+	MTPint vdate_created;
+	MTPint vdate_active;
+	MTPstringView vip;
+	MTPstringView vcountry;
+	MTPstringView vregion;
+};
+
+class MTPDaccount_authorizationsView {
+public:
+	MTPVectorView<MTPAuthorizationView > vauthorizations;
+};
+
+class MTPDaccount_noPasswordView {
+public:
+	MTPbytesView vnew_salt;
+	MTPstringView vemail_unconfirmed_pattern;
+};
+
+class MTPDaccount_passwordView {
+public:
+	MTPbytesView vcurrent_salt;
+	MTPbytesView vnew_salt;
+	MTPstringView vhint;
+	MTPBool vhas_recovery;
+	MTPstringView vemail_unconfirmed_pattern;
+};
+
+class MTPDaccount_passwordSettingsView {
+public:
+	MTPstringView vemail;
+};
+
+class MTPDaccount_passwordInputSettingsView {
+public:
+	MTPint vflags;
+	MTPbytesView vnew_salt;
+	MTPbytesView vnew_password_hash;
+	MTPstringView vhint;
+	MTPstringView vemail;
+
+	enum {
+		flag_new_salt = (1 << 0),
+		flag_new_password_hash = (1 << 0),
+		flag_hint = (1 << 0),
+		flag_email = (1 << 1),
+	};
+
+	bool has_new_salt() const { return vflags.v & flag_new_salt; }
+	bool has_new_password_hash() const { return vflags.v & flag_new_password_hash; }
+	bool has_hint() const { return vflags.v & flag_hint; }
+	bool has_email() const { return vflags.v & flag_email; }
+};
+
+class MTPDauth_passwordRecoveryView {
+public:
+	MTPstringView vemail_pattern;
+};
+
+class MTPDreceivedNotifyMessageView {
+public:
+	MTPint vid;
+	MTPint vflags;
+};
+
+class MTPDchatInviteExportedView {
+public:
+	MTPstringView vlink;
+};
+
+class MTPDchatInviteAlreadyView {
+public:
+	MTPChatView vchat;
+};
+
+class MTPDchatInviteView {
+public:
+	MTPstringView vtitle;
+};
+
+class MTPDinputStickerSetIDView {
+public:
+	MTPlong vid;
+	MTPlong vaccess_hash;
+};
+
+class MTPDinputStickerSetShortNameView {
+public:
+	MTPstringView vshort_name;
+};
+
+class MTPDstickerSetView {
+public:
+	MTPint vflags;
+	MTPlong vid;
+	MTPlong vaccess_hash;
+	MTPstringView vtitle;
+	MTPstringView vshort_name;
+	MTPint vcount;
+	MTPint vhash;
+};
+
+class MTPDmessages_stickerSetView {
+public:
+	MTPStickerSetView vset;
+	MTPVectorView<MTPStickerPackView > vpacks;
+	MTPVectorView<MTPDocumentView > vdocuments;
+};
+
+class MTPDbotCommandView {
+public:
+	MTPstringView vcommand;
+	MTPstringView vdescription;
+};
+
+class MTPDbotInfoView {
+public:
+	MTPint vuser_id;
+	MTPint vversion;
+	MTPstringView vshare_text;
+	MTPstringView vdescription;
+	MTPVectorView<MTPBotCommandView > vcommands;
+};
+
+class MTPDkeyboardButtonView {
+public:
+	MTPstringView vtext;
+};
+
+class MTPDkeyboardButtonRowView {
+public:
+	MTPVectorView<MTPKeyboardButtonView > vbuttons;
+};
+
+class MTPDreplyKeyboardHideView {
+public:
+	MTPint vflags;
+};
+
+class MTPDreplyKeyboardForceReplyView {
+public:
+	MTPint vflags;
+};
+
+class MTPDreplyKeyboardMarkupView {
+public:
+	MTPint vflags;
+	MTPVectorView<MTPKeyboardButtonRowView > vrows;
+};
+
+// Read-only view inline methods definition
+
+inline mtpReadResult MTPresPQView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_resPQ) return mtpReadUnexpected;
+	MTPDresPQView *v = arena.alloc<MTPDresPQView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vnonce, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vserver_nonce, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vpq, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vserver_public_key_fingerprints, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPp_Q_inner_dataView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_p_q_inner_data) return mtpReadUnexpected;
+	MTPDp_q_inner_dataView *v = arena.alloc<MTPDp_q_inner_dataView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vpq, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vp, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vq, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vnonce, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vserver_nonce, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vnew_nonce, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPserver_DH_ParamsView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_server_DH_params_fail: _type = cons; {
+			MTPDserver_DH_params_failView *v = arena.alloc<MTPDserver_DH_params_failView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vnonce, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vserver_nonce, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vnew_nonce_hash, from, end, arena)) return result;
+		} break;
+		case mtpc_server_DH_params_ok: _type = cons; {
+			MTPDserver_DH_params_okView *v = arena.alloc<MTPDserver_DH_params_okView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vnonce, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vserver_nonce, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vencrypted_answer, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPserver_DH_inner_dataView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_server_DH_inner_data) return mtpReadUnexpected;
+	MTPDserver_DH_inner_dataView *v = arena.alloc<MTPDserver_DH_inner_dataView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vnonce, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vserver_nonce, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vg, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vdh_prime, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vg_a, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vserver_time, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPclient_DH_Inner_DataView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_client_DH_inner_data) return mtpReadUnexpected;
+	MTPDclient_DH_inner_dataView *v = arena.alloc<MTPDclient_DH_inner_dataView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vnonce, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vserver_nonce, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vretry_id, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vg_b, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPset_client_DH_params_answerView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_dh_gen_ok: _type = cons; {
+			MTPDdh_gen_okView *v = arena.alloc<MTPDdh_gen_okView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vnonce, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vserver_nonce, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vnew_nonce_hash1, from, end, arena)) return result;
+		} break;
+		case mtpc_dh_gen_retry: _type = cons; {
+			MTPDdh_gen_retryView *v = arena.alloc<MTPDdh_gen_retryView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vnonce, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vserver_nonce, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vnew_nonce_hash2, from, end, arena)) return result;
+		} break;
+		case mtpc_dh_gen_fail: _type = cons; {
+			MTPDdh_gen_failView *v = arena.alloc<MTPDdh_gen_failView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vnonce, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vserver_nonce, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vnew_nonce_hash3, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmsgsAckView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_msgs_ack) return mtpReadUnexpected;
+	MTPDmsgs_ackView *v = arena.alloc<MTPDmsgs_ackView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vmsg_ids, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPbadMsgNotificationView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_bad_msg_notification: _type = cons; {
+			MTPDbad_msg_notificationView *v = arena.alloc<MTPDbad_msg_notificationView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vbad_msg_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vbad_msg_seqno, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->verror_code, from, end, arena)) return result;
+		} break;
+		case mtpc_bad_server_salt: _type = cons; {
+			MTPDbad_server_saltView *v = arena.alloc<MTPDbad_server_saltView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vbad_msg_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vbad_msg_seqno, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->verror_code, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vnew_server_salt, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmsgsStateReqView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_msgs_state_req) return mtpReadUnexpected;
+	MTPDmsgs_state_reqView *v = arena.alloc<MTPDmsgs_state_reqView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vmsg_ids, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmsgsStateInfoView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_msgs_state_info) return mtpReadUnexpected;
+	MTPDmsgs_state_infoView *v = arena.alloc<MTPDmsgs_state_infoView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vreq_msg_id, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vinfo, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmsgsAllInfoView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_msgs_all_info) return mtpReadUnexpected;
+	MTPDmsgs_all_infoView *v = arena.alloc<MTPDmsgs_all_infoView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vmsg_ids, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vinfo, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmsgDetailedInfoView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_msg_detailed_info: _type = cons; {
+			MTPDmsg_detailed_infoView *v = arena.alloc<MTPDmsg_detailed_infoView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vmsg_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vanswer_msg_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vbytes, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vstatus, from, end, arena)) return result;
+		} break;
+		case mtpc_msg_new_detailed_info: _type = cons; {
+			MTPDmsg_new_detailed_infoView *v = arena.alloc<MTPDmsg_new_detailed_infoView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vanswer_msg_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vbytes, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vstatus, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmsgResendReqView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_msg_resend_req) return mtpReadUnexpected;
+	MTPDmsg_resend_reqView *v = arena.alloc<MTPDmsg_resend_reqView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vmsg_ids, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPrpcErrorView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_rpc_error) return mtpReadUnexpected;
+	MTPDrpc_errorView *v = arena.alloc<MTPDrpc_errorView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->verror_code, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->verror_message, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPrpcDropAnswerView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_rpc_answer_unknown: _type = cons; _data = 0; break;
+		case mtpc_rpc_answer_dropped_running: _type = cons; _data = 0; break;
+		case mtpc_rpc_answer_dropped: _type = cons; {
+			MTPDrpc_answer_droppedView *v = arena.alloc<MTPDrpc_answer_droppedView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vmsg_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vseq_no, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vbytes, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPfutureSaltView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_future_salt) return mtpReadUnexpected;
+	MTPDfuture_saltView *v = arena.alloc<MTPDfuture_saltView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vvalid_since, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vvalid_until, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vsalt, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPfutureSaltsView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_future_salts) return mtpReadUnexpected;
+	MTPDfuture_saltsView *v = arena.alloc<MTPDfuture_saltsView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vreq_msg_id, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vnow, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vsalts, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPpongView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_pong) return mtpReadUnexpected;
+	MTPDpongView *v = arena.alloc<MTPDpongView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vmsg_id, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vping_id, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPdestroySessionResView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_destroy_session_ok: _type = cons; {
+			MTPDdestroy_session_okView *v = arena.alloc<MTPDdestroy_session_okView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vsession_id, from, end, arena)) return result;
+		} break;
+		case mtpc_destroy_session_none: _type = cons; {
+			MTPDdestroy_session_noneView *v = arena.alloc<MTPDdestroy_session_noneView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vsession_id, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPnewSessionView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_new_session_created) return mtpReadUnexpected;
+	MTPDnew_session_createdView *v = arena.alloc<MTPDnew_session_createdView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vfirst_msg_id, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vunique_id, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vserver_salt, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPhttpWaitView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_http_wait) return mtpReadUnexpected;
+	MTPDhttp_waitView *v = arena.alloc<MTPDhttp_waitView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vmax_delay, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vwait_after, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vmax_wait, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPerrorView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_error) return mtpReadUnexpected;
+	MTPDerrorView *v = arena.alloc<MTPDerrorView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vcode, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vtext, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPnullView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_null) return mtpReadUnexpected;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputPeerView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputPeerEmpty: _type = cons; _data = 0; break;
+		case mtpc_inputPeerSelf: _type = cons; _data = 0; break;
+		case mtpc_inputPeerContact: _type = cons; {
+			MTPDinputPeerContactView *v = arena.alloc<MTPDinputPeerContactView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+		} break;
+		case mtpc_inputPeerForeign: _type = cons; {
+			MTPDinputPeerForeignView *v = arena.alloc<MTPDinputPeerForeignView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+		} break;
+		case mtpc_inputPeerChat: _type = cons; {
+			MTPDinputPeerChatView *v = arena.alloc<MTPDinputPeerChatView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vchat_id, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputUserView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputUserEmpty: _type = cons; _data = 0; break;
+		case mtpc_inputUserSelf: _type = cons; _data = 0; break;
+		case mtpc_inputUserContact: _type = cons; {
+			MTPDinputUserContactView *v = arena.alloc<MTPDinputUserContactView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+		} break;
+		case mtpc_inputUserForeign: _type = cons; {
+			MTPDinputUserForeignView *v = arena.alloc<MTPDinputUserForeignView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputContactView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_inputPhoneContact) return mtpReadUnexpected;
+	MTPDinputPhoneContactView *v = arena.alloc<MTPDinputPhoneContactView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vclient_id, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vphone, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vfirst_name, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vlast_name, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputFileView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputFile: _type = cons; {
+			MTPDinputFileView *v = arena.alloc<MTPDinputFileView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vparts, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vname, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmd5_checksum, from, end, arena)) return result;
+		} break;
+		case mtpc_inputFileBig: _type = cons; {
+			MTPDinputFileBigView *v = arena.alloc<MTPDinputFileBigView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vparts, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vname, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputMediaView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputMediaEmpty: _type = cons; _data = 0; break;
+		case mtpc_inputMediaUploadedPhoto: _type = cons; {
+			MTPDinputMediaUploadedPhotoView *v = arena.alloc<MTPDinputMediaUploadedPhotoView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vfile, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vcaption, from, end, arena)) return result;
+		} break;
+		case mtpc_inputMediaPhoto: _type = cons; {
+			MTPDinputMediaPhotoView *v = arena.alloc<MTPDinputMediaPhotoView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vcaption, from, end, arena)) return result;
+		} break;
+		case mtpc_inputMediaGeoPoint: _type = cons; {
+			MTPDinputMediaGeoPointView *v = arena.alloc<MTPDinputMediaGeoPointView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vgeo_point, from, end, arena)) return result;
+		} break;
+		case mtpc_inputMediaContact: _type = cons; {
+			MTPDinputMediaContactView *v = arena.alloc<MTPDinputMediaContactView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vphone_number, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vfirst_name, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vlast_name, from, end, arena)) return result;
+		} break;
+		case mtpc_inputMediaUploadedVideo: _type = cons; {
+			MTPDinputMediaUploadedVideoView *v = arena.alloc<MTPDinputMediaUploadedVideoView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vfile, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vduration, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vw, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vh, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vcaption, from, end, arena)) return result;
+		} break;
+		case mtpc_inputMediaUploadedThumbVideo: _type = cons; {
+			MTPDinputMediaUploadedThumbVideoView *v = arena.alloc<MTPDinputMediaUploadedThumbVideoView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vfile, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vthumb, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vduration, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vw, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vh, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vcaption, from, end, arena)) return result;
+		} break;
+		case mtpc_inputMediaVideo: _type = cons; {
+			MTPDinputMediaVideoView *v = arena.alloc<MTPDinputMediaVideoView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vcaption, from, end, arena)) return result;
+		} break;
+		case mtpc_inputMediaUploadedAudio: _type = cons; {
+			MTPDinputMediaUploadedAudioView *v = arena.alloc<MTPDinputMediaUploadedAudioView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vfile, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vduration, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmime_type, from, end, arena)) return result;
+		} break;
+		case mtpc_inputMediaAudio: _type = cons; {
+			MTPDinputMediaAudioView *v = arena.alloc<MTPDinputMediaAudioView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+		} break;
+		case mtpc_inputMediaUploadedDocument: _type = cons; {
+			MTPDinputMediaUploadedDocumentView *v = arena.alloc<MTPDinputMediaUploadedDocumentView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vfile, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmime_type, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vattributes, from, end, arena)) return result;
+		} break;
+		case mtpc_inputMediaUploadedThumbDocument: _type = cons; {
+			MTPDinputMediaUploadedThumbDocumentView *v = arena.alloc<MTPDinputMediaUploadedThumbDocumentView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vfile, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vthumb, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmime_type, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vattributes, from, end, arena)) return result;
+		} break;
+		case mtpc_inputMediaDocument: _type = cons; {
+			MTPDinputMediaDocumentView *v = arena.alloc<MTPDinputMediaDocumentView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+		} break;
+		case mtpc_inputMediaVenue: _type = cons; {
+			MTPDinputMediaVenueView *v = arena.alloc<MTPDinputMediaVenueView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vgeo_point, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vtitle, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaddress, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vprovider, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vvenue_id, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputChatPhotoView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputChatPhotoEmpty: _type = cons; _data = 0; break;
+		case mtpc_inputChatUploadedPhoto: _type = cons; {
+			MTPDinputChatUploadedPhotoView *v = arena.alloc<MTPDinputChatUploadedPhotoView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vfile, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vcrop, from, end, arena)) return result;
+		} break;
+		case mtpc_inputChatPhoto: _type = cons; {
+			MTPDinputChatPhotoView *v = arena.alloc<MTPDinputChatPhotoView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vcrop, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputGeoPointView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputGeoPointEmpty: _type = cons; _data = 0; break;
+		case mtpc_inputGeoPoint: _type = cons; {
+			MTPDinputGeoPointView *v = arena.alloc<MTPDinputGeoPointView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vlat, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vlong, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputPhotoView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputPhotoEmpty: _type = cons; _data = 0; break;
+		case mtpc_inputPhoto: _type = cons; {
+			MTPDinputPhotoView *v = arena.alloc<MTPDinputPhotoView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputVideoView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputVideoEmpty: _type = cons; _data = 0; break;
+		case mtpc_inputVideo: _type = cons; {
+			MTPDinputVideoView *v = arena.alloc<MTPDinputVideoView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputFileLocationView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputFileLocation: _type = cons; {
+			MTPDinputFileLocationView *v = arena.alloc<MTPDinputFileLocationView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vvolume_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vlocal_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vsecret, from, end, arena)) return result;
+		} break;
+		case mtpc_inputVideoFileLocation: _type = cons; {
+			MTPDinputVideoFileLocationView *v = arena.alloc<MTPDinputVideoFileLocationView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+		} break;
+		case mtpc_inputEncryptedFileLocation: _type = cons; {
+			MTPDinputEncryptedFileLocationView *v = arena.alloc<MTPDinputEncryptedFileLocationView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+		} break;
+		case mtpc_inputAudioFileLocation: _type = cons; {
+			MTPDinputAudioFileLocationView *v = arena.alloc<MTPDinputAudioFileLocationView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+		} break;
+		case mtpc_inputDocumentFileLocation: _type = cons; {
+			MTPDinputDocumentFileLocationView *v = arena.alloc<MTPDinputDocumentFileLocationView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputPhotoCropView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputPhotoCropAuto: _type = cons; _data = 0; break;
+		case mtpc_inputPhotoCrop: _type = cons; {
+			MTPDinputPhotoCropView *v = arena.alloc<MTPDinputPhotoCropView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vcrop_left, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vcrop_top, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vcrop_width, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputAppEventView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_inputAppEvent) return mtpReadUnexpected;
+	MTPDinputAppEventView *v = arena.alloc<MTPDinputAppEventView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vtime, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vtype, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vpeer, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vdata, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPpeerView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_peerUser: _type = cons; {
+			MTPDpeerUserView *v = arena.alloc<MTPDpeerUserView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+		} break;
+		case mtpc_peerChat: _type = cons; {
+			MTPDpeerChatView *v = arena.alloc<MTPDpeerChatView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vchat_id, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPstorage_fileTypeView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_storage_fileUnknown: _type = cons; _data = 0; break;
+		case mtpc_storage_fileJpeg: _type = cons; _data = 0; break;
+		case mtpc_storage_fileGif: _type = cons; _data = 0; break;
+		case mtpc_storage_filePng: _type = cons; _data = 0; break;
+		case mtpc_storage_filePdf: _type = cons; _data = 0; break;
+		case mtpc_storage_fileMp3: _type = cons; _data = 0; break;
+		case mtpc_storage_fileMov: _type = cons; _data = 0; break;
+		case mtpc_storage_filePartial: _type = cons; _data = 0; break;
+		case mtpc_storage_fileMp4: _type = cons; _data = 0; break;
+		case mtpc_storage_fileWebp: _type = cons; _data = 0; break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPfileLocationView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_fileLocationUnavailable: _type = cons; {
+			MTPDfileLocationUnavailableView *v = arena.alloc<MTPDfileLocationUnavailableView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vvolume_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vlocal_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vsecret, from, end, arena)) return result;
+		} break;
+		case mtpc_fileLocation: _type = cons; {
+			MTPDfileLocationView *v = arena.alloc<MTPDfileLocationView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vdc_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vvolume_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vlocal_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vsecret, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPuserView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_userEmpty: _type = cons; {
+			MTPDuserEmptyView *v = arena.alloc<MTPDuserEmptyView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+		} break;
+		case mtpc_user: _type = cons; {
+			MTPDuserView *v = arena.alloc<MTPDuserView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vflags, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (v->has_access_hash()) if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+			if (v->has_first_name()) if (mtpReadResult result = mtpTryReadView(v->vfirst_name, from, end, arena)) return result;
+			if (v->has_last_name()) if (mtpReadResult result = mtpTryReadView(v->vlast_name, from, end, arena)) return result;
+			if (v->has_username()) if (mtpReadResult result = mtpTryReadView(v->vusername, from, end, arena)) return result;
+			if (v->has_phone()) if (mtpReadResult result = mtpTryReadView(v->vphone, from, end, arena)) return result;
+			if (v->has_photo()) if (mtpReadResult result = mtpTryReadView(v->vphoto, from, end, arena)) return result;
+			if (v->has_status()) if (mtpReadResult result = mtpTryReadView(v->vstatus, from, end, arena)) return result;
+			if (v->has_bot_info_version()) if (mtpReadResult result = mtpTryReadView(v->vbot_info_version, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPuserProfilePhotoView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_userProfilePhotoEmpty: _type = cons; _data = 0; break;
+		case mtpc_userProfilePhoto: _type = cons; {
+			MTPDuserProfilePhotoView *v = arena.alloc<MTPDuserProfilePhotoView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vphoto_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vphoto_small, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vphoto_big, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPuserStatusView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_userStatusEmpty: _type = cons; _data = 0; break;
+		case mtpc_userStatusOnline: _type = cons; {
+			MTPDuserStatusOnlineView *v = arena.alloc<MTPDuserStatusOnlineView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vexpires, from, end, arena)) return result;
+		} break;
+		case mtpc_userStatusOffline: _type = cons; {
+			MTPDuserStatusOfflineView *v = arena.alloc<MTPDuserStatusOfflineView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vwas_online, from, end, arena)) return result;
+		} break;
+		case mtpc_userStatusRecently: _type = cons; _data = 0; break;
+		case mtpc_userStatusLastWeek: _type = cons; _data = 0; break;
+		case mtpc_userStatusLastMonth: _type = cons; _data = 0; break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPchatView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_chatEmpty: _type = cons; {
+			MTPDchatEmptyView *v = arena.alloc<MTPDchatEmptyView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+		} break;
+		case mtpc_chat: _type = cons; {
+			MTPDchatView *v = arena.alloc<MTPDchatView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vtitle, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vphoto, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vparticipants_count, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vleft, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vversion, from, end, arena)) return result;
+		} break;
+		case mtpc_chatForbidden: _type = cons; {
+			MTPDchatForbiddenView *v = arena.alloc<MTPDchatForbiddenView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vtitle, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+		} break;
+		case mtpc_geoChat: _type = cons; {
+			MTPDgeoChatView *v = arena.alloc<MTPDgeoChatView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vtitle, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaddress, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vvenue, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vgeo, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vphoto, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vparticipants_count, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vchecked_in, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vversion, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPchatFullView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_chatFull) return mtpReadUnexpected;
+	MTPDchatFullView *v = arena.alloc<MTPDchatFullView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vparticipants, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vchat_photo, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vnotify_settings, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vexported_invite, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vbot_info, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPchatParticipantView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_chatParticipant) return mtpReadUnexpected;
+	MTPDchatParticipantView *v = arena.alloc<MTPDchatParticipantView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vinviter_id, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPchatParticipantsView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_chatParticipantsForbidden: _type = cons; {
+			MTPDchatParticipantsForbiddenView *v = arena.alloc<MTPDchatParticipantsForbiddenView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vchat_id, from, end, arena)) return result;
+		} break;
+		case mtpc_chatParticipants: _type = cons; {
+			MTPDchatParticipantsView *v = arena.alloc<MTPDchatParticipantsView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vchat_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vadmin_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vparticipants, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vversion, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPchatPhotoView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_chatPhotoEmpty: _type = cons; _data = 0; break;
+		case mtpc_chatPhoto: _type = cons; {
+			MTPDchatPhotoView *v = arena.alloc<MTPDchatPhotoView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vphoto_small, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vphoto_big, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmessageView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_messageEmpty: _type = cons; {
+			MTPDmessageEmptyView *v = arena.alloc<MTPDmessageEmptyView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+		} break;
+		case mtpc_message: _type = cons; {
+			MTPDmessageView *v = arena.alloc<MTPDmessageView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vflags, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vfrom_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vto_id, from, end, arena)) return result;
+			if (v->has_fwd_from_id()) if (mtpReadResult result = mtpTryReadView(v->vfwd_from_id, from, end, arena)) return result;
+			if (v->has_fwd_date()) if (mtpReadResult result = mtpTryReadView(v->vfwd_date, from, end, arena)) return result;
+			if (v->has_reply_to_msg_id()) if (mtpReadResult result = mtpTryReadView(v->vreply_to_msg_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmessage, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmedia, from, end, arena)) return result;
+			if (v->has_reply_markup()) if (mtpReadResult result = mtpTryReadView(v->vreply_markup, from, end, arena)) return result;
+		} break;
+		case mtpc_messageService: _type = cons; {
+			MTPDmessageServiceView *v = arena.alloc<MTPDmessageServiceView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vflags, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vfrom_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vto_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaction, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmessageMediaView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_messageMediaEmpty: _type = cons; _data = 0; break;
+		case mtpc_messageMediaPhoto: _type = cons; {
+			MTPDmessageMediaPhotoView *v = arena.alloc<MTPDmessageMediaPhotoView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vphoto, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vcaption, from, end, arena)) return result;
+		} break;
+		case mtpc_messageMediaVideo: _type = cons; {
+			MTPDmessageMediaVideoView *v = arena.alloc<MTPDmessageMediaVideoView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vvideo, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vcaption, from, end, arena)) return result;
+		} break;
+		case mtpc_messageMediaGeo: _type = cons; {
+			MTPDmessageMediaGeoView *v = arena.alloc<MTPDmessageMediaGeoView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vgeo, from, end, arena)) return result;
+		} break;
+		case mtpc_messageMediaContact: _type = cons; {
+			MTPDmessageMediaContactView *v = arena.alloc<MTPDmessageMediaContactView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vphone_number, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vfirst_name, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vlast_name, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+		} break;
+		case mtpc_messageMediaUnsupported: _type = cons; _data = 0; break;
+		case mtpc_messageMediaDocument: _type = cons; {
+			MTPDmessageMediaDocumentView *v = arena.alloc<MTPDmessageMediaDocumentView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vdocument, from, end, arena)) return result;
+		} break;
+		case mtpc_messageMediaAudio: _type = cons; {
+			MTPDmessageMediaAudioView *v = arena.alloc<MTPDmessageMediaAudioView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vaudio, from, end, arena)) return result;
+		} break;
+		case mtpc_messageMediaWebPage: _type = cons; {
+			MTPDmessageMediaWebPageView *v = arena.alloc<MTPDmessageMediaWebPageView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vwebpage, from, end, arena)) return result;
+		} break;
+		case mtpc_messageMediaVenue: _type = cons; {
+			MTPDmessageMediaVenueView *v = arena.alloc<MTPDmessageMediaVenueView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vgeo, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vtitle, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaddress, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vprovider, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vvenue_id, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmessageActionView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_messageActionEmpty: _type = cons; _data = 0; break;
+		case mtpc_messageActionChatCreate: _type = cons; {
+			MTPDmessageActionChatCreateView *v = arena.alloc<MTPDmessageActionChatCreateView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vtitle, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+		} break;
+		case mtpc_messageActionChatEditTitle: _type = cons; {
+			MTPDmessageActionChatEditTitleView *v = arena.alloc<MTPDmessageActionChatEditTitleView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vtitle, from, end, arena)) return result;
+		} break;
+		case mtpc_messageActionChatEditPhoto: _type = cons; {
+			MTPDmessageActionChatEditPhotoView *v = arena.alloc<MTPDmessageActionChatEditPhotoView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vphoto, from, end, arena)) return result;
+		} break;
+		case mtpc_messageActionChatDeletePhoto: _type = cons; _data = 0; break;
+		case mtpc_messageActionChatAddUser: _type = cons; {
+			MTPDmessageActionChatAddUserView *v = arena.alloc<MTPDmessageActionChatAddUserView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+		} break;
+		case mtpc_messageActionChatDeleteUser: _type = cons; {
+			MTPDmessageActionChatDeleteUserView *v = arena.alloc<MTPDmessageActionChatDeleteUserView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+		} break;
+		case mtpc_messageActionGeoChatCreate: _type = cons; {
+			MTPDmessageActionGeoChatCreateView *v = arena.alloc<MTPDmessageActionGeoChatCreateView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vtitle, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaddress, from, end, arena)) return result;
+		} break;
+		case mtpc_messageActionGeoChatCheckin: _type = cons; _data = 0; break;
+		case mtpc_messageActionChatJoinedByLink: _type = cons; {
+			MTPDmessageActionChatJoinedByLinkView *v = arena.alloc<MTPDmessageActionChatJoinedByLinkView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vinviter_id, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPdialogView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_dialog) return mtpReadUnexpected;
+	MTPDdialogView *v = arena.alloc<MTPDdialogView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vpeer, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vtop_message, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vread_inbox_max_id, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vunread_count, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vnotify_settings, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPphotoView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_photoEmpty: _type = cons; {
+			MTPDphotoEmptyView *v = arena.alloc<MTPDphotoEmptyView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+		} break;
+		case mtpc_photo: _type = cons; {
+			MTPDphotoView *v = arena.alloc<MTPDphotoView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vgeo, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vsizes, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPphotoSizeView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_photoSizeEmpty: _type = cons; {
+			MTPDphotoSizeEmptyView *v = arena.alloc<MTPDphotoSizeEmptyView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vtype, from, end, arena)) return result;
+		} break;
+		case mtpc_photoSize: _type = cons; {
+			MTPDphotoSizeView *v = arena.alloc<MTPDphotoSizeView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vtype, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vlocation, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vw, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vh, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vsize, from, end, arena)) return result;
+		} break;
+		case mtpc_photoCachedSize: _type = cons; {
+			MTPDphotoCachedSizeView *v = arena.alloc<MTPDphotoCachedSizeView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vtype, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vlocation, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vw, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vh, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vbytes, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPvideoView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_videoEmpty: _type = cons; {
+			MTPDvideoEmptyView *v = arena.alloc<MTPDvideoEmptyView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+		} break;
+		case mtpc_video: _type = cons; {
+			MTPDvideoView *v = arena.alloc<MTPDvideoView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vduration, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vsize, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vthumb, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdc_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vw, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vh, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPgeoPointView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_geoPointEmpty: _type = cons; _data = 0; break;
+		case mtpc_geoPoint: _type = cons; {
+			MTPDgeoPointView *v = arena.alloc<MTPDgeoPointView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vlong, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vlat, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPauth_checkedPhoneView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_auth_checkedPhone) return mtpReadUnexpected;
+	MTPDauth_checkedPhoneView *v = arena.alloc<MTPDauth_checkedPhoneView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vphone_registered, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPauth_sentCodeView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_auth_sentCode: _type = cons; {
+			MTPDauth_sentCodeView *v = arena.alloc<MTPDauth_sentCodeView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vphone_registered, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vphone_code_hash, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vsend_call_timeout, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vis_password, from, end, arena)) return result;
+		} break;
+		case mtpc_auth_sentAppCode: _type = cons; {
+			MTPDauth_sentAppCodeView *v = arena.alloc<MTPDauth_sentAppCodeView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vphone_registered, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vphone_code_hash, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vsend_call_timeout, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vis_password, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPauth_authorizationView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_auth_authorization) return mtpReadUnexpected;
+	MTPDauth_authorizationView *v = arena.alloc<MTPDauth_authorizationView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vuser, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPauth_exportedAuthorizationView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_auth_exportedAuthorization) return mtpReadUnexpected;
+	MTPDauth_exportedAuthorizationView *v = arena.alloc<MTPDauth_exportedAuthorizationView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vbytes, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputNotifyPeerView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputNotifyPeer: _type = cons; {
+			MTPDinputNotifyPeerView *v = arena.alloc<MTPDinputNotifyPeerView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vpeer, from, end, arena)) return result;
+		} break;
+		case mtpc_inputNotifyUsers: _type = cons; _data = 0; break;
+		case mtpc_inputNotifyChats: _type = cons; _data = 0; break;
+		case mtpc_inputNotifyAll: _type = cons; _data = 0; break;
+		case mtpc_inputNotifyGeoChatPeer: _type = cons; {
+			MTPDinputNotifyGeoChatPeerView *v = arena.alloc<MTPDinputNotifyGeoChatPeerView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vpeer, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputPeerNotifyEventsView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputPeerNotifyEventsEmpty: _type = cons; _data = 0; break;
+		case mtpc_inputPeerNotifyEventsAll: _type = cons; _data = 0; break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputPeerNotifySettingsView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_inputPeerNotifySettings) return mtpReadUnexpected;
+	MTPDinputPeerNotifySettingsView *v = arena.alloc<MTPDinputPeerNotifySettingsView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vmute_until, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vsound, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vshow_previews, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vevents_mask, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPpeerNotifyEventsView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_peerNotifyEventsEmpty: _type = cons; _data = 0; break;
+		case mtpc_peerNotifyEventsAll: _type = cons; _data = 0; break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPpeerNotifySettingsView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_peerNotifySettingsEmpty: _type = cons; _data = 0; break;
+		case mtpc_peerNotifySettings: _type = cons; {
+			MTPDpeerNotifySettingsView *v = arena.alloc<MTPDpeerNotifySettingsView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vmute_until, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vsound, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vshow_previews, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vevents_mask, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPwallPaperView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_wallPaper: _type = cons; {
+			MTPDwallPaperView *v = arena.alloc<MTPDwallPaperView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vtitle, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vsizes, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vcolor, from, end, arena)) return result;
+		} break;
+		case mtpc_wallPaperSolid: _type = cons; {
+			MTPDwallPaperSolidView *v = arena.alloc<MTPDwallPaperSolidView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vtitle, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vbg_color, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vcolor, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPuserFullView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_userFull) return mtpReadUnexpected;
+	MTPDuserFullView *v = arena.alloc<MTPDuserFullView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vuser, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vlink, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vprofile_photo, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vnotify_settings, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vblocked, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vbot_info, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPcontactView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_contact) return mtpReadUnexpected;
+	MTPDcontactView *v = arena.alloc<MTPDcontactView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vmutual, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPimportedContactView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_importedContact) return mtpReadUnexpected;
+	MTPDimportedContactView *v = arena.alloc<MTPDimportedContactView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vclient_id, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPcontactBlockedView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_contactBlocked) return mtpReadUnexpected;
+	MTPDcontactBlockedView *v = arena.alloc<MTPDcontactBlockedView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPcontactSuggestedView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_contactSuggested) return mtpReadUnexpected;
+	MTPDcontactSuggestedView *v = arena.alloc<MTPDcontactSuggestedView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vmutual_contacts, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPcontactStatusView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_contactStatus) return mtpReadUnexpected;
+	MTPDcontactStatusView *v = arena.alloc<MTPDcontactStatusView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vstatus, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPchatLocatedView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_chatLocated) return mtpReadUnexpected;
+	MTPDchatLocatedView *v = arena.alloc<MTPDchatLocatedView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vchat_id, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vdistance, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPcontacts_linkView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_contacts_link) return mtpReadUnexpected;
+	MTPDcontacts_linkView *v = arena.alloc<MTPDcontacts_linkView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vmy_link, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vforeign_link, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vuser, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPcontacts_contactsView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_contacts_contactsNotModified: _type = cons; _data = 0; break;
+		case mtpc_contacts_contacts: _type = cons; {
+			MTPDcontacts_contactsView *v = arena.alloc<MTPDcontacts_contactsView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vcontacts, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPcontacts_importedContactsView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_contacts_importedContacts) return mtpReadUnexpected;
+	MTPDcontacts_importedContactsView *v = arena.alloc<MTPDcontacts_importedContactsView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vimported, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vretry_contacts, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPcontacts_blockedView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_contacts_blocked: _type = cons; {
+			MTPDcontacts_blockedView *v = arena.alloc<MTPDcontacts_blockedView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vblocked, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+		} break;
+		case mtpc_contacts_blockedSlice: _type = cons; {
+			MTPDcontacts_blockedSliceView *v = arena.alloc<MTPDcontacts_blockedSliceView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vcount, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vblocked, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPcontacts_suggestedView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_contacts_suggested) return mtpReadUnexpected;
+	MTPDcontacts_suggestedView *v = arena.alloc<MTPDcontacts_suggestedView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vresults, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmessages_dialogsView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_messages_dialogs: _type = cons; {
+			MTPDmessages_dialogsView *v = arena.alloc<MTPDmessages_dialogsView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vdialogs, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmessages, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vchats, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+		} break;
+		case mtpc_messages_dialogsSlice: _type = cons; {
+			MTPDmessages_dialogsSliceView *v = arena.alloc<MTPDmessages_dialogsSliceView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vcount, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdialogs, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmessages, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vchats, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmessages_messagesView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_messages_messages: _type = cons; {
+			MTPDmessages_messagesView *v = arena.alloc<MTPDmessages_messagesView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vmessages, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vchats, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+		} break;
+		case mtpc_messages_messagesSlice: _type = cons; {
+			MTPDmessages_messagesSliceView *v = arena.alloc<MTPDmessages_messagesSliceView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vcount, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmessages, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vchats, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmessages_messageView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_messages_messageEmpty) return mtpReadUnexpected;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmessages_sentMessageView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_messages_sentMessage: _type = cons; {
+			MTPDmessages_sentMessageView *v = arena.alloc<MTPDmessages_sentMessageView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmedia, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vpts, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vpts_count, from, end, arena)) return result;
+		} break;
+		case mtpc_messages_sentMessageLink: _type = cons; {
+			MTPDmessages_sentMessageLinkView *v = arena.alloc<MTPDmessages_sentMessageLinkView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmedia, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vpts, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vpts_count, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vlinks, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vseq, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmessages_chatsView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_messages_chats) return mtpReadUnexpected;
+	MTPDmessages_chatsView *v = arena.alloc<MTPDmessages_chatsView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vchats, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmessages_chatFullView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_messages_chatFull) return mtpReadUnexpected;
+	MTPDmessages_chatFullView *v = arena.alloc<MTPDmessages_chatFullView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vfull_chat, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vchats, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmessages_affectedHistoryView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_messages_affectedHistory) return mtpReadUnexpected;
+	MTPDmessages_affectedHistoryView *v = arena.alloc<MTPDmessages_affectedHistoryView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vpts, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vpts_count, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->voffset, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmessagesFilterView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputMessagesFilterEmpty: _type = cons; _data = 0; break;
+		case mtpc_inputMessagesFilterPhotos: _type = cons; _data = 0; break;
+		case mtpc_inputMessagesFilterVideo: _type = cons; _data = 0; break;
+		case mtpc_inputMessagesFilterPhotoVideo: _type = cons; _data = 0; break;
+		case mtpc_inputMessagesFilterPhotoVideoDocuments: _type = cons; _data = 0; break;
+		case mtpc_inputMessagesFilterDocument: _type = cons; _data = 0; break;
+		case mtpc_inputMessagesFilterAudio: _type = cons; _data = 0; break;
+		case mtpc_inputMessagesFilterAudioDocuments: _type = cons; _data = 0; break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPupdateView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_updateNewMessage: _type = cons; {
+			MTPDupdateNewMessageView *v = arena.alloc<MTPDupdateNewMessageView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vmessage, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vpts, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vpts_count, from, end, arena)) return result;
+		} break;
+		case mtpc_updateMessageID: _type = cons; {
+			MTPDupdateMessageIDView *v = arena.alloc<MTPDupdateMessageIDView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vrandom_id, from, end, arena)) return result;
+		} break;
+		case mtpc_updateDeleteMessages: _type = cons; {
+			MTPDupdateDeleteMessagesView *v = arena.alloc<MTPDupdateDeleteMessagesView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vmessages, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vpts, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vpts_count, from, end, arena)) return result;
+		} break;
+		case mtpc_updateUserTyping: _type = cons; {
+			MTPDupdateUserTypingView *v = arena.alloc<MTPDupdateUserTypingView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaction, from, end, arena)) return result;
+		} break;
+		case mtpc_updateChatUserTyping: _type = cons; {
+			MTPDupdateChatUserTypingView *v = arena.alloc<MTPDupdateChatUserTypingView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vchat_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaction, from, end, arena)) return result;
+		} break;
+		case mtpc_updateChatParticipants: _type = cons; {
+			MTPDupdateChatParticipantsView *v = arena.alloc<MTPDupdateChatParticipantsView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vparticipants, from, end, arena)) return result;
+		} break;
+		case mtpc_updateUserStatus: _type = cons; {
+			MTPDupdateUserStatusView *v = arena.alloc<MTPDupdateUserStatusView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vstatus, from, end, arena)) return result;
+		} break;
+		case mtpc_updateUserName: _type = cons; {
+			MTPDupdateUserNameView *v = arena.alloc<MTPDupdateUserNameView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vfirst_name, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vlast_name, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vusername, from, end, arena)) return result;
+		} break;
+		case mtpc_updateUserPhoto: _type = cons; {
+			MTPDupdateUserPhotoView *v = arena.alloc<MTPDupdateUserPhotoView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vphoto, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vprevious, from, end, arena)) return result;
+		} break;
+		case mtpc_updateContactRegistered: _type = cons; {
+			MTPDupdateContactRegisteredView *v = arena.alloc<MTPDupdateContactRegisteredView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+		} break;
+		case mtpc_updateContactLink: _type = cons; {
+			MTPDupdateContactLinkView *v = arena.alloc<MTPDupdateContactLinkView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmy_link, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vforeign_link, from, end, arena)) return result;
+		} break;
+		case mtpc_updateNewAuthorization: _type = cons; {
+			MTPDupdateNewAuthorizationView *v = arena.alloc<MTPDupdateNewAuthorizationView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vauth_key_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdevice, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vlocation, from, end, arena)) return result;
+		} break;
+		case mtpc_updateNewGeoChatMessage: _type = cons; {
+			MTPDupdateNewGeoChatMessageView *v = arena.alloc<MTPDupdateNewGeoChatMessageView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vmessage, from, end, arena)) return result;
+		} break;
+		case mtpc_updateNewEncryptedMessage: _type = cons; {
+			MTPDupdateNewEncryptedMessageView *v = arena.alloc<MTPDupdateNewEncryptedMessageView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vmessage, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vqts, from, end, arena)) return result;
+		} break;
+		case mtpc_updateEncryptedChatTyping: _type = cons; {
+			MTPDupdateEncryptedChatTypingView *v = arena.alloc<MTPDupdateEncryptedChatTypingView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vchat_id, from, end, arena)) return result;
+		} break;
+		case mtpc_updateEncryption: _type = cons; {
+			MTPDupdateEncryptionView *v = arena.alloc<MTPDupdateEncryptionView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vchat, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+		} break;
+		case mtpc_updateEncryptedMessagesRead: _type = cons; {
+			MTPDupdateEncryptedMessagesReadView *v = arena.alloc<MTPDupdateEncryptedMessagesReadView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vchat_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmax_date, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+		} break;
+		case mtpc_updateChatParticipantAdd: _type = cons; {
+			MTPDupdateChatParticipantAddView *v = arena.alloc<MTPDupdateChatParticipantAddView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vchat_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vinviter_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vversion, from, end, arena)) return result;
+		} break;
+		case mtpc_updateChatParticipantDelete: _type = cons; {
+			MTPDupdateChatParticipantDeleteView *v = arena.alloc<MTPDupdateChatParticipantDeleteView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vchat_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vversion, from, end, arena)) return result;
+		} break;
+		case mtpc_updateDcOptions: _type = cons; {
+			MTPDupdateDcOptionsView *v = arena.alloc<MTPDupdateDcOptionsView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vdc_options, from, end, arena)) return result;
+		} break;
+		case mtpc_updateUserBlocked: _type = cons; {
+			MTPDupdateUserBlockedView *v = arena.alloc<MTPDupdateUserBlockedView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vblocked, from, end, arena)) return result;
+		} break;
+		case mtpc_updateNotifySettings: _type = cons; {
+			MTPDupdateNotifySettingsView *v = arena.alloc<MTPDupdateNotifySettingsView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vpeer, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vnotify_settings, from, end, arena)) return result;
+		} break;
+		case mtpc_updateServiceNotification: _type = cons; {
+			MTPDupdateServiceNotificationView *v = arena.alloc<MTPDupdateServiceNotificationView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vtype, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmessage, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmedia, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vpopup, from, end, arena)) return result;
+		} break;
+		case mtpc_updatePrivacy: _type = cons; {
+			MTPDupdatePrivacyView *v = arena.alloc<MTPDupdatePrivacyView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vkey, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vrules, from, end, arena)) return result;
+		} break;
+		case mtpc_updateUserPhone: _type = cons; {
+			MTPDupdateUserPhoneView *v = arena.alloc<MTPDupdateUserPhoneView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vphone, from, end, arena)) return result;
+		} break;
+		case mtpc_updateReadHistoryInbox: _type = cons; {
+			MTPDupdateReadHistoryInboxView *v = arena.alloc<MTPDupdateReadHistoryInboxView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vpeer, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmax_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vpts, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vpts_count, from, end, arena)) return result;
+		} break;
+		case mtpc_updateReadHistoryOutbox: _type = cons; {
+			MTPDupdateReadHistoryOutboxView *v = arena.alloc<MTPDupdateReadHistoryOutboxView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vpeer, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmax_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vpts, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vpts_count, from, end, arena)) return result;
+		} break;
+		case mtpc_updateWebPage: _type = cons; {
+			MTPDupdateWebPageView *v = arena.alloc<MTPDupdateWebPageView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vwebpage, from, end, arena)) return result;
+		} break;
+		case mtpc_updateReadMessagesContents: _type = cons; {
+			MTPDupdateReadMessagesContentsView *v = arena.alloc<MTPDupdateReadMessagesContentsView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vmessages, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vpts, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vpts_count, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPupdates_stateView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_updates_state) return mtpReadUnexpected;
+	MTPDupdates_stateView *v = arena.alloc<MTPDupdates_stateView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vpts, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vqts, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vseq, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vunread_count, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPupdates_differenceView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_updates_differenceEmpty: _type = cons; {
+			MTPDupdates_differenceEmptyView *v = arena.alloc<MTPDupdates_differenceEmptyView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vseq, from, end, arena)) return result;
+		} break;
+		case mtpc_updates_difference: _type = cons; {
+			MTPDupdates_differenceView *v = arena.alloc<MTPDupdates_differenceView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vnew_messages, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vnew_encrypted_messages, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vother_updates, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vchats, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vstate, from, end, arena)) return result;
+		} break;
+		case mtpc_updates_differenceSlice: _type = cons; {
+			MTPDupdates_differenceSliceView *v = arena.alloc<MTPDupdates_differenceSliceView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vnew_messages, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vnew_encrypted_messages, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vother_updates, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vchats, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vintermediate_state, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPupdatesView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_updatesTooLong: _type = cons; _data = 0; break;
+		case mtpc_updateShortMessage: _type = cons; {
+			MTPDupdateShortMessageView *v = arena.alloc<MTPDupdateShortMessageView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vflags, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmessage, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vpts, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vpts_count, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (v->has_fwd_from_id()) if (mtpReadResult result = mtpTryReadView(v->vfwd_from_id, from, end, arena)) return result;
+			if (v->has_fwd_date()) if (mtpReadResult result = mtpTryReadView(v->vfwd_date, from, end, arena)) return result;
+			if (v->has_reply_to_msg_id()) if (mtpReadResult result = mtpTryReadView(v->vreply_to_msg_id, from, end, arena)) return result;
+		} break;
+		case mtpc_updateShortChatMessage: _type = cons; {
+			MTPDupdateShortChatMessageView *v = arena.alloc<MTPDupdateShortChatMessageView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vflags, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vfrom_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vchat_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmessage, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vpts, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vpts_count, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (v->has_fwd_from_id()) if (mtpReadResult result = mtpTryReadView(v->vfwd_from_id, from, end, arena)) return result;
+			if (v->has_fwd_date()) if (mtpReadResult result = mtpTryReadView(v->vfwd_date, from, end, arena)) return result;
+			if (v->has_reply_to_msg_id()) if (mtpReadResult result = mtpTryReadView(v->vreply_to_msg_id, from, end, arena)) return result;
+		} break;
+		case mtpc_updateShort: _type = cons; {
+			MTPDupdateShortView *v = arena.alloc<MTPDupdateShortView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vupdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+		} break;
+		case mtpc_updatesCombined: _type = cons; {
+			MTPDupdatesCombinedView *v = arena.alloc<MTPDupdatesCombinedView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vupdates, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vchats, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vseq_start, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vseq, from, end, arena)) return result;
+		} break;
+		case mtpc_updates: _type = cons; {
+			MTPDupdatesView *v = arena.alloc<MTPDupdatesView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vupdates, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vchats, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vseq, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPphotos_photosView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_photos_photos: _type = cons; {
+			MTPDphotos_photosView *v = arena.alloc<MTPDphotos_photosView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vphotos, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+		} break;
+		case mtpc_photos_photosSlice: _type = cons; {
+			MTPDphotos_photosSliceView *v = arena.alloc<MTPDphotos_photosSliceView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vcount, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vphotos, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPphotos_photoView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_photos_photo) return mtpReadUnexpected;
+	MTPDphotos_photoView *v = arena.alloc<MTPDphotos_photoView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vphoto, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPupload_fileView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_upload_file) return mtpReadUnexpected;
+	MTPDupload_fileView *v = arena.alloc<MTPDupload_fileView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vtype, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vmtime, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vbytes, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPdcOptionView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_dcOption) return mtpReadUnexpected;
+	MTPDdcOptionView *v = arena.alloc<MTPDdcOptionView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vflags, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vip_address, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vport, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPconfigView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_config) return mtpReadUnexpected;
+	MTPDconfigView *v = arena.alloc<MTPDconfigView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vexpires, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vtest_mode, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vthis_dc, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vdc_options, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vchat_size_max, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vbroadcast_size_max, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vforwarded_count_max, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vonline_update_period_ms, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->voffline_blur_timeout_ms, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->voffline_idle_timeout_ms, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vonline_cloud_timeout_ms, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vnotify_cloud_delay_ms, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vnotify_default_delay_ms, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vchat_big_size, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vpush_chat_period_ms, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vpush_chat_limit, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vdisabled_features, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPnearestDcView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_nearestDc) return mtpReadUnexpected;
+	MTPDnearestDcView *v = arena.alloc<MTPDnearestDcView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vcountry, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vthis_dc, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vnearest_dc, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPhelp_appUpdateView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_help_appUpdate: _type = cons; {
+			MTPDhelp_appUpdateView *v = arena.alloc<MTPDhelp_appUpdateView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vcritical, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vurl, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vtext, from, end, arena)) return result;
+		} break;
+		case mtpc_help_noAppUpdate: _type = cons; _data = 0; break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPhelp_inviteTextView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_help_inviteText) return mtpReadUnexpected;
+	MTPDhelp_inviteTextView *v = arena.alloc<MTPDhelp_inviteTextView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vmessage, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputGeoChatView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_inputGeoChat) return mtpReadUnexpected;
+	MTPDinputGeoChatView *v = arena.alloc<MTPDinputGeoChatView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vchat_id, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPgeoChatMessageView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_geoChatMessageEmpty: _type = cons; {
+			MTPDgeoChatMessageEmptyView *v = arena.alloc<MTPDgeoChatMessageEmptyView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vchat_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+		} break;
+		case mtpc_geoChatMessage: _type = cons; {
+			MTPDgeoChatMessageView *v = arena.alloc<MTPDgeoChatMessageView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vchat_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vfrom_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmessage, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmedia, from, end, arena)) return result;
+		} break;
+		case mtpc_geoChatMessageService: _type = cons; {
+			MTPDgeoChatMessageServiceView *v = arena.alloc<MTPDgeoChatMessageServiceView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vchat_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vfrom_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaction, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPgeochats_statedMessageView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_geochats_statedMessage) return mtpReadUnexpected;
+	MTPDgeochats_statedMessageView *v = arena.alloc<MTPDgeochats_statedMessageView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vmessage, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vchats, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vseq, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPgeochats_locatedView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_geochats_located) return mtpReadUnexpected;
+	MTPDgeochats_locatedView *v = arena.alloc<MTPDgeochats_locatedView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vresults, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vmessages, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vchats, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPgeochats_messagesView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_geochats_messages: _type = cons; {
+			MTPDgeochats_messagesView *v = arena.alloc<MTPDgeochats_messagesView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vmessages, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vchats, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+		} break;
+		case mtpc_geochats_messagesSlice: _type = cons; {
+			MTPDgeochats_messagesSliceView *v = arena.alloc<MTPDgeochats_messagesSliceView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vcount, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmessages, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vchats, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPencryptedChatView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_encryptedChatEmpty: _type = cons; {
+			MTPDencryptedChatEmptyView *v = arena.alloc<MTPDencryptedChatEmptyView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+		} break;
+		case mtpc_encryptedChatWaiting: _type = cons; {
+			MTPDencryptedChatWaitingView *v = arena.alloc<MTPDencryptedChatWaitingView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vadmin_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vparticipant_id, from, end, arena)) return result;
+		} break;
+		case mtpc_encryptedChatRequested: _type = cons; {
+			MTPDencryptedChatRequestedView *v = arena.alloc<MTPDencryptedChatRequestedView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vadmin_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vparticipant_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vg_a, from, end, arena)) return result;
+		} break;
+		case mtpc_encryptedChat: _type = cons; {
+			MTPDencryptedChatView *v = arena.alloc<MTPDencryptedChatView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vadmin_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vparticipant_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vg_a_or_b, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vkey_fingerprint, from, end, arena)) return result;
+		} break;
+		case mtpc_encryptedChatDiscarded: _type = cons; {
+			MTPDencryptedChatDiscardedView *v = arena.alloc<MTPDencryptedChatDiscardedView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputEncryptedChatView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_inputEncryptedChat) return mtpReadUnexpected;
+	MTPDinputEncryptedChatView *v = arena.alloc<MTPDinputEncryptedChatView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vchat_id, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPencryptedFileView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_encryptedFileEmpty: _type = cons; _data = 0; break;
+		case mtpc_encryptedFile: _type = cons; {
+			MTPDencryptedFileView *v = arena.alloc<MTPDencryptedFileView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vsize, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdc_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vkey_fingerprint, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputEncryptedFileView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputEncryptedFileEmpty: _type = cons; _data = 0; break;
+		case mtpc_inputEncryptedFileUploaded: _type = cons; {
+			MTPDinputEncryptedFileUploadedView *v = arena.alloc<MTPDinputEncryptedFileUploadedView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vparts, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmd5_checksum, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vkey_fingerprint, from, end, arena)) return result;
+		} break;
+		case mtpc_inputEncryptedFile: _type = cons; {
+			MTPDinputEncryptedFileView *v = arena.alloc<MTPDinputEncryptedFileView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+		} break;
+		case mtpc_inputEncryptedFileBigUploaded: _type = cons; {
+			MTPDinputEncryptedFileBigUploadedView *v = arena.alloc<MTPDinputEncryptedFileBigUploadedView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vparts, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vkey_fingerprint, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPencryptedMessageView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_encryptedMessage: _type = cons; {
+			MTPDencryptedMessageView *v = arena.alloc<MTPDencryptedMessageView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vrandom_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vchat_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vbytes, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vfile, from, end, arena)) return result;
+		} break;
+		case mtpc_encryptedMessageService: _type = cons; {
+			MTPDencryptedMessageServiceView *v = arena.alloc<MTPDencryptedMessageServiceView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vrandom_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vchat_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vbytes, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmessages_dhConfigView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_messages_dhConfigNotModified: _type = cons; {
+			MTPDmessages_dhConfigNotModifiedView *v = arena.alloc<MTPDmessages_dhConfigNotModifiedView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vrandom, from, end, arena)) return result;
+		} break;
+		case mtpc_messages_dhConfig: _type = cons; {
+			MTPDmessages_dhConfigView *v = arena.alloc<MTPDmessages_dhConfigView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vg, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vp, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vversion, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vrandom, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmessages_sentEncryptedMessageView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_messages_sentEncryptedMessage: _type = cons; {
+			MTPDmessages_sentEncryptedMessageView *v = arena.alloc<MTPDmessages_sentEncryptedMessageView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+		} break;
+		case mtpc_messages_sentEncryptedFile: _type = cons; {
+			MTPDmessages_sentEncryptedFileView *v = arena.alloc<MTPDmessages_sentEncryptedFileView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vfile, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputAudioView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputAudioEmpty: _type = cons; _data = 0; break;
+		case mtpc_inputAudio: _type = cons; {
+			MTPDinputAudioView *v = arena.alloc<MTPDinputAudioView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputDocumentView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputDocumentEmpty: _type = cons; _data = 0; break;
+		case mtpc_inputDocument: _type = cons; {
+			MTPDinputDocumentView *v = arena.alloc<MTPDinputDocumentView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPaudioView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_audioEmpty: _type = cons; {
+			MTPDaudioEmptyView *v = arena.alloc<MTPDaudioEmptyView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+		} break;
+		case mtpc_audio: _type = cons; {
+			MTPDaudioView *v = arena.alloc<MTPDaudioView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vduration, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmime_type, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vsize, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdc_id, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPdocumentView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_documentEmpty: _type = cons; {
+			MTPDdocumentEmptyView *v = arena.alloc<MTPDdocumentEmptyView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+		} break;
+		case mtpc_document: _type = cons; {
+			MTPDdocumentView *v = arena.alloc<MTPDdocumentView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vmime_type, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vsize, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vthumb, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdc_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vattributes, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPhelp_supportView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_help_support) return mtpReadUnexpected;
+	MTPDhelp_supportView *v = arena.alloc<MTPDhelp_supportView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vphone_number, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vuser, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPnotifyPeerView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_notifyPeer: _type = cons; {
+			MTPDnotifyPeerView *v = arena.alloc<MTPDnotifyPeerView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vpeer, from, end, arena)) return result;
+		} break;
+		case mtpc_notifyUsers: _type = cons; _data = 0; break;
+		case mtpc_notifyChats: _type = cons; _data = 0; break;
+		case mtpc_notifyAll: _type = cons; _data = 0; break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPsendMessageActionView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_sendMessageTypingAction: _type = cons; _data = 0; break;
+		case mtpc_sendMessageCancelAction: _type = cons; _data = 0; break;
+		case mtpc_sendMessageRecordVideoAction: _type = cons; _data = 0; break;
+		case mtpc_sendMessageUploadVideoAction: _type = cons; {
+			MTPDsendMessageUploadVideoActionView *v = arena.alloc<MTPDsendMessageUploadVideoActionView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vprogress, from, end, arena)) return result;
+		} break;
+		case mtpc_sendMessageRecordAudioAction: _type = cons; _data = 0; break;
+		case mtpc_sendMessageUploadAudioAction: _type = cons; {
+			MTPDsendMessageUploadAudioActionView *v = arena.alloc<MTPDsendMessageUploadAudioActionView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vprogress, from, end, arena)) return result;
+		} break;
+		case mtpc_sendMessageUploadPhotoAction: _type = cons; {
+			MTPDsendMessageUploadPhotoActionView *v = arena.alloc<MTPDsendMessageUploadPhotoActionView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vprogress, from, end, arena)) return result;
+		} break;
+		case mtpc_sendMessageUploadDocumentAction: _type = cons; {
+			MTPDsendMessageUploadDocumentActionView *v = arena.alloc<MTPDsendMessageUploadDocumentActionView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vprogress, from, end, arena)) return result;
+		} break;
+		case mtpc_sendMessageGeoLocationAction: _type = cons; _data = 0; break;
+		case mtpc_sendMessageChooseContactAction: _type = cons; _data = 0; break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPcontactFoundView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_contactFound) return mtpReadUnexpected;
+	MTPDcontactFoundView *v = arena.alloc<MTPDcontactFoundView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPcontacts_foundView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_contacts_found) return mtpReadUnexpected;
+	MTPDcontacts_foundView *v = arena.alloc<MTPDcontacts_foundView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vresults, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputPrivacyKeyView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_inputPrivacyKeyStatusTimestamp) return mtpReadUnexpected;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPprivacyKeyView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_privacyKeyStatusTimestamp) return mtpReadUnexpected;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputPrivacyRuleView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputPrivacyValueAllowContacts: _type = cons; _data = 0; break;
+		case mtpc_inputPrivacyValueAllowAll: _type = cons; _data = 0; break;
+		case mtpc_inputPrivacyValueAllowUsers: _type = cons; {
+			MTPDinputPrivacyValueAllowUsersView *v = arena.alloc<MTPDinputPrivacyValueAllowUsersView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+		} break;
+		case mtpc_inputPrivacyValueDisallowContacts: _type = cons; _data = 0; break;
+		case mtpc_inputPrivacyValueDisallowAll: _type = cons; _data = 0; break;
+		case mtpc_inputPrivacyValueDisallowUsers: _type = cons; {
+			MTPDinputPrivacyValueDisallowUsersView *v = arena.alloc<MTPDinputPrivacyValueDisallowUsersView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPprivacyRuleView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_privacyValueAllowContacts: _type = cons; _data = 0; break;
+		case mtpc_privacyValueAllowAll: _type = cons; _data = 0; break;
+		case mtpc_privacyValueAllowUsers: _type = cons; {
+			MTPDprivacyValueAllowUsersView *v = arena.alloc<MTPDprivacyValueAllowUsersView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+		} break;
+		case mtpc_privacyValueDisallowContacts: _type = cons; _data = 0; break;
+		case mtpc_privacyValueDisallowAll: _type = cons; _data = 0; break;
+		case mtpc_privacyValueDisallowUsers: _type = cons; {
+			MTPDprivacyValueDisallowUsersView *v = arena.alloc<MTPDprivacyValueDisallowUsersView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPaccount_privacyRulesView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_account_privacyRules) return mtpReadUnexpected;
+	MTPDaccount_privacyRulesView *v = arena.alloc<MTPDaccount_privacyRulesView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vrules, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vusers, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPaccountDaysTTLView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_accountDaysTTL) return mtpReadUnexpected;
+	MTPDaccountDaysTTLView *v = arena.alloc<MTPDaccountDaysTTLView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vdays, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPaccount_sentChangePhoneCodeView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_account_sentChangePhoneCode) return mtpReadUnexpected;
+	MTPDaccount_sentChangePhoneCodeView *v = arena.alloc<MTPDaccount_sentChangePhoneCodeView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vphone_code_hash, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vsend_call_timeout, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPdocumentAttributeView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_documentAttributeImageSize: _type = cons; {
+			MTPDdocumentAttributeImageSizeView *v = arena.alloc<MTPDdocumentAttributeImageSizeView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vw, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vh, from, end, arena)) return result;
+		} break;
+		case mtpc_documentAttributeAnimated: _type = cons; _data = 0; break;
+		case mtpc_documentAttributeSticker: _type = cons; {
+			MTPDdocumentAttributeStickerView *v = arena.alloc<MTPDdocumentAttributeStickerView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->valt, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vstickerset, from, end, arena)) return result;
+		} break;
+		case mtpc_documentAttributeVideo: _type = cons; {
+			MTPDdocumentAttributeVideoView *v = arena.alloc<MTPDdocumentAttributeVideoView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vduration, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vw, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vh, from, end, arena)) return result;
+		} break;
+		case mtpc_documentAttributeAudio: _type = cons; {
+			MTPDdocumentAttributeAudioView *v = arena.alloc<MTPDdocumentAttributeAudioView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vduration, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vtitle, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vperformer, from, end, arena)) return result;
+		} break;
+		case mtpc_documentAttributeFilename: _type = cons; {
+			MTPDdocumentAttributeFilenameView *v = arena.alloc<MTPDdocumentAttributeFilenameView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vfile_name, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmessages_stickersView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_messages_stickersNotModified: _type = cons; _data = 0; break;
+		case mtpc_messages_stickers: _type = cons; {
+			MTPDmessages_stickersView *v = arena.alloc<MTPDmessages_stickersView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vhash, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vstickers, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPstickerPackView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_stickerPack) return mtpReadUnexpected;
+	MTPDstickerPackView *v = arena.alloc<MTPDstickerPackView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vemoticon, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vdocuments, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmessages_allStickersView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_messages_allStickersNotModified: _type = cons; _data = 0; break;
+		case mtpc_messages_allStickers: _type = cons; {
+			MTPDmessages_allStickersView *v = arena.alloc<MTPDmessages_allStickersView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vhash, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vsets, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPdisabledFeatureView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_disabledFeature) return mtpReadUnexpected;
+	MTPDdisabledFeatureView *v = arena.alloc<MTPDdisabledFeatureView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vfeature, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vdescription, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmessages_affectedMessagesView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_messages_affectedMessages) return mtpReadUnexpected;
+	MTPDmessages_affectedMessagesView *v = arena.alloc<MTPDmessages_affectedMessagesView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vpts, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vpts_count, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPcontactLinkView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_contactLinkUnknown: _type = cons; _data = 0; break;
+		case mtpc_contactLinkNone: _type = cons; _data = 0; break;
+		case mtpc_contactLinkHasPhone: _type = cons; _data = 0; break;
+		case mtpc_contactLinkContact: _type = cons; _data = 0; break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPwebPageView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_webPageEmpty: _type = cons; {
+			MTPDwebPageEmptyView *v = arena.alloc<MTPDwebPageEmptyView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+		} break;
+		case mtpc_webPagePending: _type = cons; {
+			MTPDwebPagePendingView *v = arena.alloc<MTPDwebPagePendingView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdate, from, end, arena)) return result;
+		} break;
+		case mtpc_webPage: _type = cons; {
+			MTPDwebPageView *v = arena.alloc<MTPDwebPageView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vflags, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vurl, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdisplay_url, from, end, arena)) return result;
+			if (v->has_type()) if (mtpReadResult result = mtpTryReadView(v->vtype, from, end, arena)) return result;
+			if (v->has_site_name()) if (mtpReadResult result = mtpTryReadView(v->vsite_name, from, end, arena)) return result;
+			if (v->has_title()) if (mtpReadResult result = mtpTryReadView(v->vtitle, from, end, arena)) return result;
+			if (v->has_description()) if (mtpReadResult result = mtpTryReadView(v->vdescription, from, end, arena)) return result;
+			if (v->has_photo()) if (mtpReadResult result = mtpTryReadView(v->vphoto, from, end, arena)) return result;
+			if (v->has_embed_url()) if (mtpReadResult result = mtpTryReadView(v->vembed_url, from, end, arena)) return result;
+			if (v->has_embed_type()) if (mtpReadResult result = mtpTryReadView(v->vembed_type, from, end, arena)) return result;
+			if (v->has_embed_width()) if (mtpReadResult result = mtpTryReadView(v->vembed_width, from, end, arena)) return result;
+			if (v->has_embed_height()) if (mtpReadResult result = mtpTryReadView(v->vembed_height, from, end, arena)) return result;
+			if (v->has_duration()) if (mtpReadResult result = mtpTryReadView(v->vduration, from, end, arena)) return result;
+			if (v->has_author()) if (mtpReadResult result = mtpTryReadView(v->vauthor, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPauthorizationView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_authorization) return mtpReadUnexpected;
+	MTPDauthorizationView *v = arena.alloc<MTPDauthorizationView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vhash, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vflags, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vdevice_model, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vplatform, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vsystem_version, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vapi_id, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vapp_name, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vapp_version, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vdate_created, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vdate_active, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vip, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vcountry, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vregion, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPaccount_authorizationsView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_account_authorizations) return mtpReadUnexpected;
+	MTPDaccount_authorizationsView *v = arena.alloc<MTPDaccount_authorizationsView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vauthorizations, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPaccount_passwordView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_account_noPassword: _type = cons; {
+			MTPDaccount_noPasswordView *v = arena.alloc<MTPDaccount_noPasswordView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vnew_salt, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vemail_unconfirmed_pattern, from, end, arena)) return result;
+		} break;
+		case mtpc_account_password: _type = cons; {
+			MTPDaccount_passwordView *v = arena.alloc<MTPDaccount_passwordView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vcurrent_salt, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vnew_salt, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vhint, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vhas_recovery, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vemail_unconfirmed_pattern, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPaccount_passwordSettingsView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_account_passwordSettings) return mtpReadUnexpected;
+	MTPDaccount_passwordSettingsView *v = arena.alloc<MTPDaccount_passwordSettingsView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vemail, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPaccount_passwordInputSettingsView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_account_passwordInputSettings) return mtpReadUnexpected;
+	MTPDaccount_passwordInputSettingsView *v = arena.alloc<MTPDaccount_passwordInputSettingsView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vflags, from, end, arena)) return result;
+	if (v->has_new_salt()) if (mtpReadResult result = mtpTryReadView(v->vnew_salt, from, end, arena)) return result;
+	if (v->has_new_password_hash()) if (mtpReadResult result = mtpTryReadView(v->vnew_password_hash, from, end, arena)) return result;
+	if (v->has_hint()) if (mtpReadResult result = mtpTryReadView(v->vhint, from, end, arena)) return result;
+	if (v->has_email()) if (mtpReadResult result = mtpTryReadView(v->vemail, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPauth_passwordRecoveryView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_auth_passwordRecovery) return mtpReadUnexpected;
+	MTPDauth_passwordRecoveryView *v = arena.alloc<MTPDauth_passwordRecoveryView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vemail_pattern, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPreceivedNotifyMessageView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_receivedNotifyMessage) return mtpReadUnexpected;
+	MTPDreceivedNotifyMessageView *v = arena.alloc<MTPDreceivedNotifyMessageView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vflags, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPexportedChatInviteView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_chatInviteEmpty: _type = cons; _data = 0; break;
+		case mtpc_chatInviteExported: _type = cons; {
+			MTPDchatInviteExportedView *v = arena.alloc<MTPDchatInviteExportedView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vlink, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPchatInviteView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_chatInviteAlready: _type = cons; {
+			MTPDchatInviteAlreadyView *v = arena.alloc<MTPDchatInviteAlreadyView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vchat, from, end, arena)) return result;
+		} break;
+		case mtpc_chatInvite: _type = cons; {
+			MTPDchatInviteView *v = arena.alloc<MTPDchatInviteView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vtitle, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPinputStickerSetView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_inputStickerSetEmpty: _type = cons; _data = 0; break;
+		case mtpc_inputStickerSetID: _type = cons; {
+			MTPDinputStickerSetIDView *v = arena.alloc<MTPDinputStickerSetIDView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+		} break;
+		case mtpc_inputStickerSetShortName: _type = cons; {
+			MTPDinputStickerSetShortNameView *v = arena.alloc<MTPDinputStickerSetShortNameView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vshort_name, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPstickerSetView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_stickerSet) return mtpReadUnexpected;
+	MTPDstickerSetView *v = arena.alloc<MTPDstickerSetView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vflags, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vid, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vaccess_hash, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vtitle, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vshort_name, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vcount, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vhash, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPmessages_stickerSetView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_messages_stickerSet) return mtpReadUnexpected;
+	MTPDmessages_stickerSetView *v = arena.alloc<MTPDmessages_stickerSetView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vset, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vpacks, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vdocuments, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPbotCommandView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_botCommand) return mtpReadUnexpected;
+	MTPDbotCommandView *v = arena.alloc<MTPDbotCommandView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vcommand, from, end, arena)) return result;
+	if (mtpReadResult result = mtpTryReadView(v->vdescription, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPbotInfoView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_botInfoEmpty: _type = cons; _data = 0; break;
+		case mtpc_botInfo: _type = cons; {
+			MTPDbotInfoView *v = arena.alloc<MTPDbotInfoView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vuser_id, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vversion, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vshare_text, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vdescription, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vcommands, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPkeyboardButtonView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_keyboardButton) return mtpReadUnexpected;
+	MTPDkeyboardButtonView *v = arena.alloc<MTPDkeyboardButtonView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vtext, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPkeyboardButtonRowView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	if (cons != mtpc_keyboardButtonRow) return mtpReadUnexpected;
+	MTPDkeyboardButtonRowView *v = arena.alloc<MTPDkeyboardButtonRowView>(1);
+	_data = v;
+	if (mtpReadResult result = mtpTryReadView(v->vbuttons, from, end, arena)) return result;
+	return mtpReadDone;
+}
+
+inline mtpReadResult MTPreplyMarkupView::tryRead(const mtpPrime *&from, const mtpPrime *end, mtpArena &arena, mtpTypeId cons) {
+	switch (cons) {
+		case mtpc_replyKeyboardHide: _type = cons; {
+			MTPDreplyKeyboardHideView *v = arena.alloc<MTPDreplyKeyboardHideView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vflags, from, end, arena)) return result;
+		} break;
+		case mtpc_replyKeyboardForceReply: _type = cons; {
+			MTPDreplyKeyboardForceReplyView *v = arena.alloc<MTPDreplyKeyboardForceReplyView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vflags, from, end, arena)) return result;
+		} break;
+		case mtpc_replyKeyboardMarkup: _type = cons; {
+			MTPDreplyKeyboardMarkupView *v = arena.alloc<MTPDreplyKeyboardMarkupView>(1);
+			_data = v;
+			if (mtpReadResult result = mtpTryReadView(v->vflags, from, end, arena)) return result;
+			if (mtpReadResult result = mtpTryReadView(v->vrows, from, end, arena)) return result;
+		} break;
+		default: return mtpReadUnexpected;
+	}
+	return mtpReadDone;
+}
+
 // Human-readable text serialization
 #if (defined _DEBUG || defined _WITH_DEBUG)
 
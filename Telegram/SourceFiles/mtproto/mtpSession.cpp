@@ -489,20 +489,19 @@ int32 MTProtoSession::getDcWithShift() const {
 }
 
 void MTProtoSession::tryToReceive() {
-	int32 cnt = 0;
-	while (true) {
-		mtpRequestId requestId;
-		mtpResponse response;
-		{
-			QWriteLocker locker(data.haveReceivedMutex());
-			mtpResponseMap &responses(data.haveReceivedMap());
-			mtpResponseMap::iterator i = responses.begin();
-			if (i == responses.end()) return;
-
-			requestId = i.key();
-			response = i.value();
-			responses.erase(i);
-		}
+	mtpResponseMap responses;
+	{
+		QWriteLocker locker(data.haveReceivedMutex());
+		if (data.haveReceivedMap().isEmpty()) return;
+
+		qSwap(responses, data.haveReceivedMap()); // responses received while dispatching will come with the next needToReceive()
+	}
+
+	_mtp_internal::takeCallbacks(responses);
+	_mtp_internal::onResponsesBatch(true);
+	for (mtpResponseMap::iterator i = responses.begin(), e = responses.end(); i != e; ++i) {
+		mtpRequestId requestId = i.key();
+		const mtpResponse &response(i.value());
 		if (requestId <= 0) {
 			if (dcWithShift < int(_mtp_internal::dcShift)) { // call globalCallback only in main session
 				_mtp_internal::globalCallback(response.constData(), response.constData() + response.size());
@@ -510,8 +509,9 @@ void MTProtoSession::tryToReceive() {
 		} else {
 			_mtp_internal::execCallback(requestId, response.constData(), response.constData() + response.size());
 		}
-		++cnt;
+		mtpReleaseBuffer(i.value()); // parsed result does not reference the response data
 	}
+	_mtp_internal::onResponsesBatch(false);
 }
 
 MTProtoSession::~MTProtoSession() {
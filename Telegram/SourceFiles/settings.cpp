@@ -29,6 +29,7 @@ bool gDevVersion = DevVersion;
 bool gTestMode = false;
 bool gDebug = false;
 bool gManyInstance = false;
+bool gHistoryRasters = false;
 QString gKeyFile;
 QString gWorkingDir, gExeDir, gExeName;
 
@@ -159,6 +160,10 @@ int gOtherOnline = 0;
 
 float64 gSongVolume = 0.9;
 
+int32 gStorageImagesLimit = DefaultStorageImagesLimit;
+int32 gStorageStickersLimit = DefaultStorageStickersLimit;
+int32 gStorageAudiosLimit = DefaultStorageAudiosLimit;
+
 SavedPeers gSavedPeers;
 SavedPeersByTime gSavedPeersByTime;
 
@@ -181,6 +186,8 @@ void settingsParseArgs(int argc, char *argv[]) {
 			gDebug = true;
 		} else if (string("-many") == argv[i]) {
 			gManyInstance = true;
+		} else if (string("-historyrasters") == argv[i]) {
+			gHistoryRasters = true;
 		} else if (string("-key") == argv[i] && i + 1 < argc) {
 			gKeyFile = QString::fromLocal8Bit(argv[++i]);
 		} else if (string("-autostart") == argv[i]) {
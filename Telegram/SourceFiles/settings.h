@@ -125,6 +125,7 @@ DeclareSetting(bool, StartToSettings);
 DeclareSetting(int32, MaxGroupCount);
 DeclareSetting(bool, ReplaceEmojis);
 DeclareReadSetting(bool, ManyInstance);
+DeclareReadSetting(bool, HistoryRasters); // keep painted history messages, their text loses subpixel antialiasing
 DeclareSetting(bool, AskDownloadPath);
 DeclareSetting(QString, DownloadPath);
 DeclareSetting(QByteArray, LocalSalt);
@@ -308,6 +309,10 @@ DeclareSetting(int, OtherOnline);
 
 DeclareSetting(float64, SongVolume);
 
+DeclareSetting(int32, StorageImagesLimit); // in mb, 0 - unlimited
+DeclareSetting(int32, StorageStickersLimit);
+DeclareSetting(int32, StorageAudiosLimit);
+
 struct PeerData;
 typedef QMap<PeerData*, QDateTime> SavedPeers;
 typedef QMultiMap<QDateTime, PeerData*> SavedPeersByTime;
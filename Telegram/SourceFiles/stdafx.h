@@ -46,6 +46,10 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 #define _NEED_WIN_GENERATE_DUMP
 #endif
 
+#if defined _DEBUG && !defined _WITH_SELFTEST // -selftest and -benchmark, add _WITH_SELFTEST to DEFINES to benchmark a release build
+#define _WITH_SELFTEST
+#endif
+
 #include "types.h"
 #include "config.h"
 
@@ -28,6 +28,20 @@ Copyright (c) 2014 John Preston, https://desktop.telegram.org
 
 #include <openssl/rand.h>
 
+#if defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#if defined _MSC_VER
+#define TYPES_USE_AESNI
+#define TYPES_AESNI_TARGET
+#include <intrin.h>
+#include <wmmintrin.h>
+#elif defined __AES__ || (defined __GNUC__ && !defined __clang__ && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))) // older compilers need -maes for the intrinsics
+#define TYPES_USE_AESNI
+#define TYPES_AESNI_TARGET __attribute__((target("aes,sse2")))
+#include <cpuid.h>
+#include <wmmintrin.h>
+#endif
+#endif
+
 // Base types compile-time check
 
 namespace {
@@ -233,6 +247,161 @@ namespace {
 	_MsStarter _msStarter;
 }
 
+namespace {
+
+	typedef void (*AesIgeMethod)(const uchar *src, uchar *dst, uint32 len, const uchar *key, const uchar *iv);
+
+	void _aesIgeEncryptOpenSSL(const uchar *src, uchar *dst, uint32 len, const uchar *key, const uchar *iv) {
+		uchar aes_iv[32];
+		memcpy(aes_iv, iv, 32);
+
+		AES_KEY aes;
+		AES_set_encrypt_key(key, 256, &aes);
+		AES_ige_encrypt(src, dst, len, &aes, aes_iv, AES_ENCRYPT);
+	}
+
+	void _aesIgeDecryptOpenSSL(const uchar *src, uchar *dst, uint32 len, const uchar *key, const uchar *iv) {
+		uchar aes_iv[32];
+		memcpy(aes_iv, iv, 32);
+
+		AES_KEY aes;
+		AES_set_decrypt_key(key, 256, &aes);
+		AES_ige_encrypt(src, dst, len, &aes, aes_iv, AES_DECRYPT);
+	}
+
+	AesIgeMethod _aesIgeEncrypt = _aesIgeEncryptOpenSSL, _aesIgeDecrypt = _aesIgeDecryptOpenSSL; // chosen in InitOpenSSL
+
+#ifdef TYPES_USE_AESNI
+	bool _aesniSupported() {
+#ifdef _MSC_VER
+		int info[4] = { 0 };
+		__cpuid(info, 1);
+		return (info[2] & (1 << 25)) != 0;
+#else
+		unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+		if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return false;
+		return (ecx & (1 << 25)) != 0;
+#endif
+	}
+
+	TYPES_AESNI_TARGET inline __m128i _aesniKeyShift(__m128i key) { // key ^ (key << 32) ^ (key << 64) ^ (key << 96)
+		__m128i shifted = _mm_slli_si128(key, 4);
+		key = _mm_xor_si128(key, shifted);
+		shifted = _mm_slli_si128(shifted, 4);
+		key = _mm_xor_si128(key, shifted);
+		shifted = _mm_slli_si128(shifted, 4);
+		return _mm_xor_si128(key, shifted);
+	}
+
+	TYPES_AESNI_TARGET inline __m128i _aesniKeyEven(__m128i prev, __m128i assist) {
+		return _mm_xor_si128(_aesniKeyShift(prev), _mm_shuffle_epi32(assist, 0xFF));
+	}
+
+	TYPES_AESNI_TARGET inline __m128i _aesniKeyOdd(__m128i prev, __m128i even) {
+		return _mm_xor_si128(_aesniKeyShift(prev), _mm_shuffle_epi32(_mm_aeskeygenassist_si128(even, 0x00), 0xAA));
+	}
+
+	TYPES_AESNI_TARGET void _aesniExpandKey(const uchar *key, __m128i *keys) { // 15 round keys of aes-256
+		keys[0] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(key));
+		keys[1] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(key + 16));
+		keys[2] = _aesniKeyEven(keys[0], _mm_aeskeygenassist_si128(keys[1], 0x01));
+		keys[3] = _aesniKeyOdd(keys[1], keys[2]);
+		keys[4] = _aesniKeyEven(keys[2], _mm_aeskeygenassist_si128(keys[3], 0x02));
+		keys[5] = _aesniKeyOdd(keys[3], keys[4]);
+		keys[6] = _aesniKeyEven(keys[4], _mm_aeskeygenassist_si128(keys[5], 0x04));
+		keys[7] = _aesniKeyOdd(keys[5], keys[6]);
+		keys[8] = _aesniKeyEven(keys[6], _mm_aeskeygenassist_si128(keys[7], 0x08));
+		keys[9] = _aesniKeyOdd(keys[7], keys[8]);
+		keys[10] = _aesniKeyEven(keys[8], _mm_aeskeygenassist_si128(keys[9], 0x10));
+		keys[11] = _aesniKeyOdd(keys[9], keys[10]);
+		keys[12] = _aesniKeyEven(keys[10], _mm_aeskeygenassist_si128(keys[11], 0x20));
+		keys[13] = _aesniKeyOdd(keys[11], keys[12]);
+		keys[14] = _aesniKeyEven(keys[12], _mm_aeskeygenassist_si128(keys[13], 0x40));
+	}
+
+	TYPES_AESNI_TARGET void _aesIgeEncryptAesni(const uchar *src, uchar *dst, uint32 len, const uchar *key, const uchar *iv) {
+		__m128i keys[15];
+		_aesniExpandKey(key, keys);
+
+		// IGE: out = E(in ^ iv1) ^ iv2, then iv1 = out, iv2 = in
+		__m128i iv1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iv)), iv2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iv + 16));
+		for (uint32 i = 0; i + 16 <= len; i += 16) {
+			__m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+			__m128i block = _mm_xor_si128(_mm_xor_si128(in, iv1), keys[0]);
+			for (int32 j = 1; j < 14; ++j) {
+				block = _mm_aesenc_si128(block, keys[j]);
+			}
+			block = _mm_xor_si128(_mm_aesenclast_si128(block, keys[14]), iv2);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), block);
+			iv1 = block;
+			iv2 = in;
+		}
+	}
+
+	TYPES_AESNI_TARGET void _aesIgeDecryptAesni(const uchar *src, uchar *dst, uint32 len, const uchar *key, const uchar *iv) {
+		__m128i keys[15];
+		_aesniExpandKey(key, keys);
+		for (int32 j = 1; j < 14; ++j) { // equivalent inverse cipher round keys, used in reverse order
+			keys[j] = _mm_aesimc_si128(keys[j]);
+		}
+
+		// IGE: out = D(in ^ iv2) ^ iv1, then iv1 = in, iv2 = out
+		__m128i iv1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iv)), iv2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iv + 16));
+		for (uint32 i = 0; i + 16 <= len; i += 16) {
+			__m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+			__m128i block = _mm_xor_si128(_mm_xor_si128(in, iv2), keys[14]);
+			for (int32 j = 13; j > 0; --j) {
+				block = _mm_aesdec_si128(block, keys[j]);
+			}
+			block = _mm_xor_si128(_mm_aesdeclast_si128(block, keys[0]), iv1);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), block);
+			iv1 = in;
+			iv2 = block;
+		}
+	}
+
+	bool _aesniCheck() { // compare with OpenSSL before using, in place as well
+		uchar key[32], iv[32], data[64], openssl[64], aesni[64];
+		for (int32 i = 0; i < 32; ++i) {
+			key[i] = uchar(i * 7 + 3);
+			iv[i] = uchar(i * 13 + 5);
+		}
+		for (int32 i = 0; i < 64; ++i) {
+			data[i] = uchar(i * 29 + 11);
+		}
+		_aesIgeEncryptOpenSSL(data, openssl, 64, key, iv);
+		_aesIgeEncryptAesni(data, aesni, 64, key, iv);
+		if (memcmp(openssl, aesni, 64)) return false;
+
+		_aesIgeDecryptOpenSSL(openssl, openssl, 64, key, iv);
+		_aesIgeDecryptAesni(aesni, aesni, 64, key, iv);
+		return !memcmp(openssl, aesni, 64) && !memcmp(aesni, data, 64);
+	}
+#endif
+
+	void _aesIgeInit() {
+#ifdef TYPES_USE_AESNI
+		if (_aesniSupported()) {
+			if (_aesniCheck()) {
+				_aesIgeEncrypt = _aesIgeEncryptAesni;
+				_aesIgeDecrypt = _aesIgeDecryptAesni;
+			} else {
+				LOG(("MTP Error: AES-NI IGE result differs from OpenSSL, using OpenSSL."));
+			}
+		}
+#endif
+	}
+
+}
+
+void aesIgeEncrypt(const void *src, void *dst, uint32 len, const void *key, const void *iv) {
+	_aesIgeEncrypt(static_cast<const uchar*>(src), static_cast<uchar*>(dst), len, static_cast<const uchar*>(key), static_cast<const uchar*>(iv));
+}
+
+void aesIgeDecrypt(const void *src, void *dst, uint32 len, const void *key, const void *iv) {
+	_aesIgeDecrypt(static_cast<const uchar*>(src), static_cast<uchar*>(dst), len, static_cast<const uchar*>(key), static_cast<const uchar*>(iv));
+}
+
 InitOpenSSL::InitOpenSSL() {
 	if (!RAND_status()) { // should be always inited in all modern OS
 		char buf[16];
@@ -257,6 +426,8 @@ InitOpenSSL::InitOpenSSL() {
 	CRYPTO_set_dynlock_lock_callback(_sslLockFunction);
 	CRYPTO_set_dynlock_destroy_callback(_sslDestroyFunction);
 
+	_aesIgeInit();
+
 	_sslInited = true;
 }
 
@@ -974,3 +1145,146 @@ MimeType mimeTypeForData(const QByteArray &data) {
 	}
 	return MimeType(QMimeDatabase().mimeTypeForData(data));
 }
+
+#ifdef _WITH_SELFTEST
+
+namespace {
+	const uchar _aesIgeKnownEncrypted[128] = { // aes-256-ige of _aesIgeKnownData(), checked against AES_ige_encrypt
+		0x73, 0xA3, 0xE0, 0x11, 0x08, 0x80, 0x24, 0x02, 0x9D, 0x93, 0xD8, 0xCB, 0x1E, 0x2E, 0xE9, 0x58,
+		0x64, 0x29, 0xE4, 0x29, 0x92, 0x15, 0x15, 0x51, 0x33, 0xDB, 0x52, 0xC9, 0x97, 0x96, 0x78, 0x9D,
+		0x1E, 0x2E, 0x3A, 0xFE, 0xD5, 0xAB, 0x81, 0xF8, 0x33, 0x95, 0x06, 0xEB, 0x06, 0x4E, 0x53, 0xBB,
+		0x23, 0xDF, 0xD4, 0xD7, 0x93, 0x29, 0x89, 0xE4, 0xC0, 0x88, 0xED, 0xC9, 0x0B, 0x1D, 0x05, 0x40,
+		0x24, 0xDB, 0x39, 0xFF, 0xAA, 0x6A, 0xD1, 0xBB, 0xDB, 0x35, 0x24, 0x87, 0xB1, 0x86, 0x03, 0xD5,
+		0x8C, 0x56, 0xCC, 0x05, 0x4F, 0x59, 0xB8, 0x17, 0x17, 0x19, 0x47, 0xE3, 0x40, 0x58, 0x80, 0x32,
+		0x98, 0x5C, 0xCB, 0x9A, 0xDB, 0x96, 0x82, 0x11, 0xEA, 0x6F, 0x0E, 0x29, 0xDE, 0x01, 0x17, 0xA7,
+		0x69, 0x71, 0x7E, 0xBD, 0xE1, 0x36, 0x7C, 0x90, 0x9E, 0xC9, 0xDF, 0x14, 0x4C, 0x61, 0x10, 0x9D,
+	};
+
+	void _aesIgeKnownData(uchar *key, uchar *iv, uchar *data) { // key and iv - 32 bytes, data - 128 bytes
+		for (int32 i = 0; i < 32; ++i) {
+			key[i] = uchar(i * 7 + 1);
+			iv[i] = uchar(i * 13 + 5);
+		}
+		for (int32 i = 0; i < 128; ++i) {
+			data[i] = uchar(i * 31 + 17);
+		}
+	}
+
+	bool _aesIgeKnownTest(const char *name, AesIgeMethod encrypt, AesIgeMethod decrypt) {
+		uchar key[32], iv[32], data[128], buffer[128];
+		_aesIgeKnownData(key, iv, data);
+
+		const uint32 blocks[] = { 1, 2, 3, 8 }; // ige output for a prefix is the prefix of the output
+		for (int32 i = 0, l = sizeof(blocks) / sizeof(blocks[0]); i < l; ++i) {
+			uint32 len = blocks[i] * 16;
+
+			encrypt(data, buffer, len, key, iv);
+			if (memcmp(buffer, _aesIgeKnownEncrypted, len)) {
+				LOG(("Test Error: %1 ige encrypt of %2 blocks differs from the known answer").arg(name).arg(blocks[i]));
+				return false;
+			}
+			decrypt(_aesIgeKnownEncrypted, buffer, len, key, iv);
+			if (memcmp(buffer, data, len)) {
+				LOG(("Test Error: %1 ige decrypt of %2 blocks differs from the known answer").arg(name).arg(blocks[i]));
+				return false;
+			}
+
+			memcpy(buffer, data, len);
+			encrypt(buffer, buffer, len, key, iv);
+			if (memcmp(buffer, _aesIgeKnownEncrypted, len)) {
+				LOG(("Test Error: %1 in place ige encrypt of %2 blocks differs from the known answer").arg(name).arg(blocks[i]));
+				return false;
+			}
+			decrypt(buffer, buffer, len, key, iv);
+			if (memcmp(buffer, data, len)) {
+				LOG(("Test Error: %1 in place ige decrypt of %2 blocks differs from the known answer").arg(name).arg(blocks[i]));
+				return false;
+			}
+		}
+		return true;
+	}
+
+	qint64 _aesIgeMeasure(AesIgeMethod method, const uchar *src, uchar *dst, uint32 len, const uchar *key, const uchar *iv, int32 iterations) {
+		QElapsedTimer timer;
+		timer.start();
+		for (int32 i = 0; i < iterations; ++i) {
+			method(src, dst, len, key, iv);
+		}
+		return timer.nsecsElapsed();
+	}
+}
+
+bool aesIgeTest() {
+	if (!_aesIgeKnownTest("OpenSSL", _aesIgeEncryptOpenSSL, _aesIgeDecryptOpenSSL)) return false;
+
+#ifdef TYPES_USE_AESNI
+	if (!_aesniSupported()) {
+		LOG(("Test Info: AES-NI is not supported, only OpenSSL ige was checked"));
+		return true;
+	}
+	if (!_aesIgeKnownTest("AES-NI", _aesIgeEncryptAesni, _aesIgeDecryptAesni)) return false;
+
+	const int32 iterations = 200, maxBlocks = 1024;
+	QByteArray src(maxBlocks * 16, Qt::Uninitialized), openssl(src.size(), Qt::Uninitialized), aesni(src.size(), Qt::Uninitialized);
+	uchar key[32], iv[32];
+	for (int32 i = 0; i < iterations; ++i) {
+		uint32 blocks = 0;
+		memset_rand(&blocks, sizeof(blocks));
+		uint32 len = (1 + (blocks % maxBlocks)) * 16;
+		memset_rand(key, 32);
+		memset_rand(iv, 32);
+		memset_rand(src.data(), len);
+
+		const uchar *s = reinterpret_cast<const uchar*>(src.constData());
+		uchar *o = reinterpret_cast<uchar*>(openssl.data()), *a = reinterpret_cast<uchar*>(aesni.data());
+		_aesIgeEncryptOpenSSL(s, o, len, key, iv);
+		_aesIgeEncryptAesni(s, a, len, key, iv);
+		if (memcmp(o, a, len)) {
+			LOG(("Test Error: AES-NI ige encrypt of %1 random bytes differs from OpenSSL, iteration %2").arg(len).arg(i));
+			return false;
+		}
+
+		_aesIgeDecryptOpenSSL(s, o, len, key, iv); // random data as the encrypted one
+		memcpy(a, s, len);
+		_aesIgeDecryptAesni(a, a, len, key, iv);
+		if (memcmp(o, a, len)) {
+			LOG(("Test Error: AES-NI in place ige decrypt of %1 random bytes differs from OpenSSL, iteration %2").arg(len).arg(i));
+			return false;
+		}
+	}
+#endif
+	return true;
+}
+
+void aesIgeBenchmark() {
+	const int32 iterations = 100;
+	const uint32 sizes[] = { 1024, 128 * 1024 }; // a typical rpc message and an upload / download part
+	const uint32 maxSize = 128 * 1024;
+
+	QByteArray src(maxSize, Qt::Uninitialized), dst(maxSize, Qt::Uninitialized);
+	uchar key[32], iv[32];
+	memset_rand(src.data(), maxSize);
+	memset_rand(key, 32);
+	memset_rand(iv, 32);
+	const uchar *s = reinterpret_cast<const uchar*>(src.constData());
+	uchar *d = reinterpret_cast<uchar*>(dst.data());
+
+	for (int32 i = 0, l = sizeof(sizes) / sizeof(sizes[0]); i < l; ++i) {
+		uint32 len = sizes[i];
+		int32 count = iterations * int32(maxSize / len); // the same amount of data for each size
+		double mb = double(len) * count / (1024. * 1024.);
+
+		qint64 encrypt = _aesIgeMeasure(_aesIgeEncryptOpenSSL, s, d, len, key, iv, count), decrypt = _aesIgeMeasure(_aesIgeDecryptOpenSSL, s, d, len, key, iv, count);
+		LOG(("Benchmark: OpenSSL ige of %1 bytes, encrypt %2 MB/s, decrypt %3 MB/s").arg(len).arg(mb * 1e9 / qMax(encrypt, qint64(1)), 0, 'f', 1).arg(mb * 1e9 / qMax(decrypt, qint64(1)), 0, 'f', 1));
+
+#ifdef TYPES_USE_AESNI
+		if (_aesniSupported()) {
+			encrypt = _aesIgeMeasure(_aesIgeEncryptAesni, s, d, len, key, iv, count);
+			decrypt = _aesIgeMeasure(_aesIgeDecryptAesni, s, d, len, key, iv, count);
+			LOG(("Benchmark: AES-NI ige of %1 bytes, encrypt %2 MB/s, decrypt %3 MB/s").arg(len).arg(mb * 1e9 / qMax(encrypt, qint64(1)), 0, 'f', 1).arg(mb * 1e9 / qMax(decrypt, qint64(1)), 0, 'f', 1));
+		}
+#endif
+	}
+}
+
+#endif
@@ -169,6 +169,13 @@ inline char *hashMd5Hex(const void *data, uint32 len, void *dest) { // dest = pt
 	return hashMd5Hex(HashMd5(data, len).result(), dest);
 }
 
+void aesIgeEncrypt(const void *src, void *dst, uint32 len, const void *key, const void *iv); // key and iv - ptrs to 32 bytes, len % 16 == 0, src == dst is allowed
+void aesIgeDecrypt(const void *src, void *dst, uint32 len, const void *key, const void *iv);
+#ifdef _WITH_SELFTEST
+bool aesIgeTest(); // checks known ige answers and AES-NI against OpenSSL, see -selftest
+void aesIgeBenchmark(); // measures OpenSSL and AES-NI ige throughput, see -benchmark
+#endif
+
 void memset_rand(void *data, uint32 len);
 
 template <typename T>
@@ -274,6 +281,7 @@ enum DataBlockId {
 	dbiDcOption            = 0x27,
 	dbiTryIPv6             = 0x28,
 	dbiSongVolume          = 0x29,
+	dbiStorageLimits       = 0x2a,
 
 	dbiEncryptedWithSalt   = 333,
 	dbiEncrypted           = 444,
@@ -1570,6 +1570,11 @@ void Window::notifyUpdateAllPhotos() {
 	if (_mediaView) _mediaView->updateControls();
 }
 
+void Window::onImagesDecoded() {
+	imagesDecoded();
+	emit imageLoaded();
+}
+
 void Window::notifyUpdateAll() {
 	if (cCustomNotifies()) {
 		for (NotifyWindows::const_iterator i = notifyWindows.cbegin(), e = notifyWindows.cend(); i != e; ++i) {
@@ -271,6 +271,7 @@ public slots:
 	QImage iconWithCounter(int size, int count, style::color bg, bool smallIcon);
 
 	void notifyUpdateAllPhotos();
+	void onImagesDecoded();
 
 signals:
 